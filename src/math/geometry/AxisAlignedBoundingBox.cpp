@@ -0,0 +1,88 @@
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include <glm/glm.hpp>
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec3.hpp"
+
+math::AxisAlignedBoundingBox::AxisAlignedBoundingBox() :
+    m_minimum(std::numeric_limits<float>::max()),
+    m_maximum(std::numeric_limits<float>::lowest())
+{}
+
+math::AxisAlignedBoundingBox::AxisAlignedBoundingBox(
+    const math::Vec3& minimum,
+    const math::Vec3& maximum
+) :
+    m_minimum(minimum),
+    m_maximum(maximum)
+{}
+
+bool
+math::AxisAlignedBoundingBox::isEmpty() const {
+    return
+        m_minimum.x > m_maximum.x ||
+        m_minimum.y > m_maximum.y ||
+        m_minimum.z > m_maximum.z;
+}
+
+math::AxisAlignedBoundingBox&
+math::AxisAlignedBoundingBox::expand(
+    const math::Vec3& point
+) {
+    m_minimum = glm::min(m_minimum.glmVec, point.glmVec);
+    m_maximum = glm::max(m_maximum.glmVec, point.glmVec);
+
+    return *this;
+}
+
+math::AxisAlignedBoundingBox&
+math::AxisAlignedBoundingBox::expand(
+    const math::AxisAlignedBoundingBox& other
+) {
+    if (other.isEmpty()) {
+        return *this;
+    }
+
+    m_minimum = glm::min(m_minimum.glmVec, other.m_minimum.glmVec);
+    m_maximum = glm::max(m_maximum.glmVec, other.m_maximum.glmVec);
+
+    return *this;
+}
+
+math::AxisAlignedBoundingBox
+math::AxisAlignedBoundingBox::getTransformed(
+    const math::Mat4& transformationMatrix
+) const {
+    if (this->isEmpty()) {
+        return {};
+    }
+
+    /**
+     * @brief Rather than transforming all 8 corners we transform the center and then find how far the
+     *   rotated and scaled half extents reach along each axis (Arvo's method). Each axis of the new box
+     *   extends by the sum of the absolute contributions from each column of the upper 3x3 matrix.
+     */
+    const math::Vec3 center = this->getCenter();
+    const math::Vec3 halfExtents = this->getHalfExtents();
+
+    const glm::vec4 transformedCenter = transformationMatrix.glmMat * glm::vec4(center.glmVec, 1.0f);
+
+    glm::vec3 transformedHalfExtents(0.0f);
+    for (uint32_t column = 0; column < 3; ++column) {
+        transformedHalfExtents += glm::abs(glm::vec3(transformationMatrix.glmMat[column])) * halfExtents.glmVec[column];
+    }
+
+    return {
+        glm::vec3(transformedCenter) - transformedHalfExtents,
+        glm::vec3(transformedCenter) + transformedHalfExtents
+    };
+}
+
+std::string
+math::AxisAlignedBoundingBox::toString() const {
+    return "[ " + m_minimum.toString() + " , " + m_maximum.toString() + " ]";
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <ostream>
+#include <string>
+
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec3.hpp"
+
+namespace math {
+    class AxisAlignedBoundingBox;
+}
+
+/**
+ * @brief A box aligned with the axes of whatever space its minimum and maximum corners are given in.
+ *   A default constructed box is empty and contains nothing, expanding it by points or other boxes
+ *   grows it to contain them.
+ */
+class math::AxisAlignedBoundingBox {
+public: // member functions
+    AxisAlignedBoundingBox();
+    AxisAlignedBoundingBox(const math::Vec3& minimum, const math::Vec3& maximum);
+
+    const math::Vec3& getMinimum() const { return m_minimum; }
+    const math::Vec3& getMaximum() const { return m_maximum; }
+    math::Vec3 getCenter() const { return (m_minimum + m_maximum) * 0.5f; }
+    math::Vec3 getHalfExtents() const { return (m_maximum - m_minimum) * 0.5f; }
+
+    bool isEmpty() const;
+
+    AxisAlignedBoundingBox& expand(const math::Vec3& point);
+    AxisAlignedBoundingBox& expand(const AxisAlignedBoundingBox& other);
+
+    /**
+     * @brief Get the box containing this box after it has been transformed by the matrix. This box is
+     *   not rotated, the resulting box is the smallest axis aligned box containing the transformed one
+     */
+    AxisAlignedBoundingBox getTransformed(const math::Mat4& transformationMatrix) const;
+
+    std::string toString() const;
+    friend std::ostream& operator<<(std::ostream& os, const math::AxisAlignedBoundingBox& box) { return os << box.toString(); }
+
+private: // member variables
+    math::Vec3 m_minimum;
+    math::Vec3 m_maximum;
+};
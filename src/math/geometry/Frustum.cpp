@@ -0,0 +1,70 @@
+#include <array>
+
+#include <glm/glm.hpp>
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/geometry/Frustum.hpp"
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec4.hpp"
+
+std::array<math::Vec4, 6>
+math::Frustum::extractPlanes(
+    const math::Mat4& viewProjectionMatrix
+) {
+    /**
+     * @brief Gribb & Hartmann plane extraction. glm is column major, so we transpose to get at the rows.
+     *   We are using GLM_FORCE_DEPTH_ZERO_TO_ONE, so the near plane is just the third row instead of the
+     *   sum of the third and fourth rows like it would be with OpenGL's -1 to 1 depth range.
+     */
+    const glm::mat4 rows = glm::transpose(viewProjectionMatrix.glmMat);
+
+    std::array<math::Vec4, 6> planes = {
+        rows[3] + rows[0], // left
+        rows[3] - rows[0], // right
+        rows[3] + rows[1], // bottom
+        rows[3] - rows[1], // top
+        rows[2],           // near
+        rows[3] - rows[2]  // far
+    };
+
+    for (math::Vec4& plane : planes) {
+        const float normalLength = glm::length(glm::vec3(plane.glmVec));
+        if (normalLength > 0.0f) {
+            plane.glmVec /= normalLength;
+        }
+    }
+
+    return planes;
+}
+
+math::Frustum::Frustum(
+    const math::Mat4& viewProjectionMatrix
+) :
+    m_planes(math::Frustum::extractPlanes(viewProjectionMatrix))
+{}
+
+bool
+math::Frustum::intersects(
+    const math::AxisAlignedBoundingBox& box
+) const {
+    if (box.isEmpty()) {
+        return false;
+    }
+
+    const glm::vec3 center = box.getCenter().glmVec;
+    const glm::vec3 halfExtents = box.getHalfExtents().glmVec;
+
+    for (const math::Vec4& plane : m_planes) {
+        const glm::vec3 normal(plane.glmVec);
+
+        // The furthest the box reaches along the plane's normal from its center
+        const float radius = glm::dot(glm::abs(normal), halfExtents);
+        const float signedDistance = glm::dot(normal, center) + plane.glmVec.w;
+
+        if (signedDistance + radius < 0.0f) {
+            return false;
+        }
+    }
+
+    return true;
+}
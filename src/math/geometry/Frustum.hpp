@@ -0,0 +1,35 @@
+#pragma once
+
+#include <array>
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec4.hpp"
+
+namespace math {
+    class Frustum;
+}
+
+/**
+ * @brief The volume visible through a view projection matrix, described by 6 planes whose normals point
+ *   into the volume. Each plane is stored as ( normal.x , normal.y , normal.z , distance ) so a point p
+ *   is on the inside of the plane when dot(normal, p) + distance >= 0.
+ */
+class math::Frustum {
+public: // member functions
+    Frustum(const math::Mat4& viewProjectionMatrix);
+
+    const std::array<math::Vec4, 6>& getPlanes() const { return m_planes; }
+
+    /**
+     * @brief Conservative test, may report a box near a corner of the frustum as intersecting when it
+     *   is actually outside of it. It will never report a visible box as outside
+     */
+    bool intersects(const math::AxisAlignedBoundingBox& box) const;
+
+private: // static functions
+    static std::array<math::Vec4, 6> extractPlanes(const math::Mat4& viewProjectionMatrix);
+
+private: // member variables
+    std::array<math::Vec4, 6> m_planes;
+};
@@ -1,6 +1,9 @@
 #include <cstdlib>
 
 #include <optional>
+#include <span>
+#include <vector>
+
 #include <reactphysics3d/body/RigidBody.h>
 #include <reactphysics3d/collision/Collider.h>
 #include <reactphysics3d/collision/CollisionCallback.h>
@@ -19,96 +22,13 @@
 
 #include "quartz/physics/collider/BoxShape.hpp"
 #include "quartz/physics/collider/Collider.hpp"
+#include "quartz/physics/collider/ShapeCache.hpp"
 #include "quartz/physics/collider/SphereShape.hpp"
+#include "quartz/physics/field/CollisionEventStream.hpp"
 #include "quartz/physics/field/Field.hpp"
 #include "quartz/physics/rigid_body/RigidBody.hpp"
 
-quartz::managers::PhysicsManager::EventListener::EventListener() {}
-
-quartz::managers::PhysicsManager::EventListener&
-quartz::managers::PhysicsManager::EventListener::getInstance() {
-    static quartz::managers::PhysicsManager::EventListener eventListenerInstance;
-
-    return eventListenerInstance;
-}
-
-void
-quartz::managers::PhysicsManager::EventListener::onContact(
-    const reactphysics3d::CollisionCallback::CallbackData& callbackData
-) {
-    for (uint32_t contactPairIndex = 0; contactPairIndex < callbackData.getNbContactPairs(); contactPairIndex++) {
-        const reactphysics3d::CollisionCallback::ContactPair& currentContactPair = callbackData.getContactPair(contactPairIndex);
-
-        /**
-         * @todo 2025/06/19 Make sure to provide the physics layers associated with each of the rigidbodies and colliders
-         */
-
-        reactphysics3d::Collider* p_collider1 = currentContactPair.getCollider1();
-        quartz::physics::Collider& collider1 = quartz::physics::Collider::getCollider(p_collider1);
-
-        reactphysics3d::Collider* p_collider2 = currentContactPair.getCollider2();
-        quartz::physics::Collider& collider2 = quartz::physics::Collider::getCollider(p_collider2);
-
-        quartz::physics::Collider::CollisionType collisionType = quartz::physics::Collider::getCollisionType(currentContactPair.getEventType());
-        switch (collisionType) {
-            case quartz::physics::Collider::CollisionType::ContactStart:
-                collider1.collisionStart(&collider2);
-                collider2.collisionStart(&collider1);
-                break;
-            case quartz::physics::Collider::CollisionType::ContactStay:
-                collider1.collisionStay(&collider2);
-                collider2.collisionStay(&collider1);
-                break;
-            case quartz::physics::Collider::CollisionType::ContactEnd:
-                collider1.collisionEnd(&collider2);
-                collider2.collisionEnd(&collider1);
-                break;
-        }
-
-        // This is just here to show how we can get the rigidbodies in case we wanted to do anything with them
-        reactphysics3d::RigidBody* p_rigidBody1 = dynamic_cast<reactphysics3d::RigidBody*>(currentContactPair.getBody1());
-        if (p_rigidBody1) {
-            UNUSED quartz::physics::RigidBody& rigidBody1 = quartz::physics::RigidBody::getRigidBody(p_rigidBody1);
-        } else {
-            // not a rigid body
-        }
-    }
-}
-
-void
-quartz::managers::PhysicsManager::EventListener::onTrigger(
-    const reactphysics3d::OverlapCallback::CallbackData& callbackData
-) {
-    for (uint32_t overlappingPairIndex = 0; overlappingPairIndex < callbackData.getNbOverlappingPairs(); overlappingPairIndex++) {
-        const reactphysics3d::OverlapCallback::OverlapPair& currentOverlapPair = callbackData.getOverlappingPair(overlappingPairIndex);
-
-        reactphysics3d::Collider* p_collider1 = currentOverlapPair.getCollider1();
-        quartz::physics::Collider& collider1 = quartz::physics::Collider::getCollider(p_collider1);
-
-        reactphysics3d::Collider* p_collider2 = currentOverlapPair.getCollider2();
-        quartz::physics::Collider& collider2 = quartz::physics::Collider::getCollider(p_collider2);
-
-        quartz::physics::Collider::CollisionType collisionType = quartz::physics::Collider::getCollisionType(currentOverlapPair.getEventType());
-        switch (collisionType) {
-            case quartz::physics::Collider::CollisionType::ContactStart:
-                collider1.collisionStart(&collider2);
-                collider2.collisionStart(&collider1);
-                break;
-            case quartz::physics::Collider::CollisionType::ContactStay:
-                collider1.collisionStay(&collider2);
-                collider2.collisionStay(&collider1);
-                break;
-            case quartz::physics::Collider::CollisionType::ContactEnd:
-                collider1.collisionEnd(&collider2);
-                collider2.collisionEnd(&collider1);
-                break;
-        }
-    }
-}
-
-quartz::managers::PhysicsManager::PhysicsManager() :
-    m_physicsCommon()
-{
+quartz::managers::PhysicsManager::PhysicsManager() {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
 
@@ -127,7 +47,7 @@ quartz::managers::PhysicsManager::createField(
 ) {
     LOG_FUNCTION_SCOPE_TRACEthis("");
 
-    LOG_TRACEthis("Creating rp3d physics world pointer");
+    LOG_TRACEthis("Creating rp3d physics world settings");
     reactphysics3d::PhysicsWorld::WorldSettings physicsWorldSettings;
     // Default settings that we don't currently care about
     physicsWorldSettings.defaultVelocitySolverNbIterations = 10;
@@ -139,23 +59,54 @@ quartz::managers::PhysicsManager::createField(
     // Settings that we actually do care about
     physicsWorldSettings.gravity = fieldParameters.gravity;
 
-    reactphysics3d::PhysicsWorld* p_physicsWorld = m_physicsCommon.createPhysicsWorld(physicsWorldSettings);
-    LOG_TRACEthis("rp3d physics world pointer: {}", reinterpret_cast<void*>(p_physicsWorld));
-
-    p_physicsWorld->setEventListener(&(quartz::managers::PhysicsManager::getEventListenerInstance()));
-
-    LOG_TRACEthis("Creating quartz field");
-    return quartz::physics::Field(p_physicsWorld);
+    LOG_TRACEthis("Creating quartz field, which creates its rp3d physics world with its own rp3d physics common");
+    return quartz::physics::Field(physicsWorldSettings);
 }
 
 void
 quartz::managers::PhysicsManager::destroyField(
-    UNUSED quartz::physics::Field& field
+    quartz::physics::Field& field
 ) {
     LOG_FUNCTION_CALL_TRACEthis("");
 
-    LOG_TRACEthis("Destroying rp3d physics world using rp3d physics common");
-    m_physicsCommon.destroyPhysicsWorld(field.getRP3DPhysicsWorldPtr());
+    LOG_TRACEthis("Destroying rp3d physics world using the field's rp3d physics common");
+    field.mp_physicsCommon->destroyPhysicsWorld(field.mp_physicsWorld);
+    field.mp_physicsWorld = nullptr;
+}
+
+quartz::physics::Collider::Parameters
+quartz::managers::PhysicsManager::getScaledColliderParameters(
+    const quartz::physics::Collider::Parameters& colliderParameters,
+    const math::Vec3& scale
+) {
+    quartz::physics::Collider::Parameters scaledColliderParameters = colliderParameters;
+
+    if (std::holds_alternative<quartz::physics::BoxShape::Parameters>(scaledColliderParameters.v_shapeParameters)) {
+        quartz::physics::BoxShape::Parameters boxShapeParameters = std::get<quartz::physics::BoxShape::Parameters>(scaledColliderParameters.v_shapeParameters);
+        boxShapeParameters.halfExtents_m *= scale;
+        boxShapeParameters.halfExtents_m.abs();
+        scaledColliderParameters.v_shapeParameters = boxShapeParameters;
+    } else if (std::holds_alternative<quartz::physics::SphereShape::Parameters>(scaledColliderParameters.v_shapeParameters)) {
+        quartz::physics::SphereShape::Parameters sphereShapeParameters = std::get<quartz::physics::SphereShape::Parameters>(scaledColliderParameters.v_shapeParameters);
+        sphereShapeParameters.radius_m *= scale.y; // using y value to prefer colliding with the ground properly instead of the other directions
+        sphereShapeParameters.radius_m = std::abs(sphereShapeParameters.radius_m);
+        scaledColliderParameters.v_shapeParameters = sphereShapeParameters;
+    }
+
+    return scaledColliderParameters;
+}
+
+void
+quartz::managers::PhysicsManager::setRP3DRigidBodyProperties(
+    reactphysics3d::RigidBody* p_rigidBody,
+    const quartz::physics::RigidBody::Parameters& rigidBodyParameters
+) {
+    p_rigidBody->setType(quartz::physics::RigidBody::getBodyType(rigidBodyParameters.bodyType));
+    p_rigidBody->enableGravity(rigidBodyParameters.enableGravity);
+    p_rigidBody->setLinearDamping(0.0);
+    p_rigidBody->setAngularDamping(0.0);
+    p_rigidBody->setAngularLockAxisFactor(rigidBodyParameters.angularLockAxisFactor);
+    p_rigidBody->setIsAllowedToSleep(true);
 }
 
 quartz::physics::RigidBody
@@ -171,59 +122,115 @@ quartz::managers::PhysicsManager::createRigidBody(
     reactphysics3d::RigidBody* p_rigidBody = field.getRP3DPhysicsWorldPtr()->createRigidBody(rp3dTransform);
     LOG_TRACEthis("rp3d rigidbody pointer: {}", reinterpret_cast<void*>(p_rigidBody));
 
-    const std::string bodyTypeString = quartz::physics::RigidBody::getBodyTypeString(rigidBodyParameters.bodyType);
-    LOG_TRACEthis("Using body type : {}", bodyTypeString);
+    LOG_TRACEthis("Using body type : {}", quartz::physics::RigidBody::getBodyTypeString(rigidBodyParameters.bodyType));
     LOG_TRACEthis("Enabling gravity: {}", rigidBodyParameters.enableGravity);
-    p_rigidBody->setType(quartz::physics::RigidBody::getBodyType(rigidBodyParameters.bodyType));
-    p_rigidBody->enableGravity(rigidBodyParameters.enableGravity);
-    p_rigidBody->setLinearDamping(0.0);
-    p_rigidBody->setAngularDamping(0.0);
-    p_rigidBody->setAngularLockAxisFactor(rigidBodyParameters.angularLockAxisFactor);
-    p_rigidBody->setIsAllowedToSleep(true);
-
-    quartz::physics::Collider::Parameters modifiedColliderParameters = rigidBodyParameters.colliderParameters;
-    if (std::holds_alternative<quartz::physics::BoxShape::Parameters>(modifiedColliderParameters.v_shapeParameters)) {
-        LOG_TRACEthis("Updating box collider parameters to adhere to scale");
-        quartz::physics::BoxShape::Parameters boxShapeParameters = std::get<quartz::physics::BoxShape::Parameters>(modifiedColliderParameters.v_shapeParameters);
-        boxShapeParameters.halfExtents_m *= transform.scale;
-        boxShapeParameters.halfExtents_m.abs();
-        modifiedColliderParameters.v_shapeParameters = boxShapeParameters;
-    } else if (std::holds_alternative<quartz::physics::SphereShape::Parameters>(modifiedColliderParameters.v_shapeParameters)) {
-        LOG_TRACEthis("Updating sphere collider parameters to adhere to scale");
-        quartz::physics::SphereShape::Parameters sphereShapeParameters = std::get<quartz::physics::SphereShape::Parameters>(modifiedColliderParameters.v_shapeParameters);
-        sphereShapeParameters.radius_m *= transform.scale.y; // using y value to prefer colliding with the ground properly instead of the other directions
-        sphereShapeParameters.radius_m = std::abs(sphereShapeParameters.radius_m);
-        modifiedColliderParameters.v_shapeParameters = sphereShapeParameters;
-    }
+    quartz::managers::PhysicsManager::setRP3DRigidBodyProperties(p_rigidBody, rigidBodyParameters);
 
-    LOG_TRACEthis("Creating quartz collider");
-    std::optional<quartz::physics::Collider> o_collider = this->createCollider(p_rigidBody, modifiedColliderParameters);
+    LOG_TRACEthis("Creating quartz collider with parameters scaled to adhere to the transform");
+    std::optional<quartz::physics::Collider> o_collider = this->createCollider(
+        field,
+        p_rigidBody,
+        quartz::managers::PhysicsManager::getScaledColliderParameters(rigidBodyParameters.colliderParameters, transform.scale)
+    );
 
     LOG_TRACEthis("Creating quartz rigidbody. Moving quartz collider");
     return quartz::physics::RigidBody(std::move(o_collider), p_rigidBody);
 }
 
+std::vector<quartz::physics::RigidBody>
+quartz::managers::PhysicsManager::createRigidBodies(
+    quartz::physics::Field& field,
+    const std::span<const math::Transform> transforms,
+    const std::span<const quartz::physics::RigidBody::Parameters> rigidBodyParameters
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} rigid bodies", rigidBodyParameters.size());
+    QUARTZ_ASSERT(transforms.size() == rigidBodyParameters.size(), "Every rigid body needs exactly one transform");
+
+    reactphysics3d::PhysicsWorld* p_physicsWorld = field.getRP3DPhysicsWorldPtr();
+
+    /**
+     * @brief Each pass touches one kind of rp3d component for every body before moving onto the next,
+     *   instead of bouncing between all of them once per body
+     */
+    std::vector<reactphysics3d::RigidBody*> rp3dRigidBodyPtrs;
+    rp3dRigidBodyPtrs.reserve(rigidBodyParameters.size());
+    for (uint32_t i = 0; i < rigidBodyParameters.size(); ++i) {
+        rp3dRigidBodyPtrs.push_back(p_physicsWorld->createRigidBody(reactphysics3d::Transform(transforms[i].position, transforms[i].rotation)));
+    }
+    LOG_TRACEthis("Created {} rp3d rigid bodies", rp3dRigidBodyPtrs.size());
+
+    for (uint32_t i = 0; i < rigidBodyParameters.size(); ++i) {
+        quartz::managers::PhysicsManager::setRP3DRigidBodyProperties(rp3dRigidBodyPtrs[i], rigidBodyParameters[i]);
+    }
+
+    uint32_t subscriptionCount = 0;
+    for (const quartz::physics::RigidBody::Parameters& currentRigidBodyParameters : rigidBodyParameters) {
+        const quartz::physics::Collider::Parameters& colliderParameters = currentRigidBodyParameters.colliderParameters;
+        if (colliderParameters.collisionStartCallback || colliderParameters.collisionStayCallback || colliderParameters.collisionEndCallback) {
+            subscriptionCount++;
+        }
+    }
+    field.mp_collisionEventStream->reserveSubscriptions(subscriptionCount);
+
+    std::vector<quartz::physics::RigidBody> rigidBodies;
+    rigidBodies.reserve(rigidBodyParameters.size());
+    for (uint32_t i = 0; i < rigidBodyParameters.size(); ++i) {
+        std::optional<quartz::physics::Collider> o_collider = this->createCollider(
+            field,
+            rp3dRigidBodyPtrs[i],
+            quartz::managers::PhysicsManager::getScaledColliderParameters(rigidBodyParameters[i].colliderParameters, transforms[i].scale)
+        );
+
+        rigidBodies.push_back(quartz::physics::RigidBody(std::move(o_collider), rp3dRigidBodyPtrs[i]));
+    }
+    LOG_TRACEthis("Created {} quartz rigid bodies", rigidBodies.size());
+
+    return rigidBodies;
+}
+
 void
 quartz::managers::PhysicsManager::destroyRigidBody(
-    UNUSED quartz::physics::Field& field,
+    quartz::physics::Field& field,
     quartz::physics::RigidBody& rigidBody
 ) {
     LOG_FUNCTION_SCOPE_TRACEthis("");
 
     if (rigidBody.mo_collider) {
         LOG_TRACEthis("Destroying collider");
-        this->destroyCollider(*rigidBody.mo_collider);
+        this->destroyCollider(field, rigidBody.mp_rigidBody, *rigidBody.mo_collider);
     }
 
-    LOG_TRACEthis("Erasing rp3d rigid body from collider map");
-    quartz::physics::RigidBody::eraseRigidBody(rigidBody.mp_rigidBody);
+    LOG_TRACEthis("Clearing rp3d rigid body's user data");
+    rigidBody.mp_rigidBody->setUserData(nullptr);
 
     LOG_TRACEthis("Destroying rp3d rigid body using field's rp3d physics world");
     field.mp_physicsWorld->destroyRigidBody(rigidBody.mp_rigidBody);
+    rigidBody.mp_rigidBody = nullptr;
+}
+
+void
+quartz::managers::PhysicsManager::destroyRigidBodies(
+    quartz::physics::Field& field,
+    const std::span<quartz::physics::RigidBody* const> rigidBodyPtrs
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} rigid bodies", rigidBodyPtrs.size());
+
+    for (quartz::physics::RigidBody* p_rigidBody : rigidBodyPtrs) {
+        if (p_rigidBody->mo_collider) {
+            this->destroyCollider(field, p_rigidBody->mp_rigidBody, *p_rigidBody->mo_collider);
+        }
+    }
+
+    for (quartz::physics::RigidBody* p_rigidBody : rigidBodyPtrs) {
+        p_rigidBody->mp_rigidBody->setUserData(nullptr);
+        field.mp_physicsWorld->destroyRigidBody(p_rigidBody->mp_rigidBody);
+        p_rigidBody->mp_rigidBody = nullptr;
+    }
 }
 
 std::optional<quartz::physics::Collider>
 quartz::managers::PhysicsManager::createCollider(
+    quartz::physics::Field& field,
     reactphysics3d::RigidBody* p_rigidBody,
     const quartz::physics::Collider::Parameters& colliderParameters
 ) {
@@ -239,13 +246,13 @@ quartz::managers::PhysicsManager::createCollider(
 
     if (std::holds_alternative<quartz::physics::BoxShape::Parameters>(colliderParameters.v_shapeParameters)) {
         LOG_TRACEthis("Collider shape parameters represent box collider parameters. Creating box collider");
-        v_shape = this->createBoxShape(std::get<quartz::physics::BoxShape::Parameters>(colliderParameters.v_shapeParameters));
+        v_shape = this->createBoxShape(field, std::get<quartz::physics::BoxShape::Parameters>(colliderParameters.v_shapeParameters));
         p_collisionShape = std::get<quartz::physics::BoxShape>(v_shape).mp_colliderShape;
     }
 
     if (std::holds_alternative<quartz::physics::SphereShape::Parameters>(colliderParameters.v_shapeParameters)) {
         LOG_TRACEthis("Collider shape parameters represent sphere collider parameters. Creating sphere collider");
-        v_shape = this->createSphereShape(std::get<quartz::physics::SphereShape::Parameters>(colliderParameters.v_shapeParameters));
+        v_shape = this->createSphereShape(field, std::get<quartz::physics::SphereShape::Parameters>(colliderParameters.v_shapeParameters));
         p_collisionShape = std::get<quartz::physics::SphereShape>(v_shape).mp_colliderShape;
     }
 
@@ -263,71 +270,87 @@ quartz::managers::PhysicsManager::createCollider(
     p_collider->setCollideWithMaskBits(colliderParameters.categoryProperties.collidableCategoriesBitMask);
     p_collider->setIsTrigger(colliderParameters.isTrigger);
 
+    LOG_TRACEthis("Subscribing collider's callbacks to the field's collision event stream");
+    const uint32_t subscriptionIndex = field.mp_collisionEventStream->subscribe(colliderParameters);
+
     LOG_TRACEthis("Creating quartz collider. Moving shape");
-    return quartz::physics::Collider(std::move(v_shape), p_collider, colliderParameters.collisionStartCallback, colliderParameters.collisionStayCallback, colliderParameters.collisionEndCallback);
+    return quartz::physics::Collider(std::move(v_shape), p_collider, field.mp_shapeCache.get(), field.mp_collisionEventStream.get(), subscriptionIndex);
 }
 
 void
 quartz::managers::PhysicsManager::destroyCollider(
+    quartz::physics::Field& field,
+    reactphysics3d::RigidBody* p_rigidBody,
     quartz::physics::Collider& collider
 ) {
     LOG_FUNCTION_SCOPE_TRACEthis("");
 
+    LOG_TRACEthis("Unsubscribing collider's callbacks from the field's collision event stream");
+    field.mp_collisionEventStream->unsubscribe(collider.m_subscriptionIndex);
+    collider.m_subscriptionIndex = quartz::physics::Collider::noSubscriptionIndex;
+
     /**
-     * @brief For now, we are not destroying the physics shapes. For some reason when we do it manually instead of allowing
-     *   the rp3d physics common to do it implicitly, we end up with bad SIGABRT issues with rigid bodies trying to destroy
-     *   colliders and colliders trying to destroy shapes
+     * @brief rp3d aborts if a shape is destroyed while a collider is still using it, so the rp3d collider
+     *   has to be removed from its body before we let go of the shape
      */
+    LOG_TRACEthis("Removing rp3d collider from rp3d rigid body");
+    field.mp_collisionEventStream->forgetCollider(collider.mp_collider);
+    collider.mp_collider->setUserData(nullptr);
+    p_rigidBody->removeCollider(collider.mp_collider);
+    collider.mp_collider = nullptr;
+
+    if (collider.mo_boxShape) {
+        LOG_TRACEthis("Destroying box shape");
+        this->destroyBoxShape(field, *collider.mo_boxShape);
+    }
 
-    // if (collider.mo_boxShape) {
-    //     LOG_TRACEthis("Destroying box shape");
-    //     this->destroyBoxShape(*collider.mo_boxShape);
-    // }
-
-    // if (collider.mo_sphereShape) {
-    //     LOG_TRACEthis("Destroying sphere shape");
-    //     this->destroySphereShape(*collider.mo_sphereShape);
-    // }
-
-    LOG_TRACEthis("Erasing rp3d collider from collider map");
-    quartz::physics::Collider::eraseCollider(collider.mp_collider);
+    if (collider.mo_sphereShape) {
+        LOG_TRACEthis("Destroying sphere shape");
+        this->destroySphereShape(field, *collider.mo_sphereShape);
+    }
 }
 
 quartz::physics::BoxShape
 quartz::managers::PhysicsManager::createBoxShape(
+    quartz::physics::Field& field,
     const quartz::physics::BoxShape::Parameters& boxShapeParameters
 ) {
     QUARTZ_ASSERT(boxShapeParameters.halfExtents_m.x > 0, "Box shape half extents X value must be greater than 0");
     QUARTZ_ASSERT(boxShapeParameters.halfExtents_m.y > 0, "Box shape half extents Y value must be greater than 0");
     QUARTZ_ASSERT(boxShapeParameters.halfExtents_m.z > 0, "Box shape half extents Z value must be greater than 0");
 
-    reactphysics3d::BoxShape* p_boxShape = m_physicsCommon.createBoxShape(boxShapeParameters.halfExtents_m);
+    reactphysics3d::BoxShape* p_boxShape = field.mp_shapeCache->acquireBoxShape(boxShapeParameters.halfExtents_m);
 
     return quartz::physics::BoxShape(p_boxShape);
 }
 
 void
 quartz::managers::PhysicsManager::destroyBoxShape(
-    UNUSED quartz::physics::BoxShape& boxShape
+    quartz::physics::Field& field,
+    quartz::physics::BoxShape& boxShape
 ) {
-    // m_physicsCommon.destroyBoxShape(boxShape.mp_colliderShape);
+    field.mp_shapeCache->releaseBoxShape(boxShape.mp_colliderShape);
+    boxShape.mp_colliderShape = nullptr;
 }
 
 quartz::physics::SphereShape
 quartz::managers::PhysicsManager::createSphereShape(
+    quartz::physics::Field& field,
     const quartz::physics::SphereShape::Parameters& sphereShapeParameters
 ) {
     QUARTZ_ASSERT(sphereShapeParameters.radius_m > 0, "Sphere shape radius must be greater than 0");
 
-    reactphysics3d::SphereShape* p_sphereShape = m_physicsCommon.createSphereShape(sphereShapeParameters.radius_m);
+    reactphysics3d::SphereShape* p_sphereShape = field.mp_shapeCache->acquireSphereShape(sphereShapeParameters.radius_m);
 
     return quartz::physics::SphereShape(p_sphereShape);
 }
 
 void
 quartz::managers::PhysicsManager::destroySphereShape(
-    UNUSED quartz::physics::SphereShape& sphereShape
+    quartz::physics::Field& field,
+    quartz::physics::SphereShape& sphereShape
 ) {
-    // m_physicsCommon.destroySphereShape(sphereShape.mp_colliderShape);
+    field.mp_shapeCache->releaseSphereShape(sphereShape.mp_colliderShape);
+    sphereShape.mp_colliderShape = nullptr;
 }
 
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <map>
+#include <span>
+#include <vector>
 
 #include <reactphysics3d/reactphysics3d.h>
-#include <reactphysics3d/engine/EventListener.h>
 
 #include "math/transform/Transform.hpp"
 
@@ -43,35 +44,6 @@ public: // classes
         friend class quartz::unit_test::PhysicsManagerUnitTestClient;
     };
 
-    class EventListener : public reactphysics3d::EventListener {
-    public: // classes
-        class Client {
-        public: // member functions
-            Client() = delete;
-
-        private: // static functions
-            static quartz::managers::PhysicsManager::EventListener& getInstance() { return quartz::managers::PhysicsManager::EventListener::getInstance(); }
-
-        private: // friend classes
-            friend class quartz::managers::PhysicsManager;
-        };
-
-    public: // member functions
-        /**
-         * @todo 2025/06/19 Make these private and allow the reactphysics3d::ContactManager class to be a friend so it can access these.
-         *   We probably don't want just anyone who has access to this instance to have the ability to fabricate collisions.
-         */
-        void onContact(const reactphysics3d::CollisionCallback::CallbackData& callbackData) override;
-
-        void onTrigger(const reactphysics3d::OverlapCallback::CallbackData& callbackData) override;
-
-    private: // member functions
-        EventListener();
-
-    private: // static functions
-        static EventListener& getInstance();
-    };
-
 public: // member functions
     PhysicsManager(const PhysicsManager& other) = delete;
     PhysicsManager(PhysicsManager&& other) = delete;
@@ -86,40 +58,68 @@ public: // member functions
         const math::Transform& transform,
         const quartz::physics::RigidBody::Parameters& rigidBodyParameters
     );
+    /**
+     * @brief The same as calling createRigidBody with each transform and its parameters, but without
+     *   the per body logging, and with each step done for every body before moving onto the next
+     */
+    std::vector<quartz::physics::RigidBody> createRigidBodies(
+        quartz::physics::Field& field,
+        const std::span<const math::Transform> transforms,
+        const std::span<const quartz::physics::RigidBody::Parameters> rigidBodyParameters
+    );
 
     void destroyField(quartz::physics::Field& field);
     void destroyRigidBody(
         quartz::physics::Field& field,
         quartz::physics::RigidBody& rigidBody
     );
+    void destroyRigidBodies(
+        quartz::physics::Field& field,
+        const std::span<quartz::physics::RigidBody* const> rigidBodyPtrs
+    );
 
 private: // member functions
     PhysicsManager();
 
     std::optional<quartz::physics::Collider> createCollider(
+        quartz::physics::Field& field,
         reactphysics3d::RigidBody* p_rigidBody,
         const quartz::physics::Collider::Parameters& colliderParameters
     );
     quartz::physics::BoxShape createBoxShape(
+        quartz::physics::Field& field,
         const quartz::physics::BoxShape::Parameters& boxShapeParameters
     );
     quartz::physics::SphereShape createSphereShape(
+        quartz::physics::Field& field,
         const quartz::physics::SphereShape::Parameters& sphereShapeParameters
     );
 
-    void destroyCollider(quartz::physics::Collider& collider);
-    void destroyBoxShape(quartz::physics::BoxShape& boxShape);
-    void destroySphereShape(quartz::physics::SphereShape& sphereShape);
+    void destroyCollider(
+        quartz::physics::Field& field,
+        reactphysics3d::RigidBody* p_rigidBody,
+        quartz::physics::Collider& collider
+    );
+    void destroyBoxShape(
+        quartz::physics::Field& field,
+        quartz::physics::BoxShape& boxShape
+    );
+    void destroySphereShape(
+        quartz::physics::Field& field,
+        quartz::physics::SphereShape& sphereShape
+    );
 
 private: // static functions
     static PhysicsManager& getInstance();
 
-    static quartz::managers::PhysicsManager::EventListener& getEventListenerInstance() { return quartz::managers::PhysicsManager::EventListener::Client::getInstance(); }
-
-private: // static variables
-
-private: // member variables
-    reactphysics3d::PhysicsCommon m_physicsCommon;
+    static quartz::physics::Collider::Parameters getScaledColliderParameters(
+        const quartz::physics::Collider::Parameters& colliderParameters,
+        const math::Vec3& scale
+    );
+    static void setRP3DRigidBodyProperties(
+        reactphysics3d::RigidBody* p_rigidBody,
+        const quartz::physics::RigidBody::Parameters& rigidBodyParameters
+    );
 
 private: // friends
     friend class quartz::unit_test::PhysicsManagerUnitTestClient;
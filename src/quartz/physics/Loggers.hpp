@@ -3,18 +3,24 @@
 #include "util/logger/Logger.hpp"
 
 DECLARE_LOGGER(COLLIDER, trace);
+DECLARE_LOGGER(COLLISION_EVENT_STREAM, trace);
 DECLARE_LOGGER(SHAPE_BOX, trace);
+DECLARE_LOGGER(SHAPE_CACHE, trace);
 DECLARE_LOGGER(SHAPE_SPHERE, trace);
 DECLARE_LOGGER(FIELD, trace);
+DECLARE_LOGGER(FIELD_SCHEDULER, trace);
 DECLARE_LOGGER(RIGIDBODY, trace);
 
 DECLARE_LOGGER_GROUP(
     QUARTZ_PHYSICS,
-    5,
+    8,
     COLLIDER,
+    COLLISION_EVENT_STREAM,
     SHAPE_BOX,
+    SHAPE_CACHE,
     SHAPE_SPHERE,
     FIELD,
+    FIELD_SCHEDULER,
     RIGIDBODY
 );
 
@@ -45,11 +45,3 @@ quartz::physics::BoxShape::getLocalVertexPositions() const {
         mp_colliderShape->getVertexPosition(7), // -x  y -z
     };
 }
-
-void
-quartz::physics::BoxShape::setHalfExtents_m(
-    const math::Vec3& halfExtents_m
-) {
-    mp_colliderShape->setHalfExtents(halfExtents_m.abs());
-}
-
@@ -2,6 +2,9 @@
 #include <variant>
 
 #include <reactphysics3d/body/Body.h>
+#include <reactphysics3d/body/RigidBody.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/shapes/SphereShape.h>
 #include <reactphysics3d/mathematics/Transform.h>
 
 #include "util/logger/Logger.hpp"
@@ -11,9 +14,9 @@
 
 #include "quartz/physics/collider/BoxShape.hpp"
 #include "quartz/physics/collider/SphereShape.hpp"
+#include "quartz/physics/collider/ShapeCache.hpp"
 #include "quartz/physics/collider/Collider.hpp"
-
-std::map<reactphysics3d::Collider*, quartz::physics::Collider*> quartz::physics::Collider::colliderMap;
+#include "quartz/physics/field/CollisionEventStream.hpp"
 
 quartz::physics::Collider::CollisionType
 quartz::physics::Collider::getCollisionType(
@@ -43,11 +46,6 @@ quartz::physics::Collider::getCollisionType(
     }
 }
 
-void
-quartz::physics::Collider::noopCollisionCallback(
-    UNUSED quartz::physics::Collider::CollisionCallbackParameters parameters
-) {}
-
 bool
 quartz::physics::Collider::CategoryProperties::operator==(
     const quartz::physics::Collider::CategoryProperties& other
@@ -67,9 +65,9 @@ operator<<(
 quartz::physics::Collider::Collider(
     std::variant<std::monostate, quartz::physics::BoxShape, quartz::physics::SphereShape>&& v_shape,
     reactphysics3d::Collider* p_collider,
-    const quartz::physics::Collider::CollisionCallback& collisionStartCallback,
-    const quartz::physics::Collider::CollisionCallback& collisionStayCallback,
-    const quartz::physics::Collider::CollisionCallback& collisionEndCallback
+    quartz::physics::ShapeCache* p_shapeCache,
+    quartz::physics::CollisionEventStream* p_collisionEventStream,
+    const uint32_t subscriptionIndex
 ) :
     mo_boxShape(
         (std::holds_alternative<quartz::physics::BoxShape>(v_shape)) ?
@@ -82,13 +80,13 @@ quartz::physics::Collider::Collider(
             std::nullopt
     ),
     mp_collider(p_collider),
-    m_collisionStartCallback(collisionStartCallback ? collisionStartCallback : quartz::physics::Collider::noopCollisionCallback),
-    m_collisionStayCallback(collisionStayCallback ? collisionStayCallback : quartz::physics::Collider::noopCollisionCallback),
-    m_collisionEndCallback(collisionEndCallback ? collisionEndCallback : quartz::physics::Collider::noopCollisionCallback)
+    mp_shapeCache(p_shapeCache),
+    mp_collisionEventStream(p_collisionEventStream),
+    m_subscriptionIndex(subscriptionIndex)
 {
     LOG_FUNCTION_SCOPE_TRACEthis("");
-    LOG_TRACEthis("Constructing Collider. Setting collider map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
-    quartz::physics::Collider::colliderMap[mp_collider] = this;
+    LOG_TRACEthis("Constructing Collider. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
+    mp_collider->setUserData(this);
 }
 
 quartz::physics::Collider::Collider(
@@ -97,13 +95,18 @@ quartz::physics::Collider::Collider(
     mo_boxShape(std::move(other.mo_boxShape)),
     mo_sphereShape(std::move(other.mo_sphereShape)),
     mp_collider(std::move(other.mp_collider)),
-    m_collisionStartCallback(std::move(other.m_collisionStartCallback)),
-    m_collisionStayCallback(std::move(other.m_collisionStayCallback)),
-    m_collisionEndCallback(std::move(other.m_collisionEndCallback))
+    mp_shapeCache(other.mp_shapeCache),
+    mp_collisionEventStream(other.mp_collisionEventStream),
+    m_subscriptionIndex(other.m_subscriptionIndex)
 {
     LOG_FUNCTION_SCOPE_TRACEthis("");
-    LOG_TRACEthis("Move-constructing Collider. Setting collider map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
-    quartz::physics::Collider::colliderMap[mp_collider] = this;
+    // There is no rp3d collider left to point back to us if the one we moved from was already destroyed
+    if (!mp_collider) {
+        LOG_TRACEthis("No rp3d collider to point back to us");
+    } else {
+        LOG_TRACEthis("Move-constructing Collider. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
+        mp_collider->setUserData(this);
+    }
 }
 
 quartz::physics::Collider::~Collider() {
@@ -124,13 +127,18 @@ quartz::physics::Collider::operator=(
     mo_sphereShape = std::move(other.mo_sphereShape);
 
     mp_collider = std::move(other.mp_collider);
+    mp_shapeCache = other.mp_shapeCache;
+    mp_collisionEventStream = other.mp_collisionEventStream;
 
-    m_collisionStartCallback = std::move(other.m_collisionStartCallback);
-    m_collisionStayCallback = std::move(other.m_collisionStayCallback);
-    m_collisionEndCallback = std::move(other.m_collisionEndCallback);
+    m_subscriptionIndex = other.m_subscriptionIndex;
 
-    LOG_TRACEthis("Moving Collider. Setting collider map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
-    quartz::physics::Collider::colliderMap[mp_collider] = this;
+    // There is no rp3d collider left to point back to us if the one we moved from was already destroyed
+    if (!mp_collider) {
+        LOG_TRACEthis("No rp3d collider to point back to us");
+    } else {
+        LOG_TRACEthis("Moving Collider. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_collider), reinterpret_cast<void*>(this));
+        mp_collider->setUserData(this);
+    }
 
     return *this;
 }
@@ -183,39 +191,61 @@ quartz::physics::Collider::getWorldRotation() const {
     return math::Quaternion(mp_collider->getLocalToWorldTransform().getOrientation()).normalize();
 }
 
+void
+quartz::physics::Collider::replaceRP3DCollider(
+    reactphysics3d::CollisionShape* p_collisionShape
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    // Every collider we create is attached to a rigid body
+    reactphysics3d::RigidBody* p_rigidBody = static_cast<reactphysics3d::RigidBody*>(mp_collider->getBody());
+
+    const reactphysics3d::Transform localToBodyTransform = mp_collider->getLocalToBodyTransform();
+    const uint16_t categoryBitMask = mp_collider->getCollisionCategoryBits();
+    const uint16_t collidableCategoriesBitMask = mp_collider->getCollideWithMaskBits();
+    const bool isTrigger = mp_collider->getIsTrigger();
+
+    LOG_TRACEthis("Replacing rp3d collider pointer at {}", reinterpret_cast<void*>(mp_collider));
+    // This tick's events may still reference the old one, and they must not read it once it is gone
+    mp_collisionEventStream->forgetCollider(mp_collider);
+    mp_collider->setUserData(nullptr);
+    p_rigidBody->removeCollider(mp_collider);
+    mp_collider = p_rigidBody->addCollider(p_collisionShape, localToBodyTransform);
+    LOG_TRACEthis("New rp3d collider pointer at {}", reinterpret_cast<void*>(mp_collider));
+
+    mp_collider->setCollisionCategoryBits(categoryBitMask);
+    mp_collider->setCollideWithMaskBits(collidableCategoriesBitMask);
+    mp_collider->setIsTrigger(isTrigger);
+    mp_collider->setUserData(this);
+}
+
 void
 quartz::physics::Collider::setScale(
     const math::Vec3& scale
 ) {
     if (mo_boxShape) {
-        mo_boxShape->setHalfExtents_m(scale);
+        reactphysics3d::BoxShape* p_boxShape = mo_boxShape->mp_colliderShape;
+        reactphysics3d::BoxShape* p_resizedBoxShape = mp_shapeCache->resizeBoxShape(p_boxShape, scale);
+        if (p_resizedBoxShape == p_boxShape) {
+            return;
+        }
+
+        this->replaceRP3DCollider(p_resizedBoxShape);
+        mo_boxShape->mp_colliderShape = p_resizedBoxShape;
+        mp_shapeCache->releaseBoxShape(p_boxShape);
         return;
     }
 
     if (mo_sphereShape) {
-        mo_sphereShape->setRadius_m(scale.y);
+        reactphysics3d::SphereShape* p_sphereShape = mo_sphereShape->mp_colliderShape;
+        reactphysics3d::SphereShape* p_resizedSphereShape = mp_shapeCache->resizeSphereShape(p_sphereShape, scale.y);
+        if (p_resizedSphereShape == p_sphereShape) {
+            return;
+        }
+
+        this->replaceRP3DCollider(p_resizedSphereShape);
+        mo_sphereShape->mp_colliderShape = p_resizedSphereShape;
+        mp_shapeCache->releaseSphereShape(p_sphereShape);
         return;
     }
 }
-
-void
-quartz::physics::Collider::collisionStart(
-    Collider* const p_otherCollider
-) {
-    m_collisionStartCallback({this, p_otherCollider});
-}
-
-void
-quartz::physics::Collider::collisionStay(
-    Collider* const p_otherCollider
-) {
-    m_collisionStayCallback({this, p_otherCollider});
-}
-
-void
-quartz::physics::Collider::collisionEnd(
-    Collider* const p_otherCollider
-) {
-    m_collisionEndCallback({this, p_otherCollider});
-}
-
@@ -1,19 +1,22 @@
 #pragma once
 
 #include <functional>
-#include <map>
+#include <limits>
 #include <optional>
+#include <span>
 #include <variant>
 
 #include <reactphysics3d/reactphysics3d.h>
 #include <reactphysics3d/collision/Collider.h>
 
 #include "math/transform/Quaternion.hpp"
+#include "math/transform/Vec3.hpp"
 
 #include "util/logger/Logger.hpp"
 
 #include "quartz/physics/Loggers.hpp"
 #include "quartz/physics/collider/BoxShape.hpp"
+#include "quartz/physics/collider/ShapeCache.hpp"
 #include "quartz/physics/collider/SphereShape.hpp"
 
 namespace quartz {
@@ -24,6 +27,7 @@ namespace managers {
 
 namespace physics {
     class Collider;
+    class CollisionEventStream;
 }
 
 } // namespace quartz
@@ -38,17 +42,32 @@ public: // callbacks and their info
     static CollisionType getCollisionType(const reactphysics3d::CollisionCallback::ContactPair::EventType eventType);
     static CollisionType getCollisionType(const reactphysics3d::OverlapCallback::OverlapPair::EventType eventType);
 
+    /**
+     * @brief The normal points from the first collider of the pair towards the second
+     */
+    struct ContactPoint {
+        math::Vec3 worldPosition;
+        math::Vec3 worldNormal;
+        double penetrationDepth_m;
+    };
+
     struct CollisionCallbackParameters {
         CollisionCallbackParameters(
             Collider* const p_collider_,
-            Collider* const p_otherCollider_
+            Collider* const p_otherCollider_,
+            const bool isFirstCollider_,
+            const std::span<const ContactPoint> contactPoints_
         ) :
             p_collider(p_collider_),
-            p_otherCollider(p_otherCollider_)
+            p_otherCollider(p_otherCollider_),
+            isFirstCollider(isFirstCollider_),
+            contactPoints(contactPoints_)
         {}
 
         Collider* const p_collider;
         Collider* const p_otherCollider;
+        const bool isFirstCollider; // Whether p_collider was the first collider of the pair, for the contact normals
+        const std::span<const ContactPoint> contactPoints; // Empty for triggers and for contacts that are ending
     };
 
     using CollisionCallback = std::function<void(CollisionCallbackParameters parameters)>;
@@ -119,46 +138,59 @@ public: // member functions
     const std::optional<quartz::physics::BoxShape>& getBoxShapeOptional() const { return mo_boxShape; }
     const std::optional<quartz::physics::SphereShape>& getSphereShapeOptional() const { return mo_sphereShape; }
 
+    /**
+     * @brief Shapes are shared between colliders, so this may swap our shape (and the rp3d collider
+     *   holding it) for a different one rather than resizing it
+     */
     void setScale(const math::Vec3& scale);
 
 public: // static functions
-    static quartz::physics::Collider& getCollider(reactphysics3d::Collider* const p_collider) { return *quartz::physics::Collider::colliderMap.at(p_collider); }
+    /**
+     * @brief Every rp3d collider we create holds a pointer back to the quartz collider that owns it in its
+     *   user data, which is kept up to date whenever the quartz collider moves, so this is a single load
+     *   instead of a search
+     */
+    static quartz::physics::Collider& getCollider(reactphysics3d::Collider* const p_collider) { return *static_cast<quartz::physics::Collider*>(p_collider->getUserData()); }
 
 private: // member functions
     Collider(
         std::variant<std::monostate, quartz::physics::BoxShape, quartz::physics::SphereShape>&& v_shape,
         reactphysics3d::Collider* p_collider,
-        const quartz::physics::Collider::CollisionCallback& collisionStartCallback,
-        const quartz::physics::Collider::CollisionCallback& collisionStayCallback,
-        const quartz::physics::Collider::CollisionCallback& collisionEndCallback
+        quartz::physics::ShapeCache* p_shapeCache,
+        quartz::physics::CollisionEventStream* p_collisionEventStream,
+        const uint32_t subscriptionIndex
     );
 
-    void collisionStart(Collider* const p_otherCollider);
-    void collisionStay(Collider* const p_otherCollider);
-    void collisionEnd(Collider* const p_otherCollider);
+    /**
+     * @brief rp3d colliders can't change their shape, so this replaces the rp3d collider with one
+     *   using the given shape, carrying over everything we set on the original
+     */
+    void replaceRP3DCollider(reactphysics3d::CollisionShape* p_collisionShape);
 
     const reactphysics3d::CollisionShape* getCollisionShapePtr() const;
     const reactphysics3d::Collider* getColliderPtr() const { return mp_collider; }
 
-private: // static functions
-    static void noopCollisionCallback(CollisionCallbackParameters parameters);
-    static void eraseCollider(reactphysics3d::Collider* const p_collider) { quartz::physics::Collider::colliderMap.erase(p_collider); }
-
 private: // static variables
-    static std::map<reactphysics3d::Collider*, quartz::physics::Collider*> colliderMap;
+    static constexpr uint32_t noSubscriptionIndex = std::numeric_limits<uint32_t>::max();
 
 private: // member variables
     std::optional<quartz::physics::BoxShape> mo_boxShape;
     std::optional<quartz::physics::SphereShape> mo_sphereShape;
 
     reactphysics3d::Collider* mp_collider;
+    quartz::physics::ShapeCache* mp_shapeCache;
+    quartz::physics::CollisionEventStream* mp_collisionEventStream; // of our field, told whenever we replace mp_collider
 
-    CollisionCallback m_collisionStartCallback;
-    CollisionCallback m_collisionStayCallback;
-    CollisionCallback m_collisionEndCallback;
+    /**
+     * @brief Where this collider's callbacks live in its field's collision event stream, or
+     *   noSubscriptionIndex if it was created without any. Colliders without a subscription
+     *   never have anything dispatched to them
+     */
+    uint32_t m_subscriptionIndex;
 
 private: // friends
     friend class quartz::managers::PhysicsManager;
+    friend class quartz::physics::CollisionEventStream;
 };
 
 std::ostream& operator<<(std::ostream& os, const quartz::physics::Collider::CategoryProperties& categoryProperties);
@@ -0,0 +1,224 @@
+#include <cmath>
+
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/shapes/SphereShape.h>
+#include <reactphysics3d/engine/PhysicsCommon.h>
+
+#include "math/transform/Vec3.hpp"
+
+#include "util/errors/RichException.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "quartz/physics/collider/ShapeCache.hpp"
+
+std::array<int64_t, 3>
+quartz::physics::ShapeCache::getBoxShapeKey(
+    const math::Vec3& halfExtents_m
+) {
+    return {
+        std::llround(std::abs(static_cast<reactphysics3d::decimal>(halfExtents_m.x)) / quartz::physics::ShapeCache::quantum_m),
+        std::llround(std::abs(static_cast<reactphysics3d::decimal>(halfExtents_m.y)) / quartz::physics::ShapeCache::quantum_m),
+        std::llround(std::abs(static_cast<reactphysics3d::decimal>(halfExtents_m.z)) / quartz::physics::ShapeCache::quantum_m)
+    };
+}
+
+int64_t
+quartz::physics::ShapeCache::getSphereShapeKey(
+    const double radius_m
+) {
+    return std::llround(std::abs(static_cast<reactphysics3d::decimal>(radius_m)) / quartz::physics::ShapeCache::quantum_m);
+}
+
+quartz::physics::ShapeCache::ShapeCache(
+    reactphysics3d::PhysicsCommon& physicsCommon
+) :
+    m_physicsCommon(physicsCommon),
+    m_boxShapeEntries(),
+    m_sphereShapeEntries()
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+uint32_t
+quartz::physics::ShapeCache::getReferenceCount(
+    const reactphysics3d::BoxShape* p_boxShape
+) const {
+    const std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>>::const_iterator entryIterator = m_boxShapeEntries.find(quartz::physics::ShapeCache::getBoxShapeKey(p_boxShape->getHalfExtents()));
+    if (entryIterator == m_boxShapeEntries.end() || entryIterator->second.p_shape != p_boxShape) {
+        return 0;
+    }
+
+    return entryIterator->second.referenceCount;
+}
+
+uint32_t
+quartz::physics::ShapeCache::getReferenceCount(
+    const reactphysics3d::SphereShape* p_sphereShape
+) const {
+    const std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>>::const_iterator entryIterator = m_sphereShapeEntries.find(quartz::physics::ShapeCache::getSphereShapeKey(p_sphereShape->getRadius()));
+    if (entryIterator == m_sphereShapeEntries.end() || entryIterator->second.p_shape != p_sphereShape) {
+        return 0;
+    }
+
+    return entryIterator->second.referenceCount;
+}
+
+reactphysics3d::BoxShape*
+quartz::physics::ShapeCache::acquireBoxShape(
+    const math::Vec3& halfExtents_m
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} cached box shapes", m_boxShapeEntries.size());
+
+    const std::array<int64_t, 3> key = quartz::physics::ShapeCache::getBoxShapeKey(halfExtents_m);
+
+    const std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>>::iterator entryIterator = m_boxShapeEntries.find(key);
+    if (entryIterator != m_boxShapeEntries.end()) {
+        entryIterator->second.referenceCount++;
+        LOG_TRACEthis("Reusing cached box shape, now with {} references", entryIterator->second.referenceCount);
+        return entryIterator->second.p_shape;
+    }
+
+    LOG_TRACEthis("Creating box shape");
+    reactphysics3d::BoxShape* p_boxShape = m_physicsCommon.createBoxShape(
+        reactphysics3d::Vector3(std::abs(halfExtents_m.x), std::abs(halfExtents_m.y), std::abs(halfExtents_m.z))
+    );
+    m_boxShapeEntries.emplace(key, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>{p_boxShape, 1});
+
+    return p_boxShape;
+}
+
+reactphysics3d::SphereShape*
+quartz::physics::ShapeCache::acquireSphereShape(
+    const double radius_m
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} cached sphere shapes", m_sphereShapeEntries.size());
+
+    const int64_t key = quartz::physics::ShapeCache::getSphereShapeKey(radius_m);
+
+    const std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>>::iterator entryIterator = m_sphereShapeEntries.find(key);
+    if (entryIterator != m_sphereShapeEntries.end()) {
+        entryIterator->second.referenceCount++;
+        LOG_TRACEthis("Reusing cached sphere shape, now with {} references", entryIterator->second.referenceCount);
+        return entryIterator->second.p_shape;
+    }
+
+    LOG_TRACEthis("Creating sphere shape");
+    reactphysics3d::SphereShape* p_sphereShape = m_physicsCommon.createSphereShape(std::abs(radius_m));
+    m_sphereShapeEntries.emplace(key, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>{p_sphereShape, 1});
+
+    return p_sphereShape;
+}
+
+void
+quartz::physics::ShapeCache::releaseBoxShape(
+    reactphysics3d::BoxShape* p_boxShape
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{}", reinterpret_cast<void*>(p_boxShape));
+
+    const std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>>::iterator entryIterator = m_boxShapeEntries.find(quartz::physics::ShapeCache::getBoxShapeKey(p_boxShape->getHalfExtents()));
+    if (entryIterator == m_boxShapeEntries.end() || entryIterator->second.p_shape != p_boxShape) {
+        LOG_THROWthis(util::PointerException, reinterpret_cast<void*>(p_boxShape), "Releasing a box shape which didn't come from this cache");
+    }
+
+    entryIterator->second.referenceCount--;
+    if (entryIterator->second.referenceCount > 0) {
+        LOG_TRACEthis("{} references remaining", entryIterator->second.referenceCount);
+        return;
+    }
+
+    LOG_TRACEthis("Last reference released. Destroying box shape");
+    m_physicsCommon.destroyBoxShape(p_boxShape);
+    m_boxShapeEntries.erase(entryIterator);
+}
+
+void
+quartz::physics::ShapeCache::releaseSphereShape(
+    reactphysics3d::SphereShape* p_sphereShape
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{}", reinterpret_cast<void*>(p_sphereShape));
+
+    const std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>>::iterator entryIterator = m_sphereShapeEntries.find(quartz::physics::ShapeCache::getSphereShapeKey(p_sphereShape->getRadius()));
+    if (entryIterator == m_sphereShapeEntries.end() || entryIterator->second.p_shape != p_sphereShape) {
+        LOG_THROWthis(util::PointerException, reinterpret_cast<void*>(p_sphereShape), "Releasing a sphere shape which didn't come from this cache");
+    }
+
+    entryIterator->second.referenceCount--;
+    if (entryIterator->second.referenceCount > 0) {
+        LOG_TRACEthis("{} references remaining", entryIterator->second.referenceCount);
+        return;
+    }
+
+    LOG_TRACEthis("Last reference released. Destroying sphere shape");
+    m_physicsCommon.destroySphereShape(p_sphereShape);
+    m_sphereShapeEntries.erase(entryIterator);
+}
+
+reactphysics3d::BoxShape*
+quartz::physics::ShapeCache::resizeBoxShape(
+    reactphysics3d::BoxShape* p_boxShape,
+    const math::Vec3& halfExtents_m
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{}", reinterpret_cast<void*>(p_boxShape));
+
+    const std::array<int64_t, 3> key = quartz::physics::ShapeCache::getBoxShapeKey(halfExtents_m);
+    const std::array<int64_t, 3> currentKey = quartz::physics::ShapeCache::getBoxShapeKey(p_boxShape->getHalfExtents());
+    if (key == currentKey) {
+        LOG_TRACEthis("Box shape already has these half extents");
+        return p_boxShape;
+    }
+
+    const std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>>::iterator entryIterator = m_boxShapeEntries.find(currentKey);
+    if (
+        entryIterator != m_boxShapeEntries.end() &&
+        entryIterator->second.p_shape == p_boxShape &&
+        entryIterator->second.referenceCount == 1 &&
+        !m_boxShapeEntries.contains(key)
+    ) {
+        LOG_TRACEthis("Nothing else is using this box shape. Resizing it in place");
+        p_boxShape->setHalfExtents(reactphysics3d::Vector3(std::abs(halfExtents_m.x), std::abs(halfExtents_m.y), std::abs(halfExtents_m.z)));
+
+        std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>>::node_type entryNode = m_boxShapeEntries.extract(entryIterator);
+        entryNode.key() = key;
+        m_boxShapeEntries.insert(std::move(entryNode));
+
+        return p_boxShape;
+    }
+
+    LOG_TRACEthis("Box shape is shared. Acquiring one with the new half extents instead");
+    return this->acquireBoxShape(halfExtents_m);
+}
+
+reactphysics3d::SphereShape*
+quartz::physics::ShapeCache::resizeSphereShape(
+    reactphysics3d::SphereShape* p_sphereShape,
+    const double radius_m
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{}", reinterpret_cast<void*>(p_sphereShape));
+
+    const int64_t key = quartz::physics::ShapeCache::getSphereShapeKey(radius_m);
+    const int64_t currentKey = quartz::physics::ShapeCache::getSphereShapeKey(p_sphereShape->getRadius());
+    if (key == currentKey) {
+        LOG_TRACEthis("Sphere shape already has this radius");
+        return p_sphereShape;
+    }
+
+    const std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>>::iterator entryIterator = m_sphereShapeEntries.find(currentKey);
+    if (
+        entryIterator != m_sphereShapeEntries.end() &&
+        entryIterator->second.p_shape == p_sphereShape &&
+        entryIterator->second.referenceCount == 1 &&
+        !m_sphereShapeEntries.contains(key)
+    ) {
+        LOG_TRACEthis("Nothing else is using this sphere shape. Resizing it in place");
+        p_sphereShape->setRadius(std::abs(radius_m));
+
+        std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>>::node_type entryNode = m_sphereShapeEntries.extract(entryIterator);
+        entryNode.key() = key;
+        m_sphereShapeEntries.insert(std::move(entryNode));
+
+        return p_sphereShape;
+    }
+
+    LOG_TRACEthis("Sphere shape is shared. Acquiring one with the new radius instead");
+    return this->acquireSphereShape(radius_m);
+}
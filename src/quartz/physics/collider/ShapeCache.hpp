@@ -0,0 +1,98 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <map>
+
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/collision/shapes/BoxShape.h>
+#include <reactphysics3d/collision/shapes/SphereShape.h>
+
+#include "math/transform/Vec3.hpp"
+
+#include "util/logger/Logger.hpp"
+
+#include "quartz/physics/Loggers.hpp"
+
+namespace quartz {
+
+namespace managers {
+    class PhysicsManager;
+}
+
+namespace physics {
+    class ShapeCache;
+}
+
+} // namespace quartz
+
+/**
+ * @brief Hands out one rp3d shape for every distinct set of shape parameters, so every collider with
+ *   the same box or sphere shares it instead of each allocating their own. Parameters are quantized
+ *   before they are compared, so extents which only differ by floating point noise still share.
+ *
+ * @brief Every acquire must be paired with a release. The shape is destroyed when its last reference
+ *   is released, which must only happen after the rp3d collider using it is removed from its body,
+ *   as rp3d won't destroy a shape that a collider is still attached to.
+ *
+ * @brief Shared shapes can't be resized in place without resizing every collider using them, so only
+ *   a shape with a single reference is resized in place. Anything else gets a different shape.
+ */
+class quartz::physics::ShapeCache {
+public: // member functions
+    ShapeCache(reactphysics3d::PhysicsCommon& physicsCommon);
+    ShapeCache(const ShapeCache& other) = delete;
+    ShapeCache& operator=(const ShapeCache& other) = delete;
+
+    USE_LOGGER(SHAPE_CACHE);
+
+    uint32_t getBoxShapeCount() const { return m_boxShapeEntries.size(); }
+    uint32_t getSphereShapeCount() const { return m_sphereShapeEntries.size(); }
+    uint32_t getReferenceCount(const reactphysics3d::BoxShape* p_boxShape) const;
+    uint32_t getReferenceCount(const reactphysics3d::SphereShape* p_sphereShape) const;
+
+    reactphysics3d::BoxShape* acquireBoxShape(const math::Vec3& halfExtents_m);
+    reactphysics3d::SphereShape* acquireSphereShape(const double radius_m);
+
+    void releaseBoxShape(reactphysics3d::BoxShape* p_boxShape);
+    void releaseSphereShape(reactphysics3d::SphereShape* p_sphereShape);
+
+    /**
+     * @brief Returns the given shape if it could be resized in place. Otherwise this acquires the
+     *   shape with the new parameters, and the caller releases the given shape once its rp3d collider
+     *   no longer uses it
+     */
+    reactphysics3d::BoxShape* resizeBoxShape(
+        reactphysics3d::BoxShape* p_boxShape,
+        const math::Vec3& halfExtents_m
+    );
+    reactphysics3d::SphereShape* resizeSphereShape(
+        reactphysics3d::SphereShape* p_sphereShape,
+        const double radius_m
+    );
+
+public: // static functions
+    /**
+     * @brief Quantizes the values rp3d will actually store, so a shape's key can be recalculated
+     *   from the shape itself
+     */
+    static std::array<int64_t, 3> getBoxShapeKey(const math::Vec3& halfExtents_m);
+    static int64_t getSphereShapeKey(const double radius_m);
+
+public: // static variables
+    static constexpr double quantum_m = 1.0e-5;
+
+private: // classes
+    template <typename ShapeType>
+    struct Entry {
+    public: // member variables
+        ShapeType* p_shape;
+        uint32_t referenceCount;
+    };
+
+private: // member variables
+    reactphysics3d::PhysicsCommon& m_physicsCommon;
+
+    std::map<std::array<int64_t, 3>, quartz::physics::ShapeCache::Entry<reactphysics3d::BoxShape>> m_boxShapeEntries;
+    std::map<int64_t, quartz::physics::ShapeCache::Entry<reactphysics3d::SphereShape>> m_sphereShapeEntries;
+};
@@ -31,10 +31,3 @@ double
 quartz::physics::SphereShape::getRadius_m() const {
     return mp_colliderShape->getRadius();
 }
-
-void
-quartz::physics::SphereShape::setRadius_m(
-    const double radius_m
-) {
-    mp_colliderShape->setRadius(std::abs(radius_m));
-}
@@ -0,0 +1,244 @@
+#include <reactphysics3d/collision/Collider.h>
+#include <reactphysics3d/collision/CollisionCallback.h>
+#include <reactphysics3d/collision/OverlapCallback.h>
+#include <reactphysics3d/mathematics/Transform.h>
+
+#include "util/logger/Logger.hpp"
+
+#include "quartz/physics/collider/Collider.hpp"
+#include "quartz/physics/field/CollisionEventStream.hpp"
+
+quartz::physics::CollisionEventStream::CollisionEventStream() :
+    m_events(),
+    m_contactPoints(),
+    m_forgottenColliders(),
+    m_subscriptions(),
+    m_freeSubscriptionIndices(),
+    m_isDispatching(false),
+    m_pendingSubscriptions(),
+    m_pendingUnsubscriptionIndices()
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+std::span<const quartz::physics::Collider::ContactPoint>
+quartz::physics::CollisionEventStream::getContactPoints(
+    const quartz::physics::CollisionEventStream::Event& event
+) const {
+    return std::span<const quartz::physics::Collider::ContactPoint>(m_contactPoints).subspan(event.firstContactPointIndex, event.contactPointCount);
+}
+
+quartz::physics::Collider*
+quartz::physics::CollisionEventStream::getCollider(
+    const reactphysics3d::Collider* p_rp3dCollider
+) const {
+    // A forgotten collider's memory may already be gone, so it must not be read
+    if (m_forgottenColliders.contains(p_rp3dCollider)) {
+        return nullptr;
+    }
+
+    return static_cast<quartz::physics::Collider*>(p_rp3dCollider->getUserData());
+}
+
+void
+quartz::physics::CollisionEventStream::onContact(
+    const reactphysics3d::CollisionCallback::CallbackData& callbackData
+) {
+    for (uint32_t contactPairIndex = 0; contactPairIndex < callbackData.getNbContactPairs(); contactPairIndex++) {
+        const reactphysics3d::CollisionCallback::ContactPair& currentContactPair = callbackData.getContactPair(contactPairIndex);
+        reactphysics3d::Collider* p_collider1 = currentContactPair.getCollider1();
+
+        const uint32_t firstContactPointIndex = m_contactPoints.size();
+        const reactphysics3d::Transform& collider1LocalToWorldTransform = p_collider1->getLocalToWorldTransform();
+        for (uint32_t contactPointIndex = 0; contactPointIndex < currentContactPair.getNbContactPoints(); contactPointIndex++) {
+            const reactphysics3d::CollisionCallback::ContactPoint& currentContactPoint = currentContactPair.getContactPoint(contactPointIndex);
+            m_contactPoints.push_back({
+                collider1LocalToWorldTransform * currentContactPoint.getLocalPointOnCollider1(),
+                currentContactPoint.getWorldNormal(),
+                currentContactPoint.getPenetrationDepth()
+            });
+        }
+
+        m_events.push_back({
+            p_collider1,
+            currentContactPair.getCollider2(),
+            quartz::physics::Collider::getCollisionType(currentContactPair.getEventType()),
+            false,
+            firstContactPointIndex,
+            static_cast<uint32_t>(m_contactPoints.size() - firstContactPointIndex)
+        });
+    }
+}
+
+void
+quartz::physics::CollisionEventStream::onTrigger(
+    const reactphysics3d::OverlapCallback::CallbackData& callbackData
+) {
+    for (uint32_t overlappingPairIndex = 0; overlappingPairIndex < callbackData.getNbOverlappingPairs(); overlappingPairIndex++) {
+        const reactphysics3d::OverlapCallback::OverlapPair& currentOverlapPair = callbackData.getOverlappingPair(overlappingPairIndex);
+
+        m_events.push_back({
+            currentOverlapPair.getCollider1(),
+            currentOverlapPair.getCollider2(),
+            quartz::physics::Collider::getCollisionType(currentOverlapPair.getEventType()),
+            true,
+            static_cast<uint32_t>(m_contactPoints.size()),
+            0
+        });
+    }
+}
+
+uint32_t
+quartz::physics::CollisionEventStream::subscribe(
+    const quartz::physics::Collider::Parameters& colliderParameters
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    if (
+        !colliderParameters.collisionStartCallback &&
+        !colliderParameters.collisionStayCallback &&
+        !colliderParameters.collisionEndCallback
+    ) {
+        LOG_TRACEthis("No callbacks provided. Not subscribing");
+        return quartz::physics::Collider::noSubscriptionIndex;
+    }
+
+    quartz::physics::CollisionEventStream::Subscription subscription = {
+        colliderParameters.collisionStartCallback,
+        colliderParameters.collisionStayCallback,
+        colliderParameters.collisionEndCallback
+    };
+
+    if (m_freeSubscriptionIndices.empty() && m_isDispatching) {
+        LOG_TRACEthis("Dispatching. Appending subscription at index {} once the dispatch is over", m_subscriptions.size() + m_pendingSubscriptions.size());
+        m_pendingSubscriptions.push_back(std::move(subscription));
+        return m_subscriptions.size() + m_pendingSubscriptions.size() - 1;
+    }
+
+    if (m_freeSubscriptionIndices.empty()) {
+        LOG_TRACEthis("Appending subscription at index {}", m_subscriptions.size());
+        m_subscriptions.push_back(std::move(subscription));
+        return m_subscriptions.size() - 1;
+    }
+
+    const uint32_t subscriptionIndex = m_freeSubscriptionIndices.back();
+    m_freeSubscriptionIndices.pop_back();
+    LOG_TRACEthis("Reusing subscription at index {}", subscriptionIndex);
+    m_subscriptions[subscriptionIndex] = std::move(subscription);
+
+    return subscriptionIndex;
+}
+
+void
+quartz::physics::CollisionEventStream::unsubscribe(
+    const uint32_t subscriptionIndex
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{}", subscriptionIndex);
+
+    if (subscriptionIndex == quartz::physics::Collider::noSubscriptionIndex) {
+        return;
+    }
+
+    if (m_isDispatching) {
+        LOG_TRACEthis("Dispatching. Freeing subscription once the dispatch is over");
+        m_pendingUnsubscriptionIndices.push_back(subscriptionIndex);
+        return;
+    }
+
+    m_subscriptions[subscriptionIndex] = {};
+    m_freeSubscriptionIndices.push_back(subscriptionIndex);
+}
+
+void
+quartz::physics::CollisionEventStream::reserveSubscriptions(
+    const uint32_t subscriptionCount
+) {
+    // Growing the storage would move the callback that is running
+    if (m_isDispatching) {
+        return;
+    }
+
+    const uint32_t reusableSubscriptionCount = m_freeSubscriptionIndices.size();
+    if (subscriptionCount <= reusableSubscriptionCount) {
+        return;
+    }
+
+    m_subscriptions.reserve(m_subscriptions.size() + subscriptionCount - reusableSubscriptionCount);
+}
+
+void
+quartz::physics::CollisionEventStream::clear() {
+    m_events.clear();
+    m_contactPoints.clear();
+    m_forgottenColliders.clear();
+}
+
+void
+quartz::physics::CollisionEventStream::dispatch() {
+    m_isDispatching = true;
+
+    for (const quartz::physics::CollisionEventStream::Event& event : m_events) {
+        quartz::physics::Collider* p_collider1 = this->getCollider(event.p_rp3dCollider1);
+        quartz::physics::Collider* p_collider2 = this->getCollider(event.p_rp3dCollider2);
+        if (!p_collider1 || !p_collider2) {
+            continue;
+        }
+
+        if (p_collider1->m_subscriptionIndex != quartz::physics::Collider::noSubscriptionIndex) {
+            this->dispatchToCollider(*p_collider1, *p_collider2, true, event);
+
+            // The callback may have moved or destroyed either of them
+            p_collider1 = this->getCollider(event.p_rp3dCollider1);
+            p_collider2 = this->getCollider(event.p_rp3dCollider2);
+            if (!p_collider1 || !p_collider2) {
+                continue;
+            }
+        }
+
+        if (p_collider2->m_subscriptionIndex != quartz::physics::Collider::noSubscriptionIndex) {
+            this->dispatchToCollider(*p_collider2, *p_collider1, false, event);
+        }
+    }
+
+    m_isDispatching = false;
+
+    for (quartz::physics::CollisionEventStream::Subscription& subscription : m_pendingSubscriptions) {
+        m_subscriptions.push_back(std::move(subscription));
+    }
+    m_pendingSubscriptions.clear();
+
+    for (const uint32_t subscriptionIndex : m_pendingUnsubscriptionIndices) {
+        m_subscriptions[subscriptionIndex] = {};
+        m_freeSubscriptionIndices.push_back(subscriptionIndex);
+    }
+    m_pendingUnsubscriptionIndices.clear();
+}
+
+void
+quartz::physics::CollisionEventStream::dispatchToCollider(
+    quartz::physics::Collider& collider,
+    quartz::physics::Collider& otherCollider,
+    const bool isFirstCollider,
+    const quartz::physics::CollisionEventStream::Event& event
+) {
+    const quartz::physics::CollisionEventStream::Subscription& subscription = m_subscriptions[collider.m_subscriptionIndex];
+
+    const quartz::physics::Collider::CollisionCallback* p_callback = nullptr;
+    switch (event.collisionType) {
+        case quartz::physics::Collider::CollisionType::ContactStart:
+            p_callback = &subscription.collisionStartCallback;
+            break;
+        case quartz::physics::Collider::CollisionType::ContactStay:
+            p_callback = &subscription.collisionStayCallback;
+            break;
+        case quartz::physics::Collider::CollisionType::ContactEnd:
+            p_callback = &subscription.collisionEndCallback;
+            break;
+    }
+
+    if (!*p_callback) {
+        return;
+    }
+
+    (*p_callback)({&collider, &otherCollider, isFirstCollider, this->getContactPoints(event)});
+}
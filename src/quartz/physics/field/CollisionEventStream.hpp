@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <unordered_set>
+#include <vector>
+
+#include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/engine/EventListener.h>
+
+#include "util/logger/Logger.hpp"
+
+#include "quartz/physics/Loggers.hpp"
+#include "quartz/physics/collider/Collider.hpp"
+
+namespace quartz {
+
+namespace managers {
+    class PhysicsManager;
+}
+
+namespace physics {
+    class CollisionEventStream;
+    class Field;
+}
+
+} // namespace quartz
+
+/**
+ * @brief Every contact and trigger event rp3d reports while its world is stepping is written into
+ *   contiguous buffers here instead of being handed to anyone right away. Once the step is over the
+ *   field dispatches the whole tick's events in one pass, and only to the colliders that subscribed
+ *   with callbacks. The buffers are cleared at the start of the next tick but keep their capacity,
+ *   so a steady stream of contacts doesn't allocate.
+ *
+ * @brief Events hold rp3d colliders rather than ours, because callbacks may move or destroy rigid
+ *   bodies (and the colliders in them) partway through a dispatch. Each one is resolved through its
+ *   rp3d user data right before it is used, and events with a collider that has been destroyed (or
+ *   replaced by a rescale) since they were recorded are skipped.
+ *
+ * @brief Subscribing and unsubscribing from inside a callback is fine. Neither takes effect on the
+ *   subscription storage until the dispatch is over, so the callback being run is never moved or
+ *   destroyed out from under itself.
+ */
+class quartz::physics::CollisionEventStream : public reactphysics3d::EventListener {
+public: // classes
+    struct Event {
+    public: // member variables
+        const reactphysics3d::Collider* p_rp3dCollider1;
+        const reactphysics3d::Collider* p_rp3dCollider2;
+        quartz::physics::Collider::CollisionType collisionType;
+        bool isTrigger;
+        uint32_t firstContactPointIndex;
+        uint32_t contactPointCount;
+    };
+
+public: // member functions
+    CollisionEventStream();
+    CollisionEventStream(const CollisionEventStream& other) = delete;
+    CollisionEventStream& operator=(const CollisionEventStream& other) = delete;
+
+    USE_LOGGER(COLLISION_EVENT_STREAM);
+
+    const std::vector<quartz::physics::CollisionEventStream::Event>& getEvents() const { return m_events; }
+    std::span<const quartz::physics::Collider::ContactPoint> getContactPoints(const quartz::physics::CollisionEventStream::Event& event) const;
+    uint32_t getSubscriptionCount() const { return m_subscriptions.size() + m_pendingSubscriptions.size() - m_freeSubscriptionIndices.size() - m_pendingUnsubscriptionIndices.size(); }
+    uint32_t getSubscriptionSlotCount() const { return m_subscriptions.size() + m_pendingSubscriptions.size(); }
+
+    /**
+     * @brief Null if the rp3d collider has been destroyed since this tick's events were recorded
+     */
+    quartz::physics::Collider* getCollider(const reactphysics3d::Collider* p_rp3dCollider) const;
+
+    /**
+     * @brief Called by rp3d while the world is stepping, so these only record the events
+     */
+    void onContact(const reactphysics3d::CollisionCallback::CallbackData& callbackData) override;
+    void onTrigger(const reactphysics3d::OverlapCallback::CallbackData& callbackData) override;
+
+private: // classes
+    struct Subscription {
+    public: // member variables
+        quartz::physics::Collider::CollisionCallback collisionStartCallback;
+        quartz::physics::Collider::CollisionCallback collisionStayCallback;
+        quartz::physics::Collider::CollisionCallback collisionEndCallback;
+    };
+
+private: // member functions
+    /**
+     * @brief Returns Collider::noSubscriptionIndex if none of the callbacks are set, so colliders
+     *   nobody is listening to never show up in the dispatch
+     */
+    uint32_t subscribe(const quartz::physics::Collider::Parameters& colliderParameters);
+    void unsubscribe(const uint32_t subscriptionIndex);
+    void reserveSubscriptions(const uint32_t subscriptionCount);
+
+    /**
+     * @brief Called right before an rp3d collider is destroyed, so events still referencing it don't
+     *   read it after it is gone. Defined here so colliders replacing their own rp3d collider can call
+     *   it without linking against the field library
+     */
+    void forgetCollider(const reactphysics3d::Collider* p_rp3dCollider) {
+        // Nothing can be referencing it if there aren't any events
+        if (m_events.empty()) {
+            return;
+        }
+
+        m_forgottenColliders.insert(p_rp3dCollider);
+    }
+
+    void clear();
+    void dispatch();
+    void dispatchToCollider(
+        quartz::physics::Collider& collider,
+        quartz::physics::Collider& otherCollider,
+        const bool isFirstCollider,
+        const quartz::physics::CollisionEventStream::Event& event
+    );
+
+private: // member variables
+    std::vector<quartz::physics::CollisionEventStream::Event> m_events;
+    std::vector<quartz::physics::Collider::ContactPoint> m_contactPoints;
+
+    /**
+     * @brief A set because dispatch looks up every event's colliders in here, and a callback may forget
+     *   a great many at once, such as when a burst of debris is destroyed
+     */
+    std::unordered_set<const reactphysics3d::Collider*> m_forgottenColliders;
+
+    std::vector<quartz::physics::CollisionEventStream::Subscription> m_subscriptions;
+    std::vector<uint32_t> m_freeSubscriptionIndices;
+
+    bool m_isDispatching;
+    std::vector<quartz::physics::CollisionEventStream::Subscription> m_pendingSubscriptions;
+    std::vector<uint32_t> m_pendingUnsubscriptionIndices;
+
+private: // friends
+    friend class quartz::managers::PhysicsManager;
+    friend class quartz::physics::Collider;
+    friend class quartz::physics::Field;
+};
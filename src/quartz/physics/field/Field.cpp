@@ -1,19 +1,33 @@
+#include <memory>
+
+#include <reactphysics3d/engine/PhysicsCommon.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 
 #include "util/logger/Logger.hpp"
 
+#include "quartz/physics/collider/ShapeCache.hpp"
+#include "quartz/physics/field/CollisionEventStream.hpp"
 #include "quartz/physics/field/Field.hpp"
 
 quartz::physics::Field::Field(
-    reactphysics3d::PhysicsWorld* p_physicsWorld
+    const reactphysics3d::PhysicsWorld::WorldSettings& physicsWorldSettings
 ) :
-    mp_physicsWorld(p_physicsWorld)
-{}
+    mp_physicsCommon(std::make_unique<reactphysics3d::PhysicsCommon>()),
+    mp_shapeCache(std::make_unique<quartz::physics::ShapeCache>(*mp_physicsCommon)),
+    mp_physicsWorld(mp_physicsCommon->createPhysicsWorld(physicsWorldSettings)),
+    mp_collisionEventStream(std::make_unique<quartz::physics::CollisionEventStream>())
+{
+    LOG_FUNCTION_CALL_TRACEthis("rp3d physics world pointer: {}", reinterpret_cast<void*>(mp_physicsWorld));
+    mp_physicsWorld->setEventListener(mp_collisionEventStream.get());
+}
 
 quartz::physics::Field::Field(
     quartz::physics::Field&& other
 ) :
-    mp_physicsWorld(std::move(other.mp_physicsWorld))
+    mp_physicsCommon(std::move(other.mp_physicsCommon)),
+    mp_shapeCache(std::move(other.mp_shapeCache)),
+    mp_physicsWorld(std::move(other.mp_physicsWorld)),
+    mp_collisionEventStream(std::move(other.mp_collisionEventStream))
 {}
 
 quartz::physics::Field::~Field() {
@@ -24,6 +38,21 @@ void
 quartz::physics::Field::fixedUpdate(
     const double tickTimeDelta
 ) {
+    this->step(tickTimeDelta);
+    this->dispatch();
+}
+
+void
+quartz::physics::Field::step(
+    const double tickTimeDelta
+) {
+    mp_collisionEventStream->clear();
+
     mp_physicsWorld->update(tickTimeDelta);
 }
 
+void
+quartz::physics::Field::dispatch() {
+    mp_collisionEventStream->dispatch();
+}
+
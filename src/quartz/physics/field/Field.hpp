@@ -1,6 +1,9 @@
 #pragma once
 
+#include <memory>
+
 #include <reactphysics3d/reactphysics3d.h>
+#include <reactphysics3d/engine/PhysicsCommon.h>
 #include <reactphysics3d/engine/PhysicsWorld.h>
 
 #include "math/transform/Vec3.hpp"
@@ -8,6 +11,8 @@
 #include "util/logger/Logger.hpp"
 
 #include "quartz/physics/Loggers.hpp"
+#include "quartz/physics/collider/ShapeCache.hpp"
+#include "quartz/physics/field/CollisionEventStream.hpp"
 
 namespace quartz {
 
@@ -17,10 +22,17 @@ namespace managers {
 
 namespace physics {
     class Field;
+    class FieldScheduler;
 }
 
 } // namespace quartz
 
+/**
+ * @brief Every field owns everything its world touches while stepping: its own rp3d physics common
+ *   (and with it, its own allocators), its own shapes, and its own collision event stream. rp3d's
+ *   allocators aren't thread safe, so this is what lets separate fields be stepped on separate
+ *   threads, which the field scheduler does.
+ */
 class quartz::physics::Field {
 public: // classes
     struct Parameters {
@@ -47,20 +59,46 @@ public: // member functions
      */
     reactphysics3d::PhysicsWorld* getRP3DPhysicsWorldPtr() { return mp_physicsWorld; }
 
+    /**
+     * @brief The events from the most recent fixed update, which have already been dispatched
+     */
+    const quartz::physics::CollisionEventStream& getCollisionEventStream() const { return *mp_collisionEventStream; }
+
+    /**
+     * @brief Steps the world, collecting its contact and trigger events as it goes, and then
+     *   dispatches all of them to their subscribers at once
+     */
     void fixedUpdate(const double tickTimeDelta);
 
 private: // member functions
-    Field(reactphysics3d::PhysicsWorld* p_physicsWorld); // Private so we are forced to use the physics manager
+    Field(const reactphysics3d::PhysicsWorld::WorldSettings& physicsWorldSettings); // Private so we are forced to use the physics manager
+
+    /**
+     * @brief The halves of a fixed update, so the scheduler can step fields concurrently and still
+     *   dispatch their events one field at a time on its own thread. Stepping doesn't log
+     */
+    void step(const double tickTimeDelta);
+    void dispatch();
 
 private: // member variables
     /**
-     * @todo 2024/11/09 DESTROY THIS PHYSICS WORLD VIA THE PHYSICS COMMON OBJECT WHEN WE ARE DONE WITH IT
-     *
-     * @todo 2024/11/09 Use a smart pointer similar to how we create the glfw window, custom deallocator
+     * @brief Behind pointers because the shape cache and colliders hold onto the physics common and
+     *   shape cache's addresses, which need to stay put when the field is moved. Destroying the
+     *   physics common destroys the world and any shapes still in it
      */
+    std::unique_ptr<reactphysics3d::PhysicsCommon> mp_physicsCommon;
+    std::unique_ptr<quartz::physics::ShapeCache> mp_shapeCache;
+
     reactphysics3d::PhysicsWorld* mp_physicsWorld;
 
+    /**
+     * @brief rp3d holds onto the address of its event listener, so this needs to stay put when the
+     *   field is moved
+     */
+    std::unique_ptr<quartz::physics::CollisionEventStream> mp_collisionEventStream;
+
 private: // friends
     friend class quartz::managers::PhysicsManager;
+    friend class quartz::physics::FieldScheduler;
 };
 
@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <future>
+#include <vector>
+
+#include "util/logger/Logger.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+
+#include "quartz/physics/field/Field.hpp"
+#include "quartz/physics/field/FieldScheduler.hpp"
+
+void
+quartz::physics::FieldScheduler::stepFields(
+    const std::span<quartz::physics::Field* const> fieldPtrs,
+    const double tickTimeDelta
+) {
+    for (quartz::physics::Field* p_field : fieldPtrs) {
+        p_field->step(tickTimeDelta);
+    }
+}
+
+quartz::physics::FieldScheduler::FieldScheduler(
+    util::ThreadPool& threadPool
+) :
+    m_threadPool(threadPool)
+{
+    LOG_FUNCTION_CALL_TRACEthis("{} threads", m_threadPool.getThreadCount());
+}
+
+uint32_t
+quartz::physics::FieldScheduler::getGroupCount(
+    const uint32_t fieldCount
+) const {
+    return std::min(fieldCount, m_threadPool.getThreadCount());
+}
+
+void
+quartz::physics::FieldScheduler::fixedUpdate(
+    const std::span<quartz::physics::Field* const> fieldPtrs,
+    const double tickTimeDelta
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} fields", fieldPtrs.size());
+
+    const uint32_t groupCount = this->getGroupCount(fieldPtrs.size());
+
+    if (groupCount <= 1) {
+        LOG_TRACEthis("Stepping every field on this thread");
+        quartz::physics::FieldScheduler::stepFields(fieldPtrs, tickTimeDelta);
+    } else {
+        const uint32_t groupFieldCount = (fieldPtrs.size() + groupCount - 1) / groupCount;
+        std::vector<std::future<void>> groupFutures;
+        groupFutures.reserve(groupCount);
+
+        for (uint32_t firstField = 0; firstField < fieldPtrs.size(); firstField += groupFieldCount) {
+            const std::span<quartz::physics::Field* const> groupFieldPtrs = fieldPtrs.subspan(firstField, std::min<size_t>(groupFieldCount, fieldPtrs.size() - firstField));
+            groupFutures.push_back(
+                m_threadPool.submit(
+                    [=]() {
+                        quartz::physics::FieldScheduler::stepFields(groupFieldPtrs, tickTimeDelta);
+                    }
+                )
+            );
+        }
+        LOG_TRACEthis("Stepping fields in {} groups of up to {}", groupFutures.size(), groupFieldCount);
+
+        // Every group has to be done with the fields before an exception from any of them leaves here
+        for (std::future<void>& groupFuture : groupFutures) {
+            groupFuture.wait();
+        }
+        for (std::future<void>& groupFuture : groupFutures) {
+            groupFuture.get();
+        }
+    }
+
+    LOG_TRACEthis("Dispatching every field's collision events");
+    for (quartz::physics::Field* p_field : fieldPtrs) {
+        p_field->dispatch();
+    }
+}
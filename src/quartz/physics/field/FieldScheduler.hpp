@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "util/logger/Logger.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+
+#include "quartz/physics/Loggers.hpp"
+#include "quartz/physics/field/Field.hpp"
+
+namespace quartz {
+namespace physics {
+    class FieldScheduler;
+}
+}
+
+/**
+ * @brief Steps many independent fields at once, for running batches of headless simulations. The
+ *   fields are split into contiguous groups, one for each of the pool's threads, and each group is
+ *   stepped on a worker. Fields share nothing while stepping, so no locking is needed.
+ *
+ * @brief Once every field has been stepped, their collision events are dispatched one field at a
+ *   time, in the order they were given, on the thread calling fixedUpdate. Callbacks never run
+ *   concurrently and see the same order they would if every field were updated on its own.
+ *
+ * @brief A field must only appear once per call, and must not be touched by anything else while
+ *   the call is running.
+ */
+class quartz::physics::FieldScheduler {
+public: // member functions
+    FieldScheduler(util::ThreadPool& threadPool);
+    FieldScheduler(const FieldScheduler& other) = delete;
+    FieldScheduler& operator=(const FieldScheduler& other) = delete;
+
+    USE_LOGGER(FIELD_SCHEDULER);
+
+    uint32_t getGroupCount(const uint32_t fieldCount) const;
+
+    void fixedUpdate(
+        const std::span<quartz::physics::Field* const> fieldPtrs,
+        const double tickTimeDelta
+    );
+
+private: // static functions
+    static void stepFields(
+        const std::span<quartz::physics::Field* const> fieldPtrs,
+        const double tickTimeDelta
+    );
+
+private: // member variables
+    util::ThreadPool& m_threadPool;
+};
@@ -9,8 +9,6 @@
 
 #include "quartz/physics/rigid_body/RigidBody.hpp"
 
-std::map<reactphysics3d::RigidBody*, quartz::physics::RigidBody*> quartz::physics::RigidBody::rigidBodyMap;
-
 quartz::physics::RigidBody::BodyType
 quartz::physics::RigidBody::getBodyType(
     reactphysics3d::BodyType bodyType
@@ -75,8 +73,8 @@ quartz::physics::RigidBody::RigidBody(
     mp_rigidBody(p_rigidBody)
 {
     LOG_FUNCTION_SCOPE_TRACEthis("");
-    LOG_TRACEthis("Constructing RigidBody. Setting rigid body map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
-    quartz::physics::RigidBody::rigidBodyMap[mp_rigidBody] = this;
+    LOG_TRACEthis("Constructing RigidBody. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
+    mp_rigidBody->setUserData(this);
 }
 
 quartz::physics::RigidBody::RigidBody(
@@ -86,8 +84,13 @@ quartz::physics::RigidBody::RigidBody(
     mp_rigidBody(std::move(other.mp_rigidBody))
 {
     LOG_FUNCTION_SCOPE_TRACEthis("");
-    LOG_TRACEthis("Move-constructing RigidBody. Setting rigid body map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
-    quartz::physics::RigidBody::rigidBodyMap[mp_rigidBody] = this;
+    // There is no rp3d rigid body left to point back to us if the one we moved from was already destroyed
+    if (!mp_rigidBody) {
+        LOG_TRACEthis("No rp3d rigid body to point back to us");
+    } else {
+        LOG_TRACEthis("Move-constructing RigidBody. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
+        mp_rigidBody->setUserData(this);
+    }
 }
 
 quartz::physics::RigidBody&
@@ -103,8 +106,13 @@ quartz::physics::RigidBody::operator=(
     mo_collider = std::move(other.mo_collider);
     mp_rigidBody = std::move(other.mp_rigidBody);
 
-    LOG_TRACEthis("Moving RigidBody. Setting rigid body map rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
-    quartz::physics::RigidBody::rigidBodyMap[mp_rigidBody] = this;
+    // There is no rp3d rigid body left to point back to us if the one we moved from was already destroyed
+    if (!mp_rigidBody) {
+        LOG_TRACEthis("No rp3d rigid body to point back to us");
+    } else {
+        LOG_TRACEthis("Moving RigidBody. Setting user data of rp3d pointer at {} to point to quartz pointer at {}", reinterpret_cast<void*>(mp_rigidBody), reinterpret_cast<void*>(this));
+        mp_rigidBody->setUserData(this);
+    }
 
     return *this;
 }
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <map>
 #include <optional>
 
 #include <reactphysics3d/body/RigidBody.h>
@@ -83,7 +82,10 @@ public: // member functions
     void applyLocalForceToCenterOfMass_N(const math::Vec3& force_N);
 
 public: // static functions
-    static quartz::physics::RigidBody& getRigidBody(reactphysics3d::RigidBody* const p_rigidBody) { return *quartz::physics::RigidBody::rigidBodyMap.at(p_rigidBody); }
+    /**
+     * @brief Resolved through the rp3d body's user data, the same way Collider::getCollider is
+     */
+    static quartz::physics::RigidBody& getRigidBody(reactphysics3d::RigidBody* const p_rigidBody) { return *static_cast<quartz::physics::RigidBody*>(p_rigidBody->getUserData()); }
 
 private: // member functions
     RigidBody(
@@ -91,12 +93,6 @@ private: // member functions
         reactphysics3d::RigidBody* p_rigidBody
     );
 
-private: // static functions
-    static void eraseRigidBody(reactphysics3d::RigidBody* const p_rigidBody) { quartz::physics::RigidBody::rigidBodyMap.erase(p_rigidBody); }
-
-private: // static variables
-    static std::map<reactphysics3d::RigidBody*, quartz::physics::RigidBody*> rigidBodyMap;
-
 private: // member variables
     std::optional<quartz::physics::Collider> mo_collider;
 
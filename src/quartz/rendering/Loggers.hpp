@@ -3,9 +3,11 @@
 #include "util/logger/Logger.hpp"
 
 DECLARE_LOGGER(BUFFER, trace);
+DECLARE_LOGGER(BUFFER_ALLOCATOR, trace);
 DECLARE_LOGGER(BUFFER_MAPPED, trace);
 DECLARE_LOGGER(BUFFER_STAGED, trace);
 DECLARE_LOGGER(BUFFER_IMAGE, trace);
+DECLARE_LOGGER(BUFFER_UPLOAD, trace);
 DECLARE_LOGGER(CONTEXT, trace);
 DECLARE_LOGGER(CUBEMAP, trace);
 DECLARE_LOGGER(DEPTHBUFFER, trace);
@@ -14,25 +16,38 @@ DECLARE_LOGGER(IMAGE, trace);
 DECLARE_LOGGER(INSTANCE, trace);
 DECLARE_LOGGER(MATERIAL, trace);
 DECLARE_LOGGER(MODEL, trace);
+DECLARE_LOGGER(MODEL_CACHE, trace);
+DECLARE_LOGGER(MODEL_COOKED, trace);
+DECLARE_LOGGER(MODEL_GLB, trace);
 DECLARE_LOGGER(MODEL_MESH, trace);
 DECLARE_LOGGER(MODEL_NODE, trace);
 DECLARE_LOGGER(MODEL_PRIMITIVE, trace);
 DECLARE_LOGGER(MODEL_SCENE, trace);
 DECLARE_LOGGER(PIPELINE, trace);
 DECLARE_LOGGER(RENDERPASS, trace);
+DECLARE_LOGGER(RENDER_QUEUE, trace);
 DECLARE_LOGGER(SWAPCHAIN, trace);
 DECLARE_LOGGER(TEXTURE, trace);
+DECLARE_LOGGER(TEXTURE_COMPRESSION, trace);
+DECLARE_LOGGER(TEXTURE_COOKED, trace);
+DECLARE_LOGGER(TEXTURE_KTX2, trace);
+DECLARE_LOGGER(TEXTURE_LOADER, trace);
+DECLARE_LOGGER(TEXTURE_MIPS, trace);
+DECLARE_LOGGER(TEXTURE_SAMPLER, trace);
+DECLARE_LOGGER(TEXTURE_STREAMING, trace);
 DECLARE_LOGGER(VULKAN, trace);
 DECLARE_LOGGER(VULKANUTIL, trace);
 DECLARE_LOGGER(WINDOW, trace);
 
 DECLARE_LOGGER_GROUP(
         QUARTZ_RENDERING,
-        23,
+        36,
         BUFFER,
+        BUFFER_ALLOCATOR,
         BUFFER_MAPPED,
         BUFFER_STAGED,
         BUFFER_IMAGE,
+        BUFFER_UPLOAD,
         CONTEXT,
         CUBEMAP,
         DEPTHBUFFER,
@@ -41,14 +56,25 @@ DECLARE_LOGGER_GROUP(
         INSTANCE,
         MATERIAL,
         MODEL,
+        MODEL_CACHE,
+        MODEL_COOKED,
+        MODEL_GLB,
         MODEL_MESH,
         MODEL_PRIMITIVE,
         MODEL_NODE,
         MODEL_SCENE,
         PIPELINE,
         RENDERPASS,
+        RENDER_QUEUE,
         SWAPCHAIN,
         TEXTURE,
+        TEXTURE_COMPRESSION,
+        TEXTURE_COOKED,
+        TEXTURE_KTX2,
+        TEXTURE_LOADER,
+        TEXTURE_MIPS,
+        TEXTURE_SAMPLER,
+        TEXTURE_STREAMING,
         VULKAN,
         VULKANUTIL,
         WINDOW
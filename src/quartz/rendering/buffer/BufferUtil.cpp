@@ -105,13 +105,14 @@ quartz::rendering::BufferUtil::chooseMemoryTypeIndex(
 }
 
 
-vk::UniqueDeviceMemory
-quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemoryPtr(
+quartz::rendering::DeviceMemoryAllocation
+quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
     const vk::PhysicalDevice& physicalDevice,
     const vk::UniqueDevice& p_logicalDevice,
     UNUSED const uint32_t sizeBytes, /** @todo 2024/04/23 Do we need this parameter? Are we getting the size correctly from mem requirements? */
     const vk::UniqueBuffer& p_logicalBuffer,
-    const vk::MemoryPropertyFlags requiredMemoryProperties
+    const vk::MemoryPropertyFlags requiredMemoryProperties,
+    const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER, "{} bytes", sizeBytes);
 
@@ -123,46 +124,41 @@ quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemoryPtr(
         memoryRequirements
     );
 
-    vk::MemoryAllocateInfo memoryAllocateInfo(
-        memoryRequirements.size,
-        chosenMemoryTypeIndex
+    LOG_TRACE(BUFFER, "Attempting to allocate {} bytes of device memory", memoryRequirements.size);
+    quartz::rendering::DeviceMemoryAllocation physicalMemoryAllocation = quartz::rendering::DeviceMemoryAllocator::allocate(
+        physicalDevice,
+        p_logicalDevice,
+        memoryRequirements,
+        chosenMemoryTypeIndex,
+        quartz::rendering::DeviceMemoryAllocator::ResourceType::Buffer,
+        lifetime
     );
-
-    LOG_TRACE(BUFFER, "Attempting to allocate vk::DeviceMemory");
-    vk::UniqueDeviceMemory p_logicalBufferPhysicalMemory = p_logicalDevice->allocateMemoryUnique(memoryAllocateInfo);
-
-    if (!p_logicalBufferPhysicalMemory) {
-        LOG_THROW(BUFFER, util::RichException<vk::MemoryAllocateInfo>, memoryAllocateInfo, "Failed to allocated vk::DeviceMemory");
-    }
-    LOG_TRACE(BUFFER, "Successfully allocated vk::DeviceMemory instance at {}", static_cast<void*>(&(*p_logicalBufferPhysicalMemory)));
+    LOG_TRACE(BUFFER, "Successfully allocated device memory at offset {} of vk::DeviceMemory instance at {}", physicalMemoryAllocation.getOffset(), static_cast<const void*>(&(physicalMemoryAllocation.getVulkanDeviceMemory())));
 
     LOG_TRACE(BUFFER, "Binding memory to logical device");
     p_logicalDevice->bindBufferMemory(
         *p_logicalBuffer,
-        *p_logicalBufferPhysicalMemory,
-        0
+        physicalMemoryAllocation.getVulkanDeviceMemory(),
+        physicalMemoryAllocation.getOffset()
     );
 
-    return p_logicalBufferPhysicalMemory;
+    return physicalMemoryAllocation;
 }
 
 void
 quartz::rendering::BufferUtil::populateVulkanPhysicalDeviceMemoryWithLocalData(
-    const vk::UniqueDevice& p_logicalDevice,
     const uint32_t sizeBytes,
     const void* p_bufferData,
-    vk::UniqueDeviceMemory& p_physicalMemory
+    const quartz::rendering::DeviceMemoryAllocation& physicalMemoryAllocation
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER, "{} bytes", sizeBytes);
 
     LOG_TRACE(BUFFER, "Memory *IS* allocated for a source buffer. Populating device's buffer memory with input raw data");
 
-    LOG_TRACE(BUFFER, "  - Creating mapping for allocated device memory of size {}", sizeBytes);
-    void* p_mappedDestinationDeviceMemory = p_logicalDevice->mapMemory(
-        *p_physicalMemory,
-        0,
-        sizeBytes
-    );
+    void* p_mappedDestinationDeviceMemory = physicalMemoryAllocation.getMappedLocalMemoryPtr();
+    if (!p_mappedDestinationDeviceMemory) {
+        LOG_THROW(BUFFER, util::RichException<uint32_t>, sizeBytes, "Cannot populate device memory which is not host visible");
+    }
 
     LOG_TRACE(BUFFER, "  - Copying {} bytes to mapped device memory at {} from buffer at {}", sizeBytes, p_mappedDestinationDeviceMemory, p_bufferData);
     memcpy(
@@ -171,14 +167,11 @@ quartz::rendering::BufferUtil::populateVulkanPhysicalDeviceMemoryWithLocalData(
         sizeBytes
     );
 
-    LOG_TRACE(BUFFER, "  - Unmapping device memory");
-    p_logicalDevice->unmapMemory(*p_physicalMemory);
-
     LOG_TRACE(BUFFER, "Successfully copied input data to device buffer memory");
 }
 
-vk::UniqueDeviceMemory
-quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceStagingMemoryPtr(
+quartz::rendering::DeviceMemoryAllocation
+quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceStagingMemory(
     const vk::PhysicalDevice& physicalDevice,
     const vk::UniqueDevice& p_logicalDevice,
     const uint32_t sizeBytes,
@@ -188,42 +181,22 @@ quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceStagingMemoryPtr(
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER, "{} bytes", sizeBytes);
 
-    vk::UniqueDeviceMemory p_logicalBufferPhysicalMemory = quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemoryPtr(
+    quartz::rendering::DeviceMemoryAllocation physicalMemoryAllocation = quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
         physicalDevice,
         p_logicalDevice,
         sizeBytes,
         p_logicalBuffer,
-        requiredMemoryProperties
+        requiredMemoryProperties,
+        quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient
     );
 
     quartz::rendering::BufferUtil::populateVulkanPhysicalDeviceMemoryWithLocalData(
-        p_logicalDevice,
         sizeBytes,
         p_bufferData,
-        p_logicalBufferPhysicalMemory
+        physicalMemoryAllocation
     );
 
-    return p_logicalBufferPhysicalMemory;
-}
-
-void
-quartz::rendering::BufferUtil::submitVulkanCommandBufferPtr(
-    const vk::Queue& graphicsQueue,
-    const vk::UniqueCommandBuffer& p_commandBuffer
-) {
-    LOG_FUNCTION_SCOPE_TRACE(BUFFER, "");
-
-    vk::SubmitInfo submitInfo(
-        0,
-        nullptr,
-        nullptr,
-        1,
-        &(*p_commandBuffer),
-        0,
-        nullptr
-    );
-    graphicsQueue.submit(submitInfo, VK_NULL_HANDLE);
-    graphicsQueue.waitIdle();
+    return physicalMemoryAllocation;
 }
 
 vk::UniqueImage
@@ -232,6 +205,7 @@ quartz::rendering::ImageBufferUtil::createVulkanImagePtr(
     const uint32_t imageWidth,
     const uint32_t imageHeight,
     const uint32_t layerCount,
+    const uint32_t mipLevelCount,
     const vk::ImageUsageFlags usageFlags,
     const vk::ImageCreateFlags createFlags,
     const vk::Format format,
@@ -243,6 +217,8 @@ quartz::rendering::ImageBufferUtil::createVulkanImagePtr(
 
     LOG_TRACE(IMAGE, "Using {} array layers", layerCount);
 
+    LOG_TRACE(IMAGE, "Using {} mip levels", mipLevelCount);
+
     vk::ImageCreateInfo imageCreateInfo(
         createFlags,
         vk::ImageType::e2D,
@@ -252,7 +228,7 @@ quartz::rendering::ImageBufferUtil::createVulkanImagePtr(
             static_cast<uint32_t>(imageHeight),
             1
         },
-        1,
+        mipLevelCount,
         layerCount,
         vk::SampleCountFlagBits::e1,
         tiling,
@@ -268,7 +244,7 @@ quartz::rendering::ImageBufferUtil::createVulkanImagePtr(
     return p_vulkanImage;
 }
 
-vk::UniqueDeviceMemory
+quartz::rendering::DeviceMemoryAllocation
 quartz::rendering::ImageBufferUtil::allocateVulkanPhysicalDeviceImageMemory(
     const vk::PhysicalDevice& physicalDevice,
     const vk::UniqueDevice& p_logicalDevice,
@@ -285,22 +261,20 @@ quartz::rendering::ImageBufferUtil::allocateVulkanPhysicalDeviceImageMemory(
         memoryRequirements
     );
 
-    vk::MemoryAllocateInfo memoryAllocateInfo(
-        memoryRequirements.size,
-        chosenMemoryTypeIndex
+    quartz::rendering::DeviceMemoryAllocation imageMemoryAllocation = quartz::rendering::DeviceMemoryAllocator::allocate(
+        physicalDevice,
+        p_logicalDevice,
+        memoryRequirements,
+        chosenMemoryTypeIndex,
+        quartz::rendering::DeviceMemoryAllocator::ResourceType::Image,
+        quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent
     );
 
-    vk::UniqueDeviceMemory p_vulkanPhysicalDeviceImageMemory = p_logicalDevice->allocateMemoryUnique(memoryAllocateInfo);
-    if (!p_vulkanPhysicalDeviceImageMemory) {
-        LOG_THROW(IMAGE, util::RichException<vk::MemoryAllocateInfo>, memoryAllocateInfo, "Failed to create vk::DeviceMemory for vk::Image");
-    }
-
     p_logicalDevice->bindImageMemory(
         *p_image,
-        *p_vulkanPhysicalDeviceImageMemory,
-        0
+        imageMemoryAllocation.getVulkanDeviceMemory(),
+        imageMemoryAllocation.getOffset()
     );
 
-    return p_vulkanPhysicalDeviceImageMemory;
+    return imageMemoryAllocation;
 }
-
@@ -6,6 +6,7 @@
 #include <vulkan/vulkan.hpp>
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
 #include "quartz/rendering/device/Device.hpp"
 
 namespace quartz {
@@ -16,6 +17,7 @@ namespace rendering {
     class LocallyMappedBuffer;
     class StagedBuffer;
     class StagedImageBuffer;
+    class UploadBatch;
 }
 }
 
@@ -37,20 +39,20 @@ private: // static functions
         const vk::MemoryPropertyFlags requiredMemoryProperties,
         const vk::MemoryRequirements& memoryRequirements
     );
-    static vk::UniqueDeviceMemory allocateVulkanPhysicalDeviceMemoryPtr(
+    static quartz::rendering::DeviceMemoryAllocation allocateVulkanPhysicalDeviceMemory(
         const vk::PhysicalDevice& physicalDevice,
         const vk::UniqueDevice& p_logicalDevice,
         const uint32_t sizeBytes,
         const vk::UniqueBuffer& p_logicalBuffer,
-        const vk::MemoryPropertyFlags requiredMemoryProperties
+        const vk::MemoryPropertyFlags requiredMemoryProperties,
+        const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime
     );
     static void populateVulkanPhysicalDeviceMemoryWithLocalData(
-        const vk::UniqueDevice& p_logicalDevice,
         const uint32_t sizeBytes,
         const void* p_bufferData,
-        vk::UniqueDeviceMemory& p_logicalBufferPhysicalMemory
+        const quartz::rendering::DeviceMemoryAllocation& physicalMemoryAllocation
     );
-    static vk::UniqueDeviceMemory allocateVulkanPhysicalDeviceStagingMemoryPtr(
+    static quartz::rendering::DeviceMemoryAllocation allocateVulkanPhysicalDeviceStagingMemory(
         const vk::PhysicalDevice& physicalDevice,
         const vk::UniqueDevice& p_logicalDevice,
         const uint32_t sizeBytes,
@@ -59,19 +61,13 @@ private: // static functions
         const vk::MemoryPropertyFlags requiredMemoryProperties
     );
 
-    // ----- command buffer things ----- //
-
-    static void submitVulkanCommandBufferPtr(
-        const vk::Queue& graphicsQueue,
-        const vk::UniqueCommandBuffer& p_commandBuffer
-    );
-
 private: // friends
     friend class quartz::rendering::ImageBuffer;
     friend class quartz::rendering::ImageBufferUtil;
     friend class quartz::rendering::LocallyMappedBuffer;
     friend class quartz::rendering::StagedBuffer;
     friend class quartz::rendering::StagedImageBuffer;
+    friend class quartz::rendering::UploadBatch;
 };
 
 class quartz::rendering::ImageBufferUtil {
@@ -84,12 +80,13 @@ private: // static functions
         const uint32_t imageWidth,
         const uint32_t imageHeight,
         const uint32_t layerCount,
+        const uint32_t mipLevelCount,
         const vk::ImageUsageFlags usageFlags,
         const vk::ImageCreateFlags createFlags,
         const vk::Format format,
         const vk::ImageTiling tiling
     );
-    static vk::UniqueDeviceMemory allocateVulkanPhysicalDeviceImageMemory(
+    static quartz::rendering::DeviceMemoryAllocation allocateVulkanPhysicalDeviceImageMemory(
         const vk::PhysicalDevice& physicalDevice,
         const vk::UniqueDevice& p_logicalDevice,
         const vk::UniqueImage& p_image,
@@ -0,0 +1,495 @@
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+
+struct quartz::rendering::DeviceMemoryAllocation::Block {
+public: // member variables
+    vk::UniqueDeviceMemory p_vulkanDeviceMemory;
+    vk::DeviceSize sizeBytes;
+    void* p_mappedLocalMemory; // nullptr if this block is not host visible
+    vk::Device vulkanLogicalDevice; // memory from one device can't be handed out for another
+
+    uint32_t memoryTypeIndex;
+    quartz::rendering::DeviceMemoryAllocator::ResourceType resourceType;
+    quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime;
+    uint32_t sizeClassIndex; // dedicatedSizeClassIndex for dedicated and linear blocks
+
+    std::vector<uint32_t> freeSlotIndices; // only used by size class blocks
+    vk::DeviceSize linearOffsetBytes; // only used by linear blocks
+
+    uint32_t liveAllocationCount;
+};
+
+std::mutex quartz::rendering::DeviceMemoryAllocator::mutex;
+std::vector<std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>> quartz::rendering::DeviceMemoryAllocator::blockPtrs;
+quartz::rendering::DeviceMemoryAllocator::Statistics quartz::rendering::DeviceMemoryAllocator::statistics;
+
+// ----- DeviceMemoryAllocation ----- //
+
+quartz::rendering::DeviceMemoryAllocation::DeviceMemoryAllocation() :
+    mp_block(nullptr),
+    m_offset(0),
+    m_sizeBytes(0)
+{}
+
+quartz::rendering::DeviceMemoryAllocation::DeviceMemoryAllocation(
+    quartz::rendering::DeviceMemoryAllocation::Block* p_block,
+    const vk::DeviceSize offset,
+    const vk::DeviceSize sizeBytes
+) :
+    mp_block(p_block),
+    m_offset(offset),
+    m_sizeBytes(sizeBytes)
+{}
+
+quartz::rendering::DeviceMemoryAllocation::DeviceMemoryAllocation(
+    quartz::rendering::DeviceMemoryAllocation&& other
+) :
+    mp_block(other.mp_block),
+    m_offset(other.m_offset),
+    m_sizeBytes(other.m_sizeBytes)
+{
+    other.mp_block = nullptr;
+}
+
+quartz::rendering::DeviceMemoryAllocation::~DeviceMemoryAllocation() {
+    this->reset();
+}
+
+quartz::rendering::DeviceMemoryAllocation&
+quartz::rendering::DeviceMemoryAllocation::operator=(
+    quartz::rendering::DeviceMemoryAllocation&& other
+) {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->reset();
+
+    mp_block = other.mp_block;
+    m_offset = other.m_offset;
+    m_sizeBytes = other.m_sizeBytes;
+
+    other.mp_block = nullptr;
+
+    return *this;
+}
+
+const vk::DeviceMemory&
+quartz::rendering::DeviceMemoryAllocation::getVulkanDeviceMemory() const {
+    return *(mp_block->p_vulkanDeviceMemory);
+}
+
+void*
+quartz::rendering::DeviceMemoryAllocation::getMappedLocalMemoryPtr() const {
+    if (!mp_block || !mp_block->p_mappedLocalMemory) {
+        return nullptr;
+    }
+
+    return static_cast<uint8_t*>(mp_block->p_mappedLocalMemory) + m_offset;
+}
+
+void
+quartz::rendering::DeviceMemoryAllocation::reset() {
+    if (!mp_block) {
+        return;
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::free(mp_block, m_offset, m_sizeBytes);
+
+    mp_block = nullptr;
+    m_offset = 0;
+    m_sizeBytes = 0;
+}
+
+// ----- DeviceMemoryAllocator ----- //
+
+vk::DeviceSize
+quartz::rendering::DeviceMemoryAllocator::alignUp(
+    const vk::DeviceSize value,
+    const vk::DeviceSize alignment
+) {
+    if (alignment <= 1) {
+        return value;
+    }
+
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+uint32_t
+quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(
+    const vk::DeviceSize sizeBytes,
+    const vk::DeviceSize alignment
+) {
+    /**
+     * @brief Slots are placed at multiples of their class size, and every class size is a power of
+     *   two, so a class at least as large as the alignment gives us correctly aligned slots for free
+     */
+    const vk::DeviceSize requiredBytes = std::max({sizeBytes, alignment, quartz::rendering::DeviceMemoryAllocator::minimumSizeClassBytes});
+    const vk::DeviceSize classBytes = std::bit_ceil(requiredBytes);
+
+    const uint32_t sizeClassIndex = std::countr_zero(classBytes) - std::countr_zero(quartz::rendering::DeviceMemoryAllocator::minimumSizeClassBytes);
+
+    return std::min(sizeClassIndex, quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex);
+}
+
+vk::DeviceSize
+quartz::rendering::DeviceMemoryAllocator::getSizeClassBlockBytes(
+    const uint32_t sizeClassIndex
+) {
+    const vk::DeviceSize minimumBlockBytes = 1 * 1024 * 1024;
+    const vk::DeviceSize maximumBlockBytes = 64 * 1024 * 1024;
+
+    return std::clamp<vk::DeviceSize>(
+        quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(sizeClassIndex) * 64,
+        minimumBlockBytes,
+        maximumBlockBytes
+    );
+}
+
+quartz::rendering::DeviceMemoryAllocation::Block*
+quartz::rendering::DeviceMemoryAllocator::createBlock(
+    const vk::PhysicalDevice& physicalDevice,
+    const vk::UniqueDevice& p_logicalDevice,
+    const uint32_t memoryTypeIndex,
+    const quartz::rendering::DeviceMemoryAllocator::ResourceType resourceType,
+    const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime,
+    const uint32_t sizeClassIndex,
+    const vk::DeviceSize blockBytes
+) {
+    LOG_FUNCTION_SCOPE_TRACE(BUFFER_ALLOCATOR, "memory type {}, size class {}, {} bytes", memoryTypeIndex, sizeClassIndex, blockBytes);
+
+    vk::MemoryAllocateInfo memoryAllocateInfo(
+        blockBytes,
+        memoryTypeIndex
+    );
+
+    LOG_TRACE(BUFFER_ALLOCATOR, "Attempting to allocate vk::DeviceMemory block");
+    vk::UniqueDeviceMemory p_vulkanDeviceMemory = p_logicalDevice->allocateMemoryUnique(memoryAllocateInfo);
+    if (!p_vulkanDeviceMemory) {
+        LOG_THROW(BUFFER_ALLOCATOR, util::RichException<vk::MemoryAllocateInfo>, memoryAllocateInfo, "Failed to allocate vk::DeviceMemory block");
+    }
+    quartz::rendering::DeviceMemoryAllocator::statistics.vulkanAllocationCallCount++;
+
+    const vk::MemoryPropertyFlags memoryPropertyFlags = physicalDevice.getMemoryProperties().memoryTypes[memoryTypeIndex].propertyFlags;
+    const bool isHostVisible = static_cast<bool>(memoryPropertyFlags & vk::MemoryPropertyFlagBits::eHostVisible);
+
+    void* p_mappedLocalMemory = nullptr;
+    if (isHostVisible) {
+        p_mappedLocalMemory = p_logicalDevice->mapMemory(*p_vulkanDeviceMemory, 0, VK_WHOLE_SIZE);
+        LOG_TRACE(BUFFER_ALLOCATOR, "Mapped host visible block to {}", p_mappedLocalMemory);
+    }
+
+    std::vector<uint32_t> freeSlotIndices;
+    if (
+        lifetime == quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent &&
+        sizeClassIndex != quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex
+    ) {
+        const uint32_t slotCount = blockBytes / quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(sizeClassIndex);
+        freeSlotIndices.reserve(slotCount);
+
+        // Reversed so we hand out slots from the front of the block first
+        for (uint32_t i = slotCount; i > 0; --i) {
+            freeSlotIndices.push_back(i - 1);
+        }
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::blockPtrs.push_back(
+        std::make_unique<quartz::rendering::DeviceMemoryAllocation::Block>(
+            std::move(p_vulkanDeviceMemory),
+            blockBytes,
+            p_mappedLocalMemory,
+            *p_logicalDevice,
+            memoryTypeIndex,
+            resourceType,
+            lifetime,
+            sizeClassIndex,
+            std::move(freeSlotIndices),
+            0,
+            0
+        )
+    );
+
+    quartz::rendering::DeviceMemoryAllocator::statistics.blockCount++;
+    quartz::rendering::DeviceMemoryAllocator::statistics.blockBytes += blockBytes;
+    if (isHostVisible) {
+        quartz::rendering::DeviceMemoryAllocator::statistics.hostVisibleBlockBytes += blockBytes;
+        quartz::rendering::DeviceMemoryAllocator::statistics.peakHostVisibleBlockBytes = std::max(
+            quartz::rendering::DeviceMemoryAllocator::statistics.peakHostVisibleBlockBytes,
+            quartz::rendering::DeviceMemoryAllocator::statistics.hostVisibleBlockBytes
+        );
+    } else {
+        quartz::rendering::DeviceMemoryAllocator::statistics.deviceLocalBlockBytes += blockBytes;
+    }
+
+    return quartz::rendering::DeviceMemoryAllocator::blockPtrs.back().get();
+}
+
+quartz::rendering::DeviceMemoryAllocation
+quartz::rendering::DeviceMemoryAllocator::allocate(
+    const vk::PhysicalDevice& physicalDevice,
+    const vk::UniqueDevice& p_logicalDevice,
+    const vk::MemoryRequirements& memoryRequirements,
+    const uint32_t memoryTypeIndex,
+    const quartz::rendering::DeviceMemoryAllocator::ResourceType resourceType,
+    const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime
+) {
+    LOG_FUNCTION_SCOPE_TRACE(BUFFER_ALLOCATOR, "{} bytes aligned to {}, memory type {}", memoryRequirements.size, memoryRequirements.alignment, memoryTypeIndex);
+
+    std::lock_guard<std::mutex> lock(quartz::rendering::DeviceMemoryAllocator::mutex);
+
+    const uint32_t sizeClassIndex = quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(memoryRequirements.size, memoryRequirements.alignment);
+
+    // ----- Transient allocations are bumped out of a linear block ----- //
+
+    if (lifetime == quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient) {
+        quartz::rendering::DeviceMemoryAllocation::Block* p_chosenBlock = nullptr;
+        vk::DeviceSize offset = 0;
+
+        for (const std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>& p_block : quartz::rendering::DeviceMemoryAllocator::blockPtrs) {
+            if (
+                p_block->lifetime != lifetime ||
+                p_block->vulkanLogicalDevice != *p_logicalDevice ||
+                p_block->memoryTypeIndex != memoryTypeIndex ||
+                p_block->resourceType != resourceType
+            ) {
+                continue;
+            }
+
+            const vk::DeviceSize alignedOffset = quartz::rendering::DeviceMemoryAllocator::alignUp(p_block->linearOffsetBytes, memoryRequirements.alignment);
+            if (alignedOffset + memoryRequirements.size <= p_block->sizeBytes) {
+                p_chosenBlock = p_block.get();
+                offset = alignedOffset;
+                break;
+            }
+        }
+
+        if (!p_chosenBlock) {
+            p_chosenBlock = quartz::rendering::DeviceMemoryAllocator::createBlock(
+                physicalDevice,
+                p_logicalDevice,
+                memoryTypeIndex,
+                resourceType,
+                lifetime,
+                quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex,
+                std::max(quartz::rendering::DeviceMemoryAllocator::linearBlockBytes, memoryRequirements.size)
+            );
+            offset = 0;
+        }
+
+        const vk::DeviceSize allocatedBytes = offset + memoryRequirements.size - p_chosenBlock->linearOffsetBytes;
+        p_chosenBlock->linearOffsetBytes = offset + memoryRequirements.size;
+        p_chosenBlock->liveAllocationCount++;
+
+        quartz::rendering::DeviceMemoryAllocator::statistics.allocationCount++;
+        quartz::rendering::DeviceMemoryAllocator::statistics.allocatedBytes += allocatedBytes;
+
+        LOG_TRACE(BUFFER_ALLOCATOR, "Using transient range at offset {} of block {}", offset, static_cast<void*>(p_chosenBlock));
+        return quartz::rendering::DeviceMemoryAllocation(p_chosenBlock, offset, allocatedBytes);
+    }
+
+    // ----- Anything too large for a size class gets a block to itself ----- //
+
+    if (sizeClassIndex == quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex) {
+        quartz::rendering::DeviceMemoryAllocation::Block* p_block = quartz::rendering::DeviceMemoryAllocator::createBlock(
+            physicalDevice,
+            p_logicalDevice,
+            memoryTypeIndex,
+            resourceType,
+            lifetime,
+            sizeClassIndex,
+            memoryRequirements.size
+        );
+        p_block->liveAllocationCount++;
+
+        quartz::rendering::DeviceMemoryAllocator::statistics.dedicatedBlockCount++;
+        quartz::rendering::DeviceMemoryAllocator::statistics.allocationCount++;
+        quartz::rendering::DeviceMemoryAllocator::statistics.allocatedBytes += memoryRequirements.size;
+
+        LOG_TRACE(BUFFER_ALLOCATOR, "Using dedicated block {}", static_cast<void*>(p_block));
+        return quartz::rendering::DeviceMemoryAllocation(p_block, 0, memoryRequirements.size);
+    }
+
+    // ----- Everything else takes a slot from a size class block ----- //
+
+    quartz::rendering::DeviceMemoryAllocation::Block* p_chosenBlock = nullptr;
+
+    for (const std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>& p_block : quartz::rendering::DeviceMemoryAllocator::blockPtrs) {
+        if (
+            p_block->lifetime == lifetime &&
+            p_block->vulkanLogicalDevice == *p_logicalDevice &&
+            p_block->memoryTypeIndex == memoryTypeIndex &&
+            p_block->resourceType == resourceType &&
+            p_block->sizeClassIndex == sizeClassIndex &&
+            !p_block->freeSlotIndices.empty()
+        ) {
+            p_chosenBlock = p_block.get();
+            break;
+        }
+    }
+
+    if (!p_chosenBlock) {
+        p_chosenBlock = quartz::rendering::DeviceMemoryAllocator::createBlock(
+            physicalDevice,
+            p_logicalDevice,
+            memoryTypeIndex,
+            resourceType,
+            lifetime,
+            sizeClassIndex,
+            quartz::rendering::DeviceMemoryAllocator::getSizeClassBlockBytes(sizeClassIndex)
+        );
+    }
+
+    const uint32_t slotIndex = p_chosenBlock->freeSlotIndices.back();
+    p_chosenBlock->freeSlotIndices.pop_back();
+    p_chosenBlock->liveAllocationCount++;
+
+    const vk::DeviceSize classBytes = quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(sizeClassIndex);
+
+    quartz::rendering::DeviceMemoryAllocator::statistics.allocationCount++;
+    quartz::rendering::DeviceMemoryAllocator::statistics.allocatedBytes += classBytes;
+
+    LOG_TRACE(BUFFER_ALLOCATOR, "Using slot {} of size class {} ({} bytes) in block {}", slotIndex, sizeClassIndex, classBytes, static_cast<void*>(p_chosenBlock));
+    return quartz::rendering::DeviceMemoryAllocation(p_chosenBlock, slotIndex * classBytes, classBytes);
+}
+
+void
+quartz::rendering::DeviceMemoryAllocator::free(
+    quartz::rendering::DeviceMemoryAllocation::Block* p_block,
+    const vk::DeviceSize offset,
+    const vk::DeviceSize sizeBytes
+) {
+    std::lock_guard<std::mutex> lock(quartz::rendering::DeviceMemoryAllocator::mutex);
+
+    if (
+        p_block->lifetime == quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent &&
+        p_block->sizeClassIndex != quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex
+    ) {
+        p_block->freeSlotIndices.push_back(offset / quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(p_block->sizeClassIndex));
+    }
+
+    p_block->liveAllocationCount--;
+    quartz::rendering::DeviceMemoryAllocator::statistics.allocationCount--;
+    quartz::rendering::DeviceMemoryAllocator::statistics.allocatedBytes -= sizeBytes;
+
+    if (p_block->liveAllocationCount > 0) {
+        return;
+    }
+
+    if (p_block->lifetime == quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient) {
+        p_block->linearOffsetBytes = 0;
+
+        if (quartz::rendering::DeviceMemoryAllocator::shouldRetainEmptyTransientBlock(p_block)) {
+            LOG_TRACE(BUFFER_ALLOCATOR, "Keeping empty transient block {} of {} bytes for the next upload", static_cast<void*>(p_block), p_block->sizeBytes);
+            return;
+        }
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::releaseBlock(p_block);
+}
+
+bool
+quartz::rendering::DeviceMemoryAllocator::shouldRetainEmptyTransientBlock(
+    const quartz::rendering::DeviceMemoryAllocation::Block* p_block
+) {
+    // Blocks grown to fit one oversized allocation aren't worth holding on to
+    if (p_block->sizeBytes != quartz::rendering::DeviceMemoryAllocator::linearBlockBytes) {
+        return false;
+    }
+
+    return std::ranges::none_of(
+        quartz::rendering::DeviceMemoryAllocator::blockPtrs,
+        [p_block](const std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>& p_candidate) {
+            return
+                p_candidate.get() != p_block &&
+                p_candidate->liveAllocationCount == 0 &&
+                p_candidate->lifetime == p_block->lifetime &&
+                p_candidate->vulkanLogicalDevice == p_block->vulkanLogicalDevice &&
+                p_candidate->memoryTypeIndex == p_block->memoryTypeIndex &&
+                p_candidate->resourceType == p_block->resourceType;
+        }
+    );
+}
+
+void
+quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks() {
+    LOG_FUNCTION_SCOPE_TRACE(BUFFER_ALLOCATOR, "");
+
+    std::lock_guard<std::mutex> lock(quartz::rendering::DeviceMemoryAllocator::mutex);
+
+    std::vector<quartz::rendering::DeviceMemoryAllocation::Block*> emptyBlockPtrs;
+    for (const std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>& p_block : quartz::rendering::DeviceMemoryAllocator::blockPtrs) {
+        if (p_block->liveAllocationCount == 0) {
+            emptyBlockPtrs.push_back(p_block.get());
+        }
+    }
+
+    for (quartz::rendering::DeviceMemoryAllocation::Block* p_block : emptyBlockPtrs) {
+        quartz::rendering::DeviceMemoryAllocator::releaseBlock(p_block);
+    }
+}
+
+void
+quartz::rendering::DeviceMemoryAllocator::releaseBlock(
+    quartz::rendering::DeviceMemoryAllocation::Block* p_block
+) {
+    LOG_TRACE(BUFFER_ALLOCATOR, "Releasing empty block {} of {} bytes", static_cast<void*>(p_block), p_block->sizeBytes);
+
+    quartz::rendering::DeviceMemoryAllocator::statistics.blockCount--;
+    quartz::rendering::DeviceMemoryAllocator::statistics.blockBytes -= p_block->sizeBytes;
+    if (p_block->p_mappedLocalMemory) {
+        quartz::rendering::DeviceMemoryAllocator::statistics.hostVisibleBlockBytes -= p_block->sizeBytes;
+    } else {
+        quartz::rendering::DeviceMemoryAllocator::statistics.deviceLocalBlockBytes -= p_block->sizeBytes;
+    }
+    if (
+        p_block->lifetime == quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent &&
+        p_block->sizeClassIndex == quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex
+    ) {
+        quartz::rendering::DeviceMemoryAllocator::statistics.dedicatedBlockCount--;
+    }
+
+    std::erase_if(
+        quartz::rendering::DeviceMemoryAllocator::blockPtrs,
+        [p_block](const std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>& p_candidate) {
+            return p_candidate.get() == p_block;
+        }
+    );
+}
+
+void
+quartz::rendering::DeviceMemoryAllocator::recordStagedBytes(
+    const vk::DeviceSize sizeBytes
+) {
+    std::lock_guard<std::mutex> lock(quartz::rendering::DeviceMemoryAllocator::mutex);
+
+    quartz::rendering::DeviceMemoryAllocator::statistics.stagedBytes += sizeBytes;
+}
+
+quartz::rendering::DeviceMemoryAllocator::Statistics
+quartz::rendering::DeviceMemoryAllocator::getStatistics() {
+    std::lock_guard<std::mutex> lock(quartz::rendering::DeviceMemoryAllocator::mutex);
+
+    return quartz::rendering::DeviceMemoryAllocator::statistics;
+}
+
+void
+quartz::rendering::DeviceMemoryAllocator::logStatistics() {
+    const quartz::rendering::DeviceMemoryAllocator::Statistics currentStatistics = quartz::rendering::DeviceMemoryAllocator::getStatistics();
+
+    LOG_INFO(BUFFER_ALLOCATOR, "{} allocations using {} bytes across {} blocks ({} dedicated) of {} bytes", currentStatistics.allocationCount, currentStatistics.allocatedBytes, currentStatistics.blockCount, currentStatistics.dedicatedBlockCount, currentStatistics.blockBytes);
+    LOG_INFO(BUFFER_ALLOCATOR, "  {} bytes device local, {} bytes host visible", currentStatistics.deviceLocalBlockBytes, currentStatistics.hostVisibleBlockBytes);
+    LOG_INFO(BUFFER_ALLOCATOR, "  {} bytes staged through a peak of {} bytes of host visible memory", currentStatistics.stagedBytes, currentStatistics.peakHostVisibleBlockBytes);
+    LOG_INFO(BUFFER_ALLOCATOR, "  {} vkAllocateMemory calls so far", currentStatistics.vulkanAllocationCallCount);
+}
@@ -0,0 +1,182 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+
+namespace quartz {
+namespace rendering {
+    class DeviceMemoryAllocation;
+    class DeviceMemoryAllocator;
+}
+}
+
+/**
+ * @brief A range of a vk::DeviceMemory block handed out by the DeviceMemoryAllocator. The range is
+ *   returned to the allocator when this is destroyed, so it must outlive whatever is bound to it.
+ */
+class quartz::rendering::DeviceMemoryAllocation {
+public: // member functions
+    DeviceMemoryAllocation();
+    DeviceMemoryAllocation(const DeviceMemoryAllocation& other) = delete;
+    DeviceMemoryAllocation(DeviceMemoryAllocation&& other);
+    ~DeviceMemoryAllocation();
+
+    DeviceMemoryAllocation& operator=(DeviceMemoryAllocation&& other);
+
+    USE_LOGGER(BUFFER_ALLOCATOR);
+
+    operator bool() const { return mp_block != nullptr; }
+
+    const vk::DeviceMemory& getVulkanDeviceMemory() const;
+    vk::DeviceSize getOffset() const { return m_offset; }
+    vk::DeviceSize getSizeBytes() const { return m_sizeBytes; }
+
+    /**
+     * @brief Only valid for host visible memory. Blocks of host visible memory are mapped for their
+     *   entire lifetime, because a vk::DeviceMemory may only be mapped once at a time and it is shared
+     *   between many allocations.
+     */
+    void* getMappedLocalMemoryPtr() const;
+
+    void reset();
+
+private: // classes
+    struct Block;
+
+private: // member functions
+    DeviceMemoryAllocation(
+        Block* p_block,
+        const vk::DeviceSize offset,
+        const vk::DeviceSize sizeBytes
+    );
+
+private: // member variables
+    Block* mp_block;
+    vk::DeviceSize m_offset;
+    vk::DeviceSize m_sizeBytes;
+
+private: // friends
+    friend class quartz::rendering::DeviceMemoryAllocator;
+};
+
+/**
+ * @brief Sub-allocates buffers and images out of large vk::DeviceMemory blocks instead of making a
+ *   vkAllocateMemory call for each one, keeping us well under maxMemoryAllocationCount and avoiding the
+ *   allocation latency while loading.
+ *
+ * @brief Persistent allocations are rounded up to a power of two size class and come from blocks
+ *   split into equally sized slots of that class, so freeing and reusing a slot is trivial. Transient
+ *   allocations (such as staging data) are bumped out of a linear block which is rewound once
+ *   everything in it has been freed. Allocations too large for the biggest size class get their own
+ *   dedicated block.
+ *
+ * @brief Buffers and images never share a block. This means we never have to worry about a linear
+ *   resource and an optimal image landing within the same bufferImageGranularity page.
+ *
+ * @brief Blocks only ever serve the device they were allocated from.
+ *
+ * @brief Blocks are released as soon as their last allocation is freed, except for one empty linear
+ *   block per device, memory type, and resource type. Keeping it means back to back uploads don't
+ *   allocate and free a whole linear block each time. Call releaseEmptyBlocks before destroying the
+ *   device so that block doesn't outlive it.
+ */
+class quartz::rendering::DeviceMemoryAllocator {
+public: // enums
+    enum class ResourceType : uint32_t {
+        Buffer = 0,
+        Image = 1
+    };
+
+    enum class Lifetime : uint32_t {
+        Persistent = 0,
+        Transient = 1
+    };
+
+public: // classes
+    struct Statistics {
+    public: // member variables
+        uint32_t blockCount = 0; // live vk::DeviceMemory objects
+        uint32_t dedicatedBlockCount = 0;
+        uint32_t allocationCount = 0;
+        uint64_t vulkanAllocationCallCount = 0; // over the lifetime of the application
+        vk::DeviceSize blockBytes = 0; // device memory reserved in blocks
+        vk::DeviceSize allocatedBytes = 0; // device memory handed out to allocations, including padding
+        vk::DeviceSize hostVisibleBlockBytes = 0;
+        vk::DeviceSize deviceLocalBlockBytes = 0;
+        vk::DeviceSize peakHostVisibleBlockBytes = 0;
+        vk::DeviceSize stagedBytes = 0; // uploaded through staging memory over the lifetime of the application
+    };
+
+public: // member functions
+    DeviceMemoryAllocator() = delete;
+
+    USE_LOGGER(BUFFER_ALLOCATOR);
+
+public: // static functions
+    static quartz::rendering::DeviceMemoryAllocation allocate(
+        const vk::PhysicalDevice& physicalDevice,
+        const vk::UniqueDevice& p_logicalDevice,
+        const vk::MemoryRequirements& memoryRequirements,
+        const uint32_t memoryTypeIndex,
+        const quartz::rendering::DeviceMemoryAllocator::ResourceType resourceType,
+        const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime
+    );
+
+    /**
+     * @brief Frees every block without a live allocation, including the linear blocks we keep around
+     *   for the next upload
+     */
+    static void releaseEmptyBlocks();
+
+    static quartz::rendering::DeviceMemoryAllocator::Statistics getStatistics();
+    static void logStatistics();
+
+    /**
+     * @brief Staging memory is recycled, so the bytes pushed through it are tracked separately to show
+     *   how much host visible memory that saves us
+     */
+    static void recordStagedBytes(const vk::DeviceSize sizeBytes);
+
+    static vk::DeviceSize alignUp(const vk::DeviceSize value, const vk::DeviceSize alignment);
+    static uint32_t getSizeClassIndex(const vk::DeviceSize sizeBytes, const vk::DeviceSize alignment);
+    static vk::DeviceSize getSizeClassBytes(const uint32_t sizeClassIndex) { return minimumSizeClassBytes << sizeClassIndex; }
+    static vk::DeviceSize getSizeClassBlockBytes(const uint32_t sizeClassIndex);
+
+public: // static variables
+    static constexpr vk::DeviceSize minimumSizeClassBytes = 256;
+    static constexpr uint32_t sizeClassCount = 15; // 256 bytes through 4 MiB
+    static constexpr vk::DeviceSize linearBlockBytes = 32 * 1024 * 1024;
+    static constexpr uint32_t dedicatedSizeClassIndex = sizeClassCount;
+
+private: // static functions
+    static quartz::rendering::DeviceMemoryAllocation::Block* createBlock(
+        const vk::PhysicalDevice& physicalDevice,
+        const vk::UniqueDevice& p_logicalDevice,
+        const uint32_t memoryTypeIndex,
+        const quartz::rendering::DeviceMemoryAllocator::ResourceType resourceType,
+        const quartz::rendering::DeviceMemoryAllocator::Lifetime lifetime,
+        const uint32_t sizeClassIndex,
+        const vk::DeviceSize blockBytes
+    );
+    static void free(
+        quartz::rendering::DeviceMemoryAllocation::Block* p_block,
+        const vk::DeviceSize offset,
+        const vk::DeviceSize sizeBytes
+    );
+    static bool shouldRetainEmptyTransientBlock(const quartz::rendering::DeviceMemoryAllocation::Block* p_block);
+    static void releaseBlock(quartz::rendering::DeviceMemoryAllocation::Block* p_block);
+
+private: // static variables
+    static std::mutex mutex;
+    static std::vector<std::unique_ptr<quartz::rendering::DeviceMemoryAllocation::Block>> blockPtrs;
+    static quartz::rendering::DeviceMemoryAllocator::Statistics statistics;
+
+private: // friends
+    friend class quartz::rendering::DeviceMemoryAllocation;
+};
@@ -27,13 +27,14 @@ quartz::rendering::ImageBuffer::ImageBuffer(
             m_imageWidth,
             m_imageHeight,
             m_layerCount,
+            1,
             m_usageFlags,
             m_createFlags,
             m_format,
             m_tiling
         )
     ),
-    mp_vulkanPhysicalDeviceMemory(
+    m_vulkanPhysicalDeviceMemoryAllocation(
         quartz::rendering::ImageBufferUtil::allocateVulkanPhysicalDeviceImageMemory(
             renderingDevice.getVulkanPhysicalDevice(),
             renderingDevice.getVulkanLogicalDevicePtr(),
@@ -56,7 +57,7 @@ quartz::rendering::ImageBuffer::ImageBuffer(
     m_format(other.m_format),
     m_tiling(other.m_tiling),
     mp_vulkanImage(std::move(other.mp_vulkanImage)),
-    mp_vulkanPhysicalDeviceMemory(std::move(other.mp_vulkanPhysicalDeviceMemory))
+    m_vulkanPhysicalDeviceMemoryAllocation(std::move(other.m_vulkanPhysicalDeviceMemoryAllocation))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
@@ -80,7 +81,7 @@ quartz::rendering::ImageBuffer::operator=(
     m_tiling = other.m_tiling;
 
     mp_vulkanImage = std::move(other.mp_vulkanImage);
-    mp_vulkanPhysicalDeviceMemory = std::move(other.mp_vulkanPhysicalDeviceMemory);
+    m_vulkanPhysicalDeviceMemoryAllocation = std::move(other.m_vulkanPhysicalDeviceMemoryAllocation);
 
     return *this;
 }
@@ -93,6 +94,6 @@ void
 quartz::rendering::ImageBuffer::reset() {
     LOG_FUNCTION_CALL_TRACEthis("");
 
-    mp_vulkanPhysicalDeviceMemory.reset();
+    m_vulkanPhysicalDeviceMemoryAllocation.reset();
     mp_vulkanImage.reset();
 }
\ No newline at end of file
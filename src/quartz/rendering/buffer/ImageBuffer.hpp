@@ -48,5 +48,5 @@ private: // member variables
     vk::ImageTiling m_tiling;
 
     vk::UniqueImage mp_vulkanImage;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceMemory;
+    quartz::rendering::DeviceMemoryAllocation m_vulkanPhysicalDeviceMemoryAllocation;
 };
\ No newline at end of file
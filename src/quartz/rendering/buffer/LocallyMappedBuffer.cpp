@@ -1,23 +1,27 @@
 #include <vulkan/vulkan.hpp>
 
+#include "util/errors/RichException.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/BufferUtil.hpp"
 #include "quartz/rendering/buffer/LocallyMappedBuffer.hpp"
 
 void*
 quartz::rendering::LocallyMappedBuffer::mapVulkanPhysicalDeviceMemoryToLocalMemory(
-    const vk::UniqueDevice& p_logicalDevice,
     const uint32_t sizeBytes,
-    const vk::UniqueDeviceMemory& p_physicalDeviceMemory
+    const quartz::rendering::DeviceMemoryAllocation& physicalDeviceMemoryAllocation
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER_MAPPED, "");
 
-    LOG_TRACE(BUFFER_MAPPED, "Mapping memory from physical device memory to logical memory instance {}", static_cast<const void*>(&(*p_physicalDeviceMemory)));
-    void* p_mappedLocalMemory = p_logicalDevice->mapMemory(
-        *(p_physicalDeviceMemory),
-        0,
-        sizeBytes
-    );
+    /**
+     * @brief The allocator keeps host visible blocks mapped for as long as they live, so we just need to
+     *   find where our range landed within that mapping
+     */
+    LOG_TRACE(BUFFER_MAPPED, "Getting mapping of {} bytes at offset {} of physical device memory instance {}", sizeBytes, physicalDeviceMemoryAllocation.getOffset(), static_cast<const void*>(&(physicalDeviceMemoryAllocation.getVulkanDeviceMemory())));
+    void* p_mappedLocalMemory = physicalDeviceMemoryAllocation.getMappedLocalMemoryPtr();
+    if (!p_mappedLocalMemory) {
+        LOG_THROW(BUFFER_MAPPED, util::RichException<uint32_t>, sizeBytes, "Physical device memory is not host visible and cannot be mapped");
+    }
 
     LOG_TRACE(BUFFER_MAPPED, "Mapped to {}", p_mappedLocalMemory);
     return p_mappedLocalMemory;
@@ -39,20 +43,20 @@ quartz::rendering::LocallyMappedBuffer::LocallyMappedBuffer(
             m_usageFlags
         )
     ),
-    mp_vulkanPhysicalDeviceMemory(
-        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemoryPtr(
+    m_vulkanPhysicalDeviceMemoryAllocation(
+        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
             renderingDevice.getVulkanPhysicalDevice(),
             renderingDevice.getVulkanLogicalDevicePtr(),
             m_sizeBytes,
             mp_vulkanLogicalBuffer,
-            requiredMemoryProperties
+            requiredMemoryProperties,
+            quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent
         )
     ),
     mp_mappedLocalMemory(
         quartz::rendering::LocallyMappedBuffer::mapVulkanPhysicalDeviceMemoryToLocalMemory(
-            renderingDevice.getVulkanLogicalDevicePtr(),
             m_sizeBytes,
-            mp_vulkanPhysicalDeviceMemory
+            m_vulkanPhysicalDeviceMemoryAllocation
         )
     )
 {
@@ -74,8 +78,8 @@ quartz::rendering::LocallyMappedBuffer::LocallyMappedBuffer(
     mp_vulkanLogicalBuffer(std::move(
         other.mp_vulkanLogicalBuffer
     )),
-    mp_vulkanPhysicalDeviceMemory(std::move(
-        other.mp_vulkanPhysicalDeviceMemory
+    m_vulkanPhysicalDeviceMemoryAllocation(std::move(
+        other.m_vulkanPhysicalDeviceMemoryAllocation
     )),
     mp_mappedLocalMemory(std::move(
         other.mp_mappedLocalMemory
@@ -102,7 +106,7 @@ quartz::rendering::LocallyMappedBuffer::operator=(
     m_usageFlags = other.m_usageFlags;
     m_requiredMemoryProperties = other.m_requiredMemoryProperties;
     mp_vulkanLogicalBuffer = std::move(other.mp_vulkanLogicalBuffer);
-    mp_vulkanPhysicalDeviceMemory = std::move(other.mp_vulkanPhysicalDeviceMemory);
+    m_vulkanPhysicalDeviceMemoryAllocation = std::move(other.m_vulkanPhysicalDeviceMemoryAllocation);
     mp_mappedLocalMemory = std::move(other.mp_mappedLocalMemory);
 
     return *this;
@@ -27,14 +27,14 @@ public: // member functions
 
     USE_LOGGER(BUFFER_MAPPED);
 
+    uint32_t getSizeBytes() const { return m_sizeBytes; }
     const vk::UniqueBuffer& getVulkanLogicalBufferPtr() const { return mp_vulkanLogicalBuffer; }
     void* getMappedLocalMemoryPtr() { return mp_mappedLocalMemory; }
 
 private: // static functions
     static void* mapVulkanPhysicalDeviceMemoryToLocalMemory(
-        const vk::UniqueDevice& p_logicalDevice,
         const uint32_t bufferSizeBytes,
-        const vk::UniqueDeviceMemory& p_physicalDeviceMemory
+        const quartz::rendering::DeviceMemoryAllocation& physicalDeviceMemoryAllocation
     );
 
 private: // member variables
@@ -43,6 +43,6 @@ private: // member variables
     vk::MemoryPropertyFlags m_requiredMemoryProperties;
 
     vk::UniqueBuffer mp_vulkanLogicalBuffer;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceMemory;
+    quartz::rendering::DeviceMemoryAllocation m_vulkanPhysicalDeviceMemoryAllocation;
     void* mp_mappedLocalMemory;
 };
\ No newline at end of file
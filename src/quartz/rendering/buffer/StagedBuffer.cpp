@@ -3,104 +3,72 @@
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/BufferUtil.hpp"
 #include "quartz/rendering/buffer/StagedBuffer.hpp"
-#include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
 
 void
 quartz::rendering::StagedBuffer::populateVulkanLogicalBufferWithStagedData(
-    const uint32_t graphicsQueueFamilyIndex,
-    const vk::UniqueDevice& p_logicalDevice,
-    const vk::Queue& graphicsQueue,
+    const quartz::rendering::Device& renderingDevice,
     const uint32_t sizeBytes,
+    const vk::BufferUsageFlags usageFlags,
     const vk::UniqueBuffer& p_logicalBuffer,
-    const vk::UniqueBuffer& p_logicalStagingBuffer
+    const void* p_bufferData
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER_STAGED, "{} bytes", sizeBytes);
 
-    vk::UniqueCommandPool p_commandPool =
-        quartz::rendering::VulkanUtil::createVulkanCommandPoolPtr(
-            graphicsQueueFamilyIndex,
-            p_logicalDevice,
-            vk::CommandPoolCreateFlagBits::eTransient
-        );
+    LOG_TRACE(BUFFER_STAGED, "Memory is *NOT* allocated for a source buffer. Populating with data from staging memory instead");
 
-    vk::UniqueCommandBuffer p_commandBuffer = std::move(
-        quartz::rendering::VulkanUtil::allocateVulkanCommandBufferPtr(
-            p_logicalDevice,
-            p_commandPool,
-            1
-        )[0]
-    );
+    // Joins the batch for the model or scene being loaded if there is one
+    quartz::rendering::UploadBatch uploadBatch(renderingDevice);
 
-    LOG_TRACE(BUFFER_STAGED, "Memory is *NOT* allocated for a source buffer. Populating with data from staged buffer instead");
-
-    vk::CommandBufferBeginInfo commandBufferBeginInfo(
-        vk::CommandBufferUsageFlagBits::eOneTimeSubmit
-    );
-    p_commandBuffer->begin(commandBufferBeginInfo);
-
-    vk::BufferCopy bufferCopyRegion(
-        0,
-        0,
-        sizeBytes
-    );
-
-    p_commandBuffer->copyBuffer(
-        *p_logicalStagingBuffer,
-        *p_logicalBuffer,
-        bufferCopyRegion
+    uploadBatch.recordBufferUpload(
+        p_bufferData,
+        sizeBytes,
+        p_logicalBuffer,
+        usageFlags
     );
 
-    p_commandBuffer->end();
-
-    quartz::rendering::BufferUtil::submitVulkanCommandBufferPtr(
-        graphicsQueue,
-        p_commandBuffer
-    );
+    uploadBatch.submit();
 
-    LOG_TRACE(BUFFER_STAGED, "Successfully copied data from staging buffer");
+    LOG_TRACE(BUFFER_STAGED, "Successfully recorded upload through staging memory");
 }
 
-vk::UniqueDeviceMemory
-quartz::rendering::StagedBuffer::allocateVulkanPhysicalDeviceDestinationMemoryPtr(
-    const vk::PhysicalDevice& physicalDevice,
-    const uint32_t graphicsQueueFamilyIndex,
-    const vk::UniqueDevice& p_logicalDevice,
-    const vk::Queue& graphicsQueue,
+quartz::rendering::DeviceMemoryAllocation
+quartz::rendering::StagedBuffer::allocateVulkanPhysicalDeviceDestinationMemory(
+    const quartz::rendering::Device& renderingDevice,
     const uint32_t sizeBytes,
+    const vk::BufferUsageFlags usageFlags,
     const vk::UniqueBuffer& p_logicalBuffer,
     const vk::MemoryPropertyFlags requiredMemoryProperties,
-    const vk::UniqueBuffer& p_logicalStagingBuffer
+    const void* p_bufferData
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER_STAGED, "{} bytes", sizeBytes);
-    
-    vk::UniqueDeviceMemory p_logicalBufferPhysicalMemory =
-        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemoryPtr(
-            physicalDevice,
-            p_logicalDevice,
+
+    quartz::rendering::DeviceMemoryAllocation logicalBufferPhysicalMemoryAllocation =
+        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
+            renderingDevice.getVulkanPhysicalDevice(),
+            renderingDevice.getVulkanLogicalDevicePtr(),
             sizeBytes,
             p_logicalBuffer,
-            requiredMemoryProperties
+            requiredMemoryProperties,
+            quartz::rendering::DeviceMemoryAllocator::Lifetime::Persistent
         );
 
     quartz::rendering::StagedBuffer::populateVulkanLogicalBufferWithStagedData(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        graphicsQueue,
+        renderingDevice,
         sizeBytes,
+        usageFlags,
         p_logicalBuffer,
-        p_logicalStagingBuffer
+        p_bufferData
     );
 
-    return p_logicalBufferPhysicalMemory;
+    return logicalBufferPhysicalMemoryAllocation;
 }
 
 quartz::rendering::StagedBuffer::StagedBuffer() :
     m_sizeBytes(),
     m_usageFlags(),
-    mp_vulkanLogicalStagingBuffer(),
-    mp_vulkanPhysicalDeviceStagingMemory(),
     mp_vulkanLogicalBuffer(),
-    mp_vulkanPhysicalDeviceMemory()
+    m_vulkanPhysicalDeviceMemoryAllocation()
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
@@ -113,26 +81,6 @@ quartz::rendering::StagedBuffer::StagedBuffer(
 ) :
     m_sizeBytes(sizeBytes),
     m_usageFlags(usageFlags),
-    mp_vulkanLogicalStagingBuffer(
-        quartz::rendering::BufferUtil::createVulkanBufferPtr(
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            m_sizeBytes,
-            vk::BufferUsageFlagBits::eTransferSrc
-        )
-    ),
-    mp_vulkanPhysicalDeviceStagingMemory(
-        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceStagingMemoryPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            m_sizeBytes,
-            p_bufferData,
-            mp_vulkanLogicalStagingBuffer,
-            {
-                vk::MemoryPropertyFlagBits::eHostVisible |
-                vk::MemoryPropertyFlagBits::eHostCoherent
-            }
-        )
-    ),
     mp_vulkanLogicalBuffer(
         quartz::rendering::BufferUtil::createVulkanBufferPtr(
             renderingDevice.getVulkanLogicalDevicePtr(),
@@ -140,16 +88,14 @@ quartz::rendering::StagedBuffer::StagedBuffer(
             vk::BufferUsageFlagBits::eTransferDst | m_usageFlags
         )
     ),
-    mp_vulkanPhysicalDeviceMemory(
-        quartz::rendering::StagedBuffer::allocateVulkanPhysicalDeviceDestinationMemoryPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getGraphicsQueueFamilyIndex(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            renderingDevice.getVulkanGraphicsQueue(),
+    m_vulkanPhysicalDeviceMemoryAllocation(
+        quartz::rendering::StagedBuffer::allocateVulkanPhysicalDeviceDestinationMemory(
+            renderingDevice,
             m_sizeBytes,
+            m_usageFlags,
             mp_vulkanLogicalBuffer,
             vk::MemoryPropertyFlagBits::eDeviceLocal,
-            mp_vulkanLogicalStagingBuffer
+            p_bufferData
         )
     )
 {
@@ -165,17 +111,11 @@ quartz::rendering::StagedBuffer::StagedBuffer(
     m_usageFlags(
         other.m_usageFlags
     ),
-    mp_vulkanLogicalStagingBuffer(std::move(
-        other.mp_vulkanLogicalStagingBuffer
-    )),
-    mp_vulkanPhysicalDeviceStagingMemory(std::move(
-        other.mp_vulkanPhysicalDeviceStagingMemory
-    )),
     mp_vulkanLogicalBuffer(std::move(
         other.mp_vulkanLogicalBuffer
     )),
-    mp_vulkanPhysicalDeviceMemory(std::move(
-        other.mp_vulkanPhysicalDeviceMemory
+    m_vulkanPhysicalDeviceMemoryAllocation(std::move(
+        other.m_vulkanPhysicalDeviceMemoryAllocation
     ))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
@@ -198,10 +138,8 @@ quartz::rendering::StagedBuffer::operator=(
 
     m_sizeBytes = other.m_sizeBytes;
     m_usageFlags = other.m_usageFlags;
-    mp_vulkanLogicalStagingBuffer = std::move(other.mp_vulkanLogicalStagingBuffer);
-    mp_vulkanPhysicalDeviceStagingMemory = std::move(other.mp_vulkanPhysicalDeviceStagingMemory);
     mp_vulkanLogicalBuffer = std::move(other.mp_vulkanLogicalBuffer);
-    mp_vulkanPhysicalDeviceMemory = std::move(other.mp_vulkanPhysicalDeviceMemory);
+    m_vulkanPhysicalDeviceMemoryAllocation = std::move(other.m_vulkanPhysicalDeviceMemoryAllocation);
 
     return *this;
 }
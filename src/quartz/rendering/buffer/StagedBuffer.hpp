@@ -32,31 +32,25 @@ public: // member functions
 
 private: // static functions
     static void populateVulkanLogicalBufferWithStagedData(
-        const uint32_t graphicsQueueFamilyIndex,
-        const vk::UniqueDevice& p_logicalDevice,
-        const vk::Queue& graphicsQueue,
+        const quartz::rendering::Device& renderingDevice,
         const uint32_t sizeBytes,
+        const vk::BufferUsageFlags usageFlags,
         const vk::UniqueBuffer& p_logicalBuffer,
-        const vk::UniqueBuffer& p_logicalStagingBuffer
+        const void* p_bufferData
     );
-    static vk::UniqueDeviceMemory allocateVulkanPhysicalDeviceDestinationMemoryPtr(
-        const vk::PhysicalDevice& physicalDevice,
-        const uint32_t graphicsQueueFamilyIndex,
-        const vk::UniqueDevice& p_logicalDevice,
-        const vk::Queue& graphicsQueue,
+    static quartz::rendering::DeviceMemoryAllocation allocateVulkanPhysicalDeviceDestinationMemory(
+        const quartz::rendering::Device& renderingDevice,
         const uint32_t sizeBytes,
+        const vk::BufferUsageFlags usageFlags,
         const vk::UniqueBuffer& p_logicalBuffer,
         const vk::MemoryPropertyFlags requiredMemoryProperties,
-        const vk::UniqueBuffer& p_logicalStagingBuffer
+        const void* p_bufferData
     );
 
 private: // member variables
     uint32_t m_sizeBytes;
     vk::BufferUsageFlags m_usageFlags;
 
-    vk::UniqueBuffer mp_vulkanLogicalStagingBuffer;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceStagingMemory;
-
     vk::UniqueBuffer mp_vulkanLogicalBuffer;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceMemory;
+    quartz::rendering::DeviceMemoryAllocation m_vulkanPhysicalDeviceMemoryAllocation;
 };
@@ -1,241 +1,131 @@
-#include <vulkan/vulkan.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+#include <vector>
 
-#include "util/errors/RichException.hpp"
+#include <vulkan/vulkan.hpp>
 
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/BufferUtil.hpp"
 #include "quartz/rendering/buffer/StagedImageBuffer.hpp"
-#include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
 
-void
-quartz::rendering::StagedImageBuffer::transitionImageLayout(
-    const uint32_t graphicsQueueFamilyIndex,
-    const vk::UniqueDevice& p_logicalDevice,
-    const vk::Queue& graphicsQueue,
-    const vk::UniqueImage& p_image,
-    const uint32_t layerCount,
-    const vk::ImageLayout inputLayout,
-    const vk::ImageLayout outputLayout
+uint32_t
+quartz::rendering::StagedImageBuffer::calculateFullMipLevelCount(
+    const uint32_t imageWidth,
+    const uint32_t imageHeight
 ) {
-    LOG_FUNCTION_SCOPE_TRACE(BUFFER_IMAGE, "");
-
-    vk::UniqueCommandPool p_commandPool = quartz::rendering::VulkanUtil::createVulkanCommandPoolPtr(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        vk::CommandPoolCreateFlagBits::eTransient
-    );
-
-    vk::UniqueCommandBuffer p_commandBuffer = std::move(
-        quartz::rendering::VulkanUtil::allocateVulkanCommandBufferPtr(
-            p_logicalDevice,
-            p_commandPool,
-            1
-        )[0]
-    );
-
-    LOG_TRACE(BUFFER_IMAGE, "Recording commands to newly created command buffer for transitioning image's layout");
-
-    vk::CommandBufferBeginInfo commandBufferBeginInfo(
-        vk::CommandBufferUsageFlagBits::eOneTimeSubmit
-    );
-    p_commandBuffer->begin(commandBufferBeginInfo);
+    return std::bit_width(std::max<uint32_t>(std::max(imageWidth, imageHeight), 1));
+}
 
-    vk::AccessFlags sourceAccessMask;
-    vk::AccessFlags destinationAccessMask;
-    vk::PipelineStageFlags sourceStage;
-    vk::PipelineStageFlags destinationStage;
-    if (
-        inputLayout == vk::ImageLayout::eUndefined &&
-        outputLayout == vk::ImageLayout::eTransferDstOptimal
-    ) {
-        LOG_TRACE(BUFFER_IMAGE, "Transferring image from undefined layout to optimal transfer destination layout");
+std::vector<quartz::rendering::UploadBatch::ImageLevel>
+quartz::rendering::StagedImageBuffer::calculateMipLevels(
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t layerCount,
+    const uint32_t mipLevelCount,
+    const uint32_t texelBytes
+) {
+    std::vector<quartz::rendering::UploadBatch::ImageLevel> levels;
+    levels.reserve(mipLevelCount);
 
-        destinationAccessMask = vk::AccessFlagBits::eTransferWrite;
+    // Copies out of a buffer on a transfer only queue must start on a multiple of 4 as well as of the texel size
+    const vk::DeviceSize levelAlignmentBytes = std::lcm<vk::DeviceSize>(texelBytes, 4);
 
-        sourceStage = vk::PipelineStageFlagBits::eTopOfPipe;
-        destinationStage = vk::PipelineStageFlagBits::eTransfer;
-    } else if (
-        inputLayout == vk::ImageLayout::eTransferDstOptimal &&
-        outputLayout == vk::ImageLayout::eShaderReadOnlyOptimal
-    ) {
-        LOG_TRACE(BUFFER_IMAGE, "Transferring image from optimal transfer destination layout to optimal shader read only format");
+    uint32_t levelWidth = imageWidth;
+    uint32_t levelHeight = imageHeight;
+    vk::DeviceSize offsetBytes = 0;
 
-        sourceAccessMask = vk::AccessFlagBits::eTransferWrite;
-        destinationAccessMask = vk::AccessFlagBits::eShaderRead;
+    for (uint32_t i = 0; i < mipLevelCount; ++i) {
+        levels.push_back({levelWidth, levelHeight, offsetBytes});
 
-        sourceStage = vk::PipelineStageFlagBits::eTransfer;
-        destinationStage = vk::PipelineStageFlagBits::eFragmentShader;
-    } else {
-        struct LayoutBucket {
-            vk::ImageLayout inputLayout;
-            vk::ImageLayout outputLayout;
-        } layoutBucket(inputLayout, outputLayout);
-        LOG_THROW(BUFFER_IMAGE, util::RichException<LayoutBucket>, layoutBucket, "Unsupported image layout transition");
+        offsetBytes += static_cast<vk::DeviceSize>(levelWidth) * levelHeight * layerCount * texelBytes;
+        offsetBytes = (offsetBytes + levelAlignmentBytes - 1) / levelAlignmentBytes * levelAlignmentBytes;
+        levelWidth = std::max<uint32_t>(levelWidth / 2, 1);
+        levelHeight = std::max<uint32_t>(levelHeight / 2, 1);
     }
 
-    vk::ImageMemoryBarrier imageMemoryBarrier(
-        sourceAccessMask,
-        destinationAccessMask,
-        inputLayout,
-        outputLayout,
-        VK_QUEUE_FAMILY_IGNORED,
-        VK_QUEUE_FAMILY_IGNORED,
-        *p_image,
-        {
-            vk::ImageAspectFlagBits::eColor,
-            0,
-            1,
-            0,
-            layerCount
-        }
-    );
-
-    p_commandBuffer->pipelineBarrier(
-        sourceStage,
-        destinationStage,
-        {},
-        {},
-        {},
-        imageMemoryBarrier
-    );
-
-    p_commandBuffer->end();
+    return levels;
+}
 
-    quartz::rendering::BufferUtil::submitVulkanCommandBufferPtr(
-        graphicsQueue,
-        p_commandBuffer
+uint32_t
+quartz::rendering::StagedImageBuffer::calculateMipChainSizeBytes(
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t layerCount,
+    const uint32_t mipLevelCount,
+    const uint32_t texelBytes
+) {
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel> levels = quartz::rendering::StagedImageBuffer::calculateMipLevels(
+        imageWidth,
+        imageHeight,
+        layerCount,
+        mipLevelCount,
+        texelBytes
     );
 
-    LOG_TRACE(BUFFER_IMAGE, "Successfully transitioned image's layout");
+    return levels.back().offsetBytes + static_cast<vk::DeviceSize>(levels.back().width) * levels.back().height * layerCount * texelBytes;
 }
 
 void
 quartz::rendering::StagedImageBuffer::populateVulkanImageWithStagedData(
-    const uint32_t graphicsQueueFamilyIndex,
-    const vk::UniqueDevice& p_logicalDevice,
-    const vk::Queue& graphicsQueue,
-    const uint32_t imageWidth,
-    const uint32_t imageHeight,
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
     const uint32_t layerCount,
-    const vk::UniqueBuffer& p_stagingBuffer,
+    const uint32_t sizeBytes,
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
     const vk::UniqueImage& p_image
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER_IMAGE, "");
 
-    vk::UniqueCommandPool p_commandPool = quartz::rendering::VulkanUtil::createVulkanCommandPoolPtr(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        vk::CommandPoolCreateFlagBits::eTransient
-    );
+    // Joins the batch for the model or scene being loaded if there is one
+    quartz::rendering::UploadBatch uploadBatch(renderingDevice);
 
-    vk::UniqueCommandBuffer p_commandBuffer = std::move(
-        quartz::rendering::VulkanUtil::allocateVulkanCommandBufferPtr(
-            p_logicalDevice,
-            p_commandPool,
-            1
-        )[0]
-    );
-
-    LOG_TRACE(BUFFER_IMAGE, "Recording commands to newly created command buffer for copying data from staged buffer to image");
-
-    vk::CommandBufferBeginInfo commandBufferBeginInfo(
-        vk::CommandBufferUsageFlagBits::eOneTimeSubmit
-    );
-    p_commandBuffer->begin(commandBufferBeginInfo);
-
-    vk::BufferImageCopy bufferImageCopy(
-        0,
-        0,
-        0,
-        {
-            vk::ImageAspectFlagBits::eColor,
-            0,
-            0,
-            layerCount
-        },
-        {
-            0,
-            0,
-            0
-        },
-        {
-            imageWidth,
-            imageHeight,
-            1
-        }
-    );
-
-    p_commandBuffer->copyBufferToImage(
-        *p_stagingBuffer,
-        *p_image,
-        vk::ImageLayout::eTransferDstOptimal,
-        bufferImageCopy
+    LOG_TRACE(BUFFER_IMAGE, "Recording layout transitions and copy from staging memory to image");
+    uploadBatch.recordImageUpload(
+        writeStagingData,
+        sizeBytes,
+        p_image,
+        levels,
+        layerCount
     );
 
-    p_commandBuffer->end();
+    uploadBatch.submit();
 
-    quartz::rendering::BufferUtil::submitVulkanCommandBufferPtr(
-        graphicsQueue,
-        p_commandBuffer
-    );
-
-    LOG_TRACE(BUFFER_IMAGE, "Successfully copied data");
+    LOG_TRACE(BUFFER_IMAGE, "Successfully recorded image upload");
 }
 
-vk::UniqueDeviceMemory
+quartz::rendering::DeviceMemoryAllocation
 quartz::rendering::StagedImageBuffer::allocateVulkanPhysicalDeviceImageMemoryAndPopulateWithStagedData(
-    const vk::PhysicalDevice& physicalDevice,
-    const uint32_t graphicsQueueFamilyIndex,
-    const vk::UniqueDevice& p_logicalDevice,
-    const vk::Queue& graphicsQueue,
-    const uint32_t imageWidth,
-    const uint32_t imageHeight,
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
     const uint32_t layerCount,
-    const vk::UniqueBuffer& p_stagingBuffer,
+    const uint32_t sizeBytes,
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
     const vk::UniqueImage& p_image,
     const vk::MemoryPropertyFlags requiredMemoryProperties
 ) {
     LOG_FUNCTION_SCOPE_TRACE(BUFFER_IMAGE, "");
 
-    vk::UniqueDeviceMemory p_vulkanPhysicalDeviceTextureMemory = quartz::rendering::ImageBufferUtil::allocateVulkanPhysicalDeviceImageMemory(
-        physicalDevice,
-        p_logicalDevice,
+    quartz::rendering::DeviceMemoryAllocation vulkanPhysicalDeviceTextureMemoryAllocation = quartz::rendering::ImageBufferUtil::allocateVulkanPhysicalDeviceImageMemory(
+        renderingDevice.getVulkanPhysicalDevice(),
+        renderingDevice.getVulkanLogicalDevicePtr(),
         p_image,
         requiredMemoryProperties
     );
 
     LOG_TRACE(BUFFER_IMAGE, "Transitioning layout and populating memory from buffer");
-
-    quartz::rendering::StagedImageBuffer::transitionImageLayout(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        graphicsQueue,
-        p_image,
-        layerCount,
-        vk::ImageLayout::eUndefined,
-        vk::ImageLayout::eTransferDstOptimal
-    );
     quartz::rendering::StagedImageBuffer::populateVulkanImageWithStagedData(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        graphicsQueue,
-        imageWidth,
-        imageHeight,
+        renderingDevice,
+        levels,
         layerCount,
-        p_stagingBuffer,
+        sizeBytes,
+        writeStagingData,
         p_image
     );
-    quartz::rendering::StagedImageBuffer::transitionImageLayout(
-        graphicsQueueFamilyIndex,
-        p_logicalDevice,
-        graphicsQueue,
-        p_image,
-        layerCount,
-        vk::ImageLayout::eTransferDstOptimal,
-        vk::ImageLayout::eShaderReadOnlyOptimal
-    );
 
-    return p_vulkanPhysicalDeviceTextureMemory;
+    return vulkanPhysicalDeviceTextureMemoryAllocation;
 }
 
 quartz::rendering::StagedImageBuffer::StagedImageBuffer() :
@@ -244,13 +134,12 @@ quartz::rendering::StagedImageBuffer::StagedImageBuffer() :
     m_channelCount(0),
     m_sizeBytes(0),
     m_layerCount(0),
+    m_mipLevelCount(0),
     m_usageFlags(),
     m_format(),
     m_tiling(),
-    mp_vulkanLogicalStagingBuffer(nullptr),
-    mp_vulkanPhysicalDeviceStagingMemory(nullptr),
     mp_vulkanImage(nullptr),
-    mp_vulkanPhysicalDeviceMemory(nullptr)
+    m_vulkanPhysicalDeviceMemoryAllocation()
 {}
 
 quartz::rendering::StagedImageBuffer::StagedImageBuffer(
@@ -260,69 +149,132 @@ quartz::rendering::StagedImageBuffer::StagedImageBuffer(
     const uint32_t channelCount,
     const uint32_t sizeBytes,
     const uint32_t layerCount,
+    const uint32_t mipLevelCount,
     const vk::ImageUsageFlags usageFlags,
     const vk::ImageCreateFlags createFlags,
     const vk::Format format,
     const vk::ImageTiling tiling,
     const void* p_bufferData
+) :
+    quartz::rendering::StagedImageBuffer(
+        renderingDevice,
+        imageWidth,
+        imageHeight,
+        channelCount,
+        sizeBytes,
+        layerCount,
+        mipLevelCount,
+        usageFlags,
+        createFlags,
+        format,
+        tiling,
+        [
+            p_bufferData,
+            chainSizeBytes = quartz::rendering::StagedImageBuffer::calculateMipChainSizeBytes(
+                imageWidth,
+                imageHeight,
+                layerCount,
+                mipLevelCount,
+                sizeBytes / (imageWidth * imageHeight)
+            )
+        ](uint8_t* p_stagingData) {
+            memcpy(p_stagingData, p_bufferData, chainSizeBytes);
+        }
+    )
+{}
+
+quartz::rendering::StagedImageBuffer::StagedImageBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const uint32_t sizeBytes,
+    const uint32_t layerCount,
+    const uint32_t mipLevelCount,
+    const vk::ImageUsageFlags usageFlags,
+    const vk::ImageCreateFlags createFlags,
+    const vk::Format format,
+    const vk::ImageTiling tiling,
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData
+) :
+    quartz::rendering::StagedImageBuffer(
+        renderingDevice,
+        imageWidth,
+        imageHeight,
+        channelCount,
+        layerCount,
+        quartz::rendering::StagedImageBuffer::calculateMipLevels(
+            imageWidth,
+            imageHeight,
+            layerCount,
+            std::max<uint32_t>(mipLevelCount, 1),
+            sizeBytes / (imageWidth * imageHeight)
+        ),
+        quartz::rendering::StagedImageBuffer::calculateMipChainSizeBytes(
+            imageWidth,
+            imageHeight,
+            layerCount,
+            std::max<uint32_t>(mipLevelCount, 1),
+            sizeBytes / (imageWidth * imageHeight)
+        ),
+        usageFlags,
+        createFlags,
+        format,
+        tiling,
+        writeStagingData
+    )
+{}
+
+quartz::rendering::StagedImageBuffer::StagedImageBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const uint32_t layerCount,
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+    const uint32_t chainSizeBytes,
+    const vk::ImageUsageFlags usageFlags,
+    const vk::ImageCreateFlags createFlags,
+    const vk::Format format,
+    const vk::ImageTiling tiling,
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData
 ) :
     m_imageWidth(imageWidth),
     m_imageHeight(imageHeight),
     m_channelCount(channelCount),
-    m_sizeBytes(sizeBytes),
+    m_sizeBytes((levels.size() > 1 ? levels[1].offsetBytes : chainSizeBytes) / layerCount),
     m_layerCount(layerCount),
+    m_mipLevelCount(levels.size()),
     m_usageFlags(usageFlags),
     m_createFlags(createFlags),
     m_format(format),
     m_tiling(tiling),
-    mp_vulkanLogicalStagingBuffer(
-        quartz::rendering::BufferUtil::createVulkanBufferPtr(
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            m_sizeBytes * m_layerCount,
-            vk::BufferUsageFlagBits::eTransferSrc
-        )
-    ),
-    mp_vulkanPhysicalDeviceStagingMemory(
-        quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceStagingMemoryPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            m_sizeBytes * m_layerCount,
-            p_bufferData,
-            mp_vulkanLogicalStagingBuffer,
-            {
-                vk::MemoryPropertyFlagBits::eHostVisible |
-                vk::MemoryPropertyFlagBits::eHostCoherent
-            }
-        )
-    ),
     mp_vulkanImage(
         quartz::rendering::ImageBufferUtil::createVulkanImagePtr(
             renderingDevice.getVulkanLogicalDevicePtr(),
             m_imageWidth,
             m_imageHeight,
             m_layerCount,
+            m_mipLevelCount,
             vk::ImageUsageFlagBits::eTransferDst | m_usageFlags,
             m_createFlags,
             m_format,
             m_tiling
         )
     ),
-    mp_vulkanPhysicalDeviceMemory(
+    m_vulkanPhysicalDeviceMemoryAllocation(
         quartz::rendering::StagedImageBuffer::allocateVulkanPhysicalDeviceImageMemoryAndPopulateWithStagedData(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getGraphicsQueueFamilyIndex(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            renderingDevice.getVulkanGraphicsQueue(),
-            m_imageWidth,
-            m_imageHeight,
+            renderingDevice,
+            levels,
             m_layerCount,
-            mp_vulkanLogicalStagingBuffer,
+            chainSizeBytes,
+            writeStagingData,
             mp_vulkanImage,
             vk::MemoryPropertyFlagBits::eDeviceLocal
         )
     )
 {
-    LOG_FUNCTION_CALL_TRACEthis("");
+    LOG_FUNCTION_CALL_TRACEthis("{} levels, {} bytes", m_mipLevelCount, chainSizeBytes);
 }
 
 quartz::rendering::StagedImageBuffer::StagedImageBuffer(
@@ -333,13 +285,12 @@ quartz::rendering::StagedImageBuffer::StagedImageBuffer(
     m_channelCount(other.m_channelCount),
     m_sizeBytes(other.m_sizeBytes),
     m_layerCount(other.m_layerCount),
+    m_mipLevelCount(other.m_mipLevelCount),
     m_usageFlags(other.m_usageFlags),
     m_format(other.m_format),
     m_tiling(other.m_tiling),
-    mp_vulkanLogicalStagingBuffer(std::move(other.mp_vulkanLogicalStagingBuffer)),
-    mp_vulkanPhysicalDeviceStagingMemory(std::move(other.mp_vulkanPhysicalDeviceStagingMemory)),
     mp_vulkanImage(std::move(other.mp_vulkanImage)),
-    mp_vulkanPhysicalDeviceMemory(std::move(other.mp_vulkanPhysicalDeviceMemory))
+    m_vulkanPhysicalDeviceMemoryAllocation(std::move(other.m_vulkanPhysicalDeviceMemoryAllocation))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
@@ -363,14 +314,13 @@ quartz::rendering::StagedImageBuffer::operator=(
     m_channelCount = other.m_channelCount;
     m_sizeBytes = other.m_sizeBytes;
     m_layerCount = other.m_layerCount;
+    m_mipLevelCount = other.m_mipLevelCount;
     m_usageFlags = other.m_usageFlags;
     m_format = other.m_format;
     m_tiling = other.m_tiling;
 
-    mp_vulkanLogicalStagingBuffer = std::move(other.mp_vulkanLogicalStagingBuffer);
-    mp_vulkanPhysicalDeviceStagingMemory = std::move(other.mp_vulkanPhysicalDeviceStagingMemory);
     mp_vulkanImage = std::move(other.mp_vulkanImage);
-    mp_vulkanPhysicalDeviceMemory = std::move(other.mp_vulkanPhysicalDeviceMemory);
+    m_vulkanPhysicalDeviceMemoryAllocation = std::move(other.m_vulkanPhysicalDeviceMemoryAllocation);
 
     return *this;
 }
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <vector>
+
 #include <vulkan/vulkan.hpp>
 #include <vulkan/vulkan_handles.hpp>
 
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/BufferUtil.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
 #include "quartz/rendering/device/Device.hpp"
 
 namespace quartz {
@@ -23,12 +26,50 @@ public: // member functions
         const uint32_t channelCount,
         const uint32_t sizeBytes,
         const uint32_t layerCount,
+        const uint32_t mipLevelCount,
         const vk::ImageUsageFlags usageFlags,
         const vk::ImageCreateFlags createFlags,
         const vk::Format format,
         const vk::ImageTiling tiling,
         const void* p_bufferData
     );
+    /**
+     * @brief For image data which can be produced straight into staging memory, such as pixels which
+     *   need their channels expanded on the way to the gpu. The writer fills every mip level, laid out
+     *   as calculateMipLevels describes
+     */
+    StagedImageBuffer(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const uint32_t sizeBytes,
+        const uint32_t layerCount,
+        const uint32_t mipLevelCount,
+        const vk::ImageUsageFlags usageFlags,
+        const vk::ImageCreateFlags createFlags,
+        const vk::Format format,
+        const vk::ImageTiling tiling,
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData
+    );
+    /**
+     * @brief For image data whose levels don't follow calculateMipLevels, such as block compressed
+     *   levels out of a ktx2 container. chainSizeBytes covers every layer of every level
+     */
+    StagedImageBuffer(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const uint32_t layerCount,
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const uint32_t chainSizeBytes,
+        const vk::ImageUsageFlags usageFlags,
+        const vk::ImageCreateFlags createFlags,
+        const vk::Format format,
+        const vk::ImageTiling tiling,
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData
+    );
     StagedImageBuffer(StagedImageBuffer&& other);
     ~StagedImageBuffer();
 
@@ -38,37 +79,52 @@ public: // member functions
 
     const vk::Format& getVulkanFormat() const { return m_format; }
     const vk::UniqueImage& getVulkanImagePtr() const { return mp_vulkanImage; }
-    const vk::UniqueDeviceMemory& getVulkanPhysicalDeviceStagingMemory() const { return mp_vulkanPhysicalDeviceStagingMemory; }
+    uint32_t getMipLevelCount() const { return m_mipLevelCount; }
 
-private: // static functions
-    static void transitionImageLayout(
-        const uint32_t graphicsQueueFamilyIndex,
-        const vk::UniqueDevice& p_logicalDevice,
-        const vk::Queue& graphicsQueue,
-        const vk::UniqueImage& p_image,
-        const uint32_t layerCount,
-        const vk::ImageLayout inputLayout,
-        const vk::ImageLayout outputLayout
+public: // static functions
+    /**
+     * @brief Enough levels to halve the image all the way down to 1x1
+     */
+    static uint32_t calculateFullMipLevelCount(
+        const uint32_t imageWidth,
+        const uint32_t imageHeight
     );
-    static void populateVulkanImageWithStagedData(
-        const uint32_t graphicsQueueFamilyIndex,
-        const vk::UniqueDevice& p_logicalDevice,
-        const vk::Queue& graphicsQueue,
+
+    /**
+     * @brief The staged data for an image is each mip level one after another, largest first, with
+     *   every layer of a level back to back. Each level starts on a multiple of both the texel size
+     *   and 4 bytes, so 1 and 2 byte formats get a few bytes of padding after odd sized levels
+     */
+    static std::vector<quartz::rendering::UploadBatch::ImageLevel> calculateMipLevels(
         const uint32_t imageWidth,
         const uint32_t imageHeight,
         const uint32_t layerCount,
-        const vk::UniqueBuffer& p_stagingBuffer,
-        const vk::UniqueImage& p_image
+        const uint32_t mipLevelCount,
+        const uint32_t texelBytes
     );
-    static vk::UniqueDeviceMemory allocateVulkanPhysicalDeviceImageMemoryAndPopulateWithStagedData(
-        const vk::PhysicalDevice& physicalDevice,
-        const uint32_t graphicsQueueFamilyIndex,
-        const vk::UniqueDevice& p_logicalDevice,
-        const vk::Queue& graphicsQueue,
+    static uint32_t calculateMipChainSizeBytes(
         const uint32_t imageWidth,
         const uint32_t imageHeight,
         const uint32_t layerCount,
-        const vk::UniqueBuffer& p_stagingBuffer,
+        const uint32_t mipLevelCount,
+        const uint32_t texelBytes
+    );
+
+private: // static functions
+    static void populateVulkanImageWithStagedData(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const uint32_t layerCount,
+        const uint32_t sizeBytes,
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
+        const vk::UniqueImage& p_image
+    );
+    static quartz::rendering::DeviceMemoryAllocation allocateVulkanPhysicalDeviceImageMemoryAndPopulateWithStagedData(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const uint32_t layerCount,
+        const uint32_t sizeBytes,
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
         const vk::UniqueImage& p_image,
         const vk::MemoryPropertyFlags requiredMemoryProperties
     );
@@ -77,16 +133,14 @@ private: // member variables
     uint32_t m_imageWidth;
     uint32_t m_imageHeight;
     uint32_t m_channelCount;
-    uint32_t m_sizeBytes;
+    uint32_t m_sizeBytes; // of a single layer of the largest mip level
     uint32_t m_layerCount;
+    uint32_t m_mipLevelCount;
     vk::ImageUsageFlags m_usageFlags;
     vk::ImageCreateFlags m_createFlags;
     vk::Format m_format;
     vk::ImageTiling m_tiling;
 
-    vk::UniqueBuffer mp_vulkanLogicalStagingBuffer;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceStagingMemory;
-
     vk::UniqueImage mp_vulkanImage;
-    vk::UniqueDeviceMemory mp_vulkanPhysicalDeviceMemory;
+    quartz::rendering::DeviceMemoryAllocation m_vulkanPhysicalDeviceMemoryAllocation;
 };
@@ -0,0 +1,626 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/BufferUtil.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
+
+quartz::rendering::UploadBatch* quartz::rendering::UploadBatch::p_recordingBatch = nullptr;
+
+vk::UniqueCommandBuffer
+quartz::rendering::UploadBatch::beginVulkanCommandBufferPtr(
+    const vk::UniqueDevice& p_logicalDevice,
+    const vk::UniqueCommandPool& p_commandPool
+) {
+    if (!p_commandPool) {
+        return vk::UniqueCommandBuffer();
+    }
+
+    vk::UniqueCommandBuffer p_commandBuffer = std::move(
+        quartz::rendering::VulkanUtil::allocateVulkanCommandBufferPtr(
+            p_logicalDevice,
+            p_commandPool,
+            1
+        )[0]
+    );
+
+    vk::CommandBufferBeginInfo commandBufferBeginInfo(
+        vk::CommandBufferUsageFlagBits::eOneTimeSubmit
+    );
+    p_commandBuffer->begin(commandBufferBeginInfo);
+
+    return p_commandBuffer;
+}
+
+vk::AccessFlags
+quartz::rendering::UploadBatch::getDestinationAccessMask(
+    const vk::BufferUsageFlags usageFlags
+) {
+    vk::AccessFlags accessMask;
+
+    if (usageFlags & vk::BufferUsageFlagBits::eVertexBuffer) {
+        accessMask |= vk::AccessFlagBits::eVertexAttributeRead;
+    }
+    if (usageFlags & vk::BufferUsageFlagBits::eIndexBuffer) {
+        accessMask |= vk::AccessFlagBits::eIndexRead;
+    }
+    if (usageFlags & (vk::BufferUsageFlagBits::eUniformBuffer | vk::BufferUsageFlagBits::eUniformTexelBuffer)) {
+        accessMask |= vk::AccessFlagBits::eUniformRead;
+    }
+    if (usageFlags & (vk::BufferUsageFlagBits::eStorageBuffer | vk::BufferUsageFlagBits::eStorageTexelBuffer)) {
+        accessMask |= vk::AccessFlagBits::eShaderRead;
+    }
+
+    return accessMask;
+}
+
+vk::PipelineStageFlags
+quartz::rendering::UploadBatch::getDestinationStageMask(
+    const vk::BufferUsageFlags usageFlags
+) {
+    vk::PipelineStageFlags stageMask;
+
+    if (usageFlags & (vk::BufferUsageFlagBits::eVertexBuffer | vk::BufferUsageFlagBits::eIndexBuffer)) {
+        stageMask |= vk::PipelineStageFlagBits::eVertexInput;
+    }
+    if (
+        usageFlags & (
+            vk::BufferUsageFlagBits::eUniformBuffer |
+            vk::BufferUsageFlagBits::eUniformTexelBuffer |
+            vk::BufferUsageFlagBits::eStorageBuffer |
+            vk::BufferUsageFlagBits::eStorageTexelBuffer
+        )
+    ) {
+        stageMask |= vk::PipelineStageFlagBits::eVertexShader | vk::PipelineStageFlagBits::eFragmentShader;
+    }
+
+    return stageMask ? stageMask : vk::PipelineStageFlags(vk::PipelineStageFlagBits::eAllCommands);
+}
+
+quartz::rendering::UploadBatch::UploadBatch(
+    const quartz::rendering::Device& renderingDevice
+) :
+    mp_outerBatch(quartz::rendering::UploadBatch::p_recordingBatch),
+    mp_renderingDevice(&renderingDevice),
+    mp_vulkanTransferCommandPool(
+        mp_outerBatch ?
+            vk::UniqueCommandPool() :
+            quartz::rendering::VulkanUtil::createVulkanCommandPoolPtr(
+                renderingDevice.getTransferQueueFamilyIndex(),
+                renderingDevice.getVulkanLogicalDevicePtr(),
+                vk::CommandPoolCreateFlagBits::eTransient
+            )
+    ),
+    mp_vulkanTransferCommandBuffer(
+        quartz::rendering::UploadBatch::beginVulkanCommandBufferPtr(
+            renderingDevice.getVulkanLogicalDevicePtr(),
+            mp_vulkanTransferCommandPool
+        )
+    ),
+    mp_vulkanAcquireCommandPool(
+        mp_outerBatch || !renderingDevice.getHasDedicatedTransferQueue() ?
+            vk::UniqueCommandPool() :
+            quartz::rendering::VulkanUtil::createVulkanCommandPoolPtr(
+                renderingDevice.getGraphicsQueueFamilyIndex(),
+                renderingDevice.getVulkanLogicalDevicePtr(),
+                vk::CommandPoolCreateFlagBits::eTransient
+            )
+    ),
+    mp_vulkanAcquireCommandBuffer(
+        quartz::rendering::UploadBatch::beginVulkanCommandBufferPtr(
+            renderingDevice.getVulkanLogicalDevicePtr(),
+            mp_vulkanAcquireCommandPool
+        )
+    ),
+    mp_vulkanTransferCompleteSemaphore(
+        mp_vulkanAcquireCommandPool ?
+            renderingDevice.getVulkanLogicalDevicePtr()->createSemaphoreUnique(vk::SemaphoreCreateInfo()) :
+            vk::UniqueSemaphore()
+    ),
+    mp_vulkanUploadCompleteFence(
+        mp_outerBatch ?
+            vk::UniqueFence() :
+            renderingDevice.getVulkanLogicalDevicePtr()->createFenceUnique(vk::FenceCreateInfo())
+    ),
+    mp_vulkanStagingRingBuffer(),
+    m_stagingRingMemoryAllocation(),
+    m_stagingRingHeadBytes(0),
+    m_oversizedStagingBufferPtrs(),
+    m_oversizedStagingMemoryAllocations(),
+    m_bufferBarriers(),
+    m_imageBarriers(),
+    m_destinationStageMask(),
+    m_isSubmitted(false),
+    m_isWaitPending(false)
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    if (mp_outerBatch) {
+        LOG_TRACEthis("Joining upload batch {} which is already recording", static_cast<void*>(mp_outerBatch));
+        return;
+    }
+
+    LOG_TRACEthis("Recording uploads on {} queue family {}", renderingDevice.getHasDedicatedTransferQueue() ? "dedicated transfer" : "graphics", renderingDevice.getTransferQueueFamilyIndex());
+    quartz::rendering::UploadBatch::p_recordingBatch = this;
+}
+
+quartz::rendering::UploadBatch::~UploadBatch() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    if (mp_outerBatch) {
+        return;
+    }
+
+    if (!m_isSubmitted && (!m_bufferBarriers.empty() || !m_imageBarriers.empty())) {
+        LOG_WARNINGthis("Discarding {} buffer and {} image uploads which were never submitted", m_bufferBarriers.size(), m_imageBarriers.size());
+    }
+
+    // The staging memory and command buffers are about to go, so the gpu has to be done with them
+    if (m_isWaitPending) {
+        LOG_TRACEthis("Waiting for uploads which were submitted without waiting");
+        this->waitForRecorded();
+    }
+
+    // We may have stopped recording long ago, and another batch may have started since
+    if (quartz::rendering::UploadBatch::p_recordingBatch == this) {
+        quartz::rendering::UploadBatch::p_recordingBatch = nullptr;
+    }
+}
+
+bool
+quartz::rendering::UploadBatch::getIsComplete() const {
+    if (!m_isWaitPending) {
+        return true;
+    }
+
+    return mp_renderingDevice->getVulkanLogicalDevicePtr()->getFenceStatus(*mp_vulkanUploadCompleteFence) == vk::Result::eSuccess;
+}
+
+quartz::rendering::UploadBatch::StagingRange
+quartz::rendering::UploadBatch::stageData(
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
+    const uint32_t sizeBytes,
+    const vk::DeviceSize alignment
+) {
+    const vk::UniqueDevice& p_logicalDevice = mp_renderingDevice->getVulkanLogicalDevicePtr();
+
+    quartz::rendering::DeviceMemoryAllocator::recordStagedBytes(sizeBytes);
+
+    if (sizeBytes > quartz::rendering::UploadBatch::stagingRingBytes) {
+        LOG_TRACEthis("{} bytes doesn't fit in the staging ring. Giving it a staging buffer of its own", sizeBytes);
+
+        m_oversizedStagingBufferPtrs.push_back(
+            quartz::rendering::BufferUtil::createVulkanBufferPtr(
+                p_logicalDevice,
+                sizeBytes,
+                vk::BufferUsageFlagBits::eTransferSrc
+            )
+        );
+        m_oversizedStagingMemoryAllocations.push_back(
+            quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
+                mp_renderingDevice->getVulkanPhysicalDevice(),
+                p_logicalDevice,
+                sizeBytes,
+                m_oversizedStagingBufferPtrs.back(),
+                {
+                    vk::MemoryPropertyFlagBits::eHostVisible |
+                    vk::MemoryPropertyFlagBits::eHostCoherent
+                },
+                quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient
+            )
+        );
+        writeStagingData(static_cast<uint8_t*>(m_oversizedStagingMemoryAllocations.back().getMappedLocalMemoryPtr()));
+
+        return {*(m_oversizedStagingBufferPtrs.back()), 0};
+    }
+
+    if (!mp_vulkanStagingRingBuffer) {
+        LOG_TRACEthis("Creating {} byte staging ring", quartz::rendering::UploadBatch::stagingRingBytes);
+
+        mp_vulkanStagingRingBuffer = quartz::rendering::BufferUtil::createVulkanBufferPtr(
+            p_logicalDevice,
+            quartz::rendering::UploadBatch::stagingRingBytes,
+            vk::BufferUsageFlagBits::eTransferSrc
+        );
+        m_stagingRingMemoryAllocation = quartz::rendering::BufferUtil::allocateVulkanPhysicalDeviceMemory(
+            mp_renderingDevice->getVulkanPhysicalDevice(),
+            p_logicalDevice,
+            quartz::rendering::UploadBatch::stagingRingBytes,
+            mp_vulkanStagingRingBuffer,
+            {
+                vk::MemoryPropertyFlagBits::eHostVisible |
+                vk::MemoryPropertyFlagBits::eHostCoherent
+            },
+            quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient
+        );
+        m_stagingRingHeadBytes = 0;
+    }
+
+    vk::DeviceSize offset = quartz::rendering::DeviceMemoryAllocator::alignUp(m_stagingRingHeadBytes, alignment);
+    if (offset + sizeBytes > quartz::rendering::UploadBatch::stagingRingBytes) {
+        LOG_TRACEthis("Staging ring is full. Flushing before wrapping around");
+        this->flush(true);
+        offset = 0;
+    }
+
+    writeStagingData(static_cast<uint8_t*>(m_stagingRingMemoryAllocation.getMappedLocalMemoryPtr()) + offset);
+    m_stagingRingHeadBytes = offset + sizeBytes;
+
+    return {*mp_vulkanStagingRingBuffer, offset};
+}
+
+void
+quartz::rendering::UploadBatch::recordBufferUpload(
+    const void* p_data,
+    const uint32_t sizeBytes,
+    const vk::UniqueBuffer& p_buffer,
+    const vk::BufferUsageFlags usageFlags
+) {
+    if (mp_outerBatch) {
+        mp_outerBatch->recordBufferUpload(p_data, sizeBytes, p_buffer, usageFlags);
+        return;
+    }
+
+    LOG_FUNCTION_SCOPE_TRACEthis("{} bytes", sizeBytes);
+
+    if (m_isSubmitted) {
+        LOG_THROW(BUFFER_UPLOAD, util::RichException<uint32_t>, sizeBytes, "Cannot record a buffer upload into an upload batch which was already submitted");
+    }
+
+    const quartz::rendering::UploadBatch::StagingRange stagingRange = this->stageData(
+        [p_data, sizeBytes](uint8_t* p_stagingData) { memcpy(p_stagingData, p_data, sizeBytes); },
+        sizeBytes,
+        16
+    );
+
+    vk::BufferCopy bufferCopyRegion(
+        stagingRange.offset,
+        0,
+        sizeBytes
+    );
+
+    mp_vulkanTransferCommandBuffer->copyBuffer(
+        stagingRange.vulkanBuffer,
+        *p_buffer,
+        bufferCopyRegion
+    );
+
+    const bool transferOwnership = mp_renderingDevice->getHasDedicatedTransferQueue();
+
+    m_bufferBarriers.emplace_back(
+        vk::AccessFlagBits::eTransferWrite,
+        quartz::rendering::UploadBatch::getDestinationAccessMask(usageFlags),
+        transferOwnership ? mp_renderingDevice->getTransferQueueFamilyIndex() : VK_QUEUE_FAMILY_IGNORED,
+        transferOwnership ? mp_renderingDevice->getGraphicsQueueFamilyIndex() : VK_QUEUE_FAMILY_IGNORED,
+        *p_buffer,
+        0,
+        VK_WHOLE_SIZE
+    );
+    m_destinationStageMask |= quartz::rendering::UploadBatch::getDestinationStageMask(usageFlags);
+}
+
+void
+quartz::rendering::UploadBatch::recordImageUpload(
+    const void* p_data,
+    const uint32_t sizeBytes,
+    const vk::UniqueImage& p_image,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t layerCount
+) {
+    this->recordImageUpload(
+        [p_data, sizeBytes](uint8_t* p_stagingData) { memcpy(p_stagingData, p_data, sizeBytes); },
+        sizeBytes,
+        p_image,
+        {{imageWidth, imageHeight, 0}},
+        layerCount
+    );
+}
+
+void
+quartz::rendering::UploadBatch::recordImageUpload(
+    const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
+    const uint32_t sizeBytes,
+    const vk::UniqueImage& p_image,
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+    const uint32_t layerCount
+) {
+    if (mp_outerBatch) {
+        mp_outerBatch->recordImageUpload(writeStagingData, sizeBytes, p_image, levels, layerCount);
+        return;
+    }
+
+    LOG_FUNCTION_SCOPE_TRACEthis("{} bytes, {}x{} with {} layers and {} mip levels", sizeBytes, levels[0].width, levels[0].height, layerCount, levels.size());
+
+    if (m_isSubmitted) {
+        LOG_THROW(BUFFER_UPLOAD, util::RichException<uint32_t>, sizeBytes, "Cannot record an image upload into an upload batch which was already submitted");
+    }
+
+    // Buffer to image copies must start on a multiple of the texel size, or of the block size for
+    // block compressed formats. Blocks are at most 16 bytes, which we always align to anyway
+    const vk::DeviceSize baseLevelBytes = levels.size() > 1 ? levels[1].offsetBytes : sizeBytes;
+    const vk::DeviceSize texelBytes = std::max<vk::DeviceSize>(baseLevelBytes / (levels[0].width * levels[0].height * layerCount), 1);
+    const quartz::rendering::UploadBatch::StagingRange stagingRange = this->stageData(writeStagingData, sizeBytes, std::lcm<vk::DeviceSize>(texelBytes, 16));
+
+    const vk::ImageSubresourceRange subresourceRange(
+        vk::ImageAspectFlagBits::eColor,
+        0,
+        static_cast<uint32_t>(levels.size()),
+        0,
+        layerCount
+    );
+
+    LOG_TRACEthis("Transitioning image from undefined layout to optimal transfer destination layout");
+    vk::ImageMemoryBarrier transferDestinationBarrier(
+        {},
+        vk::AccessFlagBits::eTransferWrite,
+        vk::ImageLayout::eUndefined,
+        vk::ImageLayout::eTransferDstOptimal,
+        VK_QUEUE_FAMILY_IGNORED,
+        VK_QUEUE_FAMILY_IGNORED,
+        *p_image,
+        subresourceRange
+    );
+    mp_vulkanTransferCommandBuffer->pipelineBarrier(
+        vk::PipelineStageFlagBits::eTopOfPipe,
+        vk::PipelineStageFlagBits::eTransfer,
+        {},
+        {},
+        {},
+        transferDestinationBarrier
+    );
+
+    std::vector<vk::BufferImageCopy> bufferImageCopies;
+    bufferImageCopies.reserve(levels.size());
+    for (uint32_t i = 0; i < levels.size(); ++i) {
+        bufferImageCopies.emplace_back(
+            stagingRange.offset + levels[i].offsetBytes,
+            0,
+            0,
+            vk::ImageSubresourceLayers(
+                vk::ImageAspectFlagBits::eColor,
+                i,
+                0,
+                layerCount
+            ),
+            vk::Offset3D(
+                0,
+                0,
+                0
+            ),
+            vk::Extent3D(
+                levels[i].width,
+                levels[i].height,
+                1
+            )
+        );
+    }
+
+    mp_vulkanTransferCommandBuffer->copyBufferToImage(
+        stagingRange.vulkanBuffer,
+        *p_image,
+        vk::ImageLayout::eTransferDstOptimal,
+        bufferImageCopies
+    );
+
+    const bool transferOwnership = mp_renderingDevice->getHasDedicatedTransferQueue();
+
+    m_imageBarriers.emplace_back(
+        vk::AccessFlagBits::eTransferWrite,
+        vk::AccessFlagBits::eShaderRead,
+        vk::ImageLayout::eTransferDstOptimal,
+        vk::ImageLayout::eShaderReadOnlyOptimal,
+        transferOwnership ? mp_renderingDevice->getTransferQueueFamilyIndex() : VK_QUEUE_FAMILY_IGNORED,
+        transferOwnership ? mp_renderingDevice->getGraphicsQueueFamilyIndex() : VK_QUEUE_FAMILY_IGNORED,
+        *p_image,
+        subresourceRange
+    );
+    m_destinationStageMask |= vk::PipelineStageFlagBits::eFragmentShader;
+}
+
+void
+quartz::rendering::UploadBatch::submitRecorded() {
+    if (!mp_renderingDevice->getHasDedicatedTransferQueue()) {
+        mp_vulkanTransferCommandBuffer->pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            m_destinationStageMask,
+            {},
+            {},
+            m_bufferBarriers,
+            m_imageBarriers
+        );
+        mp_vulkanTransferCommandBuffer->end();
+
+        vk::SubmitInfo submitInfo(
+            0,
+            nullptr,
+            nullptr,
+            1,
+            &(*mp_vulkanTransferCommandBuffer),
+            0,
+            nullptr
+        );
+        mp_renderingDevice->getVulkanGraphicsQueue().submit(submitInfo, *mp_vulkanUploadCompleteFence);
+    } else {
+        /**
+         * @brief A queue family ownership transfer is a matching pair of barriers. The release half on
+         *   the transfer queue ignores the destination access mask, and the acquire half on the graphics
+         *   queue ignores the source access mask
+         */
+        std::vector<vk::BufferMemoryBarrier> bufferReleaseBarriers = m_bufferBarriers;
+        std::vector<vk::ImageMemoryBarrier> imageReleaseBarriers = m_imageBarriers;
+        for (vk::BufferMemoryBarrier& barrier : bufferReleaseBarriers) { barrier.dstAccessMask = {}; }
+        for (vk::ImageMemoryBarrier& barrier : imageReleaseBarriers) { barrier.dstAccessMask = {}; }
+        for (vk::BufferMemoryBarrier& barrier : m_bufferBarriers) { barrier.srcAccessMask = {}; }
+        for (vk::ImageMemoryBarrier& barrier : m_imageBarriers) { barrier.srcAccessMask = {}; }
+
+        mp_vulkanTransferCommandBuffer->pipelineBarrier(
+            vk::PipelineStageFlagBits::eTransfer,
+            vk::PipelineStageFlagBits::eBottomOfPipe,
+            {},
+            {},
+            bufferReleaseBarriers,
+            imageReleaseBarriers
+        );
+        mp_vulkanTransferCommandBuffer->end();
+
+        /**
+         * @brief The acquire's first scope has to include the stages the semaphore wait blocks, otherwise
+         *   no dependency chain forms and its layout transition could run before the transfer queue signals
+         */
+        mp_vulkanAcquireCommandBuffer->pipelineBarrier(
+            m_destinationStageMask,
+            m_destinationStageMask,
+            {},
+            {},
+            m_bufferBarriers,
+            m_imageBarriers
+        );
+        mp_vulkanAcquireCommandBuffer->end();
+
+        vk::SubmitInfo transferSubmitInfo(
+            0,
+            nullptr,
+            nullptr,
+            1,
+            &(*mp_vulkanTransferCommandBuffer),
+            1,
+            &(*mp_vulkanTransferCompleteSemaphore)
+        );
+        mp_renderingDevice->getVulkanTransferQueue().submit(transferSubmitInfo, VK_NULL_HANDLE);
+
+        vk::SubmitInfo acquireSubmitInfo(
+            1,
+            &(*mp_vulkanTransferCompleteSemaphore),
+            &m_destinationStageMask,
+            1,
+            &(*mp_vulkanAcquireCommandBuffer),
+            0,
+            nullptr
+        );
+        mp_renderingDevice->getVulkanGraphicsQueue().submit(acquireSubmitInfo, *mp_vulkanUploadCompleteFence);
+    }
+}
+
+void
+quartz::rendering::UploadBatch::waitForRecorded() {
+    const vk::UniqueDevice& p_logicalDevice = mp_renderingDevice->getVulkanLogicalDevicePtr();
+
+    LOG_TRACEthis("Waiting for upload fence");
+    vk::Result result = p_logicalDevice->waitForFences(
+        *mp_vulkanUploadCompleteFence,
+        true,
+        std::numeric_limits<uint64_t>::max()
+    );
+    if (result != vk::Result::eSuccess) {
+        LOG_THROW(BUFFER_UPLOAD, util::RichException<vk::Result>, result, "Failed to wait for uploads to complete");
+    }
+
+    LOG_TRACEthis("Successfully uploaded {} buffers and {} images", m_bufferBarriers.size(), m_imageBarriers.size());
+
+    // ----- the fence signaled, so everything staged so far can be reclaimed ----- //
+
+    m_bufferBarriers.clear();
+    m_imageBarriers.clear();
+    m_destinationStageMask = {};
+    m_stagingRingHeadBytes = 0;
+    m_oversizedStagingMemoryAllocations.clear();
+    m_oversizedStagingBufferPtrs.clear();
+    m_isWaitPending = false;
+}
+
+void
+quartz::rendering::UploadBatch::flush(
+    const bool continueRecording
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} buffers, {} images", m_bufferBarriers.size(), m_imageBarriers.size());
+
+    if (m_bufferBarriers.empty() && m_imageBarriers.empty()) {
+        LOG_TRACEthis("Nothing was recorded. Not submitting anything");
+        return;
+    }
+
+    this->submitRecorded();
+    this->waitForRecorded();
+
+    if (!continueRecording) {
+        return;
+    }
+
+    const vk::UniqueDevice& p_logicalDevice = mp_renderingDevice->getVulkanLogicalDevicePtr();
+
+    p_logicalDevice->resetFences(*mp_vulkanUploadCompleteFence);
+
+    p_logicalDevice->resetCommandPool(*mp_vulkanTransferCommandPool);
+    mp_vulkanTransferCommandBuffer->begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+
+    if (mp_vulkanAcquireCommandPool) {
+        p_logicalDevice->resetCommandPool(*mp_vulkanAcquireCommandPool);
+        mp_vulkanAcquireCommandBuffer->begin(vk::CommandBufferBeginInfo(vk::CommandBufferUsageFlagBits::eOneTimeSubmit));
+    }
+}
+
+void
+quartz::rendering::UploadBatch::submit() {
+    if (mp_outerBatch) {
+        return;
+    }
+
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    if (m_isSubmitted) {
+        LOG_WARNINGthis("Upload batch was already submitted");
+        return;
+    }
+    m_isSubmitted = true;
+
+    // Anything recorded from here on needs a batch of its own, as this one can't take any more
+    if (quartz::rendering::UploadBatch::p_recordingBatch == this) {
+        quartz::rendering::UploadBatch::p_recordingBatch = nullptr;
+    }
+
+    this->flush(false);
+
+    LOG_TRACEthis("Releasing staging ring");
+    m_stagingRingMemoryAllocation.reset();
+    mp_vulkanStagingRingBuffer.reset();
+}
+
+void
+quartz::rendering::UploadBatch::submitWithoutWaiting() {
+    if (mp_outerBatch) {
+        return;
+    }
+
+    LOG_FUNCTION_SCOPE_TRACEthis("{} buffers, {} images", m_bufferBarriers.size(), m_imageBarriers.size());
+
+    if (m_isSubmitted) {
+        LOG_WARNINGthis("Upload batch was already submitted");
+        return;
+    }
+    m_isSubmitted = true;
+
+    // Anything recorded from here on needs a batch of its own, as this one can't take any more
+    if (quartz::rendering::UploadBatch::p_recordingBatch == this) {
+        quartz::rendering::UploadBatch::p_recordingBatch = nullptr;
+    }
+
+    if (m_bufferBarriers.empty() && m_imageBarriers.empty()) {
+        LOG_TRACEthis("Nothing was recorded. Not submitting anything");
+        return;
+    }
+
+    this->submitRecorded();
+    m_isWaitPending = true;
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+#include "quartz/rendering/device/Device.hpp"
+
+namespace quartz {
+namespace rendering {
+    class UploadBatch;
+}
+}
+
+/**
+ * @brief Gathers the copies and layout transitions for staged buffers and images into a single
+ *   command buffer so loading a model or a scene costs one submission instead of one for every
+ *   resource. Completion is tracked with a fence instead of idling the queue.
+ *
+ * @brief If the device has a dedicated transfer queue the copies are recorded on it, and ownership of
+ *   every resource is released to the graphics queue family at the end of the batch. A second, tiny
+ *   command buffer on the graphics queue acquires them once the transfer queue signals it is done.
+ *
+ * @brief Only one batch records at a time. Any batch constructed while another is recording joins it,
+ *   forwarding everything recorded into it and ignoring calls to submit, so a model loaded while a
+ *   scene is loading lands in the scene's submission.
+ *
+ * @brief Source data is copied into a ring of host visible staging memory owned by the recording
+ *   batch the moment it is recorded, so callers don't need to keep their data (or a staging buffer of
+ *   their own) around. When the ring fills up the batch flushes what it has recorded so far, waits for
+ *   it on the fence, and starts again from the front of the ring. The ring is released along with the
+ *   batch, so no host visible memory is held on to once loading is done.
+ *
+ * @brief Every buffer and image recorded into a batch must stay alive until the batch is submitted,
+ *   or until it has completed if it was submitted without waiting.
+ */
+class quartz::rendering::UploadBatch {
+public: // classes
+    /**
+     * @brief Fills the staging memory it is handed with the bytes being uploaded, for callers that
+     *   can produce their data straight into staging memory instead of into a buffer of their own
+     */
+    using StagingDataWriter = std::function<void(uint8_t* p_stagingData)>;
+
+    /**
+     * @brief Where one mip level of an image is within the data being staged. Every layer of a level
+     *   is back to back, which is how copyBufferToImage expects to find them
+     */
+    struct ImageLevel {
+    public: // member variables
+        uint32_t width;
+        uint32_t height;
+        vk::DeviceSize offsetBytes;
+    };
+
+public: // member functions
+    UploadBatch(const quartz::rendering::Device& renderingDevice);
+    UploadBatch(const UploadBatch& other) = delete;
+    ~UploadBatch();
+
+    UploadBatch& operator=(const UploadBatch& other) = delete;
+
+    USE_LOGGER(BUFFER_UPLOAD);
+
+    bool getIsRecording() const { return mp_outerBatch == nullptr; }
+
+    /**
+     * @brief Whether the gpu has finished everything submitted so far. Always true for a batch which
+     *   was submitted and waited on, or which joined another
+     */
+    bool getIsComplete() const;
+
+    void recordBufferUpload(
+        const void* p_data,
+        const uint32_t sizeBytes,
+        const vk::UniqueBuffer& p_buffer,
+        const vk::BufferUsageFlags usageFlags
+    );
+    void recordImageUpload(
+        const void* p_data,
+        const uint32_t sizeBytes,
+        const vk::UniqueImage& p_image,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t layerCount
+    );
+    void recordImageUpload(
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
+        const uint32_t sizeBytes,
+        const vk::UniqueImage& p_image,
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const uint32_t layerCount
+    );
+
+    /**
+     * @brief Submits everything recorded so far and waits on the batch's fence for the copies to
+     *   finish, after which the staging ring may be reclaimed. The batch stops being the one other
+     *   batches join. Does nothing if this batch joined another
+     */
+    void submit();
+    /**
+     * @brief Submits everything recorded so far without waiting for it, for uploads made while
+     *   rendering which can't stall a frame. Nothing recorded may be used until getIsComplete, and the
+     *   batch stops being the one other batches join. Destroying it waits for the copies to finish, as
+     *   the staging memory is released along with it. Does nothing if this batch joined another
+     */
+    void submitWithoutWaiting();
+
+public: // static variables
+    static constexpr vk::DeviceSize stagingRingBytes = 32 * 1024 * 1024;
+
+private: // classes
+    struct StagingRange {
+    public: // member variables
+        vk::Buffer vulkanBuffer;
+        vk::DeviceSize offset;
+    };
+
+private: // member functions
+    quartz::rendering::UploadBatch::StagingRange stageData(
+        const quartz::rendering::UploadBatch::StagingDataWriter& writeStagingData,
+        const uint32_t sizeBytes,
+        const vk::DeviceSize alignment
+    );
+    void flush(const bool continueRecording);
+    void submitRecorded();
+    void waitForRecorded();
+
+private: // static functions
+    static vk::UniqueCommandBuffer beginVulkanCommandBufferPtr(
+        const vk::UniqueDevice& p_logicalDevice,
+        const vk::UniqueCommandPool& p_commandPool
+    );
+    static vk::AccessFlags getDestinationAccessMask(const vk::BufferUsageFlags usageFlags);
+    static vk::PipelineStageFlags getDestinationStageMask(const vk::BufferUsageFlags usageFlags);
+
+private: // member variables
+    quartz::rendering::UploadBatch* mp_outerBatch; // the batch we joined, nullptr if we are recording
+    const quartz::rendering::Device* mp_renderingDevice;
+
+    vk::UniqueCommandPool mp_vulkanTransferCommandPool;
+    vk::UniqueCommandBuffer mp_vulkanTransferCommandBuffer;
+
+    // Only used when the device has a dedicated transfer queue
+    vk::UniqueCommandPool mp_vulkanAcquireCommandPool;
+    vk::UniqueCommandBuffer mp_vulkanAcquireCommandBuffer;
+    vk::UniqueSemaphore mp_vulkanTransferCompleteSemaphore;
+
+    vk::UniqueFence mp_vulkanUploadCompleteFence;
+
+    // Created the first time something is staged
+    vk::UniqueBuffer mp_vulkanStagingRingBuffer;
+    quartz::rendering::DeviceMemoryAllocation m_stagingRingMemoryAllocation;
+    vk::DeviceSize m_stagingRingHeadBytes;
+
+    // Uploads too large for the ring get a staging buffer to themselves, released at the next flush
+    std::vector<vk::UniqueBuffer> m_oversizedStagingBufferPtrs;
+    std::vector<quartz::rendering::DeviceMemoryAllocation> m_oversizedStagingMemoryAllocations;
+
+    /**
+     * @brief Barriers making each resource visible to the stages which will consume it. These are
+     *   gathered while recording and issued all at once when the batch is submitted
+     */
+    std::vector<vk::BufferMemoryBarrier> m_bufferBarriers;
+    std::vector<vk::ImageMemoryBarrier> m_imageBarriers;
+    vk::PipelineStageFlags m_destinationStageMask;
+
+    bool m_isSubmitted;
+    bool m_isWaitPending; // submitted without waiting, and not waited on since
+
+private: // static variables
+    static quartz::rendering::UploadBatch* p_recordingBatch;
+};
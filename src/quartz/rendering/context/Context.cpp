@@ -1,19 +1,32 @@
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <cstring>
+#include <numbers>
 #include <string>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/geometry/Frustum.hpp"
 #include "math/transform/Mat4.hpp"
 
 #include "util/file_system/FileSystem.hpp"
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+#include "quartz/rendering/buffer/LocallyMappedBuffer.hpp"
 #include "quartz/rendering/context/Context.hpp"
 #include "quartz/rendering/cube_map/CubeMap.hpp"
 #include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/DrawPacket.hpp"
+#include "quartz/rendering/model/InstanceData.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
 #include "quartz/rendering/pipeline/Pipeline.hpp"
 #include "quartz/rendering/pipeline/PushConstantInfo.hpp"
 #include "quartz/rendering/pipeline/UniformBufferInfo.hpp"
 #include "quartz/rendering/pipeline/UniformSamplerInfo.hpp"
 #include "quartz/rendering/pipeline/UniformTextureArrayInfo.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
+#include "quartz/rendering/texture/TextureStreamer.hpp"
 #include "quartz/scene/camera/Camera.hpp"
 #include "quartz/scene/light/AmbientLight.hpp"
 #include "quartz/scene/light/DirectionalLight.hpp"
@@ -58,7 +71,7 @@ quartz::rendering::Context::createSkyBoxRenderingPipeline(
         util::FileSystem::getCompiledShaderAbsoluteFilepath("skybox.vert"),
         util::FileSystem::getCompiledShaderAbsoluteFilepath("skybox.frag"),
         maxNumFramesInFlight,
-        quartz::rendering::CubeMap::getVulkanVertexInputBindingDescription(),
+        {quartz::rendering::CubeMap::getVulkanVertexInputBindingDescription()},
         quartz::rendering::CubeMap::getVulkanVertexInputAttributeDescriptions(),
         vk::CullModeFlagBits::eFront,
         false,
@@ -79,8 +92,19 @@ quartz::rendering::Context::createDoodadRenderingPipeline(
 ) {
     LOG_FUNCTION_SCOPE_DEBUG(CONTEXT, "");
 
+    std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = quartz::rendering::Vertex::getVulkanVertexInputBindingDescriptions();
+    vertexInputBindingDescriptions.push_back(quartz::rendering::InstanceData::getVulkanVertexInputBindingDescription());
+
+    std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = quartz::rendering::Vertex::getVulkanVertexInputAttributeDescriptions();
+    const std::vector<vk::VertexInputAttributeDescription> instanceInputAttributeDescriptions = quartz::rendering::InstanceData::getVulkanVertexInputAttributeDescriptions();
+    vertexInputAttributeDescriptions.insert(
+        vertexInputAttributeDescriptions.end(),
+        instanceInputAttributeDescriptions.begin(),
+        instanceInputAttributeDescriptions.end()
+    );
+
     std::vector<quartz::rendering::PushConstantInfo> pushConstantInfos = {
-        // perObjectVertexPushConstant (for model matrix)
+        // perMeshVertexPushConstant (for the node's matrix within the model, the doodad's matrix comes from the instance buffer)
         {
             vk::ShaderStageFlagBits::eVertex,
             0,
@@ -202,8 +226,8 @@ quartz::rendering::Context::createDoodadRenderingPipeline(
         util::FileSystem::getCompiledShaderAbsoluteFilepath("shader.vert"),
         util::FileSystem::getCompiledShaderAbsoluteFilepath("shader.frag"),
         maxNumFramesInFlight,
-        quartz::rendering::Vertex::getVulkanVertexInputBindingDescription(),
-        quartz::rendering::Vertex::getVulkanVertexInputAttributeDescriptions(),
+        vertexInputBindingDescriptions,
+        vertexInputAttributeDescriptions,
         vk::CullModeFlagBits::eBack,
         true,
         pushConstantInfos,
@@ -214,6 +238,53 @@ quartz::rendering::Context::createDoodadRenderingPipeline(
     };
 }
 
+std::vector<quartz::rendering::LocallyMappedBuffer>
+quartz::rendering::Context::createDoodadInstanceBuffers(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t maxNumFramesInFlight,
+    const uint32_t instanceCapacity
+) {
+    LOG_FUNCTION_SCOPE_TRACE(CONTEXT, "{} frames, {} instances each", maxNumFramesInFlight, instanceCapacity);
+
+    std::vector<quartz::rendering::LocallyMappedBuffer> instanceBuffers;
+    instanceBuffers.reserve(maxNumFramesInFlight);
+
+    for (uint32_t i = 0; i < maxNumFramesInFlight; ++i) {
+        instanceBuffers.emplace_back(
+            renderingDevice,
+            sizeof(quartz::rendering::InstanceData) * instanceCapacity,
+            vk::BufferUsageFlagBits::eVertexBuffer,
+            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+        );
+    }
+
+    return instanceBuffers;
+}
+
+quartz::rendering::TextureStreamer
+quartz::rendering::Context::createTextureStreamer(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t maxNumFramesInFlight
+) {
+    LOG_FUNCTION_SCOPE_TRACE(CONTEXT, "{} frames in flight", maxNumFramesInFlight);
+
+    const vk::PhysicalDeviceMemoryProperties memoryProperties = renderingDevice.getVulkanPhysicalDevice().getMemoryProperties();
+
+    vk::DeviceSize deviceLocalHeapSizeBytes = 0;
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i) {
+        if (memoryProperties.memoryHeaps[i].flags & vk::MemoryHeapFlagBits::eDeviceLocal) {
+            deviceLocalHeapSizeBytes = std::max(deviceLocalHeapSizeBytes, memoryProperties.memoryHeaps[i].size);
+        }
+    }
+    LOG_TRACE(CONTEXT, "Largest device local heap is {} bytes", deviceLocalHeapSizeBytes);
+
+    return {
+        deviceLocalHeapSizeBytes / 2,
+        8 * 1024 * 1024,
+        maxNumFramesInFlight
+    };
+}
+
 quartz::rendering::Context::Context(
     const std::string& applicationName,
     const uint32_t applicationMajorVersion,
@@ -265,19 +336,48 @@ quartz::rendering::Context::Context(
         m_renderingWindow,
         m_renderingRenderPass,
         m_maxNumFramesInFlight
-    )
+    ),
+    m_doodadInstanceBuffers(
+        quartz::rendering::Context::createDoodadInstanceBuffers(
+            m_renderingDevice,
+            m_maxNumFramesInFlight,
+            64
+        )
+    ),
+    m_instancedDoodadPtrs(),
+    m_visibleDoodadCount(0),
+    m_culledDoodadCount(0),
+    m_doodadRenderQueue(),
+    m_doodadRenderQueueStatistics(),
+    m_textureStreamer(
+        quartz::rendering::Context::createTextureStreamer(
+            m_renderingDevice,
+            m_maxNumFramesInFlight
+        )
+    ),
+    m_staleTextureArrayDescriptorSetCount(0)
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
 
 quartz::rendering::Context::~Context() {
     LOG_FUNCTION_CALL_TRACEthis("");
+
+    // The streamer's staging memory has to go back before we hand every empty block back to the device
+    m_renderingDevice.waitIdle();
+    m_textureStreamer.reset();
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
 }
 
 void
 quartz::rendering::Context::loadScene(const quartz::scene::Scene& scene) {
     LOG_FUNCTION_SCOPE_TRACEthis("");
 
+    // Any textures the streamer knew about are gone along with the previous scene
+    m_renderingDevice.waitIdle();
+    m_textureStreamer.reset();
+    m_staleTextureArrayDescriptorSetCount = 0;
+
     LOG_DEBUGthis("Updating skybox rendering pipeline's descriptor sets");
     m_skyBoxRenderingPipeline.updateUniformBufferDescriptorSets(m_renderingDevice);
     m_skyBoxRenderingPipeline.updateSamplerCubeDescriptorSets(m_renderingDevice, scene.getSkyBox().getCubeMap().getVulkanSamplerPtr(), scene.getSkyBox().getCubeMap().getVulkanImageViewPtr());
@@ -288,6 +388,8 @@ quartz::rendering::Context::loadScene(const quartz::scene::Scene& scene) {
     m_doodadRenderingPipeline.updateTextureArrayDescriptorSets(m_renderingDevice, quartz::rendering::Texture::getMasterTextureList());
 
     m_renderingSwapchain.setScreenClearColor(scene.getScreenClearColor());
+
+    quartz::rendering::DeviceMemoryAllocator::logStatistics();
 }
 
 void
@@ -315,6 +417,9 @@ quartz::rendering::Context::draw(
 
     quartz::scene::Camera::UniformBufferObject cameraUBO(scene.getCamera());
 
+    // This frame's descriptor sets aren't in use anymore, so textures can be swapped out from under them
+    streamTextures();
+
     // update pipelines
     updateSkyBoxPipeline(cameraUBO);
     updateDoodadPipeline(scene, cameraUBO);
@@ -373,6 +478,29 @@ quartz::rendering::Context::recreateSwapchain() {
     );
 }
 
+void
+quartz::rendering::Context::reserveDoodadInstanceBuffer(
+    const uint32_t instanceCount
+) {
+    const uint32_t requiredSizeBytes = sizeof(quartz::rendering::InstanceData) * instanceCount;
+    if (m_doodadInstanceBuffers[m_currentInFlightFrameIndex].getSizeBytes() >= requiredSizeBytes) {
+        return;
+    }
+
+    /**
+     * @brief We have already waited on this frame's in flight fence, so the gpu is no longer reading from this
+     *    frame's instance buffer and we are safe to replace it. We double the capacity so this rarely happens.
+     */
+    const uint32_t newInstanceCapacity = instanceCount * 2;
+    LOG_DEBUGthis("Growing frame {}'s doodad instance buffer to hold {} instances", m_currentInFlightFrameIndex, newInstanceCapacity);
+    m_doodadInstanceBuffers[m_currentInFlightFrameIndex] = quartz::rendering::LocallyMappedBuffer(
+        m_renderingDevice,
+        sizeof(quartz::rendering::InstanceData) * newInstanceCapacity,
+        vk::BufferUsageFlagBits::eVertexBuffer,
+        vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent
+    );
+}
+
 void
 quartz::rendering::Context::updateSkyBoxPipeline(
     const quartz::scene::Camera::UniformBufferObject& cameraUBO
@@ -463,14 +591,85 @@ quartz::rendering::Context::recordDoodadPipeline(
         m_currentInFlightFrameIndex
     );
 
+    const quartz::scene::Camera& camera = scene.getCamera();
+    const math::Frustum frustum(camera.getProjectionMatrix() * camera.getViewMatrix());
+
+    // Skip the doodads outside of the camera's view and group the rest by model so each primitive is drawn once for every doodad sharing its model
+    m_instancedDoodadPtrs.clear();
+    m_culledDoodadCount = 0;
     for (const quartz::scene::Doodad& doodad : scene.getDoodads()) {
-        m_renderingSwapchain.recordDoodadToDrawingCommandBuffer(
-            m_renderingDevice,
-            m_doodadRenderingPipeline,
-            doodad,
-            m_currentInFlightFrameIndex
-        );
+        if (!doodad.getModelPtr()) {
+            continue;
+        }
+
+        const math::AxisAlignedBoundingBox worldBoundingBox = doodad.getModelPtr()->getBoundingBox().getTransformed(doodad.getTransformationMatrix());
+        if (!frustum.intersects(worldBoundingBox)) {
+            m_culledDoodadCount++;
+            continue;
+        }
+
+        m_instancedDoodadPtrs.push_back(&doodad);
+        this->requestDoodadTextures(doodad, worldBoundingBox, camera);
+    }
+    m_visibleDoodadCount = m_instancedDoodadPtrs.size();
+    m_doodadRenderQueue.clear();
+    m_doodadRenderQueueStatistics = {};
+    LOG_TRACEthis("Recording {} visible doodads, culled {} doodads", m_visibleDoodadCount, m_culledDoodadCount);
+
+    if (m_instancedDoodadPtrs.empty()) {
+        return;
     }
+
+    std::sort(
+        m_instancedDoodadPtrs.begin(),
+        m_instancedDoodadPtrs.end(),
+        [](const quartz::scene::Doodad* p_doodadA, const quartz::scene::Doodad* p_doodadB) {
+            return p_doodadA->getModelPtr().get() < p_doodadB->getModelPtr().get();
+        }
+    );
+
+    this->reserveDoodadInstanceBuffer(m_instancedDoodadPtrs.size());
+    quartz::rendering::LocallyMappedBuffer& instanceBuffer = m_doodadInstanceBuffers[m_currentInFlightFrameIndex];
+    quartz::rendering::InstanceData* p_instances = static_cast<quartz::rendering::InstanceData*>(instanceBuffer.getMappedLocalMemoryPtr());
+
+    uint32_t firstInstance = 0;
+    while (firstInstance < m_instancedDoodadPtrs.size()) {
+        const quartz::rendering::Model* p_model = m_instancedDoodadPtrs[firstInstance]->getModelPtr().get();
+
+        uint32_t instanceCount = 0;
+        while (
+            firstInstance + instanceCount < m_instancedDoodadPtrs.size() &&
+            m_instancedDoodadPtrs[firstInstance + instanceCount]->getModelPtr().get() == p_model
+        ) {
+            memcpy(
+                &(p_instances[firstInstance + instanceCount].modelMatrix),
+                &(m_instancedDoodadPtrs[firstInstance + instanceCount]->getTransformationMatrix()),
+                sizeof(math::Mat4)
+            );
+            instanceCount++;
+        }
+
+        for (const quartz::rendering::DrawPacket& drawPacket : p_model->getDrawPackets()) {
+            m_doodadRenderQueue.push(
+                quartz::rendering::Context::doodadPipelineSortIndex,
+                drawPacket,
+                firstInstance,
+                instanceCount
+            );
+        }
+
+        firstInstance += instanceCount;
+    }
+
+    m_doodadRenderQueue.sort();
+
+    m_doodadRenderQueueStatistics = m_renderingSwapchain.recordRenderQueueToDrawingCommandBuffer(
+        m_doodadRenderingPipeline,
+        m_doodadRenderQueue,
+        instanceBuffer,
+        m_currentInFlightFrameIndex
+    );
+    LOG_TRACEthis("Recorded {} draws with {} binds, avoided {} binds", m_doodadRenderQueueStatistics.drawCount, m_doodadRenderQueueStatistics.getBindCount(), m_doodadRenderQueueStatistics.getBindsAvoidedCount());
 }
 
 void
@@ -489,6 +688,41 @@ quartz::rendering::Context::submitImage(
     );
 }
 
+void
+quartz::rendering::Context::streamTextures() {
+    if (m_textureStreamer.update(m_renderingDevice)) {
+        LOG_TRACEthis("Streamed textures changed, {} bytes are resident", m_textureStreamer.getResidentBytes());
+        m_staleTextureArrayDescriptorSetCount = m_maxNumFramesInFlight;
+    }
+
+    // Each frame in flight rewrites its own descriptor set once it is done with the previous images
+    if (m_staleTextureArrayDescriptorSetCount > 0) {
+        m_doodadRenderingPipeline.updateTextureArrayDescriptorSet(m_renderingDevice, quartz::rendering::Texture::getMasterTextureList(), m_currentInFlightFrameIndex);
+        m_staleTextureArrayDescriptorSetCount--;
+    }
+}
+
+void
+quartz::rendering::Context::requestDoodadTextures(
+    const quartz::scene::Doodad& doodad,
+    const math::AxisAlignedBoundingBox& worldBoundingBox,
+    const quartz::scene::Camera& camera
+) {
+    const float radius = worldBoundingBox.getHalfExtents().magnitude();
+    const float distance = std::max((worldBoundingBox.getCenter() - camera.getWorldPosition()).magnitude() - radius, 0.001f);
+    const float pixelsPerUnitAtUnitDistance = m_renderingWindow.getVulkanExtent().height / (2.0f * std::tan(camera.getFovDegrees() * std::numbers::pi_v<float> / 360.0f));
+    const uint32_t dimension = static_cast<uint32_t>(std::min(2.0f * radius / distance * pixelsPerUnitAtUnitDistance, 65536.0f));
+
+    for (const uint32_t materialMasterIndex : doodad.getModelPtr()->getMaterialMasterIndices()) {
+        const quartz::rendering::Material& material = *(quartz::rendering::Material::getMasterMaterialList()[materialMasterIndex]);
+        m_textureStreamer.request(material.getBaseColorTextureMasterIndex(), dimension);
+        m_textureStreamer.request(material.getMetallicRoughnessTextureMasterIndex(), dimension);
+        m_textureStreamer.request(material.getNormalTextureMasterIndex(), dimension);
+        m_textureStreamer.request(material.getEmissionTextureMasterIndex(), dimension);
+        m_textureStreamer.request(material.getOcclusionTextureMasterIndex(), dimension);
+    }
+}
+
 void
 quartz::rendering::Context::finish() {
     LOG_FUNCTION_SCOPE_TRACEthis("");
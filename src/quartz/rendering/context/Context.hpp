@@ -3,14 +3,19 @@
 #include <string>
 #include <vector>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/LocallyMappedBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/instance/Instance.hpp"
 #include "quartz/rendering/model/Model.hpp"
 #include "quartz/rendering/pipeline/Pipeline.hpp"
 #include "quartz/rendering/render_pass/RenderPass.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
 #include "quartz/rendering/swapchain/Swapchain.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureStreamer.hpp"
 #include "quartz/rendering/window/Window.hpp"
 #include "quartz/scene/camera/Camera.hpp"
 #include "quartz/scene/doodad/Doodad.hpp"
@@ -42,6 +47,13 @@ public: // member functions
 
     quartz::rendering::Window& getRenderingWindow() { return m_renderingWindow; }
 
+    uint32_t getVisibleDoodadCount() const { return m_visibleDoodadCount; }
+    uint32_t getCulledDoodadCount() const { return m_culledDoodadCount; }
+    const quartz::rendering::RenderQueue::Statistics& getDoodadRenderQueueStatistics() const { return m_doodadRenderQueueStatistics; }
+    const quartz::rendering::TextureStreamer& getTextureStreamer() const { return m_textureStreamer; }
+
+    quartz::rendering::TextureStreamer& getTextureStreamer() { return m_textureStreamer; }
+
     void loadScene(const quartz::scene::Scene& scene);
 
     void draw(
@@ -51,6 +63,9 @@ public: // member functions
     );
     void finish();
 
+private: // static variables
+    static constexpr uint8_t doodadPipelineSortIndex = 0;
+
 private: // static functions
     static quartz::rendering::Pipeline createSkyBoxRenderingPipeline(
         const quartz::rendering::Device& renderingDevice,
@@ -64,9 +79,22 @@ private: // static functions
         const quartz::rendering::RenderPass& renderingRenderPass,
         const uint32_t maxNumFramesInFlight
     );
+    static std::vector<quartz::rendering::LocallyMappedBuffer> createDoodadInstanceBuffers(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t maxNumFramesInFlight,
+        const uint32_t instanceCapacity
+    );
+    /**
+     * @brief Budgets half of the device's largest device local heap for streamed textures
+     */
+    static quartz::rendering::TextureStreamer createTextureStreamer(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t maxNumFramesInFlight
+    );
 
 private: // member functions
     void recreateSwapchain();
+    void reserveDoodadInstanceBuffer(const uint32_t instanceCount);
     void waitForImage();
     void updateSkyBoxPipeline( const quartz::scene::Camera::UniformBufferObject& cameraUBO);
     void updateDoodadPipeline(
@@ -77,6 +105,16 @@ private: // member functions
     void recordSkyBoxPipeline(const quartz::scene::Scene& scene);
     void recordDoodadPipeline(const quartz::scene::Scene& scene);
     void submitImage(const uint32_t availableSwapchainImageIndex);
+    void streamTextures();
+    /**
+     * @brief Asks for the doodad's textures at roughly as many texels across as the doodad is
+     *   pixels across on screen
+     */
+    void requestDoodadTextures(
+        const quartz::scene::Doodad& doodad,
+        const math::AxisAlignedBoundingBox& worldBoundingBox,
+        const quartz::scene::Camera& camera
+    );
 
 private: // member variables
     const uint32_t m_maxNumFramesInFlight;
@@ -88,5 +126,18 @@ private: // member variables
     quartz::rendering::Pipeline m_skyBoxRenderingPipeline;
     quartz::rendering::Pipeline m_doodadRenderingPipeline;
     quartz::rendering::Swapchain m_renderingSwapchain;
+
+    std::vector<quartz::rendering::LocallyMappedBuffer> m_doodadInstanceBuffers; // one per frame in flight
+    std::vector<const quartz::scene::Doodad*> m_instancedDoodadPtrs; // reused each frame to group doodads by model
+
+    // From the most recently recorded frame, only counting doodads with a model
+    uint32_t m_visibleDoodadCount;
+    uint32_t m_culledDoodadCount;
+
+    quartz::rendering::RenderQueue m_doodadRenderQueue; // reused each frame to sort the visible doodads' draw packets
+    quartz::rendering::RenderQueue::Statistics m_doodadRenderQueueStatistics; // from the most recently recorded frame
+
+    quartz::rendering::TextureStreamer m_textureStreamer;
+    uint32_t m_staleTextureArrayDescriptorSetCount; // frames in flight whose descriptor sets still refer to replaced texture images
 };
 
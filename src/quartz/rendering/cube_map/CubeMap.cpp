@@ -1,11 +1,19 @@
+#include <array>
+#include <future>
+#include <memory>
+#include <vector>
+
 #include <stb_image.h>
 
 #include "util/errors/RichException.hpp"
 #include "util/logger/Logger.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
 
 #include "math/transform/Vec3.hpp"
 
 #include "quartz/rendering/cube_map/CubeMap.hpp"
+#include "quartz/rendering/texture/MipChain.hpp"
+#include "quartz/rendering/texture/SamplerCache.hpp"
 #include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
 
 vk::VertexInputBindingDescription
@@ -33,6 +41,26 @@ quartz::rendering::CubeMap::getVulkanVertexInputAttributeDescriptions() {
     return vertexInputAttributeDescriptions;
 }
 
+quartz::rendering::CubeMap::DecodedFace
+quartz::rendering::CubeMap::decodeFace(
+    const std::string& filepath
+) {
+    quartz::rendering::CubeMap::DecodedFace decodedFace = {};
+
+    uint8_t* p_pixels = stbi_load(
+        filepath.c_str(),
+        &decodedFace.width,
+        &decodedFace.height,
+        &decodedFace.channelCount,
+        STBI_rgb_alpha
+    );
+    if (p_pixels) {
+        decodedFace.p_pixels = std::shared_ptr<uint8_t>(p_pixels, stbi_image_free);
+    }
+
+    return decodedFace;
+}
+
 quartz::rendering::StagedImageBuffer
 quartz::rendering::CubeMap::createStagedImageBufferFromFilepaths(
     const quartz::rendering::Device& renderingDevice,
@@ -61,80 +89,74 @@ quartz::rendering::CubeMap::createStagedImageBufferFromFilepaths(
         leftFilepath
     };
 
-    uint32_t imageWidth;
-    uint32_t imageHeight;
-    uint32_t imageChannelCount;
-    uint32_t imageSize;
-    std::vector<uint8_t> pixelBuffer;
+    /**
+     * @brief The faces don't depend on each other, so we decode all six at once. The filepaths are
+     *   copied into the tasks so nothing they use goes away if we throw before they finish
+     */
+    std::array<std::future<quartz::rendering::CubeMap::DecodedFace>, 6> faceFutures;
+    for (uint32_t i = 0; i < imageFilepaths.size(); ++i) {
+        LOG_TRACE(CUBEMAP, "Queueing image {} from {} for decoding", i, imageFilepaths[i]);
+        faceFutures[i] = util::ThreadPool::getSharedPool().submit(
+            [imageFilepath = imageFilepaths[i]]() {
+                return quartz::rendering::CubeMap::decodeFace(imageFilepath);
+            }
+        );
+    }
+
+    std::array<quartz::rendering::CubeMap::DecodedFace, 6> decodedFaces;
 
     for (uint32_t i = 0; i < imageFilepaths.size(); ++i) {
         const std::string& imageFilepath = imageFilepaths[i];
-        LOG_TRACE(CUBEMAP, "Loading image from {}", imageFilepath);
-
-        int32_t currWidth;
-        int32_t currHeight;
-        int32_t currChannelCount;
-        uint8_t* p_currPixels = stbi_load(
-            imageFilepath.c_str(),
-            &currWidth,
-            &currHeight,
-            &currChannelCount,
-            STBI_rgb_alpha
-        );
-        if (!p_currPixels) {
+        decodedFaces[i] = faceFutures[i].get();
+        const quartz::rendering::CubeMap::DecodedFace& decodedFace = decodedFaces[i];
+
+        if (!decodedFace.p_pixels) {
             LOG_THROW(CUBEMAP, util::StringException, imageFilepath, "Failed to load texture from {}", imageFilepath);
         }
 
-        // x4 for rgba (32 bits = 4 bytes)
-        uint32_t currSize = currWidth * currHeight * 4;
-        LOG_TRACE(CUBEMAP, "  Successfully loaded {}x{} image with {} channels ( {} bytes, because WxHx4 for rgba ) from {}", currWidth, currHeight, currChannelCount, currSize, imageFilepath);
-        LOG_TRACE(CUBEMAP, "  Loaded pixel data at {}", reinterpret_cast<void*>(p_currPixels));
-
-        if (i == 0) {
-            imageWidth = currWidth;
-            imageHeight = currHeight;
-            imageChannelCount = currChannelCount;
-            imageSize = currSize;
-
-            const uint32_t totalSize = imageSize * 6;
-            LOG_TRACE(CUBEMAP, "  Allocating buffer of {} * {} = {} bytes to hold all image data", imageSize, 6, totalSize);
-            pixelBuffer.reserve(totalSize); // reserve first so we don't over allocate space
-            pixelBuffer.resize(totalSize, 0x00);
-            LOG_TRACE(CUBEMAP, "  Buffer starting at {}", reinterpret_cast<void*>(pixelBuffer.data()));
-        } else if (
-            static_cast<uint32_t>(currWidth) != imageWidth ||
-            static_cast<uint32_t>(currHeight) != imageHeight ||
-            static_cast<uint32_t>(currChannelCount) != imageChannelCount ||
-            static_cast<uint32_t>(currSize) != imageSize
+        LOG_TRACE(CUBEMAP, "  Successfully loaded {}x{} image with {} channels from {}", decodedFace.width, decodedFace.height, decodedFace.channelCount, imageFilepath);
+
+        if (
+            decodedFace.width != decodedFaces[0].width ||
+            decodedFace.height != decodedFaces[0].height ||
+            decodedFace.channelCount != decodedFaces[0].channelCount
         ) {
-            LOG_THROW(CUBEMAP, util::StringException, imageFilepath, "Loaded image does not match {}x{} image with {} channels ( {} bytes )", imageWidth, imageHeight, imageChannelCount, imageSize);
+            LOG_THROW(CUBEMAP, util::StringException, imageFilepath, "Loaded image does not match {}x{} image with {} channels", decodedFaces[0].width, decodedFaces[0].height, decodedFaces[0].channelCount);
         }
+    }
 
-        const uint32_t pixelBufferOffset = i * imageSize;
-        uint8_t* p_copyDestination = pixelBuffer.data() + pixelBufferOffset;
-
-        LOG_TRACE(CUBEMAP, "  Copying data for image {}", i);
-        LOG_TRACE(CUBEMAP, "    Using offset of {} bytes", pixelBufferOffset);
-        LOG_TRACE(CUBEMAP, "    Copying to destination {} through {}", reinterpret_cast<void*>(p_copyDestination), reinterpret_cast<void*>(p_copyDestination + imageSize - 1));
-        LOG_TRACE(CUBEMAP, "    Copying from source    {}", reinterpret_cast<void*>(p_currPixels));
-        memcpy(p_copyDestination, p_currPixels, imageSize);
+    // x4 for rgba (32 bits = 4 bytes)
+    const uint32_t imageSize = decodedFaces[0].width * decodedFaces[0].height * 4;
+    LOG_TRACE(CUBEMAP, "Staging 6 images of {} bytes each", imageSize);
 
-        LOG_TRACE(CUBEMAP, "  Freeing stbi image");
-        stbi_image_free(p_currPixels);
+    std::vector<const uint8_t*> facePixels;
+    for (const quartz::rendering::CubeMap::DecodedFace& decodedFace : decodedFaces) {
+        facePixels.push_back(decodedFace.p_pixels.get());
     }
 
+    // Each face is copied straight from stbi's memory into staging memory, followed by its mips
+    const quartz::rendering::MipChain mipChain(
+        facePixels,
+        static_cast<uint32_t>(decodedFaces[0].width),
+        static_cast<uint32_t>(decodedFaces[0].height),
+        STBI_rgb_alpha,
+        4,
+        true
+    );
+
     return {
         renderingDevice,
-        static_cast<uint32_t>(imageWidth),
-        static_cast<uint32_t>(imageHeight),
-        static_cast<uint32_t>(imageChannelCount),
+        static_cast<uint32_t>(decodedFaces[0].width),
+        static_cast<uint32_t>(decodedFaces[0].height),
+        static_cast<uint32_t>(decodedFaces[0].channelCount),
         imageSize,
         6,
+        mipChain.getLevelCount(),
         vk::ImageUsageFlagBits::eSampled,
         vk::ImageCreateFlagBits::eCubeCompatible,
         vk::Format::eR8G8B8A8Srgb,
         vk::ImageTiling::eOptimal,
-        pixelBuffer.data()
+        [&mipChain](uint8_t* p_stagingData) { mipChain.write(p_stagingData); }
     };
 }
 
@@ -257,18 +279,14 @@ quartz::rendering::CubeMap::CubeMap(
             m_stagedImageBuffer.getVulkanFormat(),
             {},
             vk::ImageAspectFlagBits::eColor,
-            vk::ImageViewType::eCube
+            vk::ImageViewType::eCube,
+            m_stagedImageBuffer.getMipLevelCount()
         )
     ),
     mp_vulkanCombinedImageSampler(
-        quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            vk::Filter::eLinear,
-            vk::Filter::eLinear,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat
+        quartz::rendering::SamplerCache::getVulkanSamplerPtr(
+            renderingDevice,
+            quartz::rendering::SamplerCache::getDefaultKey(renderingDevice)
         )
     ),
     m_stagedVertexBuffer(quartz::rendering::CubeMap::createStagedVertexBuffer(renderingDevice)),
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+#include <string>
 #include <vector>
 
 #include <vulkan/vulkan.hpp>
@@ -36,7 +38,7 @@ public: // member functions
 
     const quartz::rendering::StagedImageBuffer& getStagedImageBuffer() const { return m_stagedImageBuffer; }
     const vk::UniqueImageView& getVulkanImageViewPtr() const { return mp_vulkanImageView; }
-    const vk::UniqueSampler& getVulkanSamplerPtr() const { return mp_vulkanCombinedImageSampler; }
+    const vk::UniqueSampler& getVulkanSamplerPtr() const { return *mp_vulkanCombinedImageSampler; }
     const quartz::rendering::StagedBuffer& getStagedVertexBuffer() const { return m_stagedVertexBuffer; }
     const quartz::rendering::StagedBuffer& getStagedIndexBuffer() const { return m_stagedIndexBuffer; }
 
@@ -45,7 +47,20 @@ public: // static functions
     static std::vector<vk::VertexInputAttributeDescription> getVulkanVertexInputAttributeDescriptions();
     static uint32_t getIndexCount() { return 6 * 6; }
 
+private: // classes
+    struct DecodedFace {
+    public: // member variables
+        int32_t width;
+        int32_t height;
+        int32_t channelCount;
+        std::shared_ptr<uint8_t> p_pixels; // rgba, nullptr if the face failed to decode
+    };
+
 private: // static functions
+    /**
+     * @brief Runs on a worker thread, so this must not log
+     */
+    static quartz::rendering::CubeMap::DecodedFace decodeFace(const std::string& filepath);
     quartz::rendering::StagedImageBuffer createStagedImageBufferFromFilepaths (
         const quartz::rendering::Device& renderingDevice,
         const std::string& frontFilepath,
@@ -61,7 +76,7 @@ private: // static functions
 private: // member variables
     quartz::rendering::StagedImageBuffer m_stagedImageBuffer;
     vk::UniqueImageView mp_vulkanImageView;
-    vk::UniqueSampler mp_vulkanCombinedImageSampler;
+    std::shared_ptr<vk::UniqueSampler> mp_vulkanCombinedImageSampler; // shared through the SamplerCache
     quartz::rendering::StagedBuffer m_stagedVertexBuffer;
     quartz::rendering::StagedBuffer m_stagedIndexBuffer;
 };
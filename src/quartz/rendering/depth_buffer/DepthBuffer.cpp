@@ -33,7 +33,8 @@ quartz::rendering::DepthBuffer::DepthBuffer(
             m_imageBuffer.getVulkanFormat(),
             {},
             vk::ImageAspectFlagBits::eDepth,
-            vk::ImageViewType::e2D
+            vk::ImageViewType::e2D,
+            1
         )
     )
 {
@@ -1,3 +1,4 @@
+#include <optional>
 #include <set>
 
 #include <vulkan/vulkan.hpp>
@@ -97,6 +98,50 @@ quartz::rendering::Device::getGraphicsQueueFamilyIndex(
     LOG_THROW(DEVICE, util::RichException<std::vector<vk::QueueFamilyProperties>>, queueFamilyProperties, "Failed to find queue family index");
 }
 
+uint32_t
+quartz::rendering::Device::getTransferQueueFamilyIndex(
+    const vk::PhysicalDevice& physicalDevice,
+    const uint32_t graphicsQueueFamilyIndex
+) {
+    LOG_FUNCTION_SCOPE_TRACE(DEVICE, "graphics queue family index = {}", graphicsQueueFamilyIndex);
+
+    std::vector<vk::QueueFamilyProperties> queueFamilyProperties = physicalDevice.getQueueFamilyProperties();
+
+    /**
+     * @brief Queue families which only support transfers usually map to the device's copy engines, so
+     *   we prefer those. Failing that, any family without graphics support at least keeps our uploads
+     *   out of the way of rendering.
+     */
+    std::optional<uint32_t> o_nonGraphicsQueueFamilyIndex;
+    for (uint32_t j = 0; j < queueFamilyProperties.size(); ++j) {
+        const vk::QueueFamilyProperties properties = queueFamilyProperties[j];
+
+        if (
+            !(properties.queueFlags & vk::QueueFlagBits::eTransfer) ||
+            (properties.queueFlags & vk::QueueFlagBits::eGraphics)
+        ) {
+            continue;
+        }
+
+        if (!(properties.queueFlags & vk::QueueFlagBits::eCompute)) {
+            LOG_TRACE(DEVICE, "  - queue family {} is dedicated to transfers", j);
+            return j;
+        }
+
+        if (!o_nonGraphicsQueueFamilyIndex) {
+            LOG_TRACE(DEVICE, "  - queue family {} supports transfers without graphics", j);
+            o_nonGraphicsQueueFamilyIndex = j;
+        }
+    }
+
+    if (o_nonGraphicsQueueFamilyIndex) {
+        return *o_nonGraphicsQueueFamilyIndex;
+    }
+
+    LOG_TRACE(DEVICE, "  - no dedicated transfer queue family. Using the graphics queue family");
+    return graphicsQueueFamilyIndex;
+}
+
 std::vector<const char*>
 quartz::rendering::Device::getEnabledPhysicalDeviceExtensionNames(
     const vk::PhysicalDevice& physicalDevice
@@ -136,13 +181,16 @@ vk::UniqueDevice
 quartz::rendering::Device::createVulkanLogicalDevicePtr(
     const vk::PhysicalDevice& physicalDevice,
     const uint32_t graphicsQueueFamilyIndex,
+    const uint32_t transferQueueFamilyIndex,
     const std::vector<const char*>& validationLayerNames,
     const std::vector<const char*>& physicalDeviceExtensionNames
 ) {
-    LOG_FUNCTION_SCOPE_TRACE(DEVICE, "graphics queue family index = {}", graphicsQueueFamilyIndex);
+    LOG_FUNCTION_SCOPE_TRACE(DEVICE, "graphics queue family index = {}, transfer queue family index = {}", graphicsQueueFamilyIndex, transferQueueFamilyIndex);
+
+    std::set<uint32_t> uniqueQueueFamilyIndices = { graphicsQueueFamilyIndex, transferQueueFamilyIndex };
 
-    std::set<uint32_t> uniqueQueueFamilyIndices = { graphicsQueueFamilyIndex };
-    std::vector<float> deviceQueuePriorities(uniqueQueueFamilyIndices.size(), 1.0f);
+    // One queue from each family
+    std::vector<float> deviceQueuePriorities = { 1.0f };
 
     LOG_TRACE(DEVICE, "Creating vk::DeviceQueueCreateInfo for each of the unique queue family indices");
 
@@ -161,6 +209,9 @@ quartz::rendering::Device::createVulkanLogicalDevicePtr(
 
     vk::PhysicalDeviceFeatures requestedPhysicalDeviceFeatures;
     requestedPhysicalDeviceFeatures.samplerAnisotropy = true;
+    // Block compressed textures fall back to being decompressed on the cpu when this isn't supported
+    requestedPhysicalDeviceFeatures.textureCompressionBC = physicalDevice.getFeatures().textureCompressionBC;
+    LOG_TRACE(DEVICE, "Block compressed textures supported: {}", static_cast<bool>(requestedPhysicalDeviceFeatures.textureCompressionBC));
     /// @todo 2023/11/01 enable requestedPhysicalDeviceFeatures.depthBounds
 
     vk::DeviceCreateInfo logicalDeviceCreateInfo(
@@ -193,6 +244,12 @@ quartz::rendering::Device::Device(
             m_vulkanPhysicalDevice
         )
     ),
+    m_transferQueueFamilyIndex(
+        quartz::rendering::Device::getTransferQueueFamilyIndex(
+            m_vulkanPhysicalDevice,
+            m_graphicsQueueFamilyIndex
+        )
+    ),
     m_physicalDeviceExtensionNames(
         quartz::rendering::Device::getEnabledPhysicalDeviceExtensionNames(
             m_vulkanPhysicalDevice
@@ -202,6 +259,7 @@ quartz::rendering::Device::Device(
         quartz::rendering::Device::createVulkanLogicalDevicePtr(
             m_vulkanPhysicalDevice,
             m_graphicsQueueFamilyIndex,
+            m_transferQueueFamilyIndex,
             renderingInstance.getValidationLayerNames(),
             m_physicalDeviceExtensionNames
         )
@@ -213,6 +271,10 @@ quartz::rendering::Device::Device(
     m_vulkanPresentQueue(mp_vulkanLogicalDevice->getQueue(
         m_graphicsQueueFamilyIndex,
         0
+    )),
+    m_vulkanTransferQueue(mp_vulkanLogicalDevice->getQueue(
+        m_transferQueueFamilyIndex,
+        0
     ))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
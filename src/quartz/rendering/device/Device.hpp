@@ -20,9 +20,12 @@ public: // member functions
 
     const vk::PhysicalDevice& getVulkanPhysicalDevice() const { return m_vulkanPhysicalDevice; }
     uint32_t getGraphicsQueueFamilyIndex() const { return m_graphicsQueueFamilyIndex; }
+    uint32_t getTransferQueueFamilyIndex() const { return m_transferQueueFamilyIndex; }
+    bool getHasDedicatedTransferQueue() const { return m_transferQueueFamilyIndex != m_graphicsQueueFamilyIndex; }
     const vk::UniqueDevice& getVulkanLogicalDevicePtr() const { return mp_vulkanLogicalDevice; }
     const vk::Queue& getVulkanGraphicsQueue() const { return m_vulkanGraphicsQueue; }
     const vk::Queue& getVulkanPresentQueue() const { return m_vulkanPresentQueue; }
+    const vk::Queue& getVulkanTransferQueue() const { return m_vulkanTransferQueue; }
 
     void waitIdle() const { mp_vulkanLogicalDevice->waitIdle(); }
 
@@ -35,6 +38,11 @@ private: // static functions
         const vk::PhysicalDevice& physicalDevice
     );
 
+    static uint32_t getTransferQueueFamilyIndex(
+        const vk::PhysicalDevice& physicalDevice,
+        const uint32_t graphicsQueueFamilyIndex
+    );
+
     static std::vector<const char*> getEnabledPhysicalDeviceExtensionNames(
         const vk::PhysicalDevice& physicalDevice
     );
@@ -42,6 +50,7 @@ private: // static functions
     static vk::UniqueDevice createVulkanLogicalDevicePtr(
         const vk::PhysicalDevice& physicalDevice,
         const uint32_t graphicsQueueFamilyIndex,
+        const uint32_t transferQueueFamilyIndex,
         const std::vector<const char*>& validationLayerNames,
         const std::vector<const char*>& physicalDeviceExtensionNames
     );
@@ -49,8 +58,15 @@ private: // static functions
 private: // member variables
     vk::PhysicalDevice m_vulkanPhysicalDevice;
     const uint32_t m_graphicsQueueFamilyIndex;
+
+    /**
+     * @brief The same as the graphics queue family index if the device doesn't have a queue family
+     *   dedicated to transfers
+     */
+    const uint32_t m_transferQueueFamilyIndex;
     const std::vector<const char*> m_physicalDeviceExtensionNames;
     vk::UniqueDevice mp_vulkanLogicalDevice;
     vk::Queue m_vulkanGraphicsQueue;
     vk::Queue m_vulkanPresentQueue;
+    vk::Queue m_vulkanTransferQueue;
 };
\ No newline at end of file
@@ -1,8 +1,13 @@
+#include <array>
+
+#include "util/hash/Hash.hpp"
+
 #include "quartz/rendering/material/Material.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
 
 uint32_t quartz::rendering::Material::defaultMaterialMasterIndex = 0;
 std::vector<std::shared_ptr<quartz::rendering::Material>> quartz::rendering::Material::masterMaterialList;
+std::multimap<uint64_t, uint32_t> quartz::rendering::Material::parameterHashMasterIndices;
 
 quartz::rendering::Material::UniformBufferObject::UniformBufferObject(
     const uint32_t baseColorTextureMasterIndex_,
@@ -117,8 +122,19 @@ quartz::rendering::Material::createMaterial(
         doubleSided
     );
 
+    // Hashes can collide, so every material with a matching hash is compared against ours
+    const uint64_t parameterHash = quartz::rendering::Material::calculateParameterHash(*p_material);
+    const std::pair<std::multimap<uint64_t, uint32_t>::const_iterator, std::multimap<uint64_t, uint32_t>::const_iterator> masterIndexRange = quartz::rendering::Material::parameterHashMasterIndices.equal_range(parameterHash);
+    for (std::multimap<uint64_t, uint32_t>::const_iterator masterIndexIterator = masterIndexRange.first; masterIndexIterator != masterIndexRange.second; ++masterIndexIterator) {
+        if (quartz::rendering::Material::masterMaterialList[masterIndexIterator->second]->hasSameParameters(*p_material)) {
+            LOG_TRACE(MATERIAL, "Material [ {} ] is identical to the material at master index {}", name, masterIndexIterator->second);
+            return masterIndexIterator->second;
+        }
+    }
+
     quartz::rendering::Material::masterMaterialList.push_back(p_material);
     uint32_t insertedIndex = quartz::rendering::Material::masterMaterialList.size() - 1;
+    quartz::rendering::Material::parameterHashMasterIndices.emplace(parameterHash, insertedIndex);
     LOG_TRACE(MATERIAL, "Newly created material [ {} ] was inserted into master material list at index {}", name, insertedIndex);
 
     return insertedIndex;
@@ -160,6 +176,7 @@ quartz::rendering::Material::initializeMasterMaterialList(const quartz::renderin
 
     quartz::rendering::Material::masterMaterialList.push_back(p_defaultMaterial);
     quartz::rendering::Material::defaultMaterialMasterIndex = quartz::rendering::Material::masterMaterialList.size() - 1;
+    quartz::rendering::Material::parameterHashMasterIndices.emplace(quartz::rendering::Material::calculateParameterHash(*p_defaultMaterial), quartz::rendering::Material::defaultMaterialMasterIndex);
     LOG_INFO(MATERIAL, "Initialized master material list. Size is now {} with default material at index {}", quartz::rendering::Material::masterMaterialList.size(), quartz::rendering::Material::defaultMaterialMasterIndex);
 }
 
@@ -168,6 +185,40 @@ quartz::rendering::Material::cleanUpAllMaterials() {
     LOG_FUNCTION_CALL_TRACE(MATERIAL, "");
 
     quartz::rendering::Material::masterMaterialList.clear();
+    quartz::rendering::Material::parameterHashMasterIndices.clear();
+}
+
+uint64_t
+quartz::rendering::Material::calculateParameterHash(
+    const quartz::rendering::Material& material
+) {
+    const std::array<uint32_t, 6> integerParameters = {
+        material.m_baseColorTextureMasterIndex,
+        material.m_metallicRoughnessTextureMasterIndex,
+        material.m_normalTextureMasterIndex,
+        material.m_emissionTextureMasterIndex,
+        material.m_occlusionTextureMasterIndex,
+        static_cast<uint32_t>(material.m_alphaMode) << 1 | static_cast<uint32_t>(material.m_doubleSided)
+    };
+
+    // Adding 0 turns -0 into 0, so factors which compare equal also hash the same
+    const std::array<float, 10> floatParameters = {
+        material.m_baseColorFactor.x + 0.0f,
+        material.m_baseColorFactor.y + 0.0f,
+        material.m_baseColorFactor.z + 0.0f,
+        material.m_baseColorFactor.w + 0.0f,
+        material.m_emissiveFactor.x + 0.0f,
+        material.m_emissiveFactor.y + 0.0f,
+        material.m_emissiveFactor.z + 0.0f,
+        material.m_metallicFactor + 0.0f,
+        material.m_roughnessFactor + 0.0f,
+        material.m_alphaCutoff + 0.0f
+    };
+
+    uint64_t hash = util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, integerParameters.data(), sizeof(integerParameters));
+    hash = util::Hash::fnv1a(hash, floatParameters.data(), sizeof(floatParameters));
+
+    return hash;
 }
 
 quartz::rendering::Material::Material() :
@@ -350,3 +401,22 @@ quartz::rendering::Material::operator=(
 
     return *this;
 }
+
+bool
+quartz::rendering::Material::hasSameParameters(
+    const quartz::rendering::Material& other
+) const {
+    return
+        m_baseColorTextureMasterIndex == other.m_baseColorTextureMasterIndex &&
+        m_metallicRoughnessTextureMasterIndex == other.m_metallicRoughnessTextureMasterIndex &&
+        m_normalTextureMasterIndex == other.m_normalTextureMasterIndex &&
+        m_emissionTextureMasterIndex == other.m_emissionTextureMasterIndex &&
+        m_occlusionTextureMasterIndex == other.m_occlusionTextureMasterIndex &&
+        m_baseColorFactor == other.m_baseColorFactor &&
+        m_emissiveFactor == other.m_emissiveFactor &&
+        m_metallicFactor == other.m_metallicFactor &&
+        m_roughnessFactor == other.m_roughnessFactor &&
+        m_alphaMode == other.m_alphaMode &&
+        m_alphaCutoff == other.m_alphaCutoff &&
+        m_doubleSided == other.m_doubleSided;
+}
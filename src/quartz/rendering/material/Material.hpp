@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstdint>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -95,6 +98,12 @@ public: // static functions
     static void initializeMasterMaterialList(const quartz::rendering::Device& renderingDevice);
     static void cleanUpAllMaterials();
 
+    /**
+     * @brief Covers everything the gpu sees, but not the name, so identically configured materials
+     *   from different models share a single master index
+     */
+    static uint64_t calculateParameterHash(const quartz::rendering::Material& material);
+
     static uint32_t getDefaultMaterialMasterIndex() { return quartz::rendering::Material::defaultMaterialMasterIndex; }
 
     static uint32_t getNumCreatedMaterials() { return quartz::rendering::Material::masterMaterialList.size(); }
@@ -106,6 +115,7 @@ private: // static functions
 private: // static variables
     static uint32_t defaultMaterialMasterIndex;
     static std::vector<std::shared_ptr<Material>> masterMaterialList;
+    static std::multimap<uint64_t, uint32_t> parameterHashMasterIndices;
 
 // -----+++++===== Instance Interface =====+++++----- //
 
@@ -151,6 +161,11 @@ public: // member functions
 
     const std::string& getName() const { return m_name; }
 
+    /**
+     * @brief Compares everything calculateParameterHash covers
+     */
+    bool hasSameParameters(const Material& other) const;
+
 private: // member variables
     // 20 bytes of texture indices
     alignas(4) uint32_t m_baseColorTextureMasterIndex;
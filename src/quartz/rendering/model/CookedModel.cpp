@@ -0,0 +1,260 @@
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "util/errors/RichException.hpp"
+#include "util/file_system/FileSystem.hpp"
+#include "util/file_system/MappedFile.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+
+bool
+quartz::rendering::CookedModel::isCookedFilepath(
+    const std::string& filepath
+) {
+    return util::FileSystem::getFileExtension(filepath) == quartz::rendering::CookedModel::fileExtension;
+}
+
+uint64_t
+quartz::rendering::CookedModel::alignOffset(
+    const uint64_t offset
+) {
+    return (offset + quartz::rendering::CookedModel::alignment - 1) & ~(quartz::rendering::CookedModel::alignment - 1);
+}
+
+const quartz::rendering::CookedModel::Header*
+quartz::rendering::CookedModel::loadHeader(
+    const util::MappedFile& mappedFile
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "{}", mappedFile.getFilepath());
+
+    if (mappedFile.getSizeBytes() < sizeof(quartz::rendering::CookedModel::Header)) {
+        LOG_THROW(MODEL_COOKED, util::StringException, mappedFile.getFilepath(), "{} is only {} bytes, which is too small to be a cooked model", mappedFile.getFilepath(), mappedFile.getSizeBytes());
+    }
+
+    const quartz::rendering::CookedModel::Header* p_header = reinterpret_cast<const quartz::rendering::CookedModel::Header*>(mappedFile.getData());
+
+    if (p_header->magic != quartz::rendering::CookedModel::magic) {
+        LOG_THROW(MODEL_COOKED, util::StringException, mappedFile.getFilepath(), "{} is not a cooked model (magic is {:#x}, expected {:#x})", mappedFile.getFilepath(), p_header->magic, quartz::rendering::CookedModel::magic);
+    }
+
+    if (p_header->version != quartz::rendering::CookedModel::version) {
+        LOG_THROW(MODEL_COOKED, util::StringException, mappedFile.getFilepath(), "{} was cooked with version {}, but we only load version {}. Recook it with quartz_cook", mappedFile.getFilepath(), p_header->version, quartz::rendering::CookedModel::version);
+    }
+
+    // Makes sure every data location we hand out later is at least somewhere in the file
+    mappedFile.getBytes(p_header->data.offset, p_header->data.sizeBytes);
+
+    LOG_TRACE(MODEL_COOKED, "Cooked model has {} textures, {} materials, {} scenes, {} nodes, {} meshes, and {} primitives", p_header->textureTable.count, p_header->materialTable.count, p_header->sceneTable.count, p_header->nodeTable.count, p_header->meshTable.count, p_header->primitiveTable.count);
+    LOG_TRACE(MODEL_COOKED, "Data section is {} bytes at offset {}", p_header->data.sizeBytes, p_header->data.offset);
+
+    return p_header;
+}
+
+quartz::rendering::CookedModel::CookedModel(
+    const std::string& filepath
+) :
+    mp_mappedFile(std::make_shared<const util::MappedFile>(filepath)),
+    mp_header(
+        quartz::rendering::CookedModel::loadHeader(
+            *mp_mappedFile
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("{}", filepath);
+
+    this->validateRecords();
+    this->validateNodeHierarchy();
+}
+
+quartz::rendering::CookedModel::CookedModel(
+    quartz::rendering::CookedModel&& other
+) :
+    mp_mappedFile(std::move(other.mp_mappedFile)),
+    mp_header(std::exchange(other.mp_header, nullptr))
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::CookedModel::~CookedModel() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::CookedModel&
+quartz::rendering::CookedModel::operator=(
+    quartz::rendering::CookedModel&& other
+) {
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    if (this == &other) {
+        return *this;
+    }
+
+    mp_mappedFile = std::move(other.mp_mappedFile);
+    mp_header = std::exchange(other.mp_header, nullptr);
+
+    return *this;
+}
+
+void
+quartz::rendering::CookedModel::validateRange(
+    const uint64_t tableSize,
+    const uint32_t first,
+    const uint32_t count
+) const {
+    if (first > tableSize || count > tableSize - first) {
+        LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, first, "Range of {} records starting at {} is outside of a table with {} records in {}", count, first, tableSize, mp_mappedFile->getFilepath());
+    }
+}
+
+void
+quartz::rendering::CookedModel::validateIndex(
+    const uint64_t tableSize,
+    const int32_t index
+) const {
+    if (index >= 0 && static_cast<uint64_t>(index) >= tableSize) {
+        LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, static_cast<uint32_t>(index), "Index {} is outside of a table with {} records in {}", index, tableSize, mp_mappedFile->getFilepath());
+    }
+}
+
+void
+quartz::rendering::CookedModel::validateRecords() const {
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    const std::span<const quartz::rendering::CookedModel::TextureRecord> textureRecords = this->getTextureRecords();
+    const std::span<const quartz::rendering::CookedModel::MaterialRecord> materialRecords = this->getMaterialRecords();
+    const std::span<const quartz::rendering::CookedModel::SceneRecord> sceneRecords = this->getSceneRecords();
+    const std::span<const quartz::rendering::CookedModel::NodeRecord> nodeRecords = this->getNodeRecords();
+    const std::span<const quartz::rendering::CookedModel::MeshRecord> meshRecords = this->getMeshRecords();
+    const std::span<const quartz::rendering::CookedModel::PrimitiveRecord> primitiveRecords = this->getPrimitiveRecords();
+    const std::span<const uint32_t> nodeIndices = this->getNodeIndices();
+
+    this->validateIndex(sceneRecords.size(), mp_header->defaultSceneIndex);
+
+    for (const quartz::rendering::CookedModel::TextureRecord& textureRecord : textureRecords) {
+        if (textureRecord.type > static_cast<uint32_t>(quartz::rendering::Texture::Type::Occlusion)) {
+            LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, textureRecord.type, "Texture type {} is not a quartz::rendering::Texture::Type in {}", textureRecord.type, mp_mappedFile->getFilepath());
+        }
+    }
+
+    for (const quartz::rendering::CookedModel::MaterialRecord& materialRecord : materialRecords) {
+        this->validateIndex(textureRecords.size(), materialRecord.baseColorTextureIndex);
+        this->validateIndex(textureRecords.size(), materialRecord.metallicRoughnessTextureIndex);
+        this->validateIndex(textureRecords.size(), materialRecord.normalTextureIndex);
+        this->validateIndex(textureRecords.size(), materialRecord.emissionTextureIndex);
+        this->validateIndex(textureRecords.size(), materialRecord.occlusionTextureIndex);
+
+        if (materialRecord.alphaMode > static_cast<uint32_t>(quartz::rendering::Material::AlphaMode::Blend)) {
+            LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, materialRecord.alphaMode, "Alpha mode {} is not a quartz::rendering::Material::AlphaMode in {}", materialRecord.alphaMode, mp_mappedFile->getFilepath());
+        }
+    }
+
+    for (const quartz::rendering::CookedModel::SceneRecord& sceneRecord : sceneRecords) {
+        this->validateRange(nodeIndices.size(), sceneRecord.firstRootNodeIndex, sceneRecord.rootNodeCount);
+    }
+
+    for (const quartz::rendering::CookedModel::NodeRecord& nodeRecord : nodeRecords) {
+        this->validateIndex(meshRecords.size(), nodeRecord.meshIndex);
+        this->validateRange(nodeIndices.size(), nodeRecord.firstChildIndex, nodeRecord.childCount);
+    }
+
+    for (const uint32_t nodeIndex : nodeIndices) {
+        if (nodeIndex >= nodeRecords.size()) {
+            LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, nodeIndex, "Node index {} is outside of a table with {} nodes in {}", nodeIndex, nodeRecords.size(), mp_mappedFile->getFilepath());
+        }
+    }
+
+    for (const quartz::rendering::CookedModel::MeshRecord& meshRecord : meshRecords) {
+        this->validateRange(primitiveRecords.size(), meshRecord.firstPrimitiveIndex, meshRecord.primitiveCount);
+    }
+
+    for (const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord : primitiveRecords) {
+        this->validateIndex(materialRecords.size(), primitiveRecord.materialIndex);
+    }
+}
+
+void
+quartz::rendering::CookedModel::validateNodeHierarchy() const {
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    enum class VisitState : uint8_t {
+        Unvisited,
+        OnPath,
+        Finished
+    };
+
+    const std::span<const quartz::rendering::CookedModel::NodeRecord> nodeRecords = this->getNodeRecords();
+    std::vector<VisitState> visitStates(nodeRecords.size(), VisitState::Unvisited);
+
+    // Each entry is a node on the current path and how many of its children we have already visited.
+    // Walking it ourselves instead of recursing means a deep hierarchy can't overflow the stack
+    std::vector<std::pair<uint32_t, uint32_t>> path;
+
+    for (uint32_t startIndex = 0; startIndex < nodeRecords.size(); ++startIndex) {
+        if (visitStates[startIndex] != VisitState::Unvisited) {
+            continue;
+        }
+
+        visitStates[startIndex] = VisitState::OnPath;
+        path.emplace_back(startIndex, 0);
+
+        while (!path.empty()) {
+            const uint32_t nodeIndex = path.back().first;
+            const std::span<const uint32_t> childIndices = this->getChildNodeIndices(nodeRecords[nodeIndex]);
+
+            if (path.back().second == childIndices.size()) {
+                visitStates[nodeIndex] = VisitState::Finished;
+                path.pop_back();
+                continue;
+            }
+
+            const uint32_t childIndex = childIndices[path.back().second++];
+
+            if (visitStates[childIndex] == VisitState::OnPath) {
+                LOG_THROW(MODEL_COOKED, util::RichException<uint32_t>, childIndex, "Node {} is its own ancestor through node {} in {}", childIndex, nodeIndex, mp_mappedFile->getFilepath());
+            }
+
+            if (visitStates[childIndex] == VisitState::Unvisited) {
+                visitStates[childIndex] = VisitState::OnPath;
+                path.emplace_back(childIndex, 0);
+            }
+        }
+    }
+}
+
+std::span<const uint32_t>
+quartz::rendering::CookedModel::getRootNodeIndices(
+    const quartz::rendering::CookedModel::SceneRecord& sceneRecord
+) const {
+    return this->getRange(this->getNodeIndices(), sceneRecord.firstRootNodeIndex, sceneRecord.rootNodeCount);
+}
+
+std::span<const uint32_t>
+quartz::rendering::CookedModel::getChildNodeIndices(
+    const quartz::rendering::CookedModel::NodeRecord& nodeRecord
+) const {
+    return this->getRange(this->getNodeIndices(), nodeRecord.firstChildIndex, nodeRecord.childCount);
+}
+
+std::span<const quartz::rendering::CookedModel::PrimitiveRecord>
+quartz::rendering::CookedModel::getPrimitiveRecords(
+    const quartz::rendering::CookedModel::MeshRecord& meshRecord
+) const {
+    return this->getRange(this->getPrimitiveRecords(), meshRecord.firstPrimitiveIndex, meshRecord.primitiveCount);
+}
+
+std::span<const uint8_t>
+quartz::rendering::CookedModel::getData(
+    const quartz::rendering::CookedModel::DataLocation& location
+) const {
+    if (location.offset > mp_header->data.sizeBytes || location.sizeBytes > mp_header->data.sizeBytes - location.offset) {
+        LOG_THROW(MODEL_COOKED, util::StringException, mp_mappedFile->getFilepath(), "{} bytes at offset {} is outside of the {} byte data section of {}", location.sizeBytes, location.offset, mp_header->data.sizeBytes, mp_mappedFile->getFilepath());
+    }
+
+    return mp_mappedFile->getBytes(mp_header->data.offset + location.offset, location.sizeBytes);
+}
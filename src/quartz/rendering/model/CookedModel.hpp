@@ -0,0 +1,240 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "util/errors/RichException.hpp"
+#include "util/file_system/MappedFile.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+
+namespace quartz {
+namespace rendering {
+    class CookedModel;
+}
+}
+
+/**
+ * @brief A model which has already been through everything we do when loading a gltf file, written
+ *   out ahead of time by quartz_cook (see quartz::rendering::ModelCooker). Loading one is a matter
+ *   of mapping the file and copying its streams straight into staging memory. There is no json to
+ *   parse, no images to decode, and no vertices to assemble, pack, or optimize.
+ *
+ * @brief LAYOUT
+ *   The file starts with a Header, which locates every table and the data section. Each table is a
+ *   tightly packed array of one of the records below. Every table and every piece of data starts on
+ *   a cache line boundary. Everything is little endian, which is every platform we build for.
+ *
+ * @brief Records refer to each other by their index in their table, the same way gltf does. Scenes
+ *   and nodes list their root nodes and children as a range of the node index table. Records refer
+ *   to their bytes with a DataLocation relative to the start of the data section.
+ *
+ * @brief Bump the version whenever any of these records or the contents of any stream changes, so
+ *   stale files get rejected instead of drawn incorrectly. Recook them by running quartz_cook again.
+ */
+class quartz::rendering::CookedModel {
+public: // classes
+    struct TableLocation {
+    public: // member variables
+        uint64_t offset;
+        uint32_t count;
+        uint32_t padding;
+    };
+
+    struct DataLocation {
+    public: // member variables
+        uint64_t offset;
+        uint64_t sizeBytes;
+    };
+
+    struct Header {
+    public: // member variables
+        uint32_t magic;
+        uint32_t version;
+        int32_t defaultSceneIndex; // -1 when the gltf file didn't specify one
+        uint32_t padding;
+        TableLocation textureTable;
+        TableLocation materialTable;
+        TableLocation sceneTable;
+        TableLocation nodeTable;
+        TableLocation meshTable;
+        TableLocation primitiveTable;
+        TableLocation nodeIndexTable; // uint32_t
+        DataLocation data;
+    };
+
+    /**
+     * @brief The container is a whole ktx2 file (see quartz::rendering::KTX2Container) holding every
+     *   block compressed mip level. The filters and wrap modes are the gltf values, -1 meaning the
+     *   gltf file didn't specify one
+     */
+    struct TextureRecord {
+    public: // member variables
+        uint32_t width;
+        uint32_t height;
+        int32_t minFilter;
+        int32_t magFilter;
+        int32_t wrapS;
+        int32_t wrapT;
+        uint32_t type; // quartz::rendering::Texture::Type, which picks the channels the container holds
+        uint32_t padding;
+        DataLocation container;
+    };
+
+    /**
+     * @brief Texture indices index into the texture table, -1 meaning the default texture of that type
+     */
+    struct MaterialRecord {
+    public: // member variables
+        char name[64]; // null terminated, truncated if it is too long
+        int32_t baseColorTextureIndex;
+        int32_t metallicRoughnessTextureIndex;
+        int32_t normalTextureIndex;
+        int32_t emissionTextureIndex;
+        int32_t occlusionTextureIndex;
+        float baseColorFactor[4];
+        float emissiveFactor[3];
+        float metallicFactor;
+        float roughnessFactor;
+        float alphaCutoff;
+        uint32_t alphaMode; // quartz::rendering::Material::AlphaMode
+        uint32_t doubleSided;
+    };
+
+    struct SceneRecord {
+    public: // member variables
+        uint32_t firstRootNodeIndex; // into the node index table
+        uint32_t rootNodeCount;
+    };
+
+    struct NodeRecord {
+    public: // member variables
+        float localTransformationMatrix[16]; // column major
+        int32_t meshIndex; // -1 when the node has no mesh
+        uint32_t firstChildIndex; // into the node index table
+        uint32_t childCount;
+        uint32_t padding;
+    };
+
+    struct MeshRecord {
+    public: // member variables
+        uint32_t firstPrimitiveIndex;
+        uint32_t primitiveCount;
+    };
+
+    /**
+     * @brief The streams are exactly what quartz::rendering::Primitive uploads. Positions are
+     *   math::Vec3, attributes are quartz::rendering::Vertex::PackedAttributes, and indices are
+     *   either uint16_t or uint32_t depending on the index type
+     */
+    struct PrimitiveRecord {
+    public: // member variables
+        int32_t materialIndex; // -1 meaning the default material
+        uint32_t vertexCount;
+        uint32_t indexCount;
+        uint32_t indexType; // vk::IndexType
+        float boundingBoxMinimum[3];
+        float boundingBoxMaximum[3];
+        DataLocation positions;
+        DataLocation attributes;
+        DataLocation indices;
+    };
+
+public: // member functions
+    CookedModel(const std::string& filepath);
+    CookedModel(CookedModel&& other);
+    ~CookedModel();
+
+    CookedModel& operator=(CookedModel&& other);
+
+    USE_LOGGER(MODEL_COOKED);
+
+    const std::string& getFilepath() const { return mp_mappedFile->getFilepath(); }
+    const quartz::rendering::CookedModel::Header& getHeader() const { return *mp_header; }
+
+    /**
+     * @brief Shared so whatever keeps reading out of the file after loading, such as a streamed
+     *   texture's levels, can keep it mapped after we are gone
+     */
+    const std::shared_ptr<const util::MappedFile>& getMappedFilePtr() const { return mp_mappedFile; }
+
+    std::span<const quartz::rendering::CookedModel::TextureRecord> getTextureRecords() const { return this->getTable<quartz::rendering::CookedModel::TextureRecord>(mp_header->textureTable); }
+    std::span<const quartz::rendering::CookedModel::MaterialRecord> getMaterialRecords() const { return this->getTable<quartz::rendering::CookedModel::MaterialRecord>(mp_header->materialTable); }
+    std::span<const quartz::rendering::CookedModel::SceneRecord> getSceneRecords() const { return this->getTable<quartz::rendering::CookedModel::SceneRecord>(mp_header->sceneTable); }
+    std::span<const quartz::rendering::CookedModel::NodeRecord> getNodeRecords() const { return this->getTable<quartz::rendering::CookedModel::NodeRecord>(mp_header->nodeTable); }
+    std::span<const quartz::rendering::CookedModel::MeshRecord> getMeshRecords() const { return this->getTable<quartz::rendering::CookedModel::MeshRecord>(mp_header->meshTable); }
+    std::span<const quartz::rendering::CookedModel::PrimitiveRecord> getPrimitiveRecords() const { return this->getTable<quartz::rendering::CookedModel::PrimitiveRecord>(mp_header->primitiveTable); }
+    std::span<const uint32_t> getNodeIndices() const { return this->getTable<uint32_t>(mp_header->nodeIndexTable); }
+
+    std::span<const uint32_t> getRootNodeIndices(const quartz::rendering::CookedModel::SceneRecord& sceneRecord) const;
+    std::span<const uint32_t> getChildNodeIndices(const quartz::rendering::CookedModel::NodeRecord& nodeRecord) const;
+    std::span<const quartz::rendering::CookedModel::PrimitiveRecord> getPrimitiveRecords(const quartz::rendering::CookedModel::MeshRecord& meshRecord) const;
+    std::span<const uint8_t> getData(const quartz::rendering::CookedModel::DataLocation& location) const;
+
+public: // static functions
+    static bool isCookedFilepath(const std::string& filepath);
+    static uint64_t alignOffset(const uint64_t offset);
+
+public: // static variables
+    static constexpr uint32_t magic = 0x4B435A51; // "QZCK" when read as bytes
+    static constexpr uint32_t version = 3;
+    static constexpr uint64_t alignment = 64; // a cache line
+    static constexpr const char* fileExtension = "qzmodel";
+
+private: // static functions
+    static const quartz::rendering::CookedModel::Header* loadHeader(const util::MappedFile& mappedFile);
+
+private: // member functions
+    void validateRange(const uint64_t tableSize, const uint32_t first, const uint32_t count) const;
+    void validateIndex(const uint64_t tableSize, const int32_t index) const;
+
+    /**
+     * @brief Every index must land inside the table it indexes and every enum must be one of its
+     *   values, so nothing we build from the records can read past a table or switch on garbage.
+     *   Negative indices are allowed wherever a record uses -1 to mean none or the default
+     */
+    void validateRecords() const;
+
+    /**
+     * @brief Nodes are built by recursing through their children, so a node which is its own
+     *   ancestor would recurse forever
+     */
+    void validateNodeHierarchy() const;
+
+    template <typename Record_t>
+    std::span<const Record_t> getTable(const quartz::rendering::CookedModel::TableLocation& location) const {
+        const std::span<const uint8_t> bytes = mp_mappedFile->getBytes(location.offset, static_cast<uint64_t>(location.count) * sizeof(Record_t));
+        return std::span<const Record_t>(reinterpret_cast<const Record_t*>(bytes.data()), location.count);
+    }
+
+    template <typename Record_t>
+    std::span<const Record_t> getRange(
+        const std::span<const Record_t> table,
+        const uint32_t first,
+        const uint32_t count
+    ) const {
+        if (first > table.size() || count > table.size() - first) {
+            LOG_THROW(MODEL_COOKED, util::StringException, mp_mappedFile->getFilepath(), "Range of {} records starting at {} is outside of a table with {} records in {}", count, first, table.size(), mp_mappedFile->getFilepath());
+        }
+        return table.subspan(first, count);
+    }
+
+private: // member variables
+    std::shared_ptr<const util::MappedFile> mp_mappedFile;
+    const quartz::rendering::CookedModel::Header* mp_header;
+};
+
+/**
+ * @brief Everything is memcpy'd in and out of the file, so the layout of these can't depend on the
+ *   compiler we happen to be using
+ */
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::Header> && sizeof(quartz::rendering::CookedModel::Header) == 144);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::TextureRecord> && sizeof(quartz::rendering::CookedModel::TextureRecord) == 48);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::MaterialRecord> && sizeof(quartz::rendering::CookedModel::MaterialRecord) == 132);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::SceneRecord> && sizeof(quartz::rendering::CookedModel::SceneRecord) == 8);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::NodeRecord> && sizeof(quartz::rendering::CookedModel::NodeRecord) == 80);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::MeshRecord> && sizeof(quartz::rendering::CookedModel::MeshRecord) == 8);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::CookedModel::PrimitiveRecord> && sizeof(quartz::rendering::CookedModel::PrimitiveRecord) == 88);
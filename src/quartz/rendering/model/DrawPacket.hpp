@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+#include <vulkan/vulkan.hpp>
+
+#include "math/transform/Mat4.hpp"
+
+namespace quartz {
+namespace rendering {
+    struct DrawPacket;
+}
+}
+
+/**
+ * @brief Everything needed to record the draw of a single primitive within a model, baked when the
+ *   model is loaded so recording doesn't have to walk the node hierarchy or query the device.
+ *
+ * @brief The buffer handles are non-owning. They belong to the primitive's staged buffers, which live
+ *   as long as the model that baked this packet.
+ */
+struct quartz::rendering::DrawPacket {
+public: // member variables
+    math::Mat4 nodeTransformationMatrix; // the node's matrix within the model, including all of its parents
+    vk::Buffer vulkanPositionBuffer;
+    vk::Buffer vulkanAttributeBuffer; // always belongs to the same primitive as the position buffer
+    vk::Buffer vulkanIndexBuffer;
+    uint32_t indexCount;
+    vk::IndexType indexType;
+    uint32_t materialMasterIndex;
+    uint32_t materialByteOffset; // the offset into the dynamic material uniform buffer
+};
@@ -0,0 +1,149 @@
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "util/errors/RichException.hpp"
+#include "util/file_system/FileSystem.hpp"
+#include "util/file_system/MappedFile.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/GLBFile.hpp"
+
+bool
+quartz::rendering::GLBFile::isGLBFilepath(
+    const std::string& filepath
+) {
+    return util::FileSystem::getFileExtension(filepath) == "glb";
+}
+
+uint64_t
+quartz::rendering::GLBFile::loadFileLength(
+    const util::MappedFile& mappedFile
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_GLB, "{}", mappedFile.getFilepath());
+
+    if (mappedFile.getSizeBytes() < sizeof(quartz::rendering::GLBFile::Header)) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "{} is only {} bytes, which is too small to be a glb file", mappedFile.getFilepath(), mappedFile.getSizeBytes());
+    }
+
+    quartz::rendering::GLBFile::Header header;
+    std::memcpy(&header, mappedFile.getData(), sizeof(header));
+
+    if (header.magic != quartz::rendering::GLBFile::magic) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "{} is not a glb file (magic is {:#x}, expected {:#x})", mappedFile.getFilepath(), header.magic, quartz::rendering::GLBFile::magic);
+    }
+
+    if (header.version != quartz::rendering::GLBFile::version) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "{} is glb version {}, but we only load version {}", mappedFile.getFilepath(), header.version, quartz::rendering::GLBFile::version);
+    }
+
+    if (header.length > mappedFile.getSizeBytes()) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "{} claims to be {} bytes but is only {} bytes", mappedFile.getFilepath(), header.length, mappedFile.getSizeBytes());
+    }
+
+    LOG_TRACE(MODEL_GLB, "Glb file is {} bytes", header.length);
+
+    return header.length;
+}
+
+std::span<const uint8_t>
+quartz::rendering::GLBFile::loadChunk(
+    const util::MappedFile& mappedFile,
+    const uint64_t fileLength,
+    const uint64_t offset,
+    const uint32_t expectedType
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_GLB, "offset {}, type {:#x}", offset, expectedType);
+
+    // The binary chunk is optional, so running out of file before it is fine
+    if (expectedType == quartz::rendering::GLBFile::binaryChunkType && offset >= fileLength) {
+        LOG_TRACE(MODEL_GLB, "No binary chunk in {}", mappedFile.getFilepath());
+        return {};
+    }
+
+    if (offset > fileLength || sizeof(quartz::rendering::GLBFile::ChunkHeader) > fileLength - offset) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "Chunk header at offset {} is past the end of the {} byte glb file {}", offset, fileLength, mappedFile.getFilepath());
+    }
+
+    quartz::rendering::GLBFile::ChunkHeader chunkHeader;
+    std::memcpy(&chunkHeader, mappedFile.getData() + offset, sizeof(chunkHeader));
+
+    if (chunkHeader.type != expectedType) {
+        if (expectedType == quartz::rendering::GLBFile::binaryChunkType) {
+            LOG_TRACE(MODEL_GLB, "Chunk after the json chunk has type {:#x}, so there is no binary chunk in {}", chunkHeader.type, mappedFile.getFilepath());
+            return {};
+        }
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "Chunk at offset {} of {} has type {:#x}, expected {:#x}", offset, mappedFile.getFilepath(), chunkHeader.type, expectedType);
+    }
+
+    const uint64_t chunkOffset = offset + sizeof(quartz::rendering::GLBFile::ChunkHeader);
+    if (chunkHeader.length > fileLength - chunkOffset) {
+        LOG_THROW(MODEL_GLB, util::StringException, mappedFile.getFilepath(), "Chunk of {} bytes at offset {} is past the end of the {} byte glb file {}", chunkHeader.length, chunkOffset, fileLength, mappedFile.getFilepath());
+    }
+
+    LOG_TRACE(MODEL_GLB, "Chunk with type {:#x} is {} bytes at offset {}", chunkHeader.type, chunkHeader.length, chunkOffset);
+
+    return mappedFile.getBytes(chunkOffset, chunkHeader.length);
+}
+
+quartz::rendering::GLBFile::GLBFile(
+    const std::string& filepath
+) :
+    m_mappedFile(filepath),
+    m_fileLength(
+        quartz::rendering::GLBFile::loadFileLength(
+            m_mappedFile
+        )
+    ),
+    m_jsonChunk(
+        quartz::rendering::GLBFile::loadChunk(
+            m_mappedFile,
+            m_fileLength,
+            sizeof(quartz::rendering::GLBFile::Header),
+            quartz::rendering::GLBFile::jsonChunkType
+        )
+    ),
+    m_binaryChunk(
+        quartz::rendering::GLBFile::loadChunk(
+            m_mappedFile,
+            m_fileLength,
+            sizeof(quartz::rendering::GLBFile::Header) + sizeof(quartz::rendering::GLBFile::ChunkHeader) + m_jsonChunk.size(),
+            quartz::rendering::GLBFile::binaryChunkType
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("{}", filepath);
+}
+
+quartz::rendering::GLBFile::GLBFile(
+    quartz::rendering::GLBFile&& other
+) :
+    m_mappedFile(std::move(other.m_mappedFile)),
+    m_fileLength(std::exchange(other.m_fileLength, 0)),
+    m_jsonChunk(std::exchange(other.m_jsonChunk, {})),
+    m_binaryChunk(std::exchange(other.m_binaryChunk, {}))
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::GLBFile::~GLBFile() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::GLBFile&
+quartz::rendering::GLBFile::operator=(
+    quartz::rendering::GLBFile&& other
+) {
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    if (this == &other) {
+        return *this;
+    }
+
+    m_mappedFile = std::move(other.m_mappedFile);
+    m_fileLength = std::exchange(other.m_fileLength, 0);
+    m_jsonChunk = std::exchange(other.m_jsonChunk, {});
+    m_binaryChunk = std::exchange(other.m_binaryChunk, {});
+
+    return *this;
+}
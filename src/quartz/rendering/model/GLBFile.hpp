@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+
+#include "util/file_system/MappedFile.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+
+namespace quartz {
+namespace rendering {
+    class GLBFile;
+}
+}
+
+/**
+ * @brief A binary gltf file, mapped instead of read. The json chunk is handed to tinygltf to parse
+ *   and the binary chunk is read in place by the accessors that reference it, so the geometry in a
+ *   glb file is never copied out of the mapping before it is decoded into staging memory.
+ *
+ * @brief LAYOUT
+ *   A 12 byte header, followed by a json chunk, followed by an optional binary chunk. Each chunk is
+ *   an 8 byte chunk header followed by the chunk's bytes. See
+ * https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#binary-gltf-layout
+ */
+class quartz::rendering::GLBFile {
+public: // classes
+    struct Header {
+    public: // member variables
+        uint32_t magic;
+        uint32_t version;
+        uint32_t length;
+    };
+
+    struct ChunkHeader {
+    public: // member variables
+        uint32_t length;
+        uint32_t type;
+    };
+
+public: // member functions
+    GLBFile(const std::string& filepath);
+    GLBFile(GLBFile&& other);
+    ~GLBFile();
+
+    GLBFile& operator=(GLBFile&& other);
+
+    USE_LOGGER(MODEL_GLB);
+
+    const std::string& getFilepath() const { return m_mappedFile.getFilepath(); }
+    std::span<const uint8_t> getBytes() const { return m_mappedFile.getBytes(0, m_mappedFile.getSizeBytes()); }
+    std::span<const uint8_t> getJsonChunk() const { return m_jsonChunk; }
+    std::span<const uint8_t> getBinaryChunk() const { return m_binaryChunk; } // empty if there isn't one
+
+public: // static functions
+    static bool isGLBFilepath(const std::string& filepath);
+
+public: // static variables
+    static constexpr uint32_t magic = 0x46546C67; // "glTF" when read as bytes
+    static constexpr uint32_t version = 2;
+    static constexpr uint32_t jsonChunkType = 0x4E4F534A; // "JSON"
+    static constexpr uint32_t binaryChunkType = 0x004E4942; // "BIN\0"
+
+private: // static functions
+    static uint64_t loadFileLength(const util::MappedFile& mappedFile);
+    static std::span<const uint8_t> loadChunk(
+        const util::MappedFile& mappedFile,
+        const uint64_t fileLength,
+        const uint64_t offset,
+        const uint32_t expectedType
+    );
+
+private: // member variables
+    util::MappedFile m_mappedFile;
+    uint64_t m_fileLength; // from the header, which may be less than the size of the file on disk
+
+    /**
+     * @brief These point into the mapping, which doesn't move when we do
+     */
+    std::span<const uint8_t> m_jsonChunk;
+    std::span<const uint8_t> m_binaryChunk;
+};
+
+static_assert(std::is_trivially_copyable_v<quartz::rendering::GLBFile::Header> && sizeof(quartz::rendering::GLBFile::Header) == 12);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::GLBFile::ChunkHeader> && sizeof(quartz::rendering::GLBFile::ChunkHeader) == 8);
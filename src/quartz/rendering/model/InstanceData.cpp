@@ -0,0 +1,49 @@
+#include <vulkan/vulkan.hpp>
+
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec4.hpp"
+
+#include "quartz/rendering/model/InstanceData.hpp"
+
+vk::VertexInputBindingDescription
+quartz::rendering::InstanceData::getVulkanVertexInputBindingDescription() {
+    vk::VertexInputBindingDescription vertexInputBindingDescription(
+        quartz::rendering::InstanceData::bindingIndex,
+        sizeof(quartz::rendering::InstanceData),
+        vk::VertexInputRate::eInstance
+    );
+
+    return vertexInputBindingDescription;
+}
+
+std::vector<vk::VertexInputAttributeDescription>
+quartz::rendering::InstanceData::getVulkanVertexInputAttributeDescriptions() {
+    std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = {
+        vk::VertexInputAttributeDescription(
+            static_cast<uint32_t>(quartz::rendering::InstanceData::AttributeType::ModelMatrixColumn0),
+            quartz::rendering::InstanceData::bindingIndex,
+            vk::Format::eR32G32B32A32Sfloat,
+            offsetof(quartz::rendering::InstanceData, modelMatrix) + 0 * sizeof(math::Vec4)
+        ),
+        vk::VertexInputAttributeDescription(
+            static_cast<uint32_t>(quartz::rendering::InstanceData::AttributeType::ModelMatrixColumn1),
+            quartz::rendering::InstanceData::bindingIndex,
+            vk::Format::eR32G32B32A32Sfloat,
+            offsetof(quartz::rendering::InstanceData, modelMatrix) + 1 * sizeof(math::Vec4)
+        ),
+        vk::VertexInputAttributeDescription(
+            static_cast<uint32_t>(quartz::rendering::InstanceData::AttributeType::ModelMatrixColumn2),
+            quartz::rendering::InstanceData::bindingIndex,
+            vk::Format::eR32G32B32A32Sfloat,
+            offsetof(quartz::rendering::InstanceData, modelMatrix) + 2 * sizeof(math::Vec4)
+        ),
+        vk::VertexInputAttributeDescription(
+            static_cast<uint32_t>(quartz::rendering::InstanceData::AttributeType::ModelMatrixColumn3),
+            quartz::rendering::InstanceData::bindingIndex,
+            vk::Format::eR32G32B32A32Sfloat,
+            offsetof(quartz::rendering::InstanceData, modelMatrix) + 3 * sizeof(math::Vec4)
+        )
+    };
+
+    return vertexInputAttributeDescriptions;
+}
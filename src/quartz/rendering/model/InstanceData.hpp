@@ -0,0 +1,42 @@
+#pragma once
+
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "math/transform/Mat4.hpp"
+
+namespace quartz {
+namespace rendering {
+    struct InstanceData;
+}
+}
+
+/**
+ * @brief The per-instance vertex input for the doodad pipeline. Each doodad drawn with a model
+ *   gets one of these in the per-frame instance buffer, so every primitive in the model can be
+ *   drawn once for all doodads sharing it.
+ */
+struct quartz::rendering::InstanceData {
+public: // enums
+    /**
+     * @brief A mat4 input consumes 4 consecutive locations, one for each column. These follow
+     *   directly after the locations used by quartz::rendering::Vertex
+     */
+    enum class AttributeType : uint32_t {
+        ModelMatrixColumn0 = 5,
+        ModelMatrixColumn1 = 6,
+        ModelMatrixColumn2 = 7,
+        ModelMatrixColumn3 = 8
+    };
+
+public: // static functions
+    static vk::VertexInputBindingDescription getVulkanVertexInputBindingDescription();
+    static std::vector<vk::VertexInputAttributeDescription> getVulkanVertexInputAttributeDescriptions();
+
+public: // static variables
+    static constexpr uint32_t bindingIndex = 1;
+
+public: // member variables
+    math::Mat4 modelMatrix;
+};
@@ -1,7 +1,11 @@
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Mesh.hpp"
 #include "quartz/rendering/model/Primitive.hpp"
 
@@ -9,8 +13,10 @@ std::vector<quartz::rendering::Primitive>
 quartz::rendering::Mesh::loadPrimitives(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Mesh& gltfMesh,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_MESH, "");
 
@@ -29,26 +35,105 @@ quartz::rendering::Mesh::loadPrimitives(
         primitives.emplace_back(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfPrimitive,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
         );
     }
 
     return primitives;
 }
 
+std::vector<quartz::rendering::Primitive>
+quartz::rendering::Mesh::loadPrimitives(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::MeshRecord& meshRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_MESH, "");
+
+    // Primitives without indices were already skipped when cooking
+    const std::span<const quartz::rendering::CookedModel::PrimitiveRecord> primitiveRecords = cookedModel.getPrimitiveRecords(meshRecord);
+
+    std::vector<quartz::rendering::Primitive> primitives;
+    primitives.reserve(primitiveRecords.size());
+
+    LOG_TRACE(MODEL_MESH, "Loading {} cooked primitives", primitiveRecords.size());
+    for (const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord : primitiveRecords) {
+        primitives.emplace_back(
+            renderingDevice,
+            cookedModel,
+            primitiveRecord,
+            materialMasterIndices,
+            retainGeometry
+        );
+    }
+
+    return primitives;
+}
+
+math::AxisAlignedBoundingBox
+quartz::rendering::Mesh::calculateBoundingBox(
+    const std::vector<quartz::rendering::Primitive>& primitives
+) {
+    math::AxisAlignedBoundingBox boundingBox;
+
+    for (const quartz::rendering::Primitive& primitive : primitives) {
+        boundingBox.expand(primitive.getBoundingBox());
+    }
+
+    return boundingBox;
+}
+
 quartz::rendering::Mesh::Mesh(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Mesh& gltfMesh,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) :
     m_primitives(
         quartz::rendering::Mesh::loadPrimitives(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfMesh,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
+        )
+    ),
+    m_boundingBox(
+        quartz::rendering::Mesh::calculateBoundingBox(
+            m_primitives
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::Mesh::Mesh(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::MeshRecord& meshRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) :
+    m_primitives(
+        quartz::rendering::Mesh::loadPrimitives(
+            renderingDevice,
+            cookedModel,
+            meshRecord,
+            materialMasterIndices,
+            retainGeometry
+        )
+    ),
+    m_boundingBox(
+        quartz::rendering::Mesh::calculateBoundingBox(
+            m_primitives
         )
     )
 {
@@ -58,7 +143,8 @@ quartz::rendering::Mesh::Mesh(
 quartz::rendering::Mesh::Mesh(
     quartz::rendering::Mesh&& other
 ) :
-    m_primitives(std::move(other.m_primitives))
+    m_primitives(std::move(other.m_primitives)),
+    m_boundingBox(other.m_boundingBox)
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Primitive.hpp"
 
 namespace quartz {
@@ -18,8 +22,17 @@ public: // member functions
     Mesh(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Mesh& gltfMesh,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    Mesh(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::MeshRecord& meshRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
     Mesh(Mesh&& other);
     ~Mesh();
@@ -27,15 +40,29 @@ public: // member functions
     USE_LOGGER(MODEL_MESH);
 
     const std::vector<quartz::rendering::Primitive>& getPrimitives() const { return m_primitives; }
+    const math::AxisAlignedBoundingBox& getBoundingBox() const { return m_boundingBox; }
 
 private: // static functions
-    std::vector<quartz::rendering::Primitive> loadPrimitives(
+    static std::vector<quartz::rendering::Primitive> loadPrimitives(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Mesh& gltfMesh,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static std::vector<quartz::rendering::Primitive> loadPrimitives(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::MeshRecord& meshRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static math::AxisAlignedBoundingBox calculateBoundingBox(
+        const std::vector<quartz::rendering::Primitive>& primitives
     );
 
 private: // member variables
     std::vector<quartz::rendering::Primitive> m_primitives;
+    math::AxisAlignedBoundingBox m_boundingBox;
 };
\ No newline at end of file
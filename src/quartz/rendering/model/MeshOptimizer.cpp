@@ -0,0 +1,444 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <glm/geometric.hpp>
+#include <glm/vec3.hpp>
+
+#include <vulkan/vulkan.hpp>
+
+#include "math/transform/Vec3.hpp"
+
+#include "quartz/rendering/model/MeshOptimizer.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
+
+std::string
+quartz::rendering::MeshOptimizer::Statistics::toString() const {
+    return
+        "{ vertices: " + std::to_string(vertexCountBefore) + " -> " + std::to_string(vertexCountAfter) +
+        " , acmr: " + std::to_string(acmrBefore) + " -> " + std::to_string(acmrAfter) +
+        " , bytes: " + std::to_string(bytesBefore) + " -> " + std::to_string(bytesAfter) +
+        " , indices: " + (indexType == vk::IndexType::eUint16 ? "uint16" : "uint32") +
+        " }";
+}
+
+float
+quartz::rendering::MeshOptimizer::calculateVertexScore(
+    const int32_t cachePosition,
+    const uint32_t remainingTriangleCount
+) {
+    /**
+     * @brief Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" scoring. Vertices recently used
+     *   score well, and vertices with few triangles left score well so we finish them off instead of
+     *   leaving lone triangles behind that will need the vertex transformed again
+     */
+    if (remainingTriangleCount == 0) {
+        return -1.0f;
+    }
+
+    float score = 0.0f;
+    if (cachePosition >= 0) {
+        if (cachePosition < 3) {
+            // The previous triangle's vertices are scored lower so we don't favor strips too heavily
+            score = 0.75f;
+        } else {
+            const float scale = 1.0f / (quartz::rendering::MeshOptimizer::scoredCacheSize - 3);
+            score = std::pow(1.0f - (cachePosition - 3) * scale, 1.5f);
+        }
+    }
+
+    score += 2.0f / std::sqrt(static_cast<float>(remainingTriangleCount));
+
+    return score;
+}
+
+uint32_t
+quartz::rendering::MeshOptimizer::calculateStreamBytes(
+    const uint32_t vertexCount,
+    const uint32_t indexCount,
+    const vk::IndexType indexType
+) {
+    const uint32_t vertexBytes = sizeof(math::Vec3) + sizeof(quartz::rendering::Vertex::PackedAttributes);
+
+    return vertexCount * vertexBytes + indexCount * quartz::rendering::MeshOptimizer::getIndexSizeBytes(indexType);
+}
+
+float
+quartz::rendering::MeshOptimizer::calculateACMR(
+    const uint32_t vertexCount,
+    const std::vector<uint32_t>& indices
+) {
+    const uint32_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return 0.0f;
+    }
+
+    /**
+     * @brief A fifo cache where each vertex remembers when it was inserted. It is still in the cache
+     *   as long as fewer than simulatedCacheSize vertices have been inserted since
+     */
+    std::vector<uint32_t> insertionTimestamps(vertexCount, 0);
+    uint32_t timestamp = quartz::rendering::MeshOptimizer::simulatedCacheSize + 1;
+    uint32_t missCount = 0;
+
+    for (const uint32_t index : indices) {
+        if (timestamp - insertionTimestamps[index] > quartz::rendering::MeshOptimizer::simulatedCacheSize) {
+            insertionTimestamps[index] = timestamp++;
+            missCount++;
+        }
+    }
+
+    return static_cast<float>(missCount) / triangleCount;
+}
+
+vk::IndexType
+quartz::rendering::MeshOptimizer::getIndexType(
+    const uint32_t vertexCount
+) {
+    return vertexCount <= static_cast<uint32_t>(std::numeric_limits<uint16_t>::max()) + 1 ?
+        vk::IndexType::eUint16 :
+        vk::IndexType::eUint32;
+}
+
+uint32_t
+quartz::rendering::MeshOptimizer::getIndexSizeBytes(
+    const vk::IndexType indexType
+) {
+    return indexType == vk::IndexType::eUint16 ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+void
+quartz::rendering::MeshOptimizer::weldVertices(
+    std::vector<quartz::rendering::Vertex>& vertices,
+    std::vector<uint32_t>& indices
+) {
+    const uint32_t vertexCount = vertices.size();
+    if (vertexCount == 0) {
+        return;
+    }
+
+    // Open addressing with linear probing, kept at most half full so probes stay short
+    uint32_t bucketCount = 1;
+    while (bucketCount < vertexCount * 2) {
+        bucketCount <<= 1;
+    }
+    const uint32_t bucketMask = bucketCount - 1;
+
+    std::vector<uint32_t> buckets(bucketCount, quartz::rendering::MeshOptimizer::invalidIndex);
+    std::vector<uint32_t> remappedIndices(vertexCount);
+    std::vector<quartz::rendering::Vertex> uniqueVertices;
+    uniqueVertices.reserve(vertexCount);
+
+    const std::hash<quartz::rendering::Vertex> vertexHasher;
+
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        uint32_t bucketIndex = vertexHasher(vertices[i]) & bucketMask;
+        while (buckets[bucketIndex] != quartz::rendering::MeshOptimizer::invalidIndex && !(uniqueVertices[buckets[bucketIndex]] == vertices[i])) {
+            bucketIndex = (bucketIndex + 1) & bucketMask;
+        }
+
+        if (buckets[bucketIndex] == quartz::rendering::MeshOptimizer::invalidIndex) {
+            buckets[bucketIndex] = uniqueVertices.size();
+            uniqueVertices.push_back(vertices[i]);
+        }
+
+        remappedIndices[i] = buckets[bucketIndex];
+    }
+
+    for (uint32_t& index : indices) {
+        index = remappedIndices[index];
+    }
+
+    vertices = std::move(uniqueVertices);
+}
+
+void
+quartz::rendering::MeshOptimizer::optimizeVertexCache(
+    const uint32_t vertexCount,
+    std::vector<uint32_t>& indices
+) {
+    const uint32_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    // The triangles using each vertex, stored contiguously. The ones still to be emitted are kept at the front
+    std::vector<uint32_t> remainingTriangleCounts(vertexCount, 0);
+    for (const uint32_t index : indices) {
+        remainingTriangleCounts[index]++;
+    }
+
+    std::vector<uint32_t> adjacencyOffsets(vertexCount + 1, 0);
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        adjacencyOffsets[i + 1] = adjacencyOffsets[i] + remainingTriangleCounts[i];
+    }
+
+    std::vector<uint32_t> adjacentTriangles(indices.size());
+    std::vector<uint32_t> adjacencyFillCounts(vertexCount, 0);
+    for (uint32_t i = 0; i < indices.size(); ++i) {
+        const uint32_t vertexIndex = indices[i];
+        adjacentTriangles[adjacencyOffsets[vertexIndex] + adjacencyFillCounts[vertexIndex]++] = i / 3;
+    }
+
+    std::vector<int32_t> cachePositions(vertexCount, -1);
+    std::vector<float> vertexScores(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i) {
+        vertexScores[i] = quartz::rendering::MeshOptimizer::calculateVertexScore(-1, remainingTriangleCounts[i]);
+    }
+
+    std::vector<float> triangleScores(triangleCount);
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        triangleScores[i] = vertexScores[indices[i * 3 + 0]] + vertexScores[indices[i * 3 + 1]] + vertexScores[indices[i * 3 + 2]];
+    }
+
+    std::vector<bool> triangleEmitted(triangleCount, false);
+    std::vector<uint32_t> optimizedIndices;
+    optimizedIndices.reserve(indices.size());
+
+    std::vector<uint32_t> cache;
+    std::vector<uint32_t> nextCache;
+    cache.reserve(quartz::rendering::MeshOptimizer::scoredCacheSize + 3);
+    nextCache.reserve(quartz::rendering::MeshOptimizer::scoredCacheSize + 3);
+
+    uint32_t bestTriangle = quartz::rendering::MeshOptimizer::invalidIndex;
+    uint32_t scanCursor = 0;
+
+    for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount) {
+        if (bestTriangle == quartz::rendering::MeshOptimizer::invalidIndex) {
+            // Nothing in the cache has triangles left, so pick up from the next triangle we haven't emitted
+            while (triangleEmitted[scanCursor]) {
+                scanCursor++;
+            }
+            bestTriangle = scanCursor;
+        }
+
+        const uint32_t triangle = bestTriangle;
+        triangleEmitted[triangle] = true;
+
+        nextCache.clear();
+        for (uint32_t i = 0; i < 3; ++i) {
+            const uint32_t vertexIndex = indices[triangle * 3 + i];
+            optimizedIndices.push_back(vertexIndex);
+
+            if (std::find(nextCache.begin(), nextCache.end(), vertexIndex) == nextCache.end()) {
+                nextCache.push_back(vertexIndex);
+            }
+
+            // Move the triangle to the back of the vertex's remaining triangles so it drops off the end
+            const uint32_t adjacencyBegin = adjacencyOffsets[vertexIndex];
+            const uint32_t adjacencyEnd = adjacencyBegin + remainingTriangleCounts[vertexIndex];
+            for (uint32_t j = adjacencyBegin; j < adjacencyEnd; ++j) {
+                if (adjacentTriangles[j] == triangle) {
+                    std::swap(adjacentTriangles[j], adjacentTriangles[adjacencyEnd - 1]);
+                    break;
+                }
+            }
+            remainingTriangleCounts[vertexIndex]--;
+        }
+
+        for (const uint32_t vertexIndex : cache) {
+            if (std::find(nextCache.begin(), nextCache.end(), vertexIndex) == nextCache.end()) {
+                nextCache.push_back(vertexIndex);
+            }
+        }
+
+        // Rescore everything that was in the cache, including anything just pushed out of it
+        for (uint32_t i = 0; i < nextCache.size(); ++i) {
+            const uint32_t vertexIndex = nextCache[i];
+            cachePositions[vertexIndex] = i < quartz::rendering::MeshOptimizer::scoredCacheSize ? static_cast<int32_t>(i) : -1;
+            vertexScores[vertexIndex] = quartz::rendering::MeshOptimizer::calculateVertexScore(
+                cachePositions[vertexIndex],
+                remainingTriangleCounts[vertexIndex]
+            );
+        }
+
+        // Only triangles touching those vertices changed score, so the best one must be among them
+        bestTriangle = quartz::rendering::MeshOptimizer::invalidIndex;
+        float bestTriangleScore = -std::numeric_limits<float>::max();
+        for (const uint32_t vertexIndex : nextCache) {
+            const uint32_t adjacencyBegin = adjacencyOffsets[vertexIndex];
+            const uint32_t adjacencyEnd = adjacencyBegin + remainingTriangleCounts[vertexIndex];
+            for (uint32_t j = adjacencyBegin; j < adjacencyEnd; ++j) {
+                const uint32_t adjacentTriangle = adjacentTriangles[j];
+                triangleScores[adjacentTriangle] =
+                    vertexScores[indices[adjacentTriangle * 3 + 0]] +
+                    vertexScores[indices[adjacentTriangle * 3 + 1]] +
+                    vertexScores[indices[adjacentTriangle * 3 + 2]];
+
+                if (triangleScores[adjacentTriangle] > bestTriangleScore) {
+                    bestTriangleScore = triangleScores[adjacentTriangle];
+                    bestTriangle = adjacentTriangle;
+                }
+            }
+        }
+
+        if (nextCache.size() > quartz::rendering::MeshOptimizer::scoredCacheSize) {
+            nextCache.resize(quartz::rendering::MeshOptimizer::scoredCacheSize);
+        }
+        std::swap(cache, nextCache);
+    }
+
+    indices = std::move(optimizedIndices);
+}
+
+void
+quartz::rendering::MeshOptimizer::optimizeOverdraw(
+    const std::vector<quartz::rendering::Vertex>& vertices,
+    std::vector<uint32_t>& indices,
+    const float acmrThreshold
+) {
+    const uint32_t triangleCount = indices.size() / 3;
+    if (triangleCount == 0) {
+        return;
+    }
+
+    /**
+     * @brief Split the triangles into clusters wherever the cache order had to start over, meaning all
+     *   three of a triangle's vertices missed the cache. Shuffling clusters around then costs us very
+     *   little of what the vertex cache optimization gained
+     */
+    std::vector<uint32_t> clusterStarts = {0};
+    std::vector<uint32_t> insertionTimestamps(vertices.size(), 0);
+    uint32_t timestamp = quartz::rendering::MeshOptimizer::simulatedCacheSize + 1;
+
+    for (uint32_t i = 0; i < triangleCount; ++i) {
+        uint32_t missCount = 0;
+        for (uint32_t j = 0; j < 3; ++j) {
+            const uint32_t vertexIndex = indices[i * 3 + j];
+            if (timestamp - insertionTimestamps[vertexIndex] > quartz::rendering::MeshOptimizer::simulatedCacheSize) {
+                insertionTimestamps[vertexIndex] = timestamp++;
+                missCount++;
+            }
+        }
+
+        if (i > 0 && missCount == 3) {
+            clusterStarts.push_back(i);
+        }
+    }
+
+    if (clusterStarts.size() < 2) {
+        return;
+    }
+
+    glm::vec3 meshCentroid(0.0f);
+    for (const quartz::rendering::Vertex& vertex : vertices) {
+        meshCentroid += static_cast<const glm::vec3&>(vertex.position);
+    }
+    meshCentroid /= static_cast<float>(vertices.size());
+
+    /**
+     * @brief Clusters facing away from the middle of the mesh are the ones most likely to be in front
+     *   of everything else, so we want to draw those first and let depth testing reject what's behind them
+     */
+    std::vector<float> clusterSortKeys(clusterStarts.size());
+    for (uint32_t i = 0; i < clusterStarts.size(); ++i) {
+        const uint32_t clusterEnd = i + 1 < clusterStarts.size() ? clusterStarts[i + 1] : triangleCount;
+
+        glm::vec3 weightedCentroid(0.0f);
+        glm::vec3 weightedNormal(0.0f);
+        float totalArea = 0.0f;
+
+        for (uint32_t j = clusterStarts[i]; j < clusterEnd; ++j) {
+            const glm::vec3& a = vertices[indices[j * 3 + 0]].position;
+            const glm::vec3& b = vertices[indices[j * 3 + 1]].position;
+            const glm::vec3& c = vertices[indices[j * 3 + 2]].position;
+
+            const glm::vec3 crossProduct = glm::cross(b - a, c - a); // its length is twice the triangle's area
+            const float area = glm::length(crossProduct);
+
+            weightedCentroid += (a + b + c) * (area / 3.0f);
+            weightedNormal += crossProduct;
+            totalArea += area;
+        }
+
+        const float normalLength = glm::length(weightedNormal);
+        if (totalArea == 0.0f || normalLength == 0.0f) {
+            clusterSortKeys[i] = 0.0f;
+            continue;
+        }
+
+        clusterSortKeys[i] = glm::dot((weightedCentroid / totalArea) - meshCentroid, weightedNormal / normalLength);
+    }
+
+    std::vector<uint32_t> clusterOrder(clusterStarts.size());
+    for (uint32_t i = 0; i < clusterOrder.size(); ++i) {
+        clusterOrder[i] = i;
+    }
+    std::stable_sort(
+        clusterOrder.begin(),
+        clusterOrder.end(),
+        [&clusterSortKeys](const uint32_t a, const uint32_t b) {
+            return clusterSortKeys[a] > clusterSortKeys[b];
+        }
+    );
+
+    std::vector<uint32_t> sortedIndices;
+    sortedIndices.reserve(indices.size());
+    for (const uint32_t clusterIndex : clusterOrder) {
+        const uint32_t clusterEnd = clusterIndex + 1 < clusterStarts.size() ? clusterStarts[clusterIndex + 1] : triangleCount;
+        sortedIndices.insert(
+            sortedIndices.end(),
+            indices.begin() + clusterStarts[clusterIndex] * 3,
+            indices.begin() + clusterEnd * 3
+        );
+    }
+
+    // Keep the cache order if reducing overdraw would cost us too many vertex transforms
+    const float acmrBefore = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), indices);
+    const float acmrAfter = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), sortedIndices);
+    if (acmrAfter > acmrBefore * acmrThreshold) {
+        return;
+    }
+
+    indices = std::move(sortedIndices);
+}
+
+void
+quartz::rendering::MeshOptimizer::optimizeVertexFetch(
+    std::vector<quartz::rendering::Vertex>& vertices,
+    std::vector<uint32_t>& indices
+) {
+    std::vector<uint32_t> remappedIndices(vertices.size(), quartz::rendering::MeshOptimizer::invalidIndex);
+    std::vector<quartz::rendering::Vertex> orderedVertices;
+    orderedVertices.reserve(vertices.size());
+
+    // Vertices no triangle uses are dropped along the way
+    for (uint32_t& index : indices) {
+        if (remappedIndices[index] == quartz::rendering::MeshOptimizer::invalidIndex) {
+            remappedIndices[index] = orderedVertices.size();
+            orderedVertices.push_back(vertices[index]);
+        }
+
+        index = remappedIndices[index];
+    }
+
+    vertices = std::move(orderedVertices);
+}
+
+quartz::rendering::MeshOptimizer::Statistics
+quartz::rendering::MeshOptimizer::optimize(
+    std::vector<quartz::rendering::Vertex>& vertices,
+    std::vector<uint32_t>& indices
+) {
+    quartz::rendering::MeshOptimizer::Statistics statistics;
+    statistics.vertexCountBefore = vertices.size();
+    statistics.acmrBefore = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), indices);
+    statistics.bytesBefore = quartz::rendering::MeshOptimizer::calculateStreamBytes(vertices.size(), indices.size(), vk::IndexType::eUint32);
+
+    if (!indices.empty() && indices.size() % 3 == 0) {
+        quartz::rendering::MeshOptimizer::weldVertices(vertices, indices);
+        quartz::rendering::MeshOptimizer::optimizeVertexCache(vertices.size(), indices);
+        quartz::rendering::MeshOptimizer::optimizeOverdraw(vertices, indices, quartz::rendering::MeshOptimizer::overdrawACMRThreshold);
+        quartz::rendering::MeshOptimizer::optimizeVertexFetch(vertices, indices);
+    }
+
+    statistics.vertexCountAfter = vertices.size();
+    statistics.acmrAfter = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), indices);
+    statistics.indexType = quartz::rendering::MeshOptimizer::getIndexType(vertices.size());
+    statistics.bytesAfter = quartz::rendering::MeshOptimizer::calculateStreamBytes(vertices.size(), indices.size(), statistics.indexType);
+
+    return statistics;
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/model/Vertex.hpp"
+
+namespace quartz {
+namespace rendering {
+    class MeshOptimizer;
+}
+}
+
+/**
+ * @brief Rearranges a primitive's vertices and triangle indices at load time so they are cheaper for
+ *   the gpu to draw, without changing what gets drawn. In order, we
+ *   - weld vertices which are identical in every attribute
+ *   - reorder triangles so vertices are reused while they are still in the post-transform cache
+ *   - reorder clusters of those triangles so outward facing ones are drawn first, reducing overdraw
+ *   - reorder vertices into the order the triangles first use them, so fetching them is sequential
+ *
+ * @brief Everything here works on triangle lists. Anything else is left alone.
+ */
+class quartz::rendering::MeshOptimizer {
+public: // classes
+    struct Statistics {
+    public: // member functions
+        std::string toString() const;
+
+    public: // member variables
+        uint32_t vertexCountBefore;
+        uint32_t vertexCountAfter;
+        float acmrBefore; // average cache miss ratio, the number of vertices transformed per triangle
+        float acmrAfter;
+        uint32_t bytesBefore; // vertex streams and index buffer combined
+        uint32_t bytesAfter;
+        vk::IndexType indexType;
+    };
+
+public: // member functions
+    MeshOptimizer() = delete;
+
+public: // static functions
+    static quartz::rendering::MeshOptimizer::Statistics optimize(
+        std::vector<quartz::rendering::Vertex>& vertices,
+        std::vector<uint32_t>& indices
+    );
+
+    static void weldVertices(
+        std::vector<quartz::rendering::Vertex>& vertices,
+        std::vector<uint32_t>& indices
+    );
+    static void optimizeVertexCache(
+        const uint32_t vertexCount,
+        std::vector<uint32_t>& indices
+    );
+    static void optimizeOverdraw(
+        const std::vector<quartz::rendering::Vertex>& vertices,
+        std::vector<uint32_t>& indices,
+        const float acmrThreshold
+    );
+    static void optimizeVertexFetch(
+        std::vector<quartz::rendering::Vertex>& vertices,
+        std::vector<uint32_t>& indices
+    );
+
+    static float calculateACMR(
+        const uint32_t vertexCount,
+        const std::vector<uint32_t>& indices
+    );
+    static vk::IndexType getIndexType(const uint32_t vertexCount);
+    static uint32_t getIndexSizeBytes(const vk::IndexType indexType);
+
+public: // static variables
+    /**
+     * @brief The size of the fifo cache we simulate when calculating ACMR. This is on the small side
+     *   for modern hardware, so it errs towards underestimating how well we do
+     */
+    static constexpr uint32_t simulatedCacheSize = 16;
+
+    /**
+     * @brief How much worse than the vertex cache order the overdraw order's ACMR is allowed to be
+     */
+    static constexpr float overdrawACMRThreshold = 1.05f;
+
+private: // static functions
+    static float calculateVertexScore(
+        const int32_t cachePosition,
+        const uint32_t remainingTriangleCount
+    );
+    static uint32_t calculateStreamBytes(
+        const uint32_t vertexCount,
+        const uint32_t indexCount,
+        const vk::IndexType indexType
+    );
+
+private: // static variables
+    static constexpr uint32_t scoredCacheSize = 32;
+    static constexpr uint32_t invalidIndex = std::numeric_limits<uint32_t>::max();
+};
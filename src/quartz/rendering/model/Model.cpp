@@ -1,3 +1,8 @@
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <optional>
+#include <span>
 #include <string>
 #include <queue>
 
@@ -5,34 +10,77 @@
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
 #include "util/errors/RichException.hpp"
-#include "util/file_system/FileSystem.hpp"
 
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/GLBFile.hpp"
 #include "quartz/rendering/model/Model.hpp"
+#include "quartz/rendering/texture/GLTFImageLoader.hpp"
+
+std::optional<quartz::rendering::CookedModel>
+quartz::rendering::Model::loadCookedModel(
+    const std::string& filepath
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "{}", filepath);
+
+    if (!quartz::rendering::CookedModel::isCookedFilepath(filepath)) {
+        LOG_TRACE(MODEL, "{} is not a cooked model", filepath);
+        return std::nullopt;
+    }
+
+    LOG_TRACE(MODEL, "Mapping cooked model at {}", filepath);
+    return std::optional<quartz::rendering::CookedModel>(std::in_place, filepath);
+}
+
+std::optional<quartz::rendering::GLBFile>
+quartz::rendering::Model::loadGLBFile(
+    const std::string& filepath
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "{}", filepath);
+
+    if (!quartz::rendering::GLBFile::isGLBFilepath(filepath)) {
+        LOG_TRACE(MODEL, "{} is not a glb file", filepath);
+        return std::nullopt;
+    }
+
+    LOG_TRACE(MODEL, "Mapping glb file at {}", filepath);
+    return std::optional<quartz::rendering::GLBFile>(std::in_place, filepath);
+}
 
 tinygltf::Model
 quartz::rendering::Model::loadGLTFModel(
-    const std::string& filepath
+    const std::string& filepath,
+    const std::optional<quartz::rendering::GLBFile>& o_glbFile
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL, "{}", filepath);
 
     tinygltf::TinyGLTF gltfContext;
     tinygltf::Model gltfModel;
 
+    // Images are decoded on the thread pool while tinygltf keeps parsing
+    quartz::rendering::GLTFImageLoader imageLoader(gltfContext);
+
     std::string warningString;
     std::string errorString;
 
-    const bool isBinaryFile = util::FileSystem::getFileExtension(filepath) == "glb";
+    const bool isBinaryFile = o_glbFile.has_value();
 
     LOG_TRACE(MODEL, "Using {} gltf file at {}", isBinaryFile ? "binary" : "ascii", filepath);
 
+    /**
+     * @brief Glb files are parsed straight out of the mapping rather than read into memory first
+     */
     const bool fileLoadedSuccessfully =
         isBinaryFile ?
-            gltfContext.LoadBinaryFromFile(
+            gltfContext.LoadBinaryFromMemory(
                 &gltfModel,
                 &errorString,
                 &warningString,
-                filepath.c_str()
+                o_glbFile->getBytes().data(),
+                o_glbFile->getBytes().size(),
+                std::filesystem::path(filepath).parent_path().string()
             ) :
             gltfContext.LoadASCIIFromFile(
                 &gltfModel,
@@ -51,16 +99,63 @@ quartz::rendering::Model::loadGLTFModel(
     }
 
     if (!warningString.empty()) {
-        LOG_WARNING(MODEL, "TinyGLTF::Load{}FromFile warning : {}", isBinaryFile ? "Binary" : "ASCII", warningString);
+        LOG_WARNING(MODEL, "TinyGLTF::Load{}From{} warning : {}", isBinaryFile ? "Binary" : "ASCII", isBinaryFile ? "Memory" : "File", warningString);
     }
 
     if (!errorString.empty()) {
-        LOG_ERROR(MODEL, "TinyGLTF::Load{}FromFile error : {}", isBinaryFile ? "Binary" : "ASCII", errorString);
+        LOG_ERROR(MODEL, "TinyGLTF::Load{}From{} error : {}", isBinaryFile ? "Binary" : "ASCII", isBinaryFile ? "Memory" : "File", errorString);
+    }
+
+    LOG_TRACE(MODEL, "Waiting on {} images to finish decoding", imageLoader.getPendingImageCount());
+    imageLoader.finishDecoding(gltfModel);
+
+    /**
+     * @brief Tinygltf always copies the binary chunk into the buffer that refers to it. Our
+     *   accessors read the binary chunk out of the mapping instead (see loadGLTFBuffers), and any
+     *   images in it were copied out when they were queued for decoding, so we give that copy back
+     *   right away
+     */
+    if (isBinaryFile) {
+        for (tinygltf::Buffer& gltfBuffer : gltfModel.buffers) {
+            if (!gltfBuffer.uri.empty()) {
+                continue;
+            }
+
+            LOG_TRACE(MODEL, "Releasing tinygltf's {} byte copy of the binary chunk", gltfBuffer.data.size());
+            gltfBuffer.data.clear();
+            gltfBuffer.data.shrink_to_fit();
+        }
     }
 
     return gltfModel;
 }
 
+std::vector<std::span<const uint8_t>>
+quartz::rendering::Model::loadGLTFBuffers(
+    const tinygltf::Model& gltfModel,
+    const std::optional<quartz::rendering::GLBFile>& o_glbFile
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    std::vector<std::span<const uint8_t>> gltfBuffers;
+    gltfBuffers.reserve(gltfModel.buffers.size());
+
+    for (uint32_t i = 0; i < gltfModel.buffers.size(); ++i) {
+        const tinygltf::Buffer& gltfBuffer = gltfModel.buffers[i];
+
+        if (o_glbFile && gltfBuffer.uri.empty()) {
+            LOG_TRACE(MODEL, "Buffer {} is the {} byte binary chunk of the glb file", i, o_glbFile->getBinaryChunk().size());
+            gltfBuffers.push_back(o_glbFile->getBinaryChunk());
+            continue;
+        }
+
+        LOG_TRACE(MODEL, "Buffer {} is {} bytes loaded by tinygltf", i, gltfBuffer.data.size());
+        gltfBuffers.push_back(std::span<const uint8_t>(gltfBuffer.data));
+    }
+
+    return gltfBuffers;
+}
+
 std::vector<uint32_t>
 quartz::rendering::Model::loadTextures(
     const quartz::rendering::Device& renderingDevice,
@@ -75,6 +170,9 @@ quartz::rendering::Model::loadTextures(
 
     std::vector<uint32_t> masterIndices;
 
+    // Each texture only keeps the channels the materials read from it
+    const std::vector<quartz::rendering::Texture::Type> textureTypes = quartz::rendering::Texture::getGLTFTextureTypes(gltfModel);
+
     for (uint32_t i = 0; i < gltfModel.textures.size(); ++i) {
         LOG_SCOPE_CHANGE_TRACE(MODEL);
         const tinygltf::Texture& gltfTexture = gltfModel.textures[i];
@@ -95,20 +193,55 @@ quartz::rendering::Model::loadTextures(
             LOG_TRACE(MODEL, "Using gltf sampler {} with name \"{}\"", samplerIndex, gltfSampler.name);
         }
 
-        const int32_t imageIndex = gltfTexture.source;
+        const int32_t imageIndex = quartz::rendering::Texture::getGLTFImageIndex(gltfModel, gltfTexture);
         const tinygltf::Image& gltfImage = gltfModel.images[imageIndex];
         LOG_TRACE(MODEL, "Using gltf image {} with name \"{}\"", imageIndex, gltfImage.name);
 
-        /**
-         * @todo 2023/11/17 We might be able to determine the type of texture we are creating based
-         *   on the information in gltfImage and in gltfSampler. We might not be able to store all of
-         *   these textures in 1 master list due to their differences in structure.
-         */
-
         masterIndices.emplace_back(quartz::rendering::Texture::createTexture(
             renderingDevice,
             gltfImage,
-            gltfSampler
+            gltfSampler,
+            textureTypes[i]
+        ));
+    }
+
+    return masterIndices;
+}
+
+std::vector<uint32_t>
+quartz::rendering::Model::loadTextures(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    const std::span<const quartz::rendering::CookedModel::TextureRecord> textureRecords = cookedModel.getTextureRecords();
+    LOG_TRACE(MODEL, "Got {} textures from cooked model", textureRecords.size());
+
+    quartz::rendering::Texture::initializeMasterTextureList(renderingDevice);
+
+    std::vector<uint32_t> masterIndices;
+    masterIndices.reserve(textureRecords.size());
+
+    for (uint32_t i = 0; i < textureRecords.size(); ++i) {
+        LOG_SCOPE_CHANGE_TRACE(MODEL);
+        const quartz::rendering::CookedModel::TextureRecord& textureRecord = textureRecords[i];
+
+        LOG_TRACE(MODEL, "Creating {}x{} texture {}", textureRecord.width, textureRecord.height, i);
+        const quartz::rendering::KTX2Container container(cookedModel.getData(textureRecord.container));
+
+        tinygltf::Sampler gltfSampler;
+        gltfSampler.minFilter = textureRecord.minFilter;
+        gltfSampler.magFilter = textureRecord.magFilter;
+        gltfSampler.wrapS = textureRecord.wrapS;
+        gltfSampler.wrapT = textureRecord.wrapT;
+
+        masterIndices.emplace_back(quartz::rendering::Texture::createTexture(
+            renderingDevice,
+            container,
+            cookedModel.getMappedFilePtr(),
+            gltfSampler,
+            static_cast<quartz::rendering::Texture::Type>(textureRecord.type)
         ));
     }
 
@@ -318,11 +451,61 @@ quartz::rendering::Model::loadMaterialMasterIndices(
     return masterMaterialIndices;
 }
 
+std::vector<uint32_t>
+quartz::rendering::Model::loadMaterialMasterIndices(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    quartz::rendering::Material::initializeMasterMaterialList(renderingDevice);
+
+    std::vector<uint32_t> masterTextureIndices = quartz::rendering::Model::loadTextures(renderingDevice, cookedModel);
+    LOG_TRACE(MODEL, "Loaded {} texture indices", masterTextureIndices.size());
+
+    const std::span<const quartz::rendering::CookedModel::MaterialRecord> materialRecords = cookedModel.getMaterialRecords();
+
+    std::vector<uint32_t> masterMaterialIndices;
+    masterMaterialIndices.reserve(materialRecords.size());
+
+    LOG_TRACE(MODEL, "Processing {} cooked materials", materialRecords.size());
+    for (const quartz::rendering::CookedModel::MaterialRecord& materialRecord : materialRecords) {
+        LOG_SCOPE_CHANGE_TRACE(MODEL);
+
+        const std::string materialName(materialRecord.name, strnlen(materialRecord.name, sizeof(materialRecord.name)));
+        LOG_TRACE(MODEL, "Processing material with name {}", materialName);
+
+        const uint32_t currentMaterialMasterIndex = quartz::rendering::Material::createMaterial(
+            renderingDevice,
+            materialName,
+            quartz::rendering::Model::getMasterTextureIndexFromLocalIndex(masterTextureIndices, materialRecord.baseColorTextureIndex, quartz::rendering::Texture::Type::BaseColor),
+            quartz::rendering::Model::getMasterTextureIndexFromLocalIndex(masterTextureIndices, materialRecord.metallicRoughnessTextureIndex, quartz::rendering::Texture::Type::MetallicRoughness),
+            quartz::rendering::Model::getMasterTextureIndexFromLocalIndex(masterTextureIndices, materialRecord.normalTextureIndex, quartz::rendering::Texture::Type::Normal),
+            quartz::rendering::Model::getMasterTextureIndexFromLocalIndex(masterTextureIndices, materialRecord.emissionTextureIndex, quartz::rendering::Texture::Type::Emission),
+            quartz::rendering::Model::getMasterTextureIndexFromLocalIndex(masterTextureIndices, materialRecord.occlusionTextureIndex, quartz::rendering::Texture::Type::Occlusion),
+            math::Vec4(materialRecord.baseColorFactor[0], materialRecord.baseColorFactor[1], materialRecord.baseColorFactor[2], materialRecord.baseColorFactor[3]),
+            math::Vec3(materialRecord.emissiveFactor[0], materialRecord.emissiveFactor[1], materialRecord.emissiveFactor[2]),
+            materialRecord.metallicFactor,
+            materialRecord.roughnessFactor,
+            static_cast<quartz::rendering::Material::AlphaMode>(materialRecord.alphaMode),
+            materialRecord.alphaCutoff,
+            materialRecord.doubleSided != 0
+        );
+
+        LOG_TRACE(MODEL, "Pushing material with master index {} to back of the list", currentMaterialMasterIndex);
+        masterMaterialIndices.push_back(currentMaterialMasterIndex);
+    }
+
+    return masterMaterialIndices;
+}
+
 std::vector<quartz::rendering::Scene>
 quartz::rendering::Model::loadScenes(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
 
@@ -337,48 +520,196 @@ quartz::rendering::Model::loadScenes(
         scenes.emplace_back(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfScene,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
+        );
+    }
+
+    return scenes;
+}
+
+std::vector<quartz::rendering::Scene>
+quartz::rendering::Model::loadScenes(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    const std::span<const quartz::rendering::CookedModel::SceneRecord> sceneRecords = cookedModel.getSceneRecords();
+
+    std::vector<quartz::rendering::Scene> scenes;
+    scenes.reserve(sceneRecords.size());
+
+    for (uint32_t i = 0; i < sceneRecords.size(); ++i) {
+        LOG_TRACE(MODEL, "Loading cooked scene {}", i);
+
+        scenes.emplace_back(
+            renderingDevice,
+            cookedModel,
+            sceneRecords[i],
+            materialMasterIndices,
+            retainGeometry
         );
     }
 
     return scenes;
 }
 
+math::AxisAlignedBoundingBox
+quartz::rendering::Model::calculateBoundingBox(
+    const quartz::rendering::Scene& scene
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    math::AxisAlignedBoundingBox boundingBox;
+
+    for (const std::shared_ptr<quartz::rendering::Node>& p_node : scene.getAllNodePtrs()) {
+        boundingBox.expand(p_node->getBoundingBox());
+    }
+
+    LOG_TRACE(MODEL, "Model has bounding box {}", boundingBox.toString());
+
+    return boundingBox;
+}
+
+std::vector<quartz::rendering::DrawPacket>
+quartz::rendering::Model::bakeDrawPackets(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::Scene& scene
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL, "");
+
+    const uint32_t minUniformBufferOffsetAlignment = renderingDevice.getVulkanPhysicalDevice().getProperties().limits.minUniformBufferOffsetAlignment;
+    const uint32_t materialByteStride = minUniformBufferOffsetAlignment > 0 ?
+        (sizeof(quartz::rendering::Material::UniformBufferObject) + minUniformBufferOffsetAlignment - 1) & ~(minUniformBufferOffsetAlignment - 1) :
+        sizeof(quartz::rendering::Material::UniformBufferObject);
+    LOG_TRACE(MODEL, "Using material byte stride of {}", materialByteStride);
+
+    std::vector<quartz::rendering::DrawPacket> drawPackets;
+
+    for (const std::shared_ptr<quartz::rendering::Node>& p_node : scene.getAllNodePtrs()) {
+        if (!p_node->getMeshPtr()) {
+            continue;
+        }
+
+        const math::Mat4 nodeTransformationMatrix = p_node->getTransformationMatrix();
+
+        for (const quartz::rendering::Primitive& primitive : p_node->getMeshPtr()->getPrimitives()) {
+            drawPackets.push_back({
+                nodeTransformationMatrix,
+                *(primitive.getStagedPositionBuffer().getVulkanLogicalBufferPtr()),
+                *(primitive.getStagedAttributeBuffer().getVulkanLogicalBufferPtr()),
+                *(primitive.getStagedIndexBuffer().getVulkanLogicalBufferPtr()),
+                primitive.getIndexCount(),
+                primitive.getIndexType(),
+                primitive.getMaterialMasterIndex(),
+                materialByteStride * primitive.getMaterialMasterIndex()
+            });
+        }
+    }
+
+    LOG_TRACE(MODEL, "Baked {} draw packets", drawPackets.size());
+
+    return drawPackets;
+}
+
 quartz::rendering::Model::Model(
     const quartz::rendering::Device& renderingDevice,
-    const std::string& objectFilepath
+    const std::string& objectFilepath,
+    const bool retainGeometry
 ) :
-    m_gltfModel(
-        quartz::rendering::Model::loadGLTFModel(objectFilepath)
+    mo_cookedModel(
+        quartz::rendering::Model::loadCookedModel(objectFilepath)
+    ),
+    mo_glbFile(
+        mo_cookedModel ?
+            std::nullopt :
+            quartz::rendering::Model::loadGLBFile(objectFilepath)
+    ),
+    mo_gltfModel(
+        mo_cookedModel ?
+            std::nullopt :
+            std::optional<tinygltf::Model>(quartz::rendering::Model::loadGLTFModel(objectFilepath, mo_glbFile))
     ),
+    m_retainsGeometry(retainGeometry),
     m_materialMasterIndices(
-        quartz::rendering::Model::loadMaterialMasterIndices(
-            renderingDevice,
-            m_gltfModel
-        )
+        mo_cookedModel ?
+            quartz::rendering::Model::loadMaterialMasterIndices(
+                renderingDevice,
+                *mo_cookedModel
+            ) :
+            quartz::rendering::Model::loadMaterialMasterIndices(
+                renderingDevice,
+                *mo_gltfModel
+            )
     ),
     m_defaultSceneIndex(
-        m_gltfModel.defaultScene <= -1 ?
-            0 :
-            m_gltfModel.defaultScene
+        std::max(
+            mo_cookedModel ?
+                mo_cookedModel->getHeader().defaultSceneIndex :
+                mo_gltfModel->defaultScene,
+            0
+        )
     ),
     m_scenes(
-        quartz::rendering::Model::loadScenes(
-            renderingDevice,
-            m_gltfModel,
-            m_materialMasterIndices
-        )
+        mo_cookedModel ?
+            quartz::rendering::Model::loadScenes(
+                renderingDevice,
+                *mo_cookedModel,
+                m_materialMasterIndices,
+                retainGeometry
+            ) :
+            quartz::rendering::Model::loadScenes(
+                renderingDevice,
+                *mo_gltfModel,
+                quartz::rendering::Model::loadGLTFBuffers(*mo_gltfModel, mo_glbFile),
+                m_materialMasterIndices,
+                retainGeometry
+            )
+    ),
+    m_boundingBox(
+        m_scenes.empty() ?
+            math::AxisAlignedBoundingBox() :
+            quartz::rendering::Model::calculateBoundingBox(m_scenes[m_defaultSceneIndex])
+    ),
+    m_drawPackets(
+        m_scenes.empty() ?
+            std::vector<quartz::rendering::DrawPacket>() :
+            quartz::rendering::Model::bakeDrawPackets(renderingDevice, m_scenes[m_defaultSceneIndex])
     )
 {
     LOG_FUNCTION_CALL_TRACEthis("");
+
+    if (mo_cookedModel) {
+        LOG_TRACE(MODEL, "Unmapping cooked model at {}", mo_cookedModel->getFilepath());
+        mo_cookedModel.reset();
+    }
+
+    if (mo_glbFile) {
+        LOG_TRACE(MODEL, "Unmapping glb file at {}", mo_glbFile->getFilepath());
+        mo_glbFile.reset();
+    }
+
+    if (mo_gltfModel) {
+        LOG_TRACE(MODEL, "Releasing gltf model with {} buffers and {} images", mo_gltfModel->buffers.size(), mo_gltfModel->images.size());
+        mo_gltfModel.reset();
+    }
 }
 
 quartz::rendering::Model::Model(quartz::rendering::Model&& other) :
-    m_gltfModel(std::move(other.m_gltfModel)),
+    mo_cookedModel(std::move(other.mo_cookedModel)),
+    mo_glbFile(std::move(other.mo_glbFile)),
+    mo_gltfModel(std::move(other.mo_gltfModel)),
+    m_retainsGeometry(other.m_retainsGeometry),
     m_materialMasterIndices(std::move(other.m_materialMasterIndices)),
     m_defaultSceneIndex(std::move(other.m_defaultSceneIndex)),
-    m_scenes(std::move(other.m_scenes))
+    m_scenes(std::move(other.m_scenes)),
+    m_boundingBox(other.m_boundingBox),
+    m_drawPackets(std::move(other.m_drawPackets))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
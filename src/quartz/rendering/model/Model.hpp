@@ -1,18 +1,27 @@
 #pragma once
 
+#include <optional>
 #include <queue>
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/DrawPacket.hpp"
+#include "quartz/rendering/model/GLBFile.hpp"
 #include "quartz/rendering/model/Scene.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
 
 namespace quartz {
 namespace rendering {
     class Model;
+    class ModelCooker;
 }
 }
 
@@ -74,31 +83,54 @@ namespace rendering {
  */
 
 /**
- * @todo 2023/12/1 Store buffers in model and pass those to meshes (and primitives) for
- *   them to use with their accessors and buffer views
+ * @brief Files ending in quartz::rendering::CookedModel::fileExtension are loaded as cooked models
+ *   instead of gltf files. Cooking happens ahead of time with quartz_cook, so loading one skips
+ *   parsing, decoding, and optimizing entirely. Both kinds of files end up as the same scenes,
+ *   nodes, meshes, and primitives.
+ *
+ * @brief Glb files are mapped rather than read (see quartz::rendering::GLBFile). Meshes and
+ *   primitives get a span for each of the gltf model's buffers, which for a glb file's binary chunk
+ *   points into the mapping rather than at tinygltf's copy of it.
  */
 
 class quartz::rendering::Model {
 public: // member functions
     Model(
         const quartz::rendering::Device& renderingDevice,
-        const std::string& objectFilepath
+        const std::string& objectFilepath,
+        const bool retainGeometry
     );
     Model(Model&& other);
     ~Model();
 
     USE_LOGGER(MODEL);
 
+    bool getRetainsGeometry() const { return m_retainsGeometry; }
     const std::vector<uint32_t>& getMaterialMasterIndices() const { return m_materialMasterIndices; }
     const std::vector<quartz::rendering::Scene>& getScenes() const { return m_scenes; }
     const quartz::rendering::Scene& getDefaultScene() const { return m_scenes[m_defaultSceneIndex]; }
+    const math::AxisAlignedBoundingBox& getBoundingBox() const { return m_boundingBox; }
+    const std::vector<quartz::rendering::DrawPacket>& getDrawPackets() const { return m_drawPackets; }
 
 private: // static functions
-    static tinygltf::Model loadGLTFModel(const std::string& filepath);
+    static std::optional<quartz::rendering::CookedModel> loadCookedModel(const std::string& filepath);
+    static std::optional<quartz::rendering::GLBFile> loadGLBFile(const std::string& filepath);
+    static tinygltf::Model loadGLTFModel(
+        const std::string& filepath,
+        const std::optional<quartz::rendering::GLBFile>& o_glbFile
+    );
+    static std::vector<std::span<const uint8_t>> loadGLTFBuffers(
+        const tinygltf::Model& gltfModel,
+        const std::optional<quartz::rendering::GLBFile>& o_glbFile
+    );
     static std::vector<uint32_t> loadTextures(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel
     );
+    static std::vector<uint32_t> loadTextures(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel
+    );
     static uint32_t getMasterTextureIndexFromLocalIndex(
         const std::vector<uint32_t>& masterIndices,
         const int32_t localIndex,
@@ -113,17 +145,73 @@ private: // static functions
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel
     );
+    static std::vector<uint32_t> loadMaterialMasterIndices(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel
+    );
     static std::vector<quartz::rendering::Scene> loadScenes(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static std::vector<quartz::rendering::Scene> loadScenes(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static math::AxisAlignedBoundingBox calculateBoundingBox(
+        const quartz::rendering::Scene& scene
+    );
+    static std::vector<quartz::rendering::DrawPacket> bakeDrawPackets(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::Scene& scene
     );
 
 private: // member variables
-    const tinygltf::Model m_gltfModel;
+    /**
+     * @brief Only mapped while we are constructing. Everything in it has been copied into staging
+     *   memory by the time the constructor returns, so we unmap it then
+     */
+    std::optional<quartz::rendering::CookedModel> mo_cookedModel;
+
+    /**
+     * @brief Only mapped while we are constructing, for the same reason. Accessors into the binary
+     *   chunk read straight out of the mapping
+     */
+    std::optional<quartz::rendering::GLBFile> mo_glbFile;
+
+    /**
+     * @brief Also only kept while we are constructing. Nothing we draw with needs the gltf document,
+     *   its buffers, or its decoded images once everything has been staged. Empty if we were loaded
+     *   from a cooked model
+     */
+    std::optional<tinygltf::Model> mo_gltfModel;
+
+    /**
+     * @brief Whether each primitive kept its positions and indices on the cpu after uploading them
+     */
+    bool m_retainsGeometry;
 
     std::vector<uint32_t> m_materialMasterIndices;
 
     uint32_t m_defaultSceneIndex;
     std::vector<quartz::rendering::Scene> m_scenes;
+
+    /**
+     * @brief The bounds of every mesh in the default scene, in the model's space. Used to cull
+     *   doodads using this model
+     */
+    math::AxisAlignedBoundingBox m_boundingBox;
+
+    /**
+     * @brief One packet for each primitive in the default scene, so recording this model is a
+     *   linear walk over this array
+     */
+    std::vector<quartz::rendering::DrawPacket> m_drawPackets;
+
+private: // friends
+    friend class quartz::rendering::ModelCooker;
 };
@@ -0,0 +1,170 @@
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "util/file_system/FileSystem.hpp"
+#include "util/hash/Hash.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/model/Model.hpp"
+#include "quartz/rendering/model/ModelCache.hpp"
+
+std::string
+quartz::rendering::ModelCache::getCanonicalFilepath(
+    const std::string& filepath
+) {
+    std::error_code errorCode;
+    const std::filesystem::path canonicalPath = std::filesystem::weakly_canonical(filepath, errorCode);
+
+    if (errorCode) {
+        LOG_WARNING(MODEL_CACHE, "Failed to get canonical filepath for {} ({}). Using it as is", filepath, errorCode.message());
+        return filepath;
+    }
+
+    return canonicalPath.string();
+}
+
+uint64_t
+quartz::rendering::ModelCache::calculateContentHash(
+    const std::vector<char>& bytes
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_CACHE, "{} bytes", bytes.size());
+
+    // Seeded with the size so files which are prefixes of each other differ
+    const uint64_t hash = util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis ^ static_cast<uint64_t>(bytes.size()), bytes.data(), bytes.size());
+
+    LOG_TRACE(MODEL_CACHE, "Content hash of {} bytes is {:#018x}", bytes.size(), hash);
+
+    return hash;
+}
+
+bool
+quartz::rendering::ModelCache::hasSameContent(
+    const std::string& filepath,
+    const std::vector<char>& bytes
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_CACHE, "{}", filepath);
+
+    std::error_code errorCode;
+    const uintmax_t fileSizeBytes = std::filesystem::file_size(filepath, errorCode);
+    if (errorCode || fileSizeBytes != bytes.size()) {
+        return false;
+    }
+
+    return util::FileSystem::readBytesFromFile(filepath) == bytes;
+}
+
+quartz::rendering::ModelCache::ModelCache() :
+    m_filepathModelPtrs(),
+    m_contentHashEntries(),
+    m_cacheHitCount(0),
+    m_cacheMissCount(0)
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::ModelCache::ModelCache(
+    quartz::rendering::ModelCache&& other
+) :
+    m_filepathModelPtrs(std::move(other.m_filepathModelPtrs)),
+    m_contentHashEntries(std::move(other.m_contentHashEntries)),
+    m_cacheHitCount(other.m_cacheHitCount),
+    m_cacheMissCount(other.m_cacheMissCount)
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::ModelCache::~ModelCache() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+uint32_t
+quartz::rendering::ModelCache::getLiveModelCount() const {
+    std::set<const quartz::rendering::Model*> liveModelPtrs;
+
+    for (const auto& [filepath, wp_model] : m_filepathModelPtrs) {
+        const std::shared_ptr<const quartz::rendering::Model> p_model = wp_model.lock();
+        if (p_model) {
+            liveModelPtrs.insert(p_model.get());
+        }
+    }
+
+    return liveModelPtrs.size();
+}
+
+std::shared_ptr<const quartz::rendering::Model>
+quartz::rendering::ModelCache::getModelPtr(
+    const quartz::rendering::Device& renderingDevice,
+    const std::string& objectFilepath,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} (retain geometry = {})", objectFilepath, retainGeometry);
+
+    const std::string canonicalFilepath = quartz::rendering::ModelCache::getCanonicalFilepath(objectFilepath);
+    LOG_TRACEthis("Using canonical filepath {}", canonicalFilepath);
+
+    std::shared_ptr<const quartz::rendering::Model> p_model = m_filepathModelPtrs[canonicalFilepath].lock();
+    if (p_model && (!retainGeometry || p_model->getRetainsGeometry())) {
+        LOG_TRACEthis("Found live model {} for filepath", reinterpret_cast<const void*>(p_model.get()));
+        m_cacheHitCount++;
+        return p_model;
+    }
+
+    const bool isBinaryFile = util::FileSystem::getFileExtension(canonicalFilepath) == "glb";
+    const std::vector<char> bytes = isBinaryFile ? util::FileSystem::readBytesFromFile(canonicalFilepath) : std::vector<char>();
+    const uint64_t contentHash = isBinaryFile ? quartz::rendering::ModelCache::calculateContentHash(bytes) : 0;
+
+    if (isBinaryFile) {
+        auto [contentEntryIterator, contentEntryEndIterator] = m_contentHashEntries.equal_range(contentHash);
+        while (contentEntryIterator != contentEntryEndIterator) {
+            p_model = contentEntryIterator->second.wp_model.lock();
+            if (!p_model) {
+                contentEntryIterator = m_contentHashEntries.erase(contentEntryIterator);
+                continue;
+            }
+
+            if (
+                (!retainGeometry || p_model->getRetainsGeometry()) &&
+                quartz::rendering::ModelCache::hasSameContent(contentEntryIterator->second.canonicalFilepath, bytes)
+            ) {
+                LOG_TRACEthis("Found live model {} with identical contents at {}", reinterpret_cast<const void*>(p_model.get()), contentEntryIterator->second.canonicalFilepath);
+                m_filepathModelPtrs[canonicalFilepath] = p_model;
+                m_cacheHitCount++;
+                return p_model;
+            }
+
+            ++contentEntryIterator;
+        }
+    }
+
+    LOG_TRACEthis("No live model{} found. Loading model from {}", retainGeometry ? " retaining its geometry" : "", canonicalFilepath);
+    quartz::rendering::UploadBatch uploadBatch(renderingDevice);
+    p_model = std::make_shared<const quartz::rendering::Model>(renderingDevice, canonicalFilepath, retainGeometry);
+    uploadBatch.submit();
+    m_cacheMissCount++;
+
+    m_filepathModelPtrs[canonicalFilepath] = p_model;
+    if (isBinaryFile) {
+        m_contentHashEntries.emplace(contentHash, quartz::rendering::ModelCache::ContentEntry{canonicalFilepath, p_model});
+    }
+
+    return p_model;
+}
+
+void
+quartz::rendering::ModelCache::clear() {
+    LOG_FUNCTION_SCOPE_TRACEthis("");
+
+    LOG_TRACEthis("Forgetting {} filepaths and {} content hashes", m_filepathModelPtrs.size(), m_contentHashEntries.size());
+    m_filepathModelPtrs.clear();
+    m_contentHashEntries.clear();
+
+    m_cacheHitCount = 0;
+    m_cacheMissCount = 0;
+}
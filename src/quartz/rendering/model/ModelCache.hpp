@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/model/Model.hpp"
+
+namespace quartz {
+namespace rendering {
+    class ModelCache;
+}
+}
+
+/**
+ * @brief Hands out shared, immutable models so every doodad referencing the same gltf file
+ *   uses a single set of gpu buffers, textures and materials instead of loading its own.
+ *
+ * @brief Models are keyed by their canonical filepath. Binary (glb) files are self contained,
+ *   so they are additionally keyed by a hash of their contents, allowing identical files living
+ *   at different paths to share a model as well. A matching hash alone isn't trusted, the files
+ *   are compared byte for byte before sharing. Ascii gltf files reference external buffers and
+ *   images relative to their own location, so their contents alone do not identify them.
+ *
+ * @brief The cache only holds weak references. A model is destroyed once the last doodad
+ *   referencing it is destroyed, and is reloaded the next time it is requested.
+ *
+ * @brief Asking for a model that retains its geometry when the live model doesn't loads a new one
+ *   that does. It replaces the old one in the cache, since it can serve both kinds of requests.
+ */
+class quartz::rendering::ModelCache {
+public: // classes
+    struct ContentEntry {
+    public: // member variables
+        std::string canonicalFilepath; // so we can compare the contents when another file hashes the same
+        std::weak_ptr<const quartz::rendering::Model> wp_model;
+    };
+
+public: // member functions
+    ModelCache();
+    ModelCache(const ModelCache& other) = delete;
+    ModelCache(ModelCache&& other);
+    ~ModelCache();
+
+    USE_LOGGER(MODEL_CACHE);
+
+    uint32_t getCacheHitCount() const { return m_cacheHitCount; }
+    uint32_t getCacheMissCount() const { return m_cacheMissCount; }
+    uint32_t getLiveModelCount() const;
+
+    std::shared_ptr<const quartz::rendering::Model> getModelPtr(
+        const quartz::rendering::Device& renderingDevice,
+        const std::string& objectFilepath,
+        const bool retainGeometry
+    );
+
+    void clear();
+
+public: // static functions
+    static uint64_t calculateContentHash(const std::vector<char>& bytes);
+    static bool hasSameContent(const std::string& filepath, const std::vector<char>& bytes);
+
+private: // static functions
+    static std::string getCanonicalFilepath(const std::string& filepath);
+
+private: // member variables
+    std::map<std::string, std::weak_ptr<const quartz::rendering::Model>> m_filepathModelPtrs;
+    std::multimap<uint64_t, quartz::rendering::ModelCache::ContentEntry> m_contentHashEntries;
+
+    uint32_t m_cacheHitCount;
+    uint32_t m_cacheMissCount;
+};
@@ -0,0 +1,357 @@
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <tiny_gltf.h>
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/transform/Mat4.hpp"
+
+#include "util/errors/RichException.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/GLBFile.hpp"
+#include "quartz/rendering/model/MeshOptimizer.hpp"
+#include "quartz/rendering/model/Model.hpp"
+#include "quartz/rendering/model/ModelCooker.hpp"
+#include "quartz/rendering/model/Node.hpp"
+#include "quartz/rendering/model/Primitive.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureCooker.hpp"
+
+quartz::rendering::CookedModel::DataLocation
+quartz::rendering::ModelCooker::appendData(
+    std::vector<uint8_t>& data,
+    const void* p_bytes,
+    const uint64_t sizeBytes
+) {
+    const uint64_t offset = quartz::rendering::CookedModel::alignOffset(data.size());
+
+    data.resize(offset + sizeBytes, 0);
+    if (sizeBytes > 0) {
+        std::memcpy(data.data() + offset, p_bytes, sizeBytes);
+    }
+
+    return {offset, sizeBytes};
+}
+
+void
+quartz::rendering::ModelCooker::cookTextures(
+    const tinygltf::Model& gltfModel,
+    quartz::rendering::ModelCooker::Tables& tables
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    LOG_TRACE(MODEL_COOKED, "Cooking {} textures", gltfModel.textures.size());
+    tables.textureRecords.reserve(gltfModel.textures.size());
+
+    const std::vector<quartz::rendering::Texture::Type> textureTypes = quartz::rendering::Texture::getGLTFTextureTypes(gltfModel);
+
+    for (uint32_t i = 0; i < gltfModel.textures.size(); ++i) {
+        const tinygltf::Texture& gltfTexture = gltfModel.textures[i];
+
+        quartz::rendering::CookedModel::TextureRecord textureRecord = {};
+        textureRecord.minFilter = -1;
+        textureRecord.magFilter = -1;
+        textureRecord.wrapS = -1;
+        textureRecord.wrapT = -1;
+
+        if (gltfTexture.sampler > -1) {
+            const tinygltf::Sampler& gltfSampler = gltfModel.samplers[gltfTexture.sampler];
+            textureRecord.minFilter = gltfSampler.minFilter;
+            textureRecord.magFilter = gltfSampler.magFilter;
+            textureRecord.wrapS = gltfSampler.wrapS;
+            textureRecord.wrapT = gltfSampler.wrapT;
+        }
+
+        const tinygltf::Image& gltfImage = gltfModel.images[quartz::rendering::Texture::getGLTFImageIndex(gltfModel, gltfTexture)];
+
+        std::vector<uint8_t> containerBytes;
+        if (gltfImage.mimeType == quartz::rendering::KTX2Container::mimeType) {
+            LOG_TRACE(MODEL_COOKED, "Texture {} is already a ktx2 container, embedding it as it is", i);
+            containerBytes = gltfImage.image;
+        } else {
+            if (gltfImage.image.empty() || gltfImage.bits != 8) {
+                LOG_THROW(MODEL_COOKED, util::RichException<tinygltf::Image>, gltfImage, "Texture {} uses image \"{}\", which is not a decoded 8 bit image", i, gltfImage.name);
+            }
+
+            containerBytes = quartz::rendering::TextureCooker::cook(
+                gltfImage.image.data(),
+                static_cast<uint32_t>(gltfImage.width),
+                static_cast<uint32_t>(gltfImage.height),
+                static_cast<uint32_t>(gltfImage.component),
+                textureTypes[i]
+            );
+        }
+
+        // Parsing it makes sure whatever we embed is something the runtime can load
+        const quartz::rendering::KTX2Container container(containerBytes);
+
+        textureRecord.width = container.getWidth();
+        textureRecord.height = container.getHeight();
+        textureRecord.type = static_cast<uint32_t>(textureTypes[i]);
+        textureRecord.container = quartz::rendering::ModelCooker::appendData(tables.data, containerBytes.data(), containerBytes.size());
+
+        LOG_TRACE(MODEL_COOKED, "Cooked {}x{} {} texture {} ({} bytes)", textureRecord.width, textureRecord.height, vk::to_string(container.getVulkanFormat()), i, textureRecord.container.sizeBytes);
+        tables.textureRecords.push_back(textureRecord);
+    }
+}
+
+void
+quartz::rendering::ModelCooker::cookMaterials(
+    const tinygltf::Model& gltfModel,
+    quartz::rendering::ModelCooker::Tables& tables
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    LOG_TRACE(MODEL_COOKED, "Cooking {} materials", gltfModel.materials.size());
+    tables.materialRecords.reserve(gltfModel.materials.size());
+
+    for (const tinygltf::Material& gltfMaterial : gltfModel.materials) {
+        quartz::rendering::CookedModel::MaterialRecord materialRecord = {};
+
+        std::strncpy(materialRecord.name, gltfMaterial.name.c_str(), sizeof(materialRecord.name) - 1);
+
+        materialRecord.baseColorTextureIndex = gltfMaterial.pbrMetallicRoughness.baseColorTexture.index;
+        materialRecord.metallicRoughnessTextureIndex = gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index;
+        materialRecord.normalTextureIndex = gltfMaterial.normalTexture.index;
+        materialRecord.emissionTextureIndex = gltfMaterial.emissiveTexture.index;
+        materialRecord.occlusionTextureIndex = gltfMaterial.occlusionTexture.index;
+
+        const std::vector<double>& baseColorFactorVector = gltfMaterial.pbrMetallicRoughness.baseColorFactor; // assuming length == 4
+        for (uint32_t i = 0; i < 4; ++i) {
+            materialRecord.baseColorFactor[i] = baseColorFactorVector[i];
+        }
+
+        const std::vector<double>& emissiveFactorVector = gltfMaterial.emissiveFactor; // assuming length == 3
+        for (uint32_t i = 0; i < 3; ++i) {
+            materialRecord.emissiveFactor[i] = emissiveFactorVector[i];
+        }
+
+        materialRecord.metallicFactor = gltfMaterial.pbrMetallicRoughness.metallicFactor;
+        materialRecord.roughnessFactor = gltfMaterial.pbrMetallicRoughness.roughnessFactor;
+        materialRecord.alphaCutoff = gltfMaterial.alphaCutoff;
+        materialRecord.alphaMode = static_cast<uint32_t>(quartz::rendering::Material::getAlphaModeFromGLTFString(gltfMaterial.alphaMode));
+        materialRecord.doubleSided = gltfMaterial.doubleSided;
+
+        LOG_TRACE(MODEL_COOKED, "Cooked material \"{}\"", materialRecord.name);
+        tables.materialRecords.push_back(materialRecord);
+    }
+}
+
+void
+quartz::rendering::ModelCooker::cookScenesAndNodes(
+    const tinygltf::Model& gltfModel,
+    quartz::rendering::ModelCooker::Tables& tables
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    LOG_TRACE(MODEL_COOKED, "Cooking {} nodes", gltfModel.nodes.size());
+    tables.nodeRecords.reserve(gltfModel.nodes.size());
+
+    for (const tinygltf::Node& gltfNode : gltfModel.nodes) {
+        quartz::rendering::CookedModel::NodeRecord nodeRecord = {};
+
+        const math::Mat4 localTransformationMatrix = quartz::rendering::Node::loadLocalTransformationMatrix(gltfNode);
+        std::memcpy(
+            nodeRecord.localTransformationMatrix,
+            glm::value_ptr(static_cast<const glm::mat4&>(localTransformationMatrix)),
+            sizeof(nodeRecord.localTransformationMatrix)
+        );
+
+        nodeRecord.meshIndex = gltfNode.mesh;
+        nodeRecord.firstChildIndex = tables.nodeIndices.size();
+        nodeRecord.childCount = gltfNode.children.size();
+        tables.nodeIndices.insert(tables.nodeIndices.end(), gltfNode.children.begin(), gltfNode.children.end());
+
+        tables.nodeRecords.push_back(nodeRecord);
+    }
+
+    LOG_TRACE(MODEL_COOKED, "Cooking {} scenes", gltfModel.scenes.size());
+    tables.sceneRecords.reserve(gltfModel.scenes.size());
+
+    for (const tinygltf::Scene& gltfScene : gltfModel.scenes) {
+        quartz::rendering::CookedModel::SceneRecord sceneRecord = {};
+
+        sceneRecord.firstRootNodeIndex = tables.nodeIndices.size();
+        sceneRecord.rootNodeCount = gltfScene.nodes.size();
+        tables.nodeIndices.insert(tables.nodeIndices.end(), gltfScene.nodes.begin(), gltfScene.nodes.end());
+
+        tables.sceneRecords.push_back(sceneRecord);
+    }
+}
+
+void
+quartz::rendering::ModelCooker::cookMeshes(
+    const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
+    quartz::rendering::ModelCooker::Tables& tables
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    LOG_TRACE(MODEL_COOKED, "Cooking {} meshes", gltfModel.meshes.size());
+    tables.meshRecords.reserve(gltfModel.meshes.size());
+
+    for (const tinygltf::Mesh& gltfMesh : gltfModel.meshes) {
+        quartz::rendering::CookedModel::MeshRecord meshRecord = {};
+        meshRecord.firstPrimitiveIndex = tables.primitiveRecords.size();
+
+        for (uint32_t i = 0; i < gltfMesh.primitives.size(); ++i) {
+            const tinygltf::Primitive& gltfPrimitive = gltfMesh.primitives[i];
+
+            if (gltfPrimitive.indices <= -1) {
+                LOG_TRACE(MODEL_COOKED, "Primitive {} does not contain any indices", i);
+                continue;
+            }
+
+            tables.primitiveRecords.push_back(quartz::rendering::ModelCooker::cookPrimitive(
+                gltfModel,
+                gltfBuffers,
+                gltfPrimitive,
+                tables.data
+            ));
+        }
+
+        meshRecord.primitiveCount = tables.primitiveRecords.size() - meshRecord.firstPrimitiveIndex;
+        tables.meshRecords.push_back(meshRecord);
+    }
+}
+
+quartz::rendering::CookedModel::PrimitiveRecord
+quartz::rendering::ModelCooker::cookPrimitive(
+    const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
+    const tinygltf::Primitive& gltfPrimitive,
+    std::vector<uint8_t>& data
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    std::vector<uint32_t> indices = quartz::rendering::Primitive::loadIndicesFromGltfPrimitive(gltfModel, gltfBuffers, gltfPrimitive);
+    std::vector<quartz::rendering::Vertex> vertices = quartz::rendering::Primitive::loadVertices(
+        gltfModel,
+        gltfBuffers,
+        gltfPrimitive,
+        quartz::rendering::ModelCooker::getUsesOnlyDefaultTextures(gltfModel, gltfPrimitive),
+        indices
+    );
+
+    const quartz::rendering::MeshOptimizer::Statistics optimizerStatistics = quartz::rendering::MeshOptimizer::optimize(vertices, indices);
+    LOG_INFO(MODEL_COOKED, "Optimized primitive {}", optimizerStatistics.toString());
+
+    const math::AxisAlignedBoundingBox boundingBox = quartz::rendering::Primitive::loadBoundingBox(gltfModel, gltfBuffers, gltfPrimitive);
+
+    quartz::rendering::CookedModel::PrimitiveRecord primitiveRecord = {};
+    primitiveRecord.materialIndex = gltfPrimitive.material;
+    primitiveRecord.vertexCount = vertices.size();
+    primitiveRecord.indexCount = indices.size();
+    primitiveRecord.indexType = static_cast<uint32_t>(optimizerStatistics.indexType);
+
+    std::memcpy(primitiveRecord.boundingBoxMinimum, glm::value_ptr(static_cast<const glm::vec3&>(boundingBox.getMinimum())), sizeof(primitiveRecord.boundingBoxMinimum));
+    std::memcpy(primitiveRecord.boundingBoxMaximum, glm::value_ptr(static_cast<const glm::vec3&>(boundingBox.getMaximum())), sizeof(primitiveRecord.boundingBoxMaximum));
+
+    const std::vector<math::Vec3> positions = quartz::rendering::Primitive::packPositions(vertices);
+    primitiveRecord.positions = quartz::rendering::ModelCooker::appendData(data, positions.data(), positions.size() * sizeof(math::Vec3));
+
+    const std::vector<quartz::rendering::Vertex::PackedAttributes> packedAttributes = quartz::rendering::Primitive::packAttributes(vertices);
+    primitiveRecord.attributes = quartz::rendering::ModelCooker::appendData(data, packedAttributes.data(), packedAttributes.size() * sizeof(quartz::rendering::Vertex::PackedAttributes));
+
+    if (optimizerStatistics.indexType == vk::IndexType::eUint16) {
+        const std::vector<uint16_t> narrowedIndices = quartz::rendering::Primitive::narrowIndices(indices);
+        primitiveRecord.indices = quartz::rendering::ModelCooker::appendData(data, narrowedIndices.data(), narrowedIndices.size() * sizeof(uint16_t));
+    } else {
+        primitiveRecord.indices = quartz::rendering::ModelCooker::appendData(data, indices.data(), indices.size() * sizeof(uint32_t));
+    }
+
+    return primitiveRecord;
+}
+
+bool
+quartz::rendering::ModelCooker::getUsesOnlyDefaultTextures(
+    const tinygltf::Model& gltfModel,
+    const tinygltf::Primitive& gltfPrimitive
+) {
+    if (gltfPrimitive.material < 0) {
+        return true;
+    }
+
+    // A texture index below 0 is what gives a material the default texture of that type
+    const tinygltf::Material& gltfMaterial = gltfModel.materials[gltfPrimitive.material];
+    return
+        gltfMaterial.pbrMetallicRoughness.baseColorTexture.index < 0 &&
+        gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index < 0 &&
+        gltfMaterial.normalTexture.index < 0 &&
+        gltfMaterial.emissiveTexture.index < 0 &&
+        gltfMaterial.occlusionTexture.index < 0;
+}
+
+std::vector<uint8_t>
+quartz::rendering::ModelCooker::cook(
+    const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "");
+
+    quartz::rendering::ModelCooker::Tables tables;
+    quartz::rendering::ModelCooker::cookTextures(gltfModel, tables);
+    quartz::rendering::ModelCooker::cookMaterials(gltfModel, tables);
+    quartz::rendering::ModelCooker::cookScenesAndNodes(gltfModel, tables);
+    quartz::rendering::ModelCooker::cookMeshes(gltfModel, gltfBuffers, tables);
+
+    // Reserve room for the header, we write it last once we know where everything went
+    std::vector<uint8_t> bytes(sizeof(quartz::rendering::CookedModel::Header), 0);
+
+    quartz::rendering::CookedModel::Header header = {};
+    header.magic = quartz::rendering::CookedModel::magic;
+    header.version = quartz::rendering::CookedModel::version;
+    header.defaultSceneIndex = gltfModel.defaultScene;
+    header.textureTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.textureRecords);
+    header.materialTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.materialRecords);
+    header.sceneTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.sceneRecords);
+    header.nodeTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.nodeRecords);
+    header.meshTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.meshRecords);
+    header.primitiveTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.primitiveRecords);
+    header.nodeIndexTable = quartz::rendering::ModelCooker::writeTable(bytes, tables.nodeIndices);
+    header.data = quartz::rendering::ModelCooker::appendData(bytes, tables.data.data(), tables.data.size());
+
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    LOG_TRACE(MODEL_COOKED, "Cooked {} bytes, {} of which are data", bytes.size(), header.data.sizeBytes);
+
+    return bytes;
+}
+
+void
+quartz::rendering::ModelCooker::cookFile(
+    const std::string& gltfFilepath,
+    const std::string& cookedFilepath
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_COOKED, "{} -> {}", gltfFilepath, cookedFilepath);
+
+    const std::optional<quartz::rendering::GLBFile> o_glbFile = quartz::rendering::Model::loadGLBFile(gltfFilepath);
+    const tinygltf::Model gltfModel = quartz::rendering::Model::loadGLTFModel(gltfFilepath, o_glbFile);
+    const std::vector<uint8_t> bytes = quartz::rendering::ModelCooker::cook(
+        gltfModel,
+        quartz::rendering::Model::loadGLTFBuffers(gltfModel, o_glbFile)
+    );
+
+    std::ofstream outfile(cookedFilepath, std::ios::binary | std::ios::trunc);
+    if (!outfile.is_open()) {
+        LOG_THROW(MODEL_COOKED, util::StringException, cookedFilepath, "Failed to open {} for binary writing", cookedFilepath);
+    }
+
+    outfile.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!outfile) {
+        LOG_THROW(MODEL_COOKED, util::StringException, cookedFilepath, "Failed to write {} bytes to {}", bytes.size(), cookedFilepath);
+    }
+
+    LOG_INFO(MODEL_COOKED, "Cooked {} into {} ({} bytes)", gltfFilepath, cookedFilepath, bytes.size());
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include <tiny_gltf.h>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+
+namespace quartz {
+namespace rendering {
+    class ModelCooker;
+}
+}
+
+/**
+ * @brief Turns a gltf file into a quartz::rendering::CookedModel. This does everything a
+ *   quartz::rendering::Model would do while loading the gltf file, except for creating anything on
+ *   the gpu, so it doesn't need a device. Used by quartz_cook.
+ *
+ * @brief Geometry goes through the exact same code quartz::rendering::Primitive uses, so cooked
+ *   and uncooked versions of a model are drawn identically.
+ *
+ * @brief Textures are block compressed by quartz::rendering::TextureCooker, in a format picked by
+ *   how the materials use them (see quartz::rendering::Texture::getGLTFTextureTypes). Textures which
+ *   are already ktx2 are embedded as they are.
+ */
+class quartz::rendering::ModelCooker {
+public: // member functions
+    ModelCooker() = delete;
+
+public: // static functions
+    static std::vector<uint8_t> cook(
+        const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers
+    );
+    static void cookFile(
+        const std::string& gltfFilepath,
+        const std::string& cookedFilepath
+    );
+
+private: // classes
+    /**
+     * @brief Everything we are going to write, before it is laid out in the file
+     */
+    struct Tables {
+    public: // member variables
+        std::vector<quartz::rendering::CookedModel::TextureRecord> textureRecords;
+        std::vector<quartz::rendering::CookedModel::MaterialRecord> materialRecords;
+        std::vector<quartz::rendering::CookedModel::SceneRecord> sceneRecords;
+        std::vector<quartz::rendering::CookedModel::NodeRecord> nodeRecords;
+        std::vector<quartz::rendering::CookedModel::MeshRecord> meshRecords;
+        std::vector<quartz::rendering::CookedModel::PrimitiveRecord> primitiveRecords;
+        std::vector<uint32_t> nodeIndices;
+        std::vector<uint8_t> data;
+    };
+
+private: // static functions
+    static quartz::rendering::CookedModel::DataLocation appendData(
+        std::vector<uint8_t>& data,
+        const void* p_bytes,
+        const uint64_t sizeBytes
+    );
+    template <typename Record_t>
+    static quartz::rendering::CookedModel::TableLocation writeTable(
+        std::vector<uint8_t>& bytes,
+        const std::vector<Record_t>& records
+    ) {
+        const quartz::rendering::CookedModel::DataLocation location = quartz::rendering::ModelCooker::appendData(bytes, records.data(), records.size() * sizeof(Record_t));
+        return {location.offset, static_cast<uint32_t>(records.size()), 0};
+    }
+
+    static void cookTextures(
+        const tinygltf::Model& gltfModel,
+        quartz::rendering::ModelCooker::Tables& tables
+    );
+    static void cookMaterials(
+        const tinygltf::Model& gltfModel,
+        quartz::rendering::ModelCooker::Tables& tables
+    );
+    static void cookScenesAndNodes(
+        const tinygltf::Model& gltfModel,
+        quartz::rendering::ModelCooker::Tables& tables
+    );
+    static void cookMeshes(
+        const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
+        quartz::rendering::ModelCooker::Tables& tables
+    );
+    static quartz::rendering::CookedModel::PrimitiveRecord cookPrimitive(
+        const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
+        const tinygltf::Primitive& gltfPrimitive,
+        std::vector<uint8_t>& data
+    );
+    static bool getUsesOnlyDefaultTextures(
+        const tinygltf::Model& gltfModel,
+        const tinygltf::Primitive& gltfPrimitive
+    );
+};
@@ -1,10 +1,14 @@
 #include <memory>
+#include <span>
 #include <vector>
 
 #include <glm/gtc/type_ptr.hpp>
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Mesh.hpp"
 #include "quartz/rendering/model/Node.hpp"
 
@@ -12,8 +16,10 @@ std::vector<std::shared_ptr<quartz::rendering::Node>>
 quartz::rendering::Node::loadChildrenNodePtrs(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Node& gltfNode,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_NODE, "");
 
@@ -30,9 +36,42 @@ quartz::rendering::Node::loadChildrenNodePtrs(
         childrenNodePtrs.emplace_back(std::make_shared<quartz::rendering::Node>(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             currentGltfNode,
             nullptr,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
+        ));
+    }
+
+    return childrenNodePtrs;
+}
+
+std::vector<std::shared_ptr<quartz::rendering::Node>>
+quartz::rendering::Node::loadChildrenNodePtrs(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::NodeRecord& nodeRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_NODE, "");
+
+    const std::span<const uint32_t> childNodeIndices = cookedModel.getChildNodeIndices(nodeRecord);
+
+    std::vector<std::shared_ptr<quartz::rendering::Node>> childrenNodePtrs;
+    childrenNodePtrs.reserve(childNodeIndices.size());
+
+    LOG_TRACE(MODEL_NODE, "Loading {} cooked child nodes", childNodeIndices.size());
+
+    for (const uint32_t childNodeIndex : childNodeIndices) {
+        childrenNodePtrs.emplace_back(std::make_shared<quartz::rendering::Node>(
+            renderingDevice,
+            cookedModel,
+            childNodeIndex,
+            nullptr,
+            materialMasterIndices,
+            retainGeometry
         ));
     }
 
@@ -90,8 +129,10 @@ std::shared_ptr<quartz::rendering::Mesh>
 quartz::rendering::Node::loadMeshPtr(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Node& gltfNode,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_NODE, "");
 
@@ -108,25 +149,58 @@ quartz::rendering::Node::loadMeshPtr(
     return std::make_shared<quartz::rendering::Mesh>(
         renderingDevice,
         gltfModel,
+        gltfBuffers,
         gltfMesh,
-        materialMasterIndices
+        materialMasterIndices,
+        retainGeometry
+    );
+}
+
+std::shared_ptr<quartz::rendering::Mesh>
+quartz::rendering::Node::loadMeshPtr(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::NodeRecord& nodeRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_NODE, "");
+
+    if (nodeRecord.meshIndex <= -1) {
+        LOG_TRACE(MODEL_NODE, "Node does not contain a mesh ({})", nodeRecord.meshIndex);
+        return nullptr;
+    }
+
+    LOG_TRACE(MODEL_NODE, "Using cooked mesh at index {}", nodeRecord.meshIndex);
+    const quartz::rendering::CookedModel::MeshRecord& meshRecord = cookedModel.getMeshRecords()[nodeRecord.meshIndex];
+
+    return std::make_shared<quartz::rendering::Mesh>(
+        renderingDevice,
+        cookedModel,
+        meshRecord,
+        materialMasterIndices,
+        retainGeometry
     );
 }
 
 quartz::rendering::Node::Node(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Node& gltfNode,
     const quartz::rendering::Node* p_parent,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) :
     mp_parent(p_parent),
     m_childrenPtrs(
         quartz::rendering::Node::loadChildrenNodePtrs(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfNode,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
         )
     ),
     m_localTransformationMatrix(
@@ -138,8 +212,10 @@ quartz::rendering::Node::Node(
         quartz::rendering::Node::loadMeshPtr(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfNode,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
         )
     )
 {
@@ -150,6 +226,44 @@ quartz::rendering::Node::Node(
     }
 }
 
+quartz::rendering::Node::Node(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const uint32_t nodeIndex,
+    const quartz::rendering::Node* p_parent,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) :
+    mp_parent(p_parent),
+    m_childrenPtrs(
+        quartz::rendering::Node::loadChildrenNodePtrs(
+            renderingDevice,
+            cookedModel,
+            cookedModel.getNodeRecords()[nodeIndex],
+            materialMasterIndices,
+            retainGeometry
+        )
+    ),
+    m_localTransformationMatrix(
+        glm::make_mat4x4(cookedModel.getNodeRecords()[nodeIndex].localTransformationMatrix)
+    ),
+    mp_mesh(
+        quartz::rendering::Node::loadMeshPtr(
+            renderingDevice,
+            cookedModel,
+            cookedModel.getNodeRecords()[nodeIndex],
+            materialMasterIndices,
+            retainGeometry
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("cooked node {}", nodeIndex);
+
+    for (const std::shared_ptr<quartz::rendering::Node>& p_node : m_childrenPtrs) {
+        p_node->setParentPtr(this);
+    }
+}
+
 quartz::rendering::Node::Node(
     Node&& other
 ) :
@@ -199,4 +313,13 @@ quartz::rendering::Node::getTransformationMatrix() const {
     }
 
     return transformationMatrix;
-}
\ No newline at end of file
+}
+
+math::AxisAlignedBoundingBox
+quartz::rendering::Node::getBoundingBox() const {
+    if (!mp_mesh) {
+        return {};
+    }
+
+    return mp_mesh->getBoundingBox().getTransformed(this->getTransformationMatrix());
+}
@@ -1,17 +1,21 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
 #include "math/transform/Mat4.hpp"
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Mesh.hpp"
 
 namespace quartz {
 namespace rendering {
+    class ModelCooker;
     class Node;
 }
 }
@@ -21,9 +25,19 @@ public: // member functions
     Node(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Node& gltfNode,
         const Node* p_parent,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    Node(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const uint32_t nodeIndex,
+        const Node* p_parent,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
     Node(Node&& other);
     ~Node();
@@ -37,23 +51,46 @@ public: // member functions
 
     math::Mat4 getTransformationMatrix() const;
 
+    /**
+     * @brief The bounds of this node's mesh in the model's space. Empty if the node has no mesh
+     */
+    math::AxisAlignedBoundingBox getBoundingBox() const;
+
 private: // static functions
-    std::vector<std::shared_ptr<quartz::rendering::Node>> loadChildrenNodePtrs(
+    static std::vector<std::shared_ptr<quartz::rendering::Node>> loadChildrenNodePtrs(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Node& gltfNode,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static std::vector<std::shared_ptr<quartz::rendering::Node>> loadChildrenNodePtrs(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::NodeRecord& nodeRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
 
-    math::Mat4 loadLocalTransformationMatrix(
+    static math::Mat4 loadLocalTransformationMatrix(
         const tinygltf::Node& gltfNode
     );
 
-    std::shared_ptr<quartz::rendering::Mesh> loadMeshPtr(
+    static std::shared_ptr<quartz::rendering::Mesh> loadMeshPtr(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Node& gltfNode,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static std::shared_ptr<quartz::rendering::Mesh> loadMeshPtr(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::NodeRecord& nodeRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
 
 private: // member functions
@@ -76,4 +113,7 @@ private: // member variables
     math::Mat4 m_localTransformationMatrix;
 
     std::shared_ptr<quartz::rendering::Mesh> mp_mesh;
+
+private: // friends
+    friend class quartz::rendering::ModelCooker;
 };
\ No newline at end of file
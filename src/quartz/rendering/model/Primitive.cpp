@@ -1,3 +1,5 @@
+#include <cstring>
+#include <span>
 #include <vector>
 
 #include <glm/vec3.hpp>
@@ -5,12 +7,17 @@
 
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
+#include "util/errors/RichException.hpp"
 #include "util/logger/Logger.hpp"
 
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/StagedBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/MeshOptimizer.hpp"
 #include "quartz/rendering/model/Primitive.hpp"
 #include "quartz/rendering/model/TangentCalculator.hpp"
 #include "quartz/rendering/model/Vertex.hpp"
@@ -46,73 +53,43 @@ quartz::rendering::Primitive::handleMissingVertexAttribute(
             LOG_TRACE(MODEL_PRIMITIVE, "Using default vertex color of r: {}, g: {}, b: {}", verticesToPopulate[0].color.r, verticesToPopulate[0].color.g, verticesToPopulate[0].color.b);
             return true;
 
-        case quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate:
-            LOG_TRACE(MODEL_PRIMITIVE, "Using default base color texture coordinates of {},{}", verticesToPopulate[0].baseColorTextureCoordinate.x, verticesToPopulate[0].baseColorTextureCoordinate.y);
-            return true;
-        case quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate:
-            LOG_TRACE(MODEL_PRIMITIVE, "Using default metallic roughness texture coordinates of {},{}", verticesToPopulate[0].metallicRoughnessTextureCoordinate.x, verticesToPopulate[0].metallicRoughnessTextureCoordinate.y);
-            return true;
-        case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate:
-            LOG_TRACE(MODEL_PRIMITIVE, "Using default normal texture coordinates of {},{}", verticesToPopulate[0].normalTextureCoordinate.x, verticesToPopulate[0].normalTextureCoordinate.y);
-            return true;
-        case quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate:
-            LOG_TRACE(MODEL_PRIMITIVE, "Using default emission texture coordinates of {},{}", verticesToPopulate[0].emissionTextureCoordinate.x, verticesToPopulate[0].emissionTextureCoordinate.y);
-            return true;
-        case quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate:
-            LOG_TRACE(MODEL_PRIMITIVE, "Using default occlusion texture coordinates of {},{}", verticesToPopulate[0].occlusionTextureCoordinate.x, verticesToPopulate[0].occlusionTextureCoordinate.y);
+        case quartz::rendering::Vertex::AttributeType::TextureCoordinate:
+            LOG_TRACE(MODEL_PRIMITIVE, "Using default texture coordinates of {},{}", verticesToPopulate[0].textureCoordinate.x, verticesToPopulate[0].textureCoordinate.y);
             return true;
     }
 }
 
 bool
 quartz::rendering::Primitive::handleDefaultTextureAttribute(
-    UNUSED std::vector<quartz::rendering::Vertex>& verticesToPopulate,
-    const std::shared_ptr<quartz::rendering::Material>& p_material,
+    const std::vector<quartz::rendering::Vertex>& verticesToPopulate,
+    const bool usesOnlyDefaultTextures,
     const quartz::rendering::Vertex::AttributeType attributeType
 ) {
-    switch (attributeType) {
-        case quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate:
-            if (p_material->getBaseColorTextureMasterIndex() == quartz::rendering::Texture::getBaseColorDefaultMasterIndex()) {
-                LOG_TRACE(MODEL_PRIMITIVE, "Using default base color texture, so leaving coordinates to be {},{}", verticesToPopulate[0].baseColorTextureCoordinate.x, verticesToPopulate[0].baseColorTextureCoordinate.y);
-                return true;
-            }
-            break;
-
-        case quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate:
-            if (p_material->getMetallicRoughnessTextureMasterIndex() == quartz::rendering::Texture::getMetallicRoughnessDefaultMasterIndex()) {
-                LOG_TRACE(MODEL_PRIMITIVE, "Using default metallic roughness texture, so leaving coordinates to be {},{}", verticesToPopulate[0].metallicRoughnessTextureCoordinate.x, verticesToPopulate[0].metallicRoughnessTextureCoordinate.y);
-                return true;
-            }
-            break;
-
-        case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate:
-            if (p_material->getNormalTextureMasterIndex() == quartz::rendering::Texture::getNormalDefaultMasterIndex()) {
-                LOG_TRACE(MODEL_PRIMITIVE, "Using default normal texture, so leaving coordinates to be {},{}", verticesToPopulate[0].normalTextureCoordinate.x, verticesToPopulate[0].normalTextureCoordinate.y);
-                return true;
-            }
-            break;
-
-        case quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate:
-            if (p_material->getEmissionTextureMasterIndex() == quartz::rendering::Texture::getEmissionDefaultMasterIndex()) {
-                LOG_TRACE(MODEL_PRIMITIVE, "Using default emission texture, so leaving coordinates to be {},{}", verticesToPopulate[0].emissionTextureCoordinate.x, verticesToPopulate[0].emissionTextureCoordinate.y);
-                return true;
-            }
-            break;
-
-        case quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate:
-            if (p_material->getOcclusionTextureMasterIndex() == quartz::rendering::Texture::getOcclusionDefaultMasterIndex()) {
-                LOG_TRACE(MODEL_PRIMITIVE, "Using default occlusion texture, so leaving coordinates to be {},{}", verticesToPopulate[0].occlusionTextureCoordinate.x, verticesToPopulate[0].occlusionTextureCoordinate.y);
-                return true;
-            }
-            break;
+    if (attributeType != quartz::rendering::Vertex::AttributeType::TextureCoordinate) {
+        return false;
+    }
 
-        default:
-            break;
+    // Every texture shares the same coordinates, so we only need them if at least one texture isn't a default
+    if (usesOnlyDefaultTextures) {
+        LOG_TRACE(MODEL_PRIMITIVE, "Using only default textures, so leaving coordinates to be {},{}", verticesToPopulate[0].textureCoordinate.x, verticesToPopulate[0].textureCoordinate.y);
+        return true;
     }
 
     return false;
 }
 
+bool
+quartz::rendering::Primitive::getUsesOnlyDefaultTextures(
+    const std::shared_ptr<quartz::rendering::Material>& p_material
+) {
+    return
+        p_material->getBaseColorTextureMasterIndex() == quartz::rendering::Texture::getBaseColorDefaultMasterIndex() &&
+        p_material->getMetallicRoughnessTextureMasterIndex() == quartz::rendering::Texture::getMetallicRoughnessDefaultMasterIndex() &&
+        p_material->getNormalTextureMasterIndex() == quartz::rendering::Texture::getNormalDefaultMasterIndex() &&
+        p_material->getEmissionTextureMasterIndex() == quartz::rendering::Texture::getEmissionDefaultMasterIndex() &&
+        p_material->getOcclusionTextureMasterIndex() == quartz::rendering::Texture::getOcclusionDefaultMasterIndex();
+}
+
 uint32_t
 quartz::rendering::Primitive::determineGltfAccessorByteStride(
     const quartz::rendering::Vertex::AttributeType attributeType,
@@ -123,13 +100,7 @@ quartz::rendering::Primitive::determineGltfAccessorByteStride(
     const std::string attributeGltfString = quartz::rendering::Vertex::getAttributeGLTFString(attributeType);
 
     uint32_t tinygltfVecType = TINYGLTF_TYPE_VEC3;
-    if (
-        attributeType == quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate ||
-        attributeType == quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate ||
-        attributeType == quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate ||
-        attributeType == quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate ||
-        attributeType == quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate
-    ) {
+    if (attributeType == quartz::rendering::Vertex::AttributeType::TextureCoordinate) {
         LOG_TRACE(MODEL_PRIMITIVE, "{} attribute ({}) attribute uses vector2", attributeNameString, attributeGltfString);
         tinygltfVecType = TINYGLTF_TYPE_VEC2;
     }
@@ -142,14 +113,29 @@ quartz::rendering::Primitive::determineGltfAccessorByteStride(
     return byteStride;
 }
 
+const uint8_t*
+quartz::rendering::Primitive::getGltfAccessorData(
+    const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
+    const tinygltf::Accessor& accessor
+) {
+    const tinygltf::BufferView& bufferView = gltfModel.bufferViews[accessor.bufferView];
+    const uint64_t byteOffset = static_cast<uint64_t>(accessor.byteOffset) + bufferView.byteOffset;
+
+    if (bufferView.buffer < 0 || static_cast<uint64_t>(bufferView.buffer) >= gltfBuffers.size() || byteOffset > gltfBuffers[bufferView.buffer].size()) {
+        LOG_THROW(MODEL_PRIMITIVE, util::StringException, accessor.name, "Accessor data at offset {} of buffer {} is outside of the {} buffers we were given", byteOffset, bufferView.buffer, gltfBuffers.size());
+    }
+
+    return gltfBuffers[bufferView.buffer].data() + byteOffset;
+}
+
 uint32_t
 quartz::rendering::Primitive::loadMaterialMasterIndex(
-    const tinygltf::Primitive& gltfPrimitive,
+    const int32_t materialLocalIndex,
     const std::vector<uint32_t>& materialMasterIndices
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
 
-    int32_t materialLocalIndex = gltfPrimitive.material;
     LOG_TRACE(MODEL_PRIMITIVE, "Primitive uses material at local index {}", materialLocalIndex);
 
     if (materialLocalIndex < 0) {
@@ -164,9 +150,54 @@ quartz::rendering::Primitive::loadMaterialMasterIndex(
     return materialMasterIndex;
 }
 
+math::AxisAlignedBoundingBox
+quartz::rendering::Primitive::loadBoundingBox(
+    const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
+    const tinygltf::Primitive& gltfPrimitive
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
+
+    const uint32_t accessorIndex = gltfPrimitive.attributes.find("POSITION")->second;
+    const tinygltf::Accessor& accessor = gltfModel.accessors[accessorIndex];
+
+    /**
+     * @brief The gltf spec requires position accessors to provide their min and max, so we can
+     *   almost always get the bounds without touching the vertex data at all
+     */
+    if (accessor.minValues.size() == 3 && accessor.maxValues.size() == 3) {
+        const math::AxisAlignedBoundingBox boundingBox(
+            math::Vec3(accessor.minValues[0], accessor.minValues[1], accessor.minValues[2]),
+            math::Vec3(accessor.maxValues[0], accessor.maxValues[1], accessor.maxValues[2])
+        );
+        LOG_TRACE(MODEL_PRIMITIVE, "Using bounding box {} from position accessor", boundingBox.toString());
+        return boundingBox;
+    }
+
+    LOG_WARNING(MODEL_PRIMITIVE, "Position accessor does not provide its min and max. Calculating bounding box from {} positions", accessor.count);
+
+    const tinygltf::BufferView& bufferView = gltfModel.bufferViews[accessor.bufferView];
+    const float* p_data = reinterpret_cast<const float*>(quartz::rendering::Primitive::getGltfAccessorData(gltfModel, gltfBuffers, accessor));
+
+    const uint32_t byteStride = quartz::rendering::Primitive::determineGltfAccessorByteStride(
+        quartz::rendering::Vertex::AttributeType::Position,
+        accessor,
+        bufferView
+    );
+
+    math::AxisAlignedBoundingBox boundingBox;
+    for (uint32_t i = 0; i < accessor.count; ++i) {
+        boundingBox.expand(math::Vec3(glm::make_vec3(&p_data[i * byteStride])));
+    }
+    LOG_TRACE(MODEL_PRIMITIVE, "Calculated bounding box {}", boundingBox.toString());
+
+    return boundingBox;
+}
+
 std::vector<uint32_t>
 quartz::rendering::Primitive::loadIndicesFromGltfPrimitive(
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Primitive& gltfPrimitive
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
@@ -175,16 +206,7 @@ quartz::rendering::Primitive::loadIndicesFromGltfPrimitive(
     const tinygltf::Accessor& indexAccessor = gltfModel.accessors[indexAccessorID];
     const uint32_t indexCount = indexAccessor.count;
 
-    const uint32_t indexBufferViewID = indexAccessor.bufferView;
-    const tinygltf::BufferView& indexBufferView = gltfModel.bufferViews[indexBufferViewID];
-
-    const uint32_t indexBufferID = indexBufferView.buffer;
-    const tinygltf::Buffer& indexBuffer = gltfModel.buffers[indexBufferID];
-    const uint32_t indexAccessorByteOffset = indexAccessor.byteOffset;
-    const uint32_t indexBufferViewByteOffset = indexBufferView.byteOffset;
-    const std::vector<uint8_t>& indexBufferData = indexBuffer.data;
-    const uint8_t* indexBufferDataStartAddress = indexBufferData.data();
-    const uint8_t* desiredIndexDataStartAddress = indexBufferDataStartAddress + indexAccessorByteOffset + indexBufferViewByteOffset;
+    const uint8_t* desiredIndexDataStartAddress = quartz::rendering::Primitive::getGltfAccessorData(gltfModel, gltfBuffers, indexAccessor);
 
     std::vector<uint32_t> indices(indexCount);
 
@@ -231,8 +253,9 @@ void
 quartz::rendering::Primitive::populateVerticesWithAttribute(
     std::vector<quartz::rendering::Vertex>& verticesToPopulate,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Primitive& gltfPrimitive,
-    const std::shared_ptr<quartz::rendering::Material>& p_material,
+    const bool usesOnlyDefaultTextures,
     const std::vector<uint32_t>& indices,
     const quartz::rendering::Vertex::AttributeType attributeType
 ) {
@@ -244,7 +267,7 @@ quartz::rendering::Primitive::populateVerticesWithAttribute(
         return;
     }
 
-    if (quartz::rendering::Primitive::handleDefaultTextureAttribute(verticesToPopulate, p_material, attributeType)) {
+    if (quartz::rendering::Primitive::handleDefaultTextureAttribute(verticesToPopulate, usesOnlyDefaultTextures, attributeType)) {
         return;
     }
 
@@ -256,14 +279,7 @@ quartz::rendering::Primitive::populateVerticesWithAttribute(
     const uint32_t bufferViewIndex = accessor.bufferView;
     const tinygltf::BufferView& bufferView = gltfModel.bufferViews[bufferViewIndex];
 
-    const uint32_t bufferIndex = bufferView.buffer;
-    const tinygltf::Buffer& buffer = gltfModel.buffers[bufferIndex];
-
-    const uint32_t accessorByteOffset = accessor.byteOffset;
-    const uint32_t bufferViewByteOffset = bufferView.byteOffset;
-    const std::vector<uint8_t>& bufferData = buffer.data;
-    const uint8_t* bufferDataStartAddress = bufferData.data();
-    const uint8_t* desiredDataStartAddress = bufferDataStartAddress + accessorByteOffset + bufferViewByteOffset;
+    const uint8_t* desiredDataStartAddress = quartz::rendering::Primitive::getGltfAccessorData(gltfModel, gltfBuffers, accessor);
 
     const float* p_data = reinterpret_cast<const float*>(desiredDataStartAddress);
 
@@ -287,36 +303,20 @@ quartz::rendering::Primitive::populateVerticesWithAttribute(
                 verticesToPopulate[i].color = glm::make_vec3(&p_data[i * byteStride]);
                 break;
             }
-            case quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate: {
-                verticesToPopulate[i].baseColorTextureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
-                break;
-            }
-            case quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate: {
-                verticesToPopulate[i].metallicRoughnessTextureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
-                break;
-            }
-            case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate: {
-                verticesToPopulate[i].normalTextureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
-                break;
-            }
-            case quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate: {
-                verticesToPopulate[i].emissionTextureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
-                break;
-            }
-            case quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate: {
-                verticesToPopulate[i].occlusionTextureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
+            case quartz::rendering::Vertex::AttributeType::TextureCoordinate: {
+                verticesToPopulate[i].textureCoordinate = glm::make_vec2(&p_data[i * byteStride]);
                 break;
             }
         }
     }
 }
 
-quartz::rendering::StagedBuffer
-quartz::rendering::Primitive::createStagedVertexBuffer(
-    const quartz::rendering::Device& renderingDevice,
+std::vector<quartz::rendering::Vertex>
+quartz::rendering::Primitive::loadVertices(
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Primitive& gltfPrimitive,
-    const std::shared_ptr<quartz::rendering::Material>& p_material,
+    const bool usesOnlyDefaultTextures,
     const std::vector<uint32_t>& indices
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
@@ -330,11 +330,7 @@ quartz::rendering::Primitive::createStagedVertexBuffer(
         quartz::rendering::Vertex::AttributeType::Position,
         quartz::rendering::Vertex::AttributeType::Normal,
         quartz::rendering::Vertex::AttributeType::Color,
-        quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate,
-        quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate,
-        quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate,
-        quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate,
-        quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate,
+        quartz::rendering::Vertex::AttributeType::TextureCoordinate,
         quartz::rendering::Vertex::AttributeType::Tangent, // needs to go last. uses other attributes in calculations if not provided by model
     };
 
@@ -342,8 +338,9 @@ quartz::rendering::Primitive::createStagedVertexBuffer(
         quartz::rendering::Primitive::populateVerticesWithAttribute(
             vertices,
             gltfModel,
+            gltfBuffers,
             gltfPrimitive,
-            p_material,
+            usesOnlyDefaultTextures,
             indices,
             attributeType
         );
@@ -351,64 +348,347 @@ quartz::rendering::Primitive::createStagedVertexBuffer(
 
     LOG_TRACE(MODEL_PRIMITIVE, "Successfully populated {} vertices", vertexCount);
 
-    quartz::rendering::StagedBuffer stagedVertexBuffer(
+    return vertices;
+}
+
+std::vector<math::Vec3>
+quartz::rendering::Primitive::packPositions(
+    const std::vector<quartz::rendering::Vertex>& vertices
+) {
+    std::vector<math::Vec3> positions(vertices.size());
+    for (uint32_t i = 0; i < vertices.size(); ++i) {
+        positions[i] = vertices[i].position;
+    }
+
+    return positions;
+}
+
+std::vector<quartz::rendering::Vertex::PackedAttributes>
+quartz::rendering::Primitive::packAttributes(
+    const std::vector<quartz::rendering::Vertex>& vertices
+) {
+    std::vector<quartz::rendering::Vertex::PackedAttributes> packedAttributes(vertices.size());
+    for (uint32_t i = 0; i < vertices.size(); ++i) {
+        packedAttributes[i] = vertices[i].pack();
+    }
+
+    return packedAttributes;
+}
+
+std::vector<uint16_t>
+quartz::rendering::Primitive::narrowIndices(
+    const std::vector<uint32_t>& indices
+) {
+    LOG_TRACE(MODEL_PRIMITIVE, "Narrowing {} indices to uint16_t", indices.size());
+
+    std::vector<uint16_t> narrowedIndices(indices.size());
+    for (uint32_t i = 0; i < indices.size(); ++i) {
+        narrowedIndices[i] = static_cast<uint16_t>(indices[i]);
+    }
+
+    return narrowedIndices;
+}
+
+quartz::rendering::StagedBuffer
+quartz::rendering::Primitive::createStagedPositionBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<quartz::rendering::Vertex>& vertices
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
+
+    const std::vector<math::Vec3> positions = quartz::rendering::Primitive::packPositions(vertices);
+
+    quartz::rendering::StagedBuffer stagedPositionBuffer(
+        renderingDevice,
+        sizeof(math::Vec3) * positions.size(),
+        vk::BufferUsageFlagBits::eVertexBuffer,
+        positions.data()
+    );
+
+    LOG_TRACE(MODEL_PRIMITIVE, "Successfully created staged position buffer for {} vertices", positions.size());
+
+    return stagedPositionBuffer;
+}
+
+quartz::rendering::StagedBuffer
+quartz::rendering::Primitive::createStagedAttributeBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<quartz::rendering::Vertex>& vertices
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
+
+    const std::vector<quartz::rendering::Vertex::PackedAttributes> packedAttributes = quartz::rendering::Primitive::packAttributes(vertices);
+
+    quartz::rendering::StagedBuffer stagedAttributeBuffer(
         renderingDevice,
-        sizeof(quartz::rendering::Vertex) * vertices.size(),
+        sizeof(quartz::rendering::Vertex::PackedAttributes) * packedAttributes.size(),
         vk::BufferUsageFlagBits::eVertexBuffer,
-        vertices.data()
+        packedAttributes.data()
+    );
+
+    LOG_INFO(
+        MODEL_PRIMITIVE,
+        "Successfully created staged vertex buffers for {} vertices ({} bytes, down from {} unpacked)",
+        vertices.size(),
+        (sizeof(math::Vec3) + sizeof(quartz::rendering::Vertex::PackedAttributes)) * vertices.size(),
+        sizeof(quartz::rendering::Vertex) * vertices.size()
+    );
+
+    return stagedAttributeBuffer;
+}
+
+quartz::rendering::StagedBuffer
+quartz::rendering::Primitive::createStagedIndexBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<uint32_t>& indices,
+    const vk::IndexType indexType
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "");
+
+    if (indexType == vk::IndexType::eUint32) {
+        return quartz::rendering::StagedBuffer(
+            renderingDevice,
+            sizeof(uint32_t) * indices.size(),
+            vk::BufferUsageFlagBits::eIndexBuffer,
+            indices.data()
+        );
+    }
+
+    const std::vector<uint16_t> narrowedIndices = quartz::rendering::Primitive::narrowIndices(indices);
+
+    return quartz::rendering::StagedBuffer(
+        renderingDevice,
+        sizeof(uint16_t) * narrowedIndices.size(),
+        vk::BufferUsageFlagBits::eIndexBuffer,
+        narrowedIndices.data()
     );
+}
+
+quartz::rendering::StagedBuffer
+quartz::rendering::Primitive::createStagedBufferFromCookedData(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::DataLocation& dataLocation,
+    const vk::BufferUsageFlags usageFlags
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "{} bytes", dataLocation.sizeBytes);
+
+    // The cooked bytes are exactly what we would have uploaded, so they go straight from the mapped file into staging memory
+    const std::span<const uint8_t> data = cookedModel.getData(dataLocation);
+
+    return quartz::rendering::StagedBuffer(
+        renderingDevice,
+        data.size(),
+        usageFlags,
+        data.data()
+    );
+}
+
+void
+quartz::rendering::Primitive::validateCookedPrimitiveRecord(
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "{} vertices, {} indices", primitiveRecord.vertexCount, primitiveRecord.indexCount);
+
+    const vk::IndexType indexType = static_cast<vk::IndexType>(primitiveRecord.indexType);
+    if (indexType != vk::IndexType::eUint16 && indexType != vk::IndexType::eUint32) {
+        LOG_THROW(MODEL_PRIMITIVE, util::RichException<uint32_t>, primitiveRecord.indexType, "Cooked primitive has index type {}, but only uint16 and uint32 indices are supported", primitiveRecord.indexType);
+    }
+
+    const uint64_t indexSizeBytes = indexType == vk::IndexType::eUint32 ? sizeof(uint32_t) : sizeof(uint16_t);
+    if (primitiveRecord.indices.sizeBytes != static_cast<uint64_t>(primitiveRecord.indexCount) * indexSizeBytes) {
+        LOG_THROW(MODEL_PRIMITIVE, util::RichException<uint32_t>, primitiveRecord.indexCount, "Cooked primitive has {} bytes of indices, but {} indices of {} bytes each need {}", primitiveRecord.indices.sizeBytes, primitiveRecord.indexCount, indexSizeBytes, primitiveRecord.indexCount * indexSizeBytes);
+    }
+
+    if (primitiveRecord.positions.sizeBytes != static_cast<uint64_t>(primitiveRecord.vertexCount) * sizeof(math::Vec3)) {
+        LOG_THROW(MODEL_PRIMITIVE, util::RichException<uint32_t>, primitiveRecord.vertexCount, "Cooked primitive has {} bytes of positions, but {} vertices need {}", primitiveRecord.positions.sizeBytes, primitiveRecord.vertexCount, primitiveRecord.vertexCount * sizeof(math::Vec3));
+    }
+
+    if (primitiveRecord.attributes.sizeBytes != static_cast<uint64_t>(primitiveRecord.vertexCount) * sizeof(quartz::rendering::Vertex::PackedAttributes)) {
+        LOG_THROW(MODEL_PRIMITIVE, util::RichException<uint32_t>, primitiveRecord.vertexCount, "Cooked primitive has {} bytes of attributes, but {} vertices need {}", primitiveRecord.attributes.sizeBytes, primitiveRecord.vertexCount, primitiveRecord.vertexCount * sizeof(quartz::rendering::Vertex::PackedAttributes));
+    }
+}
+
+uint32_t
+quartz::rendering::Primitive::loadCookedIndexCount(
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "{} indices", primitiveRecord.indexCount);
 
-    LOG_INFO(MODEL_PRIMITIVE, "Successfully created staged vertex buffer for {} vertices", vertexCount);
+    // The counts and index type go straight to the gpu, so make sure they agree with the data before we upload any of it
+    quartz::rendering::Primitive::validateCookedPrimitiveRecord(primitiveRecord);
 
-    return stagedVertexBuffer;
+    return primitiveRecord.indexCount;
+}
+
+std::vector<math::Vec3>
+quartz::rendering::Primitive::loadCookedPositions(
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "{} vertices", primitiveRecord.vertexCount);
+
+    const std::span<const uint8_t> data = cookedModel.getData(primitiveRecord.positions);
+
+    std::vector<math::Vec3> positions(primitiveRecord.vertexCount);
+    std::memcpy(positions.data(), data.data(), positions.size() * sizeof(math::Vec3));
+
+    return positions;
+}
+
+std::vector<uint32_t>
+quartz::rendering::Primitive::loadCookedIndices(
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_PRIMITIVE, "{} indices", primitiveRecord.indexCount);
+
+    const std::span<const uint8_t> data = cookedModel.getData(primitiveRecord.indices);
+
+    if (static_cast<vk::IndexType>(primitiveRecord.indexType) == vk::IndexType::eUint32) {
+        std::vector<uint32_t> indices(primitiveRecord.indexCount);
+        std::memcpy(indices.data(), data.data(), indices.size() * sizeof(uint32_t));
+        return indices;
+    }
+
+    std::vector<uint16_t> narrowedIndices(primitiveRecord.indexCount);
+    std::memcpy(narrowedIndices.data(), data.data(), narrowedIndices.size() * sizeof(uint16_t));
+
+    return std::vector<uint32_t>(narrowedIndices.begin(), narrowedIndices.end());
 }
 
 quartz::rendering::Primitive::Primitive(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Primitive& gltfPrimitive,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) :
     m_materialMasterIndex(
         quartz::rendering::Primitive::loadMaterialMasterIndex(
-            gltfPrimitive,
+            gltfPrimitive.material,
             materialMasterIndices
         )
     ),
-    m_indices(
-        quartz::rendering::Primitive::loadIndicesFromGltfPrimitive(
+    m_boundingBox(
+        quartz::rendering::Primitive::loadBoundingBox(
             gltfModel,
+            gltfBuffers,
             gltfPrimitive
         )
     ),
-    m_stagedVertexBuffer(
-        quartz::rendering::Primitive::createStagedVertexBuffer(
+    m_indexCount(0),
+    m_indexType(vk::IndexType::eUint32),
+    m_stagedPositionBuffer(),
+    m_stagedAttributeBuffer(),
+    m_stagedIndexBuffer(),
+    m_positions(),
+    m_indices()
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    // Everything we load here only lives as long as the constructor unless we were asked to retain it
+    std::vector<uint32_t> indices = quartz::rendering::Primitive::loadIndicesFromGltfPrimitive(
+        gltfModel,
+        gltfBuffers,
+        gltfPrimitive
+    );
+
+    // Both vertex streams are built from the same full precision vertices, so we only load them once
+    std::vector<quartz::rendering::Vertex> vertices = quartz::rendering::Primitive::loadVertices(
+        gltfModel,
+        gltfBuffers,
+        gltfPrimitive,
+        quartz::rendering::Primitive::getUsesOnlyDefaultTextures(quartz::rendering::Material::getMaterialPtr(m_materialMasterIndex)),
+        indices
+    );
+
+    const quartz::rendering::MeshOptimizer::Statistics optimizerStatistics = quartz::rendering::MeshOptimizer::optimize(vertices, indices);
+    LOG_INFOthis("Optimized primitive {}", optimizerStatistics.toString());
+    m_indexCount = indices.size();
+    m_indexType = optimizerStatistics.indexType;
+
+    m_stagedPositionBuffer = quartz::rendering::Primitive::createStagedPositionBuffer(renderingDevice, vertices);
+    m_stagedAttributeBuffer = quartz::rendering::Primitive::createStagedAttributeBuffer(renderingDevice, vertices);
+    m_stagedIndexBuffer = quartz::rendering::Primitive::createStagedIndexBuffer(renderingDevice, indices, m_indexType);
+
+    if (retainGeometry) {
+        LOG_TRACEthis("Retaining {} positions and {} indices", vertices.size(), indices.size());
+        m_positions = quartz::rendering::Primitive::packPositions(vertices);
+        m_indices = std::move(indices);
+    }
+}
+
+quartz::rendering::Primitive::Primitive(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) :
+    m_materialMasterIndex(
+        quartz::rendering::Primitive::loadMaterialMasterIndex(
+            primitiveRecord.materialIndex,
+            materialMasterIndices
+        )
+    ),
+    m_boundingBox(
+        math::Vec3(primitiveRecord.boundingBoxMinimum[0], primitiveRecord.boundingBoxMinimum[1], primitiveRecord.boundingBoxMinimum[2]),
+        math::Vec3(primitiveRecord.boundingBoxMaximum[0], primitiveRecord.boundingBoxMaximum[1], primitiveRecord.boundingBoxMaximum[2])
+    ),
+    m_indexCount(quartz::rendering::Primitive::loadCookedIndexCount(primitiveRecord)),
+    m_indexType(static_cast<vk::IndexType>(primitiveRecord.indexType)),
+    m_stagedPositionBuffer(
+        quartz::rendering::Primitive::createStagedBufferFromCookedData(
             renderingDevice,
-            gltfModel,
-            gltfPrimitive,
-            quartz::rendering::Material::getMaterialPtr(m_materialMasterIndex),
-            m_indices
+            cookedModel,
+            primitiveRecord.positions,
+            vk::BufferUsageFlagBits::eVertexBuffer
+        )
+    ),
+    m_stagedAttributeBuffer(
+        quartz::rendering::Primitive::createStagedBufferFromCookedData(
+            renderingDevice,
+            cookedModel,
+            primitiveRecord.attributes,
+            vk::BufferUsageFlagBits::eVertexBuffer
         )
     ),
     m_stagedIndexBuffer(
-        quartz::rendering::StagedBuffer(
+        quartz::rendering::Primitive::createStagedBufferFromCookedData(
             renderingDevice,
-            sizeof(uint32_t) * m_indices.size(),
-            vk::BufferUsageFlagBits::eIndexBuffer,
-            m_indices.data()
+            cookedModel,
+            primitiveRecord.indices,
+            vk::BufferUsageFlagBits::eIndexBuffer
         )
+    ),
+    m_positions(
+        retainGeometry ?
+            quartz::rendering::Primitive::loadCookedPositions(cookedModel, primitiveRecord) :
+            std::vector<math::Vec3>()
+    ),
+    m_indices(
+        retainGeometry ?
+            quartz::rendering::Primitive::loadCookedIndices(cookedModel, primitiveRecord) :
+            std::vector<uint32_t>()
     )
 {
-    LOG_FUNCTION_CALL_TRACEthis("");
+    LOG_FUNCTION_CALL_TRACEthis("{} vertices, {} indices", primitiveRecord.vertexCount, primitiveRecord.indexCount);
 }
 
 quartz::rendering::Primitive::Primitive(
     quartz::rendering::Primitive&& other
 ) :
     m_materialMasterIndex(other.m_materialMasterIndex),
-    m_indices(std::move(other.m_indices)),
-    m_stagedVertexBuffer(std::move(other.m_stagedVertexBuffer)),
-    m_stagedIndexBuffer(std::move(other.m_stagedIndexBuffer))
+    m_boundingBox(other.m_boundingBox),
+    m_indexCount(other.m_indexCount),
+    m_indexType(other.m_indexType),
+    m_stagedPositionBuffer(std::move(other.m_stagedPositionBuffer)),
+    m_stagedAttributeBuffer(std::move(other.m_stagedAttributeBuffer)),
+    m_stagedIndexBuffer(std::move(other.m_stagedIndexBuffer)),
+    m_positions(std::move(other.m_positions)),
+    m_indices(std::move(other.m_indices))
 {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
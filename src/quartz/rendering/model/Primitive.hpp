@@ -1,15 +1,22 @@
 #pragma once
 
+#include <span>
+#include <vector>
+
 #include <tiny_gltf.h>
 
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/StagedBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/material/Material.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Vertex.hpp"
 
 namespace quartz {
 namespace rendering {
+    class ModelCooker;
     class Primitive;
 }
 }
@@ -19,18 +26,37 @@ public: // member functions
     Primitive(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Primitive& gltfPrimitive,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    Primitive(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
     Primitive(Primitive&& other);
     ~Primitive();
 
     USE_LOGGER(MODEL_PRIMITIVE);
 
-    uint32_t getIndexCount() const { return m_indices.size(); }
-    const quartz::rendering::StagedBuffer& getStagedVertexBuffer() const { return m_stagedVertexBuffer; }
+    uint32_t getIndexCount() const { return m_indexCount; }
+    vk::IndexType getIndexType() const { return m_indexType; }
+    const quartz::rendering::StagedBuffer& getStagedPositionBuffer() const { return m_stagedPositionBuffer; }
+    const quartz::rendering::StagedBuffer& getStagedAttributeBuffer() const { return m_stagedAttributeBuffer; }
     const quartz::rendering::StagedBuffer& getStagedIndexBuffer() const { return m_stagedIndexBuffer; }
     uint32_t getMaterialMasterIndex() const { return m_materialMasterIndex; }
+    const math::AxisAlignedBoundingBox& getBoundingBox() const { return m_boundingBox; }
+    const std::vector<math::Vec3>& getPositions() const { return m_positions; }
+    const std::vector<uint32_t>& getIndices() const { return m_indices; }
+
+public: // static functions
+    static void validateCookedPrimitiveRecord(
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+    );
 
 private: // static functions
     // These are helper functions
@@ -42,44 +68,111 @@ private: // static functions
         const quartz::rendering::Vertex::AttributeType attributeType
     );
     static bool handleDefaultTextureAttribute(
-        std::vector<quartz::rendering::Vertex>& verticesToPopulate,
-        const std::shared_ptr<quartz::rendering::Material>& p_material,
+        const std::vector<quartz::rendering::Vertex>& verticesToPopulate,
+        const bool usesOnlyDefaultTextures,
         const quartz::rendering::Vertex::AttributeType attributeType
     );
+    static bool getUsesOnlyDefaultTextures(
+        const std::shared_ptr<quartz::rendering::Material>& p_material
+    );
     static uint32_t determineGltfAccessorByteStride(
         const quartz::rendering::Vertex::AttributeType attributeType,
         const tinygltf::Accessor& accessor,
         const tinygltf::BufferView& bufferView
     );
+    static const uint8_t* getGltfAccessorData(
+        const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
+        const tinygltf::Accessor& accessor
+    );
 
     // These functions are the actual meat and potatoes
     static uint32_t loadMaterialMasterIndex(
-        const tinygltf::Primitive& gltfPrimitive,
+        const int32_t materialLocalIndex,
         const std::vector<uint32_t>& materialMasterIndices
     );
+    static math::AxisAlignedBoundingBox loadBoundingBox(
+        const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
+        const tinygltf::Primitive& gltfPrimitive
+    );
     static std::vector<uint32_t> loadIndicesFromGltfPrimitive(
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Primitive& gltfPrimitive
     );
     static void populateVerticesWithAttribute(
         std::vector<quartz::rendering::Vertex>& verticesToPopulate,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Primitive& gltfPrimitive,
-        const std::shared_ptr<quartz::rendering::Material>& p_material,
+        const bool usesOnlyDefaultTextures,
         const std::vector<uint32_t>& indices,
         const quartz::rendering::Vertex::AttributeType attributeType
     );
-    static quartz::rendering::StagedBuffer createStagedVertexBuffer(
-        const quartz::rendering::Device& renderingDevice,
+    static std::vector<quartz::rendering::Vertex> loadVertices(
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Primitive& gltfPrimitive,
-        const std::shared_ptr<quartz::rendering::Material>& p_material,
+        const bool usesOnlyDefaultTextures,
         const std::vector<uint32_t>& indices
     );
+    static std::vector<math::Vec3> packPositions(
+        const std::vector<quartz::rendering::Vertex>& vertices
+    );
+    static std::vector<quartz::rendering::Vertex::PackedAttributes> packAttributes(
+        const std::vector<quartz::rendering::Vertex>& vertices
+    );
+    static std::vector<uint16_t> narrowIndices(
+        const std::vector<uint32_t>& indices
+    );
+    static quartz::rendering::StagedBuffer createStagedPositionBuffer(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<quartz::rendering::Vertex>& vertices
+    );
+    static quartz::rendering::StagedBuffer createStagedAttributeBuffer(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<quartz::rendering::Vertex>& vertices
+    );
+    static quartz::rendering::StagedBuffer createStagedIndexBuffer(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<uint32_t>& indices,
+        const vk::IndexType indexType
+    );
+    static quartz::rendering::StagedBuffer createStagedBufferFromCookedData(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::DataLocation& dataLocation,
+        const vk::BufferUsageFlags usageFlags
+    );
+    static uint32_t loadCookedIndexCount(
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+    );
+    static std::vector<math::Vec3> loadCookedPositions(
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+    );
+    static std::vector<uint32_t> loadCookedIndices(
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+    );
 
 private: // member variables
     uint32_t m_materialMasterIndex;
-    std::vector<uint32_t> m_indices;
-    quartz::rendering::StagedBuffer m_stagedVertexBuffer;
+    math::AxisAlignedBoundingBox m_boundingBox;
+    uint32_t m_indexCount;
+    vk::IndexType m_indexType; // uint16 whenever the primitive has few enough vertices
+    quartz::rendering::StagedBuffer m_stagedPositionBuffer;
+    quartz::rendering::StagedBuffer m_stagedAttributeBuffer;
     quartz::rendering::StagedBuffer m_stagedIndexBuffer;
+
+    /**
+     * @brief Everything above is all we need to draw. These are only kept when the model was loaded
+     *   with retainGeometry, for things like physics and picking that need the triangles on the cpu
+     */
+    std::vector<math::Vec3> m_positions;
+    std::vector<uint32_t> m_indices;
+
+private: // friends
+    friend class quartz::rendering::ModelCooker;
 };
\ No newline at end of file
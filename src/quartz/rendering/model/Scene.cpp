@@ -1,17 +1,21 @@
 #include<memory>
 #include <queue>
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Scene.hpp"
 
 std::vector<std::shared_ptr<quartz::rendering::Node>>
 quartz::rendering::Scene::loadRootNodePtrs(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Scene& gltfScene,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) {
     LOG_FUNCTION_SCOPE_TRACE(MODEL_SCENE, "");
 
@@ -28,9 +32,42 @@ quartz::rendering::Scene::loadRootNodePtrs(
         rootNodePtrs.emplace_back(std::make_shared<quartz::rendering::Node>(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfNode,
             nullptr,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
+        ));
+    }
+
+    return rootNodePtrs;
+}
+
+std::vector<std::shared_ptr<quartz::rendering::Node>>
+quartz::rendering::Scene::loadRootNodePtrs(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::SceneRecord& sceneRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) {
+    LOG_FUNCTION_SCOPE_TRACE(MODEL_SCENE, "");
+
+    const std::span<const uint32_t> rootNodeIndices = cookedModel.getRootNodeIndices(sceneRecord);
+
+    std::vector<std::shared_ptr<quartz::rendering::Node>> rootNodePtrs;
+    rootNodePtrs.reserve(rootNodeIndices.size());
+
+    LOG_TRACE(MODEL_SCENE, "Loading {} cooked root nodes", rootNodeIndices.size());
+
+    for (const uint32_t rootNodeIndex : rootNodeIndices) {
+        rootNodePtrs.emplace_back(std::make_shared<quartz::rendering::Node>(
+            renderingDevice,
+            cookedModel,
+            rootNodeIndex,
+            nullptr,
+            materialMasterIndices,
+            retainGeometry
         ));
     }
 
@@ -40,15 +77,39 @@ quartz::rendering::Scene::loadRootNodePtrs(
 quartz::rendering::Scene::Scene(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Model& gltfModel,
+    const std::vector<std::span<const uint8_t>>& gltfBuffers,
     const tinygltf::Scene& gltfScene,
-    const std::vector<uint32_t>& materialMasterIndices
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
 ) :
     m_rootNodePtrs(
         quartz::rendering::Scene::loadRootNodePtrs(
             renderingDevice,
             gltfModel,
+            gltfBuffers,
             gltfScene,
-            materialMasterIndices
+            materialMasterIndices,
+            retainGeometry
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::Scene::Scene(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::CookedModel& cookedModel,
+    const quartz::rendering::CookedModel::SceneRecord& sceneRecord,
+    const std::vector<uint32_t>& materialMasterIndices,
+    const bool retainGeometry
+) :
+    m_rootNodePtrs(
+        quartz::rendering::Scene::loadRootNodePtrs(
+            renderingDevice,
+            cookedModel,
+            sceneRecord,
+            materialMasterIndices,
+            retainGeometry
         )
     )
 {
@@ -1,11 +1,13 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <vector>
 
 #include <tiny_gltf.h>
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
 #include "quartz/rendering/model/Node.hpp"
 
 namespace quartz {
@@ -19,8 +21,17 @@ public: // member functions
     Scene(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Scene& gltfScene,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    Scene(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::SceneRecord& sceneRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
     Scene(Scene&& other);
     ~Scene();
@@ -34,8 +45,17 @@ private: // static functions
     static std::vector<std::shared_ptr<quartz::rendering::Node>> loadRootNodePtrs(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Model& gltfModel,
+        const std::vector<std::span<const uint8_t>>& gltfBuffers,
         const tinygltf::Scene& gltfScene,
-        const std::vector<uint32_t>& materialMasterIndices
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
+    );
+    static std::vector<std::shared_ptr<quartz::rendering::Node>> loadRootNodePtrs(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::CookedModel& cookedModel,
+        const quartz::rendering::CookedModel::SceneRecord& sceneRecord,
+        const std::vector<uint32_t>& materialMasterIndices,
+        const bool retainGeometry
     );
 
 private: // member variables
@@ -109,8 +109,8 @@ quartz::rendering::TangentCalculator::getVertexAttribute(
             return vertex.position;
         case quartz::rendering::Vertex::AttributeType::Normal:
             return vertex.normal;
-        case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate:
-            return {vertex.normalTextureCoordinate.x, vertex.normalTextureCoordinate.y, 0.0f};
+        case quartz::rendering::Vertex::AttributeType::TextureCoordinate:
+            return {vertex.textureCoordinate.x, vertex.textureCoordinate.y, 0.0f};
         default:
             LOG_ERROR(MODEL_PRIMITIVE, "  Not getting vertex attribute {}", quartz::rendering::Vertex::getAttributeGLTFString(type));
             return {0.0f, 0.0f, 0.0f};
@@ -188,7 +188,7 @@ quartz::rendering::TangentCalculator::getTextureCoordinate(
         p_mikktspaceContext,
         faceIndex,
         faceLocalVertexIndex,
-        quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate
+        quartz::rendering::Vertex::AttributeType::TextureCoordinate
     );
 
     textureCoordinateToPopulate2[0] = vertexAttribute.x;
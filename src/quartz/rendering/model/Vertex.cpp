@@ -1,5 +1,15 @@
+#include <algorithm>
+#include <cmath>
+
+#include <glm/packing.hpp>
+#include <glm/vec4.hpp>
+#include <glm/geometric.hpp>
+
 #include <vulkan/vulkan.hpp>
 
+#include "math/transform/Vec2.hpp"
+#include "math/transform/Vec3.hpp"
+
 #include "quartz/rendering/model/Vertex.hpp"
 
 std::string
@@ -15,16 +25,8 @@ quartz::rendering::Vertex::getAttributeNameString(
             return "Tangent";
         case quartz::rendering::Vertex::AttributeType::Color:
             return "Color";
-        case quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate:
-            return "Base Color Texture Coordinate";
-        case quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate:
-            return "Metallic Roughness Texture Coordinate";
-        case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate:
-            return "Normal Texture Coordinate";
-        case quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate:
-            return "Emission Texture Coordinate";
-        case quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate:
-            return "Occlusion Texture Coordinate";
+        case quartz::rendering::Vertex::AttributeType::TextureCoordinate:
+            return "Texture Coordinate";
     }
 }
 
@@ -41,24 +43,27 @@ quartz::rendering::Vertex::getAttributeGLTFString(
             return "TANGENT";
         case quartz::rendering::Vertex::AttributeType::Color:
             return "COLOR_0";
-        case quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate:
-        case quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate:
-        case quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate:
-        case quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate:
-        case quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate:
+        case quartz::rendering::Vertex::AttributeType::TextureCoordinate:
             return "TEXCOORD_0";
     }
 }
 
-vk::VertexInputBindingDescription
-quartz::rendering::Vertex::getVulkanVertexInputBindingDescription() {
-    vk::VertexInputBindingDescription vertexInputBindingDescription(
-        0,
-        sizeof(quartz::rendering::Vertex),
-        vk::VertexInputRate::eVertex
-    );
+std::vector<vk::VertexInputBindingDescription>
+quartz::rendering::Vertex::getVulkanVertexInputBindingDescriptions() {
+    std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions = {
+        vk::VertexInputBindingDescription(
+            quartz::rendering::Vertex::positionBindingIndex,
+            sizeof(math::Vec3),
+            vk::VertexInputRate::eVertex
+        ),
+        vk::VertexInputBindingDescription(
+            quartz::rendering::Vertex::attributeBindingIndex,
+            sizeof(quartz::rendering::Vertex::PackedAttributes),
+            vk::VertexInputRate::eVertex
+        )
+    };
 
-    return vertexInputBindingDescription;
+    return vertexInputBindingDescriptions;
 }
 
 std::vector<vk::VertexInputAttributeDescription>
@@ -66,92 +71,94 @@ quartz::rendering::Vertex::getVulkanVertexInputAttributeDescriptions() {
     std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions = {
         vk::VertexInputAttributeDescription(
             static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::Position),
-            0,
+            quartz::rendering::Vertex::positionBindingIndex,
             vk::Format::eR32G32B32Sfloat,
-            offsetof(quartz::rendering::Vertex, position)
+            0
         ),
         vk::VertexInputAttributeDescription(
             static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::Normal),
-            0,
-            vk::Format::eR32G32B32Sfloat,
-            offsetof(quartz::rendering::Vertex, normal)
+            quartz::rendering::Vertex::attributeBindingIndex,
+            vk::Format::eR16G16Snorm,
+            offsetof(quartz::rendering::Vertex::PackedAttributes, normal)
         ),
         vk::VertexInputAttributeDescription(
             static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::Tangent),
-            0,
-            vk::Format::eR32G32B32Sfloat,
-            offsetof(quartz::rendering::Vertex, tangent)
+            quartz::rendering::Vertex::attributeBindingIndex,
+            vk::Format::eR16G16Snorm,
+            offsetof(quartz::rendering::Vertex::PackedAttributes, tangent)
         ),
         vk::VertexInputAttributeDescription(
             static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::Color),
-            0,
-            vk::Format::eR32G32B32Sfloat,
-            offsetof(quartz::rendering::Vertex, color)
+            quartz::rendering::Vertex::attributeBindingIndex,
+            vk::Format::eR8G8B8A8Unorm,
+            offsetof(quartz::rendering::Vertex::PackedAttributes, color)
         ),
         vk::VertexInputAttributeDescription(
-            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::BaseColorTextureCoordinate),
-            0,
-            vk::Format::eR32G32Sfloat,
-            offsetof(quartz::rendering::Vertex, baseColorTextureCoordinate)
-        ),
-        vk::VertexInputAttributeDescription(
-            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::MetallicRoughnessTextureCoordinate),
-            0,
-            vk::Format::eR32G32Sfloat,
-            offsetof(quartz::rendering::Vertex, metallicRoughnessTextureCoordinate)
-        ),
-        vk::VertexInputAttributeDescription(
-            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::NormalTextureCoordinate),
-            0,
-            vk::Format::eR32G32Sfloat,
-            offsetof(quartz::rendering::Vertex, normalTextureCoordinate)
-        ),
-        vk::VertexInputAttributeDescription(
-            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::EmissionTextureCoordinate),
-            0,
-            vk::Format::eR32G32Sfloat,
-            offsetof(quartz::rendering::Vertex, emissionTextureCoordinate)
-        ),
-        vk::VertexInputAttributeDescription(
-            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::OcclusionTextureCoordinate),
-            0,
-            vk::Format::eR32G32Sfloat,
-            offsetof(quartz::rendering::Vertex, occlusionTextureCoordinate)
+            static_cast<uint32_t>(quartz::rendering::Vertex::AttributeType::TextureCoordinate),
+            quartz::rendering::Vertex::attributeBindingIndex,
+            vk::Format::eR16G16Sfloat,
+            offsetof(quartz::rendering::Vertex::PackedAttributes, textureCoordinate)
         )
     };
 
     return vertexInputAttributeDescriptions;
 }
 
+math::Vec2
+quartz::rendering::Vertex::encodeOctahedral(
+    const math::Vec3& unitVector
+) {
+    const float l1Norm = std::abs(unitVector.x) + std::abs(unitVector.y) + std::abs(unitVector.z);
+    if (l1Norm == 0.0f) {
+        return math::Vec2(0.0f, 0.0f);
+    }
+
+    // Project onto the octahedron, then fold the lower hemisphere over the upper one
+    const float x = unitVector.x / l1Norm;
+    const float y = unitVector.y / l1Norm;
+    if (unitVector.z >= 0.0f) {
+        return math::Vec2(x, y);
+    }
+
+    return math::Vec2(
+        (1.0f - std::abs(y)) * (x >= 0.0f ? 1.0f : -1.0f),
+        (1.0f - std::abs(x)) * (y >= 0.0f ? 1.0f : -1.0f)
+    );
+}
+
+math::Vec3
+quartz::rendering::Vertex::decodeOctahedral(
+    const math::Vec2& encodedVector
+) {
+    // Mirrors decodeOctahedral in shader.vert
+    glm::vec3 unitVector(encodedVector.x, encodedVector.y, 1.0f - std::abs(encodedVector.x) - std::abs(encodedVector.y));
+    const float fold = std::max(-unitVector.z, 0.0f);
+    unitVector.x += unitVector.x >= 0.0f ? -fold : fold;
+    unitVector.y += unitVector.y >= 0.0f ? -fold : fold;
+
+    return glm::normalize(unitVector);
+}
+
 quartz::rendering::Vertex::Vertex() :
     position(0.0f, 0.0f, 0.0f),
     normal(0.0f, 0.0f, 0.0f),
+    tangent(0.0f, 0.0f, 0.0f),
     color(1.0f, 1.0f, 1.0f),
-    baseColorTextureCoordinate(0.0f, 0.0f),
-    metallicRoughnessTextureCoordinate(0.0f, 0.0f),
-    normalTextureCoordinate(0.0f, 0.0f),
-    emissionTextureCoordinate(0.0f, 0.0f),
-    occlusionTextureCoordinate(0.0f, 0.0f)
+    textureCoordinate(0.0f, 0.0f)
 {}
 
 quartz::rendering::Vertex::Vertex(
     const math::Vec3& position_,
     const math::Vec3& normal_,
+    const math::Vec3& tangent_,
     const math::Vec3& color_,
-    const math::Vec2& baseColorTextureCoordinate_,
-    const math::Vec2& metallicRoughnessTextureCoordinate_,
-    const math::Vec2& normalTextureCoordinate_,
-    const math::Vec2& emissionTextureCoordinate_,
-    const math::Vec2& occlusionTextureCoordinate_
+    const math::Vec2& textureCoordinate_
 ) :
     position(position_),
     normal(normal_),
+    tangent(tangent_),
     color(color_),
-    baseColorTextureCoordinate(baseColorTextureCoordinate_),
-    metallicRoughnessTextureCoordinate(metallicRoughnessTextureCoordinate_),
-    normalTextureCoordinate(normalTextureCoordinate_),
-    emissionTextureCoordinate(emissionTextureCoordinate_),
-    occlusionTextureCoordinate(occlusionTextureCoordinate_)
+    textureCoordinate(textureCoordinate_)
 {}
 
 bool
@@ -167,23 +174,28 @@ quartz::rendering::Vertex::operator==(
         normal.y == other.normal.y &&
         normal.z == other.normal.z &&
 
+        tangent.x == other.tangent.x &&
+        tangent.y == other.tangent.y &&
+        tangent.z == other.tangent.z &&
+
         color.x == other.color.x &&
         color.y == other.color.y &&
         color.z == other.color.z &&
 
-        baseColorTextureCoordinate.x == other.baseColorTextureCoordinate.x &&
-        baseColorTextureCoordinate.y == other.baseColorTextureCoordinate.y &&
-
-        metallicRoughnessTextureCoordinate.x == other.metallicRoughnessTextureCoordinate.x &&
-        metallicRoughnessTextureCoordinate.y == other.metallicRoughnessTextureCoordinate.y &&
-
-        normalTextureCoordinate.x == other.normalTextureCoordinate.x &&
-        normalTextureCoordinate.y == other.normalTextureCoordinate.y &&
+        textureCoordinate.x == other.textureCoordinate.x &&
+        textureCoordinate.y == other.textureCoordinate.y
+    );
+}
 
-        emissionTextureCoordinate.x == other.emissionTextureCoordinate.x &&
-        emissionTextureCoordinate.y == other.emissionTextureCoordinate.y &&
+quartz::rendering::Vertex::PackedAttributes
+quartz::rendering::Vertex::pack() const {
+    const math::Vec2 encodedNormal = quartz::rendering::Vertex::encodeOctahedral(normal);
+    const math::Vec2 encodedTangent = quartz::rendering::Vertex::encodeOctahedral(tangent);
 
-        occlusionTextureCoordinate.x == other.occlusionTextureCoordinate.x &&
-        occlusionTextureCoordinate.y == other.occlusionTextureCoordinate.y
-    );
-}
\ No newline at end of file
+    return {
+        glm::packSnorm2x16(encodedNormal),
+        glm::packSnorm2x16(encodedTangent),
+        glm::packUnorm4x8(glm::vec4(static_cast<const glm::vec3&>(color), 1.0f)),
+        glm::packHalf2x16(textureCoordinate)
+    };
+}
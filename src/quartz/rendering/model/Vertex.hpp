@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "math/transform/Vec2.hpp"
 #include "math/transform/Vec3.hpp"
 
@@ -11,19 +13,34 @@ namespace rendering {
 }
 }
 
+/**
+ * @brief The full precision vertex we assemble while loading a primitive. This is what we calculate
+ *   tangents with, but it is never uploaded as is. It is split into a position stream and a packed
+ *   attribute stream, so anything only needing positions doesn't have to fetch the rest.
+ */
 struct quartz::rendering::Vertex {
 public: // enums
     enum class AttributeType : uint32_t {
-        Position    = 0,
-        Normal      = 1,
-        Tangent     = 2,
-        Color       = 3,
-
-        BaseColorTextureCoordinate          = 4,
-        MetallicRoughnessTextureCoordinate  = 5,
-        NormalTextureCoordinate             = 6,
-        EmissionTextureCoordinate           = 7,
-        OcclusionTextureCoordinate          = 8
+        Position            = 0,
+        Normal              = 1,
+        Tangent             = 2,
+        Color               = 3,
+        TextureCoordinate   = 4
+    };
+
+public: // classes
+    /**
+     * @brief Everything but the position, packed into 16 bytes.
+     *   - normal and tangent are octahedral encoded into two snorm16 components
+     *   - color is four unorm8 components
+     *   - the texture coordinate is two half floats, so coordinates outside of [0, 1] still work
+     */
+    struct PackedAttributes {
+    public: // member variables
+        uint32_t normal;
+        uint32_t tangent;
+        uint32_t color;
+        uint32_t textureCoordinate;
     };
 
 public: // member functions
@@ -31,50 +48,55 @@ public: // member functions
     Vertex(
         const math::Vec3& position_,
         const math::Vec3& normal_,
+        const math::Vec3& tangent_,
         const math::Vec3& color_,
-        const math::Vec2& baseColorTextureCoordinate_,
-        const math::Vec2& metallicRoughnessTextureCoordinate_,
-        const math::Vec2& normalTextureCoordinate_,
-        const math::Vec2& emissionTextureCoordinate_,
-        const math::Vec2& occlusionTextureCoordinate_
+        const math::Vec2& textureCoordinate_
     );
     bool operator==(const Vertex& other) const;
 
+    quartz::rendering::Vertex::PackedAttributes pack() const;
+
 public: // static functions
     static std::string getAttributeNameString(const quartz::rendering::Vertex::AttributeType attributeType);
     static std::string getAttributeGLTFString(const quartz::rendering::Vertex::AttributeType type);
-    static vk::VertexInputBindingDescription getVulkanVertexInputBindingDescription();
+    static std::vector<vk::VertexInputBindingDescription> getVulkanVertexInputBindingDescriptions();
     static std::vector<vk::VertexInputAttributeDescription> getVulkanVertexInputAttributeDescriptions();
 
+    static math::Vec2 encodeOctahedral(const math::Vec3& unitVector);
+    static math::Vec3 decodeOctahedral(const math::Vec2& encodedVector);
+
+public: // static variables
+    static constexpr uint32_t positionBindingIndex = 0;
+    static constexpr uint32_t attributeBindingIndex = 2; // binding 1 is used by quartz::rendering::InstanceData
+
 public: // member variables
     math::Vec3 position;
     math::Vec3 normal;
     math::Vec3 tangent;
     math::Vec3 color;
 
-    math::Vec2 baseColorTextureCoordinate;
-    math::Vec2 metallicRoughnessTextureCoordinate;
-    math::Vec2 normalTextureCoordinate;
-    math::Vec2 emissionTextureCoordinate;
-    math::Vec2 occlusionTextureCoordinate;
+    /**
+     * @brief Every texture in a material is sampled with TEXCOORD_0, so we only keep one set of
+     *   coordinates instead of one for each texture
+     */
+    math::Vec2 textureCoordinate;
 };
 
+/**
+ * @brief Doesn't allocate, so it is cheap enough to weld every vertex we load. 0.0 and -0.0 hash the
+ *   same, which keeps this consistent with operator==
+ */
 template <> struct std::hash<quartz::rendering::Vertex> {
     std::size_t operator()(const quartz::rendering::Vertex& vertex) const {
-        std::size_t seed = 0;
-
-        std::vector<float> values = {
+        const std::array<float, 14> values = {
             vertex.position.x, vertex.position.y, vertex.position.z,
             vertex.normal.x,   vertex.normal.y,   vertex.normal.z,
             vertex.tangent.x,  vertex.tangent.y,  vertex.tangent.z,
             vertex.color.x,    vertex.color.y,    vertex.color.z,
-            vertex.baseColorTextureCoordinate.x,         vertex.baseColorTextureCoordinate.y,
-            vertex.metallicRoughnessTextureCoordinate.x, vertex.metallicRoughnessTextureCoordinate.y,
-            vertex.normalTextureCoordinate.x,            vertex.normalTextureCoordinate.y,
-            vertex.emissionTextureCoordinate.x,          vertex.emissionTextureCoordinate.y,
-            vertex.occlusionTextureCoordinate.x,         vertex.occlusionTextureCoordinate.y
+            vertex.textureCoordinate.x, vertex.textureCoordinate.y
         };
 
+        std::size_t seed = 0;
         for (const float value : values) {
             seed ^=
                 std::hash<float>{}(value) +
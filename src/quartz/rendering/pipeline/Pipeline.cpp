@@ -522,7 +522,7 @@ quartz::rendering::Pipeline::createVulkanPipelineLayoutPtr(
 vk::UniquePipeline
 quartz::rendering::Pipeline::createVulkanGraphicsPipelinePtr(
     const vk::UniqueDevice& p_logicalDevice,
-    const vk::VertexInputBindingDescription vertexInputBindingDescriptions,
+    const std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions,
     const std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions,
     const std::vector<vk::Viewport> viewports,
     const std::vector<vk::Rect2D> scissorRectangles,
@@ -697,7 +697,7 @@ quartz::rendering::Pipeline::Pipeline(
     const std::string& compiledVertexShaderFilepath,
     const std::string& compiledFragmentShaderFilepath,
     const uint32_t maxNumFramesInFlight,
-    const vk::VertexInputBindingDescription& vertexInputBindingDescription,
+    const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions,
     const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions,
     const vk::CullModeFlags cullModeFlags,
     const bool shouldDepthTest,
@@ -707,7 +707,7 @@ quartz::rendering::Pipeline::Pipeline(
     const std::optional<quartz::rendering::UniformSamplerInfo>& o_uniformSamplerInfo,
     const std::optional<quartz::rendering::UniformTextureArrayInfo>& o_uniformTextureArrayInfo
 ) :
-    m_vulkanVertexInputBindingDescriptions(vertexInputBindingDescription),
+    m_vulkanVertexInputBindingDescriptions(vertexInputBindingDescriptions),
     m_vulkanVertexInputAttributeDescriptions(vertexInputAttributeDescriptions),
     m_vulkanViewports({
         vk::Viewport(
@@ -921,6 +921,20 @@ quartz::rendering::Pipeline::updateTextureArrayDescriptorSets(
     );
 }
 
+void
+quartz::rendering::Pipeline::updateTextureArrayDescriptorSet(
+    const quartz::rendering::Device& renderingDevice,
+    const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs,
+    const uint32_t inFlightFrameIndex
+) {
+    quartz::rendering::Pipeline::updateUniformTextureArrayDescriptorSets(
+        renderingDevice.getVulkanLogicalDevicePtr(),
+        mo_uniformTextureArrayInfo,
+        texturePtrs,
+        {m_vulkanDescriptorSets[inFlightFrameIndex]}
+    );
+}
+
 void
 quartz::rendering::Pipeline::updateUniformBuffer(
     const uint32_t currentInFlightFrameIndex,
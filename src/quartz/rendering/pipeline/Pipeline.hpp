@@ -40,7 +40,7 @@ public: // member functions
         const std::string& compiledVertexShaderFilepath,
         const std::string& compiledFragmentShaderFilepath,
         const uint32_t maxNumFramesInFlight,
-        const vk::VertexInputBindingDescription& vertexInputBindingDescription,
+        const std::vector<vk::VertexInputBindingDescription>& vertexInputBindingDescriptions,
         const std::vector<vk::VertexInputAttributeDescription>& vertexInputAttributeDescriptions,
         const vk::CullModeFlags cullModeFlags,
         const bool shouldDepthTest,
@@ -74,6 +74,14 @@ public: // member functions
         const quartz::rendering::Device& renderingDevice,
         const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs
     );
+    /**
+     * @brief Only the descriptor set for one frame in flight, which must not be in use by the gpu
+     */
+    void updateTextureArrayDescriptorSet(
+        const quartz::rendering::Device& renderingDevice,
+        const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs,
+        const uint32_t inFlightFrameIndex
+    );
 
     USE_LOGGER(PIPELINE);
 
@@ -156,7 +164,7 @@ private: // static functions
     );
     static vk::UniquePipeline createVulkanGraphicsPipelinePtr(
         const vk::UniqueDevice& p_logicalDevice,
-        const vk::VertexInputBindingDescription vertexInputBindingDescriptions,
+        const std::vector<vk::VertexInputBindingDescription> vertexInputBindingDescriptions,
         const std::vector<vk::VertexInputAttributeDescription> vertexInputAttributeDescriptions,
         const std::vector<vk::Viewport> viewports,
         const std::vector<vk::Rect2D> scissorRectangles,
@@ -171,7 +179,7 @@ private: // static functions
     );
 
 private: // member variables
-    vk::VertexInputBindingDescription m_vulkanVertexInputBindingDescriptions;
+    std::vector<vk::VertexInputBindingDescription> m_vulkanVertexInputBindingDescriptions;
     std::vector<vk::VertexInputAttributeDescription> m_vulkanVertexInputAttributeDescriptions;
     std::vector<vk::Viewport> m_vulkanViewports;
     std::vector<vk::Rect2D> m_vulkanScissorRectangles;
@@ -0,0 +1,107 @@
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/logger/Logger.hpp"
+
+#include "quartz/rendering/model/DrawPacket.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
+
+uint64_t
+quartz::rendering::RenderQueue::createSortKey(
+    const uint8_t pipelineIndex,
+    const quartz::rendering::DrawPacket& drawPacket
+) {
+    const uint64_t vertexBufferHandle = reinterpret_cast<uint64_t>(static_cast<VkBuffer>(drawPacket.vulkanPositionBuffer));
+    const uint64_t vertexBufferKey = (vertexBufferHandle ^ (vertexBufferHandle >> 32)) & 0xFFFFFFFFull;
+
+    return
+        (static_cast<uint64_t>(pipelineIndex) << 56) |
+        ((static_cast<uint64_t>(drawPacket.materialMasterIndex) & 0xFFFFFFull) << 32) |
+        vertexBufferKey;
+}
+
+void
+quartz::rendering::RenderQueue::radixSort(
+    std::vector<quartz::rendering::RenderQueue::Item>& items,
+    std::vector<quartz::rendering::RenderQueue::Item>& scratchItems
+) {
+    scratchItems.resize(items.size());
+
+    // Least significant byte first. Each pass is stable, so the order from earlier passes is preserved
+    for (uint32_t shift = 0; shift < 64; shift += 8) {
+        std::array<uint32_t, 256> bucketOffsets = {};
+        for (const quartz::rendering::RenderQueue::Item& item : items) {
+            bucketOffsets[(item.sortKey >> shift) & 0xFF]++;
+        }
+
+        // Every key has the same byte here, so this pass wouldn't move anything
+        if (bucketOffsets[(items[0].sortKey >> shift) & 0xFF] == items.size()) {
+            continue;
+        }
+
+        uint32_t runningOffset = 0;
+        for (uint32_t& bucketOffset : bucketOffsets) {
+            const uint32_t bucketCount = bucketOffset;
+            bucketOffset = runningOffset;
+            runningOffset += bucketCount;
+        }
+
+        for (const quartz::rendering::RenderQueue::Item& item : items) {
+            scratchItems[bucketOffsets[(item.sortKey >> shift) & 0xFF]++] = item;
+        }
+
+        items.swap(scratchItems);
+    }
+}
+
+quartz::rendering::RenderQueue::RenderQueue() :
+    m_items(),
+    m_scratchItems()
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::RenderQueue::RenderQueue(
+    quartz::rendering::RenderQueue&& other
+) :
+    m_items(std::move(other.m_items)),
+    m_scratchItems(std::move(other.m_scratchItems))
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+quartz::rendering::RenderQueue::~RenderQueue() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+void
+quartz::rendering::RenderQueue::clear() {
+    m_items.clear();
+}
+
+void
+quartz::rendering::RenderQueue::push(
+    const uint8_t pipelineIndex,
+    const quartz::rendering::DrawPacket& drawPacket,
+    const uint32_t firstInstance,
+    const uint32_t instanceCount
+) {
+    m_items.push_back({
+        quartz::rendering::RenderQueue::createSortKey(pipelineIndex, drawPacket),
+        &drawPacket,
+        firstInstance,
+        instanceCount
+    });
+}
+
+void
+quartz::rendering::RenderQueue::sort() {
+    if (m_items.size() < 2) {
+        return;
+    }
+
+    quartz::rendering::RenderQueue::radixSort(m_items, m_scratchItems);
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/DrawPacket.hpp"
+
+namespace quartz {
+namespace rendering {
+    class RenderQueue;
+}
+}
+
+/**
+ * @brief Collects the draw packets of every visible model for a frame and sorts them so packets
+ *   sharing state end up next to each other. This lets the swapchain skip binding state which is
+ *   already bound when it records the queue.
+ *
+ * @brief The sort key is laid out from most to least expensive state to change:
+ *   [63 - 56] pipeline index
+ *   [55 - 32] material master index
+ *   [31 -  0] vertex buffer handle, folded down to 32 bits
+ *   Folding the vertex buffer handle may cause two buffers to share a key, which only affects how
+ *   well the packets are grouped. Redundant state is detected by comparing the actual state.
+ */
+class quartz::rendering::RenderQueue {
+public: // classes
+    struct Item {
+    public: // member variables
+        uint64_t sortKey;
+        const quartz::rendering::DrawPacket* p_drawPacket;
+        uint32_t firstInstance;
+        uint32_t instanceCount;
+    };
+
+    /**
+     * @brief How much state was bound when recording the queue, and how much binding was skipped
+     *   because the previous draw already had it bound
+     */
+    struct Statistics {
+    public: // member functions
+        uint32_t getBindCount() const { return descriptorSetBindCount + vertexBufferBindCount + indexBufferBindCount + pushConstantCount; }
+        uint32_t getBindsAvoidedCount() const { return descriptorSetBindsAvoided + vertexBufferBindsAvoided + indexBufferBindsAvoided + pushConstantsAvoided; }
+
+    public: // member variables
+        uint32_t drawCount = 0;
+        uint32_t descriptorSetBindCount = 0;
+        uint32_t descriptorSetBindsAvoided = 0;
+        uint32_t vertexBufferBindCount = 0;
+        uint32_t vertexBufferBindsAvoided = 0;
+        uint32_t indexBufferBindCount = 0;
+        uint32_t indexBufferBindsAvoided = 0;
+        uint32_t pushConstantCount = 0;
+        uint32_t pushConstantsAvoided = 0;
+    };
+
+public: // member functions
+    RenderQueue();
+    RenderQueue(const RenderQueue& other) = delete;
+    RenderQueue(RenderQueue&& other);
+    ~RenderQueue();
+
+    USE_LOGGER(RENDER_QUEUE);
+
+    const std::vector<Item>& getItems() const { return m_items; }
+
+    void clear();
+    void push(
+        const uint8_t pipelineIndex,
+        const quartz::rendering::DrawPacket& drawPacket,
+        const uint32_t firstInstance,
+        const uint32_t instanceCount
+    );
+    void sort();
+
+public: // static functions
+    static uint64_t createSortKey(
+        const uint8_t pipelineIndex,
+        const quartz::rendering::DrawPacket& drawPacket
+    );
+
+private: // static functions
+    static void radixSort(
+        std::vector<Item>& items,
+        std::vector<Item>& scratchItems
+    );
+
+private: // member variables
+    std::vector<Item> m_items;
+    std::vector<Item> m_scratchItems; // kept around so sorting doesn't allocate every frame
+};
@@ -104,11 +104,7 @@ layout(push_constant) uniform perObjectFragmentPushConstant {
 layout(location = 0) in vec3 in_fragmentPosition;
 layout(location = 1) in mat3 in_TBN; /** @brief Tangent, Bi-Tangent, Normal vectors. All normalized */
 layout(location = 4) in vec3 in_vertexColor;
-layout(location = 5) in vec2 in_baseColorTextureCoordinate;
-layout(location = 6) in vec2 in_metallicRoughnessTextureCoordinate;
-layout(location = 7) in vec2 in_normalTextureCoordinate;
-layout(location = 8) in vec2 in_emissionTextureCoordinate;
-layout(location = 9) in vec2 in_occlusionTextureCoordinate;
+layout(location = 5) in vec2 in_textureCoordinate; /** @brief Shared by every texture, they all sample TEXCOORD_0 */
 
 // --------------------====================================== Output =======================================-------------------- //
 
@@ -311,7 +307,7 @@ vec3 specularBRDF(
 float getOcclusionScale() {
     float occlusionScale = texture(
         sampler2D(textureArray[material.occlusionTextureMasterIndex], rgbaTextureSampler),
-        in_occlusionTextureCoordinate
+        in_textureCoordinate
     ).r;
 
     return occlusionScale;
@@ -326,8 +322,8 @@ float getOcclusionScale() {
 vec3 getMetallicRoughnessVector() {
     vec3 metallicRoughnessVector = texture(
         sampler2D(textureArray[material.metallicRoughnessTextureMasterIndex], rgbaTextureSampler),
-        in_metallicRoughnessTextureCoordinate
-    ).rgb; // roughness in g, metallic in b
+        in_textureCoordinate
+    ).rgb; // roughness in g, metallic in b (the image view swizzles them there when they are packed into rg)
 
     return vec3(
         metallicRoughnessVector.r,
@@ -347,7 +343,7 @@ vec3 calculateFragmentBaseColor(float roughnessValue, float metallicValue) {
 
     vec3 fragmentBaseColor = texture(
         sampler2D(textureArray[material.baseColorTextureMasterIndex], rgbaTextureSampler),
-        in_baseColorTextureCoordinate
+        in_textureCoordinate
     ).rgb;
     fragmentBaseColor *= in_vertexColor;
     fragmentBaseColor *= material.baseColorFactor.rgb;
@@ -360,12 +356,16 @@ vec3 calculateFragmentBaseColor(float roughnessValue, float metallicValue) {
 // --------------------------------------------------------------------------------
 
 vec3 calculateFragmentNormal() {
-    vec3 normalDisplacement = texture(
+    vec2 normalDisplacementXY = texture(
         sampler2D(textureArray[material.normalTextureMasterIndex], rgbaTextureSampler),
-        in_normalTextureCoordinate
-    ).rgb;
+        in_textureCoordinate
+    ).rg;
+
+    normalDisplacementXY = (normalDisplacementXY * 2.0) - 1.0; // convert it to range [-1, 1] from range [0, 1]
 
-    normalDisplacement = normalize((normalDisplacement * 2.0) - 1.0); // convert it to range [-1, 1] from range [0, 1]
+    // Block compressed normal maps only store x and y, so z is always rebuilt from them (it points out of the surface)
+    vec3 normalDisplacement = vec3(normalDisplacementXY, sqrt(max(1.0 - dot(normalDisplacementXY, normalDisplacementXY), 0.0)));
+    normalDisplacement = normalize(normalDisplacement);
 
     vec3 fragmentNormal = normalize(in_TBN * normalDisplacement); // convert the normal to tangent space and normalize it
 
@@ -519,7 +519,7 @@ vec3 calculateSpotLightContribution(
 vec3 calculateEmissiveColorContribution() {
     vec3 emissiveColor = texture(
         sampler2D(textureArray[material.emissionTextureMasterIndex], rgbaTextureSampler),
-        in_emissionTextureCoordinate
+        in_textureCoordinate
     ).rgb;
 
     return vec3(
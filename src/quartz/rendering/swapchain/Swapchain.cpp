@@ -1,5 +1,5 @@
+#include <cstring>
 #include <set>
-#include <queue>
 #include <vector>
 
 #include <vulkan/vulkan.hpp>
@@ -9,7 +9,12 @@
 
 #include "math/transform/Mat4.hpp"
 
+#include "quartz/rendering/buffer/LocallyMappedBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/model/DrawPacket.hpp"
+#include "quartz/rendering/model/InstanceData.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
 #include "quartz/rendering/swapchain/Swapchain.hpp"
 #include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
 #include "quartz/rendering/window/Window.hpp"
@@ -91,7 +96,8 @@ quartz::rendering::Swapchain::createVulkanSwapchainImageViewUniquePtrs(
                 surfaceFormat.format,
                 components,
                 vk::ImageAspectFlagBits::eColor,
-                vk::ImageViewType::e2D
+                vk::ImageViewType::e2D,
+                1
             )
         );
     }
@@ -572,57 +578,55 @@ quartz::rendering::Swapchain::recordSkyBoxToDrawingCommandBuffer(
     );
 }
 
-void
-quartz::rendering::Swapchain::recordDoodadToDrawingCommandBuffer(
-    const quartz::rendering::Device& renderingDevice,
+quartz::rendering::RenderQueue::Statistics
+quartz::rendering::Swapchain::recordRenderQueueToDrawingCommandBuffer(
     const quartz::rendering::Pipeline& doodadRenderingPipeline,
-    const quartz::scene::Doodad& doodad,
+    const quartz::rendering::RenderQueue& renderQueue,
+    const quartz::rendering::LocallyMappedBuffer& instanceBuffer,
     const uint32_t inFlightFrameIndex
 ) {
-    if (!doodad.getModelOptional()) {
-        return;
-    }
+    quartz::rendering::RenderQueue::Statistics statistics;
 
-    const uint32_t minUniformBufferOffsetAlignment = renderingDevice.getVulkanPhysicalDevice().getProperties().limits.minUniformBufferOffsetAlignment;
+    if (renderQueue.getItems().empty()) {
+        return statistics;
+    }
 
-    std::queue<std::shared_ptr<quartz::rendering::Node>> nodeQueue(
-        std::deque(
-            doodad.getModelOptional()->getDefaultScene().getRootNodePtrs().begin(),
-            doodad.getModelOptional()->getDefaultScene().getRootNodePtrs().end()
-        )
+    // Each instance's model matrix comes from the instance buffer, so we only need to bind it once for all primitives
+    const vk::DeviceSize instanceBufferOffset = 0;
+    m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindVertexBuffers(
+        quartz::rendering::InstanceData::bindingIndex,
+        *(instanceBuffer.getVulkanLogicalBufferPtr()),
+        instanceBufferOffset
     );
 
-    while (!nodeQueue.empty()) {
-        const std::shared_ptr<quartz::rendering::Node>& p_node = nodeQueue.front();
-        nodeQueue.pop();
-
-        for (const std::shared_ptr<quartz::rendering::Node>& p_child : p_node->getChildrenNodePtrs()) {
-            nodeQueue.push(p_child);
-        }
+    const quartz::rendering::PushConstantInfo& transformMatrixPushConstantInfo = doodadRenderingPipeline.getPushConstantInfos()[0];
+    const quartz::rendering::PushConstantInfo& dummyPushConstantInfo = doodadRenderingPipeline.getPushConstantInfos()[1];
 
-        if (!p_node->getMeshPtr()) {
-            continue;
-        }
+    // The queue is sorted so packets sharing state are adjacent, we only record state that differs from the previous packet
+    const quartz::rendering::DrawPacket* p_previousDrawPacket = nullptr;
 
-        math::Mat4 currentTransformationMatrix = doodad.getTransformationMatrix() * p_node->getTransformationMatrix();
-        const quartz::rendering::PushConstantInfo& transformMatrixPushConstantInfo = doodadRenderingPipeline.getPushConstantInfos()[0];
-        m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->pushConstants(
-            *doodadRenderingPipeline.getVulkanPipelineLayoutPtr(),
-            transformMatrixPushConstantInfo.getVulkanShaderStageFlags(),
-            transformMatrixPushConstantInfo.getOffset(),
-            transformMatrixPushConstantInfo.getSize(),
-            reinterpret_cast<void*>(&currentTransformationMatrix)
-        );
+    for (const quartz::rendering::RenderQueue::Item& item : renderQueue.getItems()) {
+        const quartz::rendering::DrawPacket& drawPacket = *(item.p_drawPacket);
 
-        for (const quartz::rendering::Primitive& primitive : p_node->getMeshPtr()->getPrimitives()) {
-            /** @brief This is the offset into the dynamic uniform buffer */
-            uint32_t materialMasterIndex = primitive.getMaterialMasterIndex();
-            uint32_t materialByteOffset = minUniformBufferOffsetAlignment > 0 ?
-                (sizeof(quartz::rendering::Material::UniformBufferObject) + minUniformBufferOffsetAlignment - 1) & ~(minUniformBufferOffsetAlignment - 1) :
-                sizeof(quartz::rendering::Material::UniformBufferObject);
-            materialByteOffset *= materialMasterIndex;
+        // The node's transform within the model is shared by all instances, the instance's transform is applied in the shader
+        if (
+            !p_previousDrawPacket ||
+            memcmp(&(p_previousDrawPacket->nodeTransformationMatrix), &(drawPacket.nodeTransformationMatrix), sizeof(math::Mat4)) != 0
+        ) {
+            m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->pushConstants(
+                *doodadRenderingPipeline.getVulkanPipelineLayoutPtr(),
+                transformMatrixPushConstantInfo.getVulkanShaderStageFlags(),
+                transformMatrixPushConstantInfo.getOffset(),
+                transformMatrixPushConstantInfo.getSize(),
+                &(drawPacket.nodeTransformationMatrix)
+            );
+            statistics.pushConstantCount++;
+        } else {
+            statistics.pushConstantsAvoided++;
+        }
 
-            // Bind the descriptor set
+        if (!p_previousDrawPacket || p_previousDrawPacket->materialByteOffset != drawPacket.materialByteOffset) {
+            // Bind the descriptor set, offsetting into the dynamic uniform buffer for this primitive's material
             m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindDescriptorSets(
                 vk::PipelineBindPoint::eGraphics,
                 *doodadRenderingPipeline.getVulkanPipelineLayoutPtr(),
@@ -630,44 +634,68 @@ quartz::rendering::Swapchain::recordDoodadToDrawingCommandBuffer(
                 1,
                 &(doodadRenderingPipeline.getVulkanDescriptorSets()[inFlightFrameIndex]),
                 1,
-                &materialByteOffset
+                &(drawPacket.materialByteOffset)
             );
+            statistics.descriptorSetBindCount++;
 
             /** @brief 2024/05/16 This isn't actually used for anything and is just here as an example of using a push constant in the fragment shader */
-            const quartz::rendering::PushConstantInfo& dummyPushConstantInfo = doodadRenderingPipeline.getPushConstantInfos()[1];
             m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->pushConstants(
                 *doodadRenderingPipeline.getVulkanPipelineLayoutPtr(),
                 dummyPushConstantInfo.getVulkanShaderStageFlags(),
                 dummyPushConstantInfo.getOffset(),
                 dummyPushConstantInfo.getSize(),
-                reinterpret_cast<void*>(&materialMasterIndex)
+                &(drawPacket.materialMasterIndex)
             );
+            statistics.pushConstantCount++;
+        } else {
+            statistics.descriptorSetBindsAvoided++;
+            statistics.pushConstantsAvoided++;
+        }
 
-            // Bind the vertex buffer
-            uint32_t offset = 0;
+        // Bind the position and attribute streams. They always come from the same primitive, so we only need to compare one
+        if (!p_previousDrawPacket || p_previousDrawPacket->vulkanPositionBuffer != drawPacket.vulkanPositionBuffer) {
+            const vk::DeviceSize vertexBufferOffset = 0;
             m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindVertexBuffers(
-                0,
-                *(primitive.getStagedVertexBuffer().getVulkanLogicalBufferPtr()),
-                offset
+                quartz::rendering::Vertex::positionBindingIndex,
+                drawPacket.vulkanPositionBuffer,
+                vertexBufferOffset
             );
-
-            // Index buffer
-            m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindIndexBuffer(
-                *(primitive.getStagedIndexBuffer().getVulkanLogicalBufferPtr()),
-                0,
-                vk::IndexType::eUint32
+            m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindVertexBuffers(
+                quartz::rendering::Vertex::attributeBindingIndex,
+                drawPacket.vulkanAttributeBuffer,
+                vertexBufferOffset
             );
+            statistics.vertexBufferBindCount++;
+        } else {
+            statistics.vertexBufferBindsAvoided++;
+        }
 
-            // Draw using the vertex and index buffer
-            m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->drawIndexed(
-                primitive.getIndexCount(),
-                1,
-                0,
+        // Index buffer
+        if (!p_previousDrawPacket || p_previousDrawPacket->vulkanIndexBuffer != drawPacket.vulkanIndexBuffer) {
+            m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->bindIndexBuffer(
+                drawPacket.vulkanIndexBuffer,
                 0,
-                0
+                drawPacket.indexType
             );
+            statistics.indexBufferBindCount++;
+        } else {
+            statistics.indexBufferBindsAvoided++;
         }
+
+        // Draw every instance using the vertex and index buffer
+        m_vulkanDrawingCommandBufferPtrs[inFlightFrameIndex]->drawIndexed(
+            drawPacket.indexCount,
+            item.instanceCount,
+            0,
+            0,
+            item.firstInstance
+        );
+        statistics.drawCount++;
+
+        p_previousDrawPacket = &drawPacket;
     }
+
+    return statistics;
 }
 
 void
@@ -7,12 +7,13 @@
 #include "math/transform/Vec3.hpp"
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/LocallyMappedBuffer.hpp"
 #include "quartz/rendering/depth_buffer/DepthBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/model/Model.hpp"
 #include "quartz/rendering/pipeline/Pipeline.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
 #include "quartz/rendering/window/Window.hpp"
-#include "quartz/scene/doodad/Doodad.hpp"
 #include "quartz/scene/sky_box/SkyBox.hpp"
 
 namespace quartz {
@@ -73,10 +74,10 @@ public: // member functions
         const quartz::scene::SkyBox& skyBox,
         const uint32_t inFlightFrameIndex
     );
-    void recordDoodadToDrawingCommandBuffer(
-        const quartz::rendering::Device& renderingDevice,
+    quartz::rendering::RenderQueue::Statistics recordRenderQueueToDrawingCommandBuffer(
         const quartz::rendering::Pipeline& doodadRenderingPipeline,
-        const quartz::scene::Doodad& doodad,
+        const quartz::rendering::RenderQueue& renderQueue,
+        const quartz::rendering::LocallyMappedBuffer& instanceBuffer,
         const uint32_t inFlightFrameIndex
     );
     void endAndSubmitDrawingCommandBuffer(
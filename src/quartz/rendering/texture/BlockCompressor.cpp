@@ -0,0 +1,530 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/texture/BlockCompressor.hpp"
+
+uint32_t
+quartz::rendering::BlockCompressor::getBlockSizeBytes(
+    const vk::Format format
+) {
+    switch (format) {
+        case vk::Format::eBc1RgbUnormBlock:
+        case vk::Format::eBc1RgbSrgbBlock:
+        case vk::Format::eBc1RgbaUnormBlock:
+        case vk::Format::eBc1RgbaSrgbBlock:
+        case vk::Format::eBc4UnormBlock:
+            return 8;
+        case vk::Format::eBc3UnormBlock:
+        case vk::Format::eBc3SrgbBlock:
+        case vk::Format::eBc5UnormBlock:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+uint64_t
+quartz::rendering::BlockCompressor::getCompressedSizeBytes(
+    const vk::Format format,
+    const uint32_t width,
+    const uint32_t height
+) {
+    const uint64_t blockCount = static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+
+    return blockCount * quartz::rendering::BlockCompressor::getBlockSizeBytes(format);
+}
+
+uint16_t
+quartz::rendering::BlockCompressor::packRGB565(
+    const float* p_color
+) {
+    const uint32_t red = static_cast<uint32_t>(std::clamp(p_color[0] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f));
+    const uint32_t green = static_cast<uint32_t>(std::clamp(p_color[1] * (63.0f / 255.0f) + 0.5f, 0.0f, 63.0f));
+    const uint32_t blue = static_cast<uint32_t>(std::clamp(p_color[2] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f));
+
+    return static_cast<uint16_t>((red << 11) | (green << 5) | blue);
+}
+
+void
+quartz::rendering::BlockCompressor::unpackRGB565(
+    const uint16_t packedColor,
+    uint8_t* p_color
+) {
+    const uint32_t red = (packedColor >> 11) & 0x1F;
+    const uint32_t green = (packedColor >> 5) & 0x3F;
+    const uint32_t blue = packedColor & 0x1F;
+
+    // Replicating the high bits into the low bits maps the largest value to 255 exactly
+    p_color[0] = static_cast<uint8_t>((red << 3) | (red >> 2));
+    p_color[1] = static_cast<uint8_t>((green << 2) | (green >> 4));
+    p_color[2] = static_cast<uint8_t>((blue << 3) | (blue >> 2));
+}
+
+void
+quartz::rendering::BlockCompressor::loadBlock(
+    const uint8_t* p_rgbaPixels,
+    const uint32_t width,
+    const uint32_t height,
+    const uint32_t blockX,
+    const uint32_t blockY,
+    uint8_t* p_texels
+) {
+    for (uint32_t y = 0; y < 4; ++y) {
+        const uint32_t pixelY = std::min(blockY * 4 + y, height - 1);
+
+        for (uint32_t x = 0; x < 4; ++x) {
+            const uint32_t pixelX = std::min(blockX * 4 + x, width - 1);
+            std::memcpy(p_texels + (y * 4 + x) * 4, p_rgbaPixels + (static_cast<size_t>(pixelY) * width + pixelX) * 4, 4);
+        }
+    }
+}
+
+void
+quartz::rendering::BlockCompressor::storeBlock(
+    const uint8_t* p_texels,
+    const uint32_t width,
+    const uint32_t height,
+    const uint32_t blockX,
+    const uint32_t blockY,
+    uint8_t* p_rgbaPixels
+) {
+    for (uint32_t y = 0; y < 4 && blockY * 4 + y < height; ++y) {
+        for (uint32_t x = 0; x < 4 && blockX * 4 + x < width; ++x) {
+            const size_t pixelIndex = static_cast<size_t>(blockY * 4 + y) * width + blockX * 4 + x;
+            std::memcpy(p_rgbaPixels + pixelIndex * 4, p_texels + (y * 4 + x) * 4, 4);
+        }
+    }
+}
+
+void
+quartz::rendering::BlockCompressor::encodeColorBlock(
+    const uint8_t* p_texels,
+    uint8_t* p_block
+) {
+    std::array<float, 3> mean = {0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < 16; ++i) {
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            mean[channel] += p_texels[i * 4 + channel] / 16.0f;
+        }
+    }
+
+    // rr , rg , rb , gg , gb , bb
+    std::array<float, 6> covariance = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+    for (uint32_t i = 0; i < 16; ++i) {
+        const float red = p_texels[i * 4 + 0] - mean[0];
+        const float green = p_texels[i * 4 + 1] - mean[1];
+        const float blue = p_texels[i * 4 + 2] - mean[2];
+
+        covariance[0] += red * red;
+        covariance[1] += red * green;
+        covariance[2] += red * blue;
+        covariance[3] += green * green;
+        covariance[4] += green * blue;
+        covariance[5] += blue * blue;
+    }
+
+    /**
+     * @brief Power iteration for the principal axis, starting from the column of the channel which
+     *   varies the most so we can't start out perpendicular to the axis we are looking for
+     */
+    std::array<float, 3> axis =
+        covariance[0] >= covariance[3] && covariance[0] >= covariance[5] ? std::array<float, 3>{covariance[0], covariance[1], covariance[2]} :
+        covariance[3] >= covariance[5] ? std::array<float, 3>{covariance[1], covariance[3], covariance[4]} :
+        std::array<float, 3>{covariance[2], covariance[4], covariance[5]};
+
+    for (uint32_t iteration = 0; iteration < 8; ++iteration) {
+        const std::array<float, 3> nextAxis = {
+            covariance[0] * axis[0] + covariance[1] * axis[1] + covariance[2] * axis[2],
+            covariance[1] * axis[0] + covariance[3] * axis[1] + covariance[4] * axis[2],
+            covariance[2] * axis[0] + covariance[4] * axis[1] + covariance[5] * axis[2]
+        };
+
+        const float largestComponent = std::max({std::abs(nextAxis[0]), std::abs(nextAxis[1]), std::abs(nextAxis[2])});
+        if (largestComponent < 1e-6f) {
+            break;
+        }
+
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            axis[channel] = nextAxis[channel] / largestComponent;
+        }
+    }
+
+    const float axisLength = std::sqrt(axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2]);
+    float minimumProjection = 0.0f;
+    float maximumProjection = 0.0f;
+
+    if (axisLength > 1e-6f) {
+        minimumProjection = std::numeric_limits<float>::max();
+        maximumProjection = std::numeric_limits<float>::lowest();
+
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            axis[channel] /= axisLength;
+        }
+
+        for (uint32_t i = 0; i < 16; ++i) {
+            const float projection =
+                (p_texels[i * 4 + 0] - mean[0]) * axis[0] +
+                (p_texels[i * 4 + 1] - mean[1]) * axis[1] +
+                (p_texels[i * 4 + 2] - mean[2]) * axis[2];
+
+            minimumProjection = std::min(minimumProjection, projection);
+            maximumProjection = std::max(maximumProjection, projection);
+        }
+    }
+
+    std::array<float, 3> maximumEndpoint;
+    std::array<float, 3> minimumEndpoint;
+    for (uint32_t channel = 0; channel < 3; ++channel) {
+        maximumEndpoint[channel] = mean[channel] + axis[channel] * maximumProjection;
+        minimumEndpoint[channel] = mean[channel] + axis[channel] * minimumProjection;
+    }
+
+    uint16_t color0 = quartz::rendering::BlockCompressor::packRGB565(maximumEndpoint.data());
+    uint16_t color1 = quartz::rendering::BlockCompressor::packRGB565(minimumEndpoint.data());
+
+    // The first color has to be the larger one, otherwise bc1 decodes the block with 3 colors
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    std::memcpy(p_block, &color0, 2);
+    std::memcpy(p_block + 2, &color1, 2);
+
+    uint32_t indices = 0;
+
+    if (color0 != color1) {
+        std::array<std::array<uint8_t, 3>, 4> palette;
+        quartz::rendering::BlockCompressor::unpackRGB565(color0, palette[0].data());
+        quartz::rendering::BlockCompressor::unpackRGB565(color1, palette[1].data());
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            palette[2][channel] = static_cast<uint8_t>((2 * palette[0][channel] + palette[1][channel]) / 3);
+            palette[3][channel] = static_cast<uint8_t>((palette[0][channel] + 2 * palette[1][channel]) / 3);
+        }
+
+        for (uint32_t i = 0; i < 16; ++i) {
+            uint32_t bestIndex = 0;
+            int32_t bestDistance = std::numeric_limits<int32_t>::max();
+
+            for (uint32_t j = 0; j < 4; ++j) {
+                int32_t distance = 0;
+                for (uint32_t channel = 0; channel < 3; ++channel) {
+                    const int32_t difference = static_cast<int32_t>(p_texels[i * 4 + channel]) - palette[j][channel];
+                    distance += difference * difference;
+                }
+
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = j;
+                }
+            }
+
+            indices |= bestIndex << (2 * i);
+        }
+    }
+
+    // When both colors are the same every texel uses the first one, which is what 0 gives us
+    std::memcpy(p_block + 4, &indices, 4);
+}
+
+void
+quartz::rendering::BlockCompressor::encodeSingleChannelBlock(
+    const uint8_t* p_texels,
+    const uint32_t channel,
+    uint8_t* p_block
+) {
+    uint8_t minimumValue = 255;
+    uint8_t maximumValue = 0;
+    for (uint32_t i = 0; i < 16; ++i) {
+        minimumValue = std::min(minimumValue, p_texels[i * 4 + channel]);
+        maximumValue = std::max(maximumValue, p_texels[i * 4 + channel]);
+    }
+
+    // Putting the larger value first gives us the 8 value palette
+    p_block[0] = maximumValue;
+    p_block[1] = minimumValue;
+
+    uint64_t indices = 0;
+
+    if (maximumValue != minimumValue) {
+        std::array<int32_t, 8> palette;
+        palette[0] = maximumValue;
+        palette[1] = minimumValue;
+        for (uint32_t j = 2; j < 8; ++j) {
+            palette[j] = ((8 - j) * maximumValue + (j - 1) * minimumValue + 3) / 7;
+        }
+
+        for (uint32_t i = 0; i < 16; ++i) {
+            uint64_t bestIndex = 0;
+            int32_t bestDistance = std::numeric_limits<int32_t>::max();
+
+            for (uint32_t j = 0; j < 8; ++j) {
+                const int32_t distance = std::abs(static_cast<int32_t>(p_texels[i * 4 + channel]) - palette[j]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = j;
+                }
+            }
+
+            indices |= bestIndex << (3 * i);
+        }
+    }
+
+    // 16 indices of 3 bits each, packed little endian into the last 6 bytes
+    for (uint32_t i = 0; i < 6; ++i) {
+        p_block[2 + i] = static_cast<uint8_t>(indices >> (8 * i));
+    }
+}
+
+void
+quartz::rendering::BlockCompressor::decodeColorBlock(
+    const uint8_t* p_block,
+    const bool isFourColorOnly,
+    const bool hasPunchThroughAlpha,
+    uint8_t* p_texels
+) {
+    uint16_t color0;
+    uint16_t color1;
+    uint32_t indices;
+    std::memcpy(&color0, p_block, 2);
+    std::memcpy(&color1, p_block + 2, 2);
+    std::memcpy(&indices, p_block + 4, 4);
+
+    std::array<std::array<uint8_t, 4>, 4> palette;
+    quartz::rendering::BlockCompressor::unpackRGB565(color0, palette[0].data());
+    quartz::rendering::BlockCompressor::unpackRGB565(color1, palette[1].data());
+    palette[0][3] = 255;
+    palette[1][3] = 255;
+    palette[2][3] = 255;
+    palette[3][3] = 255;
+
+    if (isFourColorOnly || color0 > color1) {
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            palette[2][channel] = static_cast<uint8_t>((2 * palette[0][channel] + palette[1][channel]) / 3);
+            palette[3][channel] = static_cast<uint8_t>((palette[0][channel] + 2 * palette[1][channel]) / 3);
+        }
+    } else {
+        for (uint32_t channel = 0; channel < 3; ++channel) {
+            palette[2][channel] = static_cast<uint8_t>((palette[0][channel] + palette[1][channel]) / 2);
+            palette[3][channel] = 0;
+        }
+        palette[3][3] = hasPunchThroughAlpha ? 0 : 255;
+    }
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        std::memcpy(p_texels + i * 4, palette[(indices >> (2 * i)) & 0x3].data(), 4);
+    }
+}
+
+void
+quartz::rendering::BlockCompressor::decodeSingleChannelBlock(
+    const uint8_t* p_block,
+    const uint32_t channel,
+    uint8_t* p_texels
+) {
+    const int32_t value0 = p_block[0];
+    const int32_t value1 = p_block[1];
+
+    std::array<int32_t, 8> palette;
+    palette[0] = value0;
+    palette[1] = value1;
+
+    if (value0 > value1) {
+        for (uint32_t j = 2; j < 8; ++j) {
+            palette[j] = ((8 - j) * value0 + (j - 1) * value1 + 3) / 7;
+        }
+    } else {
+        for (uint32_t j = 2; j < 6; ++j) {
+            palette[j] = ((6 - j) * value0 + (j - 1) * value1 + 2) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    uint64_t indices = 0;
+    for (uint32_t i = 0; i < 6; ++i) {
+        indices |= static_cast<uint64_t>(p_block[2 + i]) << (8 * i);
+    }
+
+    for (uint32_t i = 0; i < 16; ++i) {
+        p_texels[i * 4 + channel] = static_cast<uint8_t>(palette[(indices >> (3 * i)) & 0x7]);
+    }
+}
+
+void
+quartz::rendering::BlockCompressor::compressBlockRows(
+    const vk::Format format,
+    const uint8_t* p_rgbaPixels,
+    const uint32_t width,
+    const uint32_t height,
+    const uint32_t firstBlockRow,
+    const uint32_t blockRowCount,
+    uint8_t* p_blocks
+) {
+    const uint32_t blockSizeBytes = quartz::rendering::BlockCompressor::getBlockSizeBytes(format);
+    const uint32_t blocksWide = (width + 3) / 4;
+    std::array<uint8_t, 64> texels;
+
+    for (uint32_t blockY = firstBlockRow; blockY < firstBlockRow + blockRowCount; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+            uint8_t* p_block = p_blocks + (static_cast<size_t>(blockY) * blocksWide + blockX) * blockSizeBytes;
+            quartz::rendering::BlockCompressor::loadBlock(p_rgbaPixels, width, height, blockX, blockY, texels.data());
+
+            switch (format) {
+                case vk::Format::eBc3UnormBlock:
+                case vk::Format::eBc3SrgbBlock:
+                    quartz::rendering::BlockCompressor::encodeSingleChannelBlock(texels.data(), 3, p_block);
+                    quartz::rendering::BlockCompressor::encodeColorBlock(texels.data(), p_block + 8);
+                    break;
+                case vk::Format::eBc4UnormBlock:
+                    quartz::rendering::BlockCompressor::encodeSingleChannelBlock(texels.data(), 0, p_block);
+                    break;
+                case vk::Format::eBc5UnormBlock:
+                    quartz::rendering::BlockCompressor::encodeSingleChannelBlock(texels.data(), 0, p_block);
+                    quartz::rendering::BlockCompressor::encodeSingleChannelBlock(texels.data(), 1, p_block + 8);
+                    break;
+                default:
+                    quartz::rendering::BlockCompressor::encodeColorBlock(texels.data(), p_block);
+                    break;
+            }
+        }
+    }
+}
+
+std::vector<uint8_t>
+quartz::rendering::BlockCompressor::compress(
+    const vk::Format format,
+    const uint8_t* p_rgbaPixels,
+    const uint32_t width,
+    const uint32_t height
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_COMPRESSION, "{}x{} to {}", width, height, vk::to_string(format));
+
+    if (quartz::rendering::BlockCompressor::getBlockSizeBytes(format) == 0) {
+        LOG_THROW(TEXTURE_COMPRESSION, util::StringException, vk::to_string(format), "We can't compress to {}", vk::to_string(format));
+    }
+
+    if (width == 0 || height == 0) {
+        LOG_THROW(TEXTURE_COMPRESSION, util::StringException, vk::to_string(format), "Can't compress a {}x{} image", width, height);
+    }
+
+    std::vector<uint8_t> blocks(quartz::rendering::BlockCompressor::getCompressedSizeBytes(format, width, height));
+
+    /**
+     * @brief Small images aren't worth handing out, so they are compressed right here. Large ones are
+     *   split into bands of block rows, which are independent of each other
+     */
+    const uint32_t blocksWide = (width + 3) / 4;
+    const uint32_t blocksHigh = (height + 3) / 4;
+    const uint32_t minimumBandBlockRowCount = std::max<uint32_t>(4096 / blocksWide, 1);
+    util::ThreadPool& threadPool = util::ThreadPool::getSharedPool();
+    const uint32_t bandCount = std::min(blocksHigh / minimumBandBlockRowCount, threadPool.getThreadCount() + 1);
+    LOG_TRACE(TEXTURE_COMPRESSION, "Compressing {}x{} blocks in {} bands", blocksWide, blocksHigh, std::max<uint32_t>(bandCount, 1));
+
+    if (bandCount <= 1) {
+        quartz::rendering::BlockCompressor::compressBlockRows(format, p_rgbaPixels, width, height, 0, blocksHigh, blocks.data());
+        return blocks;
+    }
+
+    const uint32_t bandBlockRowCount = (blocksHigh + bandCount - 1) / bandCount;
+    std::vector<std::future<void>> bandFutures;
+    bandFutures.reserve(bandCount);
+
+    for (uint32_t firstBlockRow = 0; firstBlockRow < blocksHigh; firstBlockRow += bandBlockRowCount) {
+        const uint32_t blockRowCount = std::min(bandBlockRowCount, blocksHigh - firstBlockRow);
+        uint8_t* p_blocks = blocks.data();
+
+        bandFutures.push_back(
+            threadPool.submit(
+                [=]() {
+                    quartz::rendering::BlockCompressor::compressBlockRows(
+                        format,
+                        p_rgbaPixels,
+                        width,
+                        height,
+                        firstBlockRow,
+                        blockRowCount,
+                        p_blocks
+                    );
+                }
+            )
+        );
+    }
+
+    for (std::future<void>& bandFuture : bandFutures) {
+        bandFuture.get();
+    }
+
+    return blocks;
+}
+
+std::vector<uint8_t>
+quartz::rendering::BlockCompressor::decompress(
+    const vk::Format format,
+    const uint8_t* p_blocks,
+    const uint32_t width,
+    const uint32_t height
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_COMPRESSION, "{}x{} from {}", width, height, vk::to_string(format));
+
+    const uint32_t blockSizeBytes = quartz::rendering::BlockCompressor::getBlockSizeBytes(format);
+    if (blockSizeBytes == 0) {
+        LOG_THROW(TEXTURE_COMPRESSION, util::StringException, vk::to_string(format), "We can't decompress {}", vk::to_string(format));
+    }
+
+    const uint32_t blocksWide = (width + 3) / 4;
+    const uint32_t blocksHigh = (height + 3) / 4;
+    std::vector<uint8_t> rgbaPixels(static_cast<size_t>(width) * height * 4);
+
+    for (uint32_t blockY = 0; blockY < blocksHigh; ++blockY) {
+        for (uint32_t blockX = 0; blockX < blocksWide; ++blockX) {
+            const uint8_t* p_block = p_blocks + (static_cast<size_t>(blockY) * blocksWide + blockX) * blockSizeBytes;
+
+            // Whatever the format doesn't store reads back as zero, with opaque alpha
+            std::array<uint8_t, 64> texels;
+            for (uint32_t i = 0; i < 16; ++i) {
+                texels[i * 4 + 0] = 0;
+                texels[i * 4 + 1] = 0;
+                texels[i * 4 + 2] = 0;
+                texels[i * 4 + 3] = 255;
+            }
+
+            switch (format) {
+                case vk::Format::eBc1RgbaUnormBlock:
+                case vk::Format::eBc1RgbaSrgbBlock:
+                    quartz::rendering::BlockCompressor::decodeColorBlock(p_block, false, true, texels.data());
+                    break;
+                case vk::Format::eBc3UnormBlock:
+                case vk::Format::eBc3SrgbBlock:
+                    quartz::rendering::BlockCompressor::decodeColorBlock(p_block + 8, true, false, texels.data());
+                    quartz::rendering::BlockCompressor::decodeSingleChannelBlock(p_block, 3, texels.data());
+                    break;
+                case vk::Format::eBc4UnormBlock:
+                    quartz::rendering::BlockCompressor::decodeSingleChannelBlock(p_block, 0, texels.data());
+                    break;
+                case vk::Format::eBc5UnormBlock:
+                    quartz::rendering::BlockCompressor::decodeSingleChannelBlock(p_block, 0, texels.data());
+                    quartz::rendering::BlockCompressor::decodeSingleChannelBlock(p_block + 8, 1, texels.data());
+                    break;
+                default:
+                    quartz::rendering::BlockCompressor::decodeColorBlock(p_block, false, false, texels.data());
+                    break;
+            }
+
+            quartz::rendering::BlockCompressor::storeBlock(texels.data(), width, height, blockX, blockY, rgbaPixels.data());
+        }
+    }
+
+    return rgbaPixels;
+}
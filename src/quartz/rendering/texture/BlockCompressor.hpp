@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+
+namespace quartz {
+namespace rendering {
+    class BlockCompressor;
+}
+}
+
+/**
+ * @brief Compresses rgba8 pixels into the bc formats we cook textures into, and decompresses them
+ *   again for devices which can't sample them. Each 4x4 block is independent, so rows of blocks are
+ *   spread across the shared thread pool.
+ *
+ * @brief Bc1 color endpoints are fit along the principal axis of the block's colors. Single channel
+ *   blocks (bc4, the alpha of bc3, and both channels of bc5) use the block's range as their endpoints.
+ *   This is nowhere near as thorough as a dedicated encoder, but it is fast and has no dependencies.
+ *
+ * @brief We don't encode or decode bc7, whose modes and partitions are far more involved. Bc7
+ *   textures can still be uploaded straight out of a ktx2 container made by another tool.
+ */
+class quartz::rendering::BlockCompressor {
+public: // member functions
+    BlockCompressor() = delete;
+
+public: // static functions
+    /**
+     * @brief 0 for formats we can't compress to or decompress from
+     */
+    static uint32_t getBlockSizeBytes(const vk::Format format);
+    static uint64_t getCompressedSizeBytes(
+        const vk::Format format,
+        const uint32_t width,
+        const uint32_t height
+    );
+
+    static std::vector<uint8_t> compress(
+        const vk::Format format,
+        const uint8_t* p_rgbaPixels,
+        const uint32_t width,
+        const uint32_t height
+    );
+    /**
+     * @brief Channels the format doesn't store come back the way the gpu would sample them, which is
+     *   zero for color and opaque for alpha
+     */
+    static std::vector<uint8_t> decompress(
+        const vk::Format format,
+        const uint8_t* p_blocks,
+        const uint32_t width,
+        const uint32_t height
+    );
+
+private: // static functions
+    /**
+     * @brief Copies the 4x4 block at the given block coordinates into p_texels as rgba, repeating the
+     *   last row and column for blocks hanging off the edge of the image
+     */
+    static void loadBlock(
+        const uint8_t* p_rgbaPixels,
+        const uint32_t width,
+        const uint32_t height,
+        const uint32_t blockX,
+        const uint32_t blockY,
+        uint8_t* p_texels
+    );
+    static void storeBlock(
+        const uint8_t* p_texels,
+        const uint32_t width,
+        const uint32_t height,
+        const uint32_t blockX,
+        const uint32_t blockY,
+        uint8_t* p_rgbaPixels
+    );
+
+    static void encodeColorBlock(
+        const uint8_t* p_texels,
+        uint8_t* p_block
+    );
+    static void encodeSingleChannelBlock(
+        const uint8_t* p_texels,
+        const uint32_t channel,
+        uint8_t* p_block
+    );
+    /**
+     * @brief Bc3 color blocks always have 4 colors. Bc1 blocks whose first color isn't the larger one
+     *   have 3, plus black, which is transparent for the bc1 formats with alpha
+     */
+    static void decodeColorBlock(
+        const uint8_t* p_block,
+        const bool isFourColorOnly,
+        const bool hasPunchThroughAlpha,
+        uint8_t* p_texels
+    );
+    static void decodeSingleChannelBlock(
+        const uint8_t* p_block,
+        const uint32_t channel,
+        uint8_t* p_texels
+    );
+
+    /**
+     * @brief Runs on a worker thread, so this must not log
+     */
+    static void compressBlockRows(
+        const vk::Format format,
+        const uint8_t* p_rgbaPixels,
+        const uint32_t width,
+        const uint32_t height,
+        const uint32_t firstBlockRow,
+        const uint32_t blockRowCount,
+        uint8_t* p_blocks
+    );
+
+    static uint16_t packRGB565(const float* p_color);
+    static void unpackRGB565(
+        const uint16_t packedColor,
+        uint8_t* p_color
+    );
+};
@@ -0,0 +1,166 @@
+#include <cstring>
+#include <future>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <stb_image.h>
+
+#include "util/macros.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/texture/GLTFImageLoader.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+
+quartz::rendering::GLTFImageLoader::DecodedImage
+quartz::rendering::GLTFImageLoader::decodeImage(
+    const std::vector<uint8_t>& encodedBytes
+) {
+    quartz::rendering::GLTFImageLoader::DecodedImage decodedImage = {};
+
+    // The container is parsed properly once it reaches Texture, all we need here is its size
+    if (quartz::rendering::KTX2Container::isKTX2(encodedBytes)) {
+        quartz::rendering::KTX2Container::Header header;
+        std::memcpy(&header, encodedBytes.data(), sizeof(header));
+
+        decodedImage.width = header.pixelWidth;
+        decodedImage.height = header.pixelHeight;
+        decodedImage.channelCount = 0;
+        decodedImage.isKTX2 = true;
+        decodedImage.pixels = encodedBytes;
+        return decodedImage;
+    }
+
+    int32_t fileChannelCount;
+    if (!stbi_info_from_memory(encodedBytes.data(), encodedBytes.size(), &decodedImage.width, &decodedImage.height, &fileChannelCount)) {
+        decodedImage.failureReason = stbi_failure_reason();
+        return decodedImage;
+    }
+
+    // Keep rgb as rgb so we don't expand it twice. See the class comment for why the others can't be
+    const int32_t desiredChannelCount = fileChannelCount == 3 ? STBI_rgb : STBI_rgb_alpha;
+
+    uint8_t* p_pixels = stbi_load_from_memory(
+        encodedBytes.data(),
+        encodedBytes.size(),
+        &decodedImage.width,
+        &decodedImage.height,
+        &fileChannelCount,
+        desiredChannelCount
+    );
+    if (!p_pixels) {
+        decodedImage.failureReason = stbi_failure_reason();
+        return decodedImage;
+    }
+
+    decodedImage.channelCount = desiredChannelCount;
+    decodedImage.pixels.assign(p_pixels, p_pixels + static_cast<size_t>(decodedImage.width) * decodedImage.height * desiredChannelCount);
+    stbi_image_free(p_pixels);
+
+    return decodedImage;
+}
+
+bool
+quartz::rendering::GLTFImageLoader::deferImageDecoding(
+    UNUSED tinygltf::Image* p_gltfImage,
+    const int imageIndex,
+    std::string* p_errorString,
+    UNUSED std::string* p_warningString,
+    UNUSED int requestedWidth,
+    UNUSED int requestedHeight,
+    const unsigned char* p_bytes,
+    int sizeBytes,
+    void* p_userData
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_LOADER, "image {}, {} bytes", imageIndex, sizeBytes);
+
+    quartz::rendering::GLTFImageLoader* p_imageLoader = static_cast<quartz::rendering::GLTFImageLoader*>(p_userData);
+
+    if (imageIndex < 0 || !p_bytes || sizeBytes <= 0) {
+        if (p_errorString) {
+            *p_errorString += "Image " + std::to_string(imageIndex) + " has no data to decode\n";
+        }
+        return false;
+    }
+
+    std::vector<uint8_t> encodedBytes(p_bytes, p_bytes + sizeBytes);
+
+    p_imageLoader->m_pendingImages[static_cast<uint32_t>(imageIndex)] = util::ThreadPool::getSharedPool().submit(
+        [encodedBytes = std::move(encodedBytes)]() {
+            return quartz::rendering::GLTFImageLoader::decodeImage(encodedBytes);
+        }
+    );
+
+    LOG_TRACE(TEXTURE_LOADER, "Queued image {} for decoding", imageIndex);
+
+    return true;
+}
+
+quartz::rendering::GLTFImageLoader::GLTFImageLoader(
+    tinygltf::TinyGLTF& gltfContext
+) :
+    m_pendingImages()
+{
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    gltfContext.SetImageLoader(
+        quartz::rendering::GLTFImageLoader::deferImageDecoding,
+        this
+    );
+}
+
+quartz::rendering::GLTFImageLoader::~GLTFImageLoader() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+
+    // The decoding tasks own their bytes, so anything still pending can be abandoned safely
+    if (!m_pendingImages.empty()) {
+        LOG_TRACEthis("Abandoning {} images which were never finished", m_pendingImages.size());
+    }
+}
+
+void
+quartz::rendering::GLTFImageLoader::finishDecoding(
+    tinygltf::Model& gltfModel
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} images", m_pendingImages.size());
+
+    std::map<uint32_t, std::future<quartz::rendering::GLTFImageLoader::DecodedImage>> pendingImages = std::move(m_pendingImages);
+    m_pendingImages.clear();
+
+    for (std::pair<const uint32_t, std::future<quartz::rendering::GLTFImageLoader::DecodedImage>>& pendingImage : pendingImages) {
+        const uint32_t imageIndex = pendingImage.first;
+        quartz::rendering::GLTFImageLoader::DecodedImage decodedImage = pendingImage.second.get();
+
+        if (imageIndex >= gltfModel.images.size()) {
+            LOG_THROW(TEXTURE_LOADER, util::RichException<uint32_t>, imageIndex, "Decoded image {}, but the model only has {} images", imageIndex, gltfModel.images.size());
+        }
+
+        tinygltf::Image& gltfImage = gltfModel.images[imageIndex];
+
+        if (!decodedImage.failureReason.empty()) {
+            LOG_THROW(TEXTURE_LOADER, util::RichException<tinygltf::Image>, gltfImage, "Failed to decode image {} \"{}\" ({})", imageIndex, gltfImage.name, decodedImage.failureReason);
+        }
+
+        if (decodedImage.isKTX2) {
+            LOG_TRACEthis("Kept image {} \"{}\" as a {}x{} ktx2 container", imageIndex, gltfImage.name, decodedImage.width, decodedImage.height);
+
+            gltfImage.width = decodedImage.width;
+            gltfImage.height = decodedImage.height;
+            gltfImage.component = 0;
+            gltfImage.mimeType = quartz::rendering::KTX2Container::mimeType;
+            gltfImage.image = std::move(decodedImage.pixels);
+            continue;
+        }
+
+        LOG_TRACEthis("Decoded image {} \"{}\" to {}x{} with {} channels", imageIndex, gltfImage.name, decodedImage.width, decodedImage.height, decodedImage.channelCount);
+
+        gltfImage.width = decodedImage.width;
+        gltfImage.height = decodedImage.height;
+        gltfImage.component = decodedImage.channelCount;
+        gltfImage.bits = 8;
+        gltfImage.pixel_type = TINYGLTF_COMPONENT_TYPE_UNSIGNED_BYTE;
+        gltfImage.image = std::move(decodedImage.pixels);
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstdint>
+#include <future>
+#include <map>
+#include <string>
+#include <vector>
+
+#define TINYGLTF_NO_STB_IMAGE_WRITE
+#include <tiny_gltf.h>
+
+#include "quartz/rendering/Loggers.hpp"
+
+namespace quartz {
+namespace rendering {
+    class GLTFImageLoader;
+}
+}
+
+/**
+ * @brief Takes over tinygltf's image loading so that images are decoded in parallel on the shared
+ *   thread pool instead of one after another while tinygltf parses. Tinygltf hands us each image's
+ *   encoded bytes, which we copy and queue up for decoding before returning so it can move on to the
+ *   next one. Once tinygltf is done parsing, finishDecoding waits for all of the images and puts
+ *   their pixels into the model.
+ *
+ * @brief Rgb and rgba images are kept as they are and expanded to rgba on their way into staging
+ *   memory. Everything else (grey, grey alpha) is decoded straight to rgba, because expanding them
+ *   the same way rgb is expanded would put the grey in the red channel only.
+ *
+ * @brief Ktx2 images (from KHR_texture_basisu) aren't decoded at all. Their container bytes are
+ *   kept as the image and the image's mime type is set so Texture knows to upload the levels inside.
+ */
+class quartz::rendering::GLTFImageLoader {
+public: // member functions
+    GLTFImageLoader(tinygltf::TinyGLTF& gltfContext);
+    GLTFImageLoader(const GLTFImageLoader& other) = delete;
+    ~GLTFImageLoader();
+
+    GLTFImageLoader& operator=(const GLTFImageLoader& other) = delete;
+
+    USE_LOGGER(TEXTURE_LOADER);
+
+    uint32_t getPendingImageCount() const { return m_pendingImages.size(); }
+
+    /**
+     * @brief Blocks until every image tinygltf gave us is decoded. Throws if any of them failed
+     */
+    void finishDecoding(tinygltf::Model& gltfModel);
+
+private: // classes
+    struct DecodedImage {
+    public: // member variables
+        int32_t width;
+        int32_t height;
+        int32_t channelCount;
+        bool isKTX2; // pixels are the whole container if so
+        std::vector<uint8_t> pixels;
+        std::string failureReason; // empty if the image decoded successfully
+    };
+
+private: // static functions
+    /**
+     * @brief Matches tinygltf::LoadImageDataFunction. The bytes are only valid for the duration of
+     *   the call and the image may be a temporary, so we hold on to the index instead of the image
+     */
+    static bool deferImageDecoding(
+        tinygltf::Image* p_gltfImage,
+        const int imageIndex,
+        std::string* p_errorString,
+        std::string* p_warningString,
+        int requestedWidth,
+        int requestedHeight,
+        const unsigned char* p_bytes,
+        int sizeBytes,
+        void* p_userData
+    );
+
+    /**
+     * @brief Runs on a worker thread, so this must not log
+     */
+    static quartz::rendering::GLTFImageLoader::DecodedImage decodeImage(
+        const std::vector<uint8_t>& encodedBytes
+    );
+
+private: // member variables
+    std::map<uint32_t, std::future<quartz::rendering::GLTFImageLoader::DecodedImage>> m_pendingImages;
+};
@@ -0,0 +1,406 @@
+#include <algorithm>
+#include <cstring>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+#include "util/file_system/FileSystem.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+
+bool
+quartz::rendering::KTX2Container::isKTX2(
+    const std::span<const uint8_t> bytes
+) {
+    return
+        bytes.size() >= sizeof(quartz::rendering::KTX2Container::Header) &&
+        std::memcmp(bytes.data(), quartz::rendering::KTX2Container::identifier, sizeof(quartz::rendering::KTX2Container::identifier)) == 0;
+}
+
+bool
+quartz::rendering::KTX2Container::isKTX2Filepath(
+    const std::string& filepath
+) {
+    return util::FileSystem::getFileExtension(filepath) == quartz::rendering::KTX2Container::fileExtension;
+}
+
+bool
+quartz::rendering::KTX2Container::requiresTranscoding(
+    const std::span<const uint8_t> bytes
+) {
+    quartz::rendering::KTX2Container::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    return header.supercompressionScheme != 0 || header.vulkanFormat == static_cast<uint32_t>(vk::Format::eUndefined);
+}
+
+uint64_t
+quartz::rendering::KTX2Container::calculateImageSizeBytes(
+    const vk::Format format,
+    const uint32_t width,
+    const uint32_t height
+) {
+    uint64_t blockSizeBytes = 0;
+    uint32_t blockExtent = 1;
+
+    switch (format) {
+        case vk::Format::eR8Unorm:
+        case vk::Format::eR8Srgb:
+            blockSizeBytes = 1;
+            break;
+        case vk::Format::eR8G8Unorm:
+        case vk::Format::eR8G8Srgb:
+        case vk::Format::eR16Unorm:
+        case vk::Format::eR16Sfloat:
+            blockSizeBytes = 2;
+            break;
+        case vk::Format::eR8G8B8Unorm:
+        case vk::Format::eR8G8B8Srgb:
+            blockSizeBytes = 3;
+            break;
+        case vk::Format::eR8G8B8A8Unorm:
+        case vk::Format::eR8G8B8A8Srgb:
+        case vk::Format::eB8G8R8A8Unorm:
+        case vk::Format::eB8G8R8A8Srgb:
+        case vk::Format::eA2B10G10R10UnormPack32:
+        case vk::Format::eB10G11R11UfloatPack32:
+        case vk::Format::eE5B9G9R9UfloatPack32:
+        case vk::Format::eR16G16Unorm:
+        case vk::Format::eR16G16Sfloat:
+        case vk::Format::eR32Sfloat:
+            blockSizeBytes = 4;
+            break;
+        case vk::Format::eR16G16B16A16Unorm:
+        case vk::Format::eR16G16B16A16Sfloat:
+        case vk::Format::eR32G32Sfloat:
+            blockSizeBytes = 8;
+            break;
+        case vk::Format::eR32G32B32A32Sfloat:
+            blockSizeBytes = 16;
+            break;
+        case vk::Format::eBc1RgbUnormBlock:
+        case vk::Format::eBc1RgbSrgbBlock:
+        case vk::Format::eBc1RgbaUnormBlock:
+        case vk::Format::eBc1RgbaSrgbBlock:
+        case vk::Format::eBc4UnormBlock:
+        case vk::Format::eBc4SnormBlock:
+            blockSizeBytes = 8;
+            blockExtent = 4;
+            break;
+        case vk::Format::eBc2UnormBlock:
+        case vk::Format::eBc2SrgbBlock:
+        case vk::Format::eBc3UnormBlock:
+        case vk::Format::eBc3SrgbBlock:
+        case vk::Format::eBc5UnormBlock:
+        case vk::Format::eBc5SnormBlock:
+        case vk::Format::eBc6HUfloatBlock:
+        case vk::Format::eBc6HSfloatBlock:
+        case vk::Format::eBc7UnormBlock:
+        case vk::Format::eBc7SrgbBlock:
+            blockSizeBytes = 16;
+            blockExtent = 4;
+            break;
+        default:
+            return 0;
+    }
+
+    const uint64_t blocksWide = (static_cast<uint64_t>(width) + blockExtent - 1) / blockExtent;
+    const uint64_t blocksHigh = (static_cast<uint64_t>(height) + blockExtent - 1) / blockExtent;
+
+    return blocksWide * blocksHigh * blockSizeBytes;
+}
+
+quartz::rendering::KTX2Container::Header
+quartz::rendering::KTX2Container::loadHeader(
+    const std::span<const uint8_t> bytes
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_KTX2, "{} bytes", bytes.size());
+
+    if (!quartz::rendering::KTX2Container::isKTX2(bytes)) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "{} bytes are not a ktx2 container", bytes.size());
+    }
+
+    quartz::rendering::KTX2Container::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    LOG_TRACE(TEXTURE_KTX2, "{}x{}x{} with {} layers, {} faces, and {} levels in vulkan format {}", header.pixelWidth, header.pixelHeight, header.pixelDepth, header.layerCount, header.faceCount, header.levelCount, header.vulkanFormat);
+
+    if (quartz::rendering::KTX2Container::requiresTranscoding(bytes)) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Ktx2 container uses supercompression scheme {} with vulkan format {}. Basis universal containers need to be transcoded, which we can't do. Encode it to a block compressed format without supercompression instead", header.supercompressionScheme, header.vulkanFormat);
+    }
+
+    if (header.pixelWidth == 0 || header.pixelHeight == 0 || header.faceCount == 0) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Ktx2 container is {}x{} pixels with {} faces", header.pixelWidth, header.pixelHeight, header.faceCount);
+    }
+
+    // Every level's size is checked against this, as readers copy and decompress levels at the size their dimensions call for
+    if (quartz::rendering::KTX2Container::calculateImageSizeBytes(static_cast<vk::Format>(header.vulkanFormat), 1, 1) == 0) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Ktx2 container uses {}, which we don't know the size of", vk::to_string(static_cast<vk::Format>(header.vulkanFormat)));
+    }
+
+    return header;
+}
+
+std::vector<quartz::rendering::KTX2Container::LevelIndexEntry>
+quartz::rendering::KTX2Container::loadLevelIndex(
+    const std::span<const uint8_t> bytes,
+    const quartz::rendering::KTX2Container::Header& header
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_KTX2, "{} levels", header.levelCount);
+
+    // A level count of 0 asks us to generate the mips, but the base level is still in the index
+    const uint32_t levelCount = std::max<uint32_t>(header.levelCount, 1);
+    const uint64_t levelIndexSizeBytes = static_cast<uint64_t>(levelCount) * sizeof(quartz::rendering::KTX2Container::LevelIndexEntry);
+
+    if (levelIndexSizeBytes > bytes.size() - sizeof(quartz::rendering::KTX2Container::Header)) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Level index for {} levels doesn't fit in a {} byte ktx2 container", levelCount, bytes.size());
+    }
+
+    std::vector<quartz::rendering::KTX2Container::LevelIndexEntry> levelIndex(levelCount);
+    std::memcpy(levelIndex.data(), bytes.data() + sizeof(quartz::rendering::KTX2Container::Header), levelIndexSizeBytes);
+
+    for (uint32_t i = 0; i < levelIndex.size(); ++i) {
+        const quartz::rendering::KTX2Container::LevelIndexEntry& entry = levelIndex[i];
+
+        if (entry.offset > bytes.size() || entry.sizeBytes > bytes.size() - entry.offset) {
+            LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Level {} is {} bytes at offset {}, which is past the end of the {} byte ktx2 container", i, entry.sizeBytes, entry.offset, bytes.size());
+        }
+
+        const uint64_t expectedSizeBytes =
+            quartz::rendering::KTX2Container::calculateImageSizeBytes(
+                static_cast<vk::Format>(header.vulkanFormat),
+                std::max<uint32_t>(header.pixelWidth >> i, 1),
+                std::max<uint32_t>(header.pixelHeight >> i, 1)
+            ) *
+            std::max<uint32_t>(header.pixelDepth >> i, 1) *
+            std::max<uint32_t>(header.layerCount, 1) *
+            header.faceCount;
+        if (entry.sizeBytes != expectedSizeBytes) {
+            LOG_THROW(TEXTURE_KTX2, util::RichException<uint64_t>, bytes.size(), "Level {} is {} bytes, but a {}x{} level of {} needs {}", i, entry.sizeBytes, std::max<uint32_t>(header.pixelWidth >> i, 1), std::max<uint32_t>(header.pixelHeight >> i, 1), vk::to_string(static_cast<vk::Format>(header.vulkanFormat)), expectedSizeBytes);
+        }
+
+        LOG_TRACE(TEXTURE_KTX2, "Level {} is {} bytes at offset {}", i, entry.sizeBytes, entry.offset);
+    }
+
+    return levelIndex;
+}
+
+std::vector<uint8_t>
+quartz::rendering::KTX2Container::createDataFormatDescriptor(
+    const vk::Format format
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_KTX2, "{}", vk::to_string(format));
+
+    struct Sample {
+        uint8_t channel;
+        uint16_t bitOffset;
+        uint8_t bitLength;
+    };
+
+    // The color models and channels are the khr_df_model and khr_df_channel values from khr_df.h
+    uint8_t colorModel = 0;
+    uint8_t blockSizeBytes = 0;
+    std::vector<Sample> samples;
+
+    switch (format) {
+        case vk::Format::eBc1RgbUnormBlock:
+        case vk::Format::eBc1RgbSrgbBlock:
+            colorModel = 128;
+            blockSizeBytes = 8;
+            samples = {{0, 0, 64}};
+            break;
+        case vk::Format::eBc1RgbaUnormBlock:
+        case vk::Format::eBc1RgbaSrgbBlock:
+            colorModel = 128;
+            blockSizeBytes = 8;
+            samples = {{1, 0, 64}};
+            break;
+        case vk::Format::eBc3UnormBlock:
+        case vk::Format::eBc3SrgbBlock:
+            colorModel = 130;
+            blockSizeBytes = 16;
+            samples = {{15, 0, 64}, {0, 64, 64}};
+            break;
+        case vk::Format::eBc4UnormBlock:
+            colorModel = 131;
+            blockSizeBytes = 8;
+            samples = {{0, 0, 64}};
+            break;
+        case vk::Format::eBc5UnormBlock:
+            colorModel = 132;
+            blockSizeBytes = 16;
+            samples = {{0, 0, 64}, {1, 64, 64}};
+            break;
+        case vk::Format::eBc7UnormBlock:
+        case vk::Format::eBc7SrgbBlock:
+            colorModel = 134;
+            blockSizeBytes = 16;
+            samples = {{0, 0, 128}};
+            break;
+        default:
+            LOG_THROW(TEXTURE_KTX2, util::StringException, vk::to_string(format), "We don't know how to describe {} in a ktx2 container", vk::to_string(format));
+    }
+
+    const bool isSRGB =
+        format == vk::Format::eBc1RgbSrgbBlock ||
+        format == vk::Format::eBc1RgbaSrgbBlock ||
+        format == vk::Format::eBc3SrgbBlock ||
+        format == vk::Format::eBc7SrgbBlock;
+
+    const uint16_t blockSizeWithSamples = 24 + 16 * samples.size();
+    const uint32_t totalSizeBytes = 4 + blockSizeWithSamples;
+
+    std::vector<uint8_t> descriptor(totalSizeBytes, 0);
+    uint8_t* p_descriptor = descriptor.data();
+
+    std::memcpy(p_descriptor, &totalSizeBytes, 4);
+    // Vendor and descriptor type are both 0 (khronos, basic) so the first word stays zeroed
+    const uint16_t versionNumber = 2;
+    std::memcpy(p_descriptor + 8, &versionNumber, 2);
+    std::memcpy(p_descriptor + 10, &blockSizeWithSamples, 2);
+    p_descriptor[12] = colorModel;
+    p_descriptor[13] = 1; // bt709 primaries
+    p_descriptor[14] = isSRGB ? 2 : 1;
+    p_descriptor[15] = 0; // straight alpha
+    p_descriptor[16] = 3; // 4x4 texel blocks, each dimension stored minus 1
+    p_descriptor[17] = 3;
+    p_descriptor[20] = blockSizeBytes;
+
+    for (uint32_t i = 0; i < samples.size(); ++i) {
+        uint8_t* p_sample = p_descriptor + 28 + 16 * i;
+        const uint32_t sampleUpper = 0xFFFFFFFF;
+
+        std::memcpy(p_sample, &samples[i].bitOffset, 2);
+        p_sample[2] = samples[i].bitLength - 1;
+        p_sample[3] = samples[i].channel;
+        std::memcpy(p_sample + 12, &sampleUpper, 4);
+    }
+
+    return descriptor;
+}
+
+std::vector<uint8_t>
+quartz::rendering::KTX2Container::write(
+    const vk::Format format,
+    const uint32_t width,
+    const uint32_t height,
+    const std::vector<std::vector<uint8_t>>& levels
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_KTX2, "{}x{} {} with {} levels", width, height, vk::to_string(format), levels.size());
+
+    if (levels.empty()) {
+        LOG_THROW(TEXTURE_KTX2, util::StringException, vk::to_string(format), "Can't write a ktx2 container without any levels");
+    }
+
+    const std::vector<uint8_t> dataFormatDescriptor = quartz::rendering::KTX2Container::createDataFormatDescriptor(format);
+
+    quartz::rendering::KTX2Container::Header header = {};
+    std::memcpy(header.identifier, quartz::rendering::KTX2Container::identifier, sizeof(header.identifier));
+    header.vulkanFormat = static_cast<uint32_t>(format);
+    header.typeSize = 1;
+    header.pixelWidth = width;
+    header.pixelHeight = height;
+    header.faceCount = 1;
+    header.levelCount = levels.size();
+    header.dataFormatDescriptorOffset = sizeof(quartz::rendering::KTX2Container::Header) + levels.size() * sizeof(quartz::rendering::KTX2Container::LevelIndexEntry);
+    header.dataFormatDescriptorSizeBytes = dataFormatDescriptor.size();
+
+    std::vector<uint8_t> bytes(header.dataFormatDescriptorOffset + header.dataFormatDescriptorSizeBytes, 0);
+    std::memcpy(bytes.data() + header.dataFormatDescriptorOffset, dataFormatDescriptor.data(), dataFormatDescriptor.size());
+
+    // Levels go smallest first, each starting on a multiple of the block size
+    const uint64_t levelAlignment = 16;
+    std::vector<quartz::rendering::KTX2Container::LevelIndexEntry> levelIndex(levels.size());
+
+    for (uint32_t i = levels.size(); i-- > 0;) {
+        const uint64_t offset = (bytes.size() + levelAlignment - 1) & ~(levelAlignment - 1);
+
+        bytes.resize(offset + levels[i].size(), 0);
+        std::memcpy(bytes.data() + offset, levels[i].data(), levels[i].size());
+
+        levelIndex[i] = {offset, levels[i].size(), levels[i].size()};
+        LOG_TRACE(TEXTURE_KTX2, "Wrote {} byte level {} at offset {}", levels[i].size(), i, offset);
+    }
+
+    std::memcpy(bytes.data(), &header, sizeof(header));
+    std::memcpy(bytes.data() + sizeof(header), levelIndex.data(), levelIndex.size() * sizeof(quartz::rendering::KTX2Container::LevelIndexEntry));
+
+    return bytes;
+}
+
+quartz::rendering::KTX2Container::KTX2Container(
+    const std::span<const uint8_t> bytes
+) :
+    m_bytes(bytes),
+    m_header(
+        quartz::rendering::KTX2Container::loadHeader(
+            m_bytes
+        )
+    ),
+    m_levelIndex(
+        quartz::rendering::KTX2Container::loadLevelIndex(
+            m_bytes,
+            m_header
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("{} bytes", bytes.size());
+}
+
+std::span<const uint8_t>
+quartz::rendering::KTX2Container::getLevel(
+    const uint32_t level
+) const {
+    if (level >= m_levelIndex.size()) {
+        LOG_THROW(TEXTURE_KTX2, util::RichException<uint32_t>, level, "Ktx2 container only has {} levels, not {}", m_levelIndex.size(), level + 1);
+    }
+
+    return m_bytes.subspan(m_levelIndex[level].offset, m_levelIndex[level].sizeBytes);
+}
+
+std::vector<quartz::rendering::UploadBatch::ImageLevel>
+quartz::rendering::KTX2Container::getImageLevels() const {
+    std::vector<quartz::rendering::UploadBatch::ImageLevel> imageLevels;
+    imageLevels.reserve(m_levelIndex.size());
+
+    vk::DeviceSize offsetBytes = 0;
+
+    for (uint32_t i = 0; i < m_levelIndex.size(); ++i) {
+        imageLevels.push_back({
+            std::max<uint32_t>(m_header.pixelWidth >> i, 1),
+            std::max<uint32_t>(m_header.pixelHeight >> i, 1),
+            offsetBytes
+        });
+
+        offsetBytes += m_levelIndex[i].sizeBytes;
+    }
+
+    return imageLevels;
+}
+
+uint64_t
+quartz::rendering::KTX2Container::getLevelDataSizeBytes() const {
+    uint64_t sizeBytes = 0;
+
+    for (const quartz::rendering::KTX2Container::LevelIndexEntry& entry : m_levelIndex) {
+        sizeBytes += entry.sizeBytes;
+    }
+
+    return sizeBytes;
+}
+
+void
+quartz::rendering::KTX2Container::writeLevels(
+    uint8_t* p_destination
+) const {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} levels", m_levelIndex.size());
+
+    for (const quartz::rendering::KTX2Container::LevelIndexEntry& entry : m_levelIndex) {
+        std::memcpy(p_destination, m_bytes.data() + entry.offset, entry.sizeBytes);
+        p_destination += entry.sizeBytes;
+    }
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+
+namespace quartz {
+namespace rendering {
+    class KTX2Container;
+}
+}
+
+/**
+ * @brief A view of a ktx2 container's bytes, which may be a mapped .ktx2 file, an image embedded in a
+ *   gltf file, or a texture in a cooked model. Nothing is copied out of the bytes, so they must outlive
+ *   the container. Each mip level is already in the layout the gpu wants, so uploading one is a matter
+ *   of copying its levels straight into staging memory.
+ *
+ * @brief We only read containers whose levels are stored as they are, without supercompression. Basis
+ *   universal containers (BasisLZ supercompression, or uastc which has an undefined vulkan format)
+ *   would need transcoding first, which we have no transcoder for, so they are rejected.
+ *
+ * @brief LAYOUT
+ *   An 80 byte header, followed by a level index with an entry for every mip level (largest first),
+ *   followed by the data format descriptor, the key value data, and the levels themselves, which are
+ *   stored smallest first. See https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+ */
+class quartz::rendering::KTX2Container {
+public: // classes
+    struct Header {
+    public: // member variables
+        uint8_t identifier[12];
+        uint32_t vulkanFormat;
+        uint32_t typeSize;
+        uint32_t pixelWidth;
+        uint32_t pixelHeight;
+        uint32_t pixelDepth;
+        uint32_t layerCount; // 0 if this isn't an array texture
+        uint32_t faceCount;
+        uint32_t levelCount; // 0 if the reader is supposed to generate the mips
+        uint32_t supercompressionScheme;
+        uint32_t dataFormatDescriptorOffset;
+        uint32_t dataFormatDescriptorSizeBytes;
+        uint32_t keyValueDataOffset;
+        uint32_t keyValueDataSizeBytes;
+        uint64_t supercompressionGlobalDataOffset;
+        uint64_t supercompressionGlobalDataSizeBytes;
+    };
+
+    struct LevelIndexEntry {
+    public: // member variables
+        uint64_t offset;
+        uint64_t sizeBytes;
+        uint64_t uncompressedSizeBytes;
+    };
+
+public: // member functions
+    KTX2Container(const std::span<const uint8_t> bytes);
+
+    USE_LOGGER(TEXTURE_KTX2);
+
+    vk::Format getVulkanFormat() const { return static_cast<vk::Format>(m_header.vulkanFormat); }
+    uint32_t getWidth() const { return m_header.pixelWidth; }
+    uint32_t getHeight() const { return m_header.pixelHeight; }
+    uint32_t getDepth() const { return m_header.pixelDepth; }
+    uint32_t getLayerCount() const { return m_header.layerCount; }
+    uint32_t getFaceCount() const { return m_header.faceCount; }
+    uint32_t getLevelCount() const { return m_levelIndex.size(); }
+    std::span<const uint8_t> getBytes() const { return m_bytes; }
+
+    std::span<const uint8_t> getLevel(const uint32_t level) const;
+
+    /**
+     * @brief Where each level goes when they are staged largest first with nothing between them,
+     *   which is the layout StagedImageBuffer and UploadBatch expect
+     */
+    std::vector<quartz::rendering::UploadBatch::ImageLevel> getImageLevels() const;
+    uint64_t getLevelDataSizeBytes() const;
+
+    /**
+     * @brief Copies every level out of the container, laid out as getImageLevels describes
+     */
+    void writeLevels(uint8_t* p_destination) const;
+
+public: // static functions
+    static bool isKTX2(const std::span<const uint8_t> bytes);
+    static bool isKTX2Filepath(const std::string& filepath);
+
+    /**
+     * @brief True for basis universal containers, which we can't upload. Only valid for bytes
+     *   isKTX2 accepts
+     */
+    static bool requiresTranscoding(const std::span<const uint8_t> bytes);
+
+    /**
+     * @brief How many bytes a single width x height image in the format takes, rounding block compressed
+     *   formats up to whole 4x4 blocks. 0 for formats we don't know the size of
+     */
+    static uint64_t calculateImageSizeBytes(
+        const vk::Format format,
+        const uint32_t width,
+        const uint32_t height
+    );
+
+    /**
+     * @brief Writes a container with a basic data format descriptor for the block compressed formats
+     *   we cook. The levels are largest first, as getLevel would return them
+     */
+    static std::vector<uint8_t> write(
+        const vk::Format format,
+        const uint32_t width,
+        const uint32_t height,
+        const std::vector<std::vector<uint8_t>>& levels
+    );
+
+public: // static variables
+    static constexpr uint8_t identifier[12] = {0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A}; // "«KTX 20»\r\n\x1A\n"
+    static constexpr const char* fileExtension = "ktx2";
+    static constexpr const char* mimeType = "image/ktx2";
+
+private: // static functions
+    static quartz::rendering::KTX2Container::Header loadHeader(const std::span<const uint8_t> bytes);
+    static std::vector<quartz::rendering::KTX2Container::LevelIndexEntry> loadLevelIndex(
+        const std::span<const uint8_t> bytes,
+        const quartz::rendering::KTX2Container::Header& header
+    );
+    static std::vector<uint8_t> createDataFormatDescriptor(const vk::Format format);
+
+private: // member variables
+    std::span<const uint8_t> m_bytes;
+    quartz::rendering::KTX2Container::Header m_header;
+    std::vector<quartz::rendering::KTX2Container::LevelIndexEntry> m_levelIndex; // largest level first
+};
+
+/**
+ * @brief These are memcpy'd out of the container, so their layout must match the spec exactly
+ */
+static_assert(std::is_trivially_copyable_v<quartz::rendering::KTX2Container::Header> && sizeof(quartz::rendering::KTX2Container::Header) == 80);
+static_assert(std::is_trivially_copyable_v<quartz::rendering::KTX2Container::LevelIndexEntry> && sizeof(quartz::rendering::KTX2Container::LevelIndexEntry) == 24);
@@ -0,0 +1,284 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <future>
+#include <vector>
+
+#include "util/thread_pool/ThreadPool.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/StagedImageBuffer.hpp"
+#include "quartz/rendering/texture/MipChain.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+
+const std::array<float, 256>&
+quartz::rendering::MipChain::getSRGBToLinearTable() {
+    static const std::array<float, 256> srgbToLinearTable = []() {
+        std::array<float, 256> table;
+        for (uint32_t i = 0; i < table.size(); ++i) {
+            const float srgb = i / 255.0f;
+            table[i] = srgb <= 0.04045f ? srgb / 12.92f : std::pow((srgb + 0.055f) / 1.055f, 2.4f);
+        }
+        return table;
+    }();
+
+    return srgbToLinearTable;
+}
+
+const std::array<uint8_t, 4096>&
+quartz::rendering::MipChain::getLinearToSRGBTable() {
+    static const std::array<uint8_t, 4096> linearToSRGBTable = []() {
+        std::array<uint8_t, 4096> table;
+        for (uint32_t i = 0; i < table.size(); ++i) {
+            const float linear = i / 4095.0f;
+            const float srgb = linear <= 0.0031308f ? linear * 12.92f : 1.055f * std::pow(linear, 1.0f / 2.4f) - 0.055f;
+            table[i] = static_cast<uint8_t>(std::clamp(srgb * 255.0f + 0.5f, 0.0f, 255.0f));
+        }
+        return table;
+    }();
+
+    return linearToSRGBTable;
+}
+
+void
+quartz::rendering::MipChain::downsampleRows(
+    const uint8_t* p_sourcePixels,
+    const uint32_t sourceWidth,
+    const uint32_t sourceHeight,
+    const uint32_t sourceChannelCount,
+    uint8_t* p_destinationPixels,
+    const uint32_t destinationWidth,
+    const uint32_t destinationChannelCount,
+    const uint32_t firstRow,
+    const uint32_t rowCount,
+    const bool isSRGB
+) {
+    const std::array<float, 256>& srgbToLinearTable = quartz::rendering::MipChain::getSRGBToLinearTable();
+    const std::array<uint8_t, 4096>& linearToSRGBTable = quartz::rendering::MipChain::getLinearToSRGBTable();
+
+    for (uint32_t y = firstRow; y < firstRow + rowCount; ++y) {
+        // Odd sizes clamp to the last row or column instead of reading past the edge
+        const std::array<uint32_t, 2> sourceRows = {std::min(y * 2, sourceHeight - 1), std::min(y * 2 + 1, sourceHeight - 1)};
+
+        for (uint32_t x = 0; x < destinationWidth; ++x) {
+            const std::array<uint32_t, 2> sourceColumns = {std::min(x * 2, sourceWidth - 1), std::min(x * 2 + 1, sourceWidth - 1)};
+            uint8_t* p_destinationPixel = p_destinationPixels + (static_cast<size_t>(y) * destinationWidth + x) * destinationChannelCount;
+
+            for (uint32_t channel = 0; channel < destinationChannelCount; ++channel) {
+                // Missing channels are filled the same way Texture::expandToRGBA fills them
+                if (channel >= sourceChannelCount) {
+                    p_destinationPixel[channel] = channel == 3 ? 255 : 0;
+                    continue;
+                }
+
+                // Alpha is always linear
+                const bool isLinearized = isSRGB && channel < 3;
+                uint32_t integerSum = 0;
+                float linearSum = 0.0f;
+
+                for (const uint32_t sourceRow : sourceRows) {
+                    for (const uint32_t sourceColumn : sourceColumns) {
+                        const uint8_t value = p_sourcePixels[(static_cast<size_t>(sourceRow) * sourceWidth + sourceColumn) * sourceChannelCount + channel];
+                        integerSum += value;
+                        linearSum += srgbToLinearTable[value];
+                    }
+                }
+
+                p_destinationPixel[channel] =
+                    isLinearized ?
+                        linearToSRGBTable[static_cast<uint32_t>(linearSum * 0.25f * 4095.0f + 0.5f)] :
+                        static_cast<uint8_t>((integerSum + 2) / 4);
+            }
+        }
+    }
+}
+
+void
+quartz::rendering::MipChain::downsample(
+    const uint8_t* p_sourcePixels,
+    const uint32_t sourceWidth,
+    const uint32_t sourceHeight,
+    const uint32_t sourceChannelCount,
+    uint8_t* p_destinationPixels,
+    const uint32_t destinationWidth,
+    const uint32_t destinationHeight,
+    const uint32_t destinationChannelCount,
+    const bool isSRGB
+) {
+    /**
+     * @brief Small levels aren't worth handing out, so they are filtered right here. Large ones are
+     *   split into bands of rows, which are independent of each other
+     */
+    const uint32_t minimumBandRowCount = std::max<uint32_t>(65536 / std::max<uint32_t>(destinationWidth, 1), 1);
+    util::ThreadPool& threadPool = util::ThreadPool::getSharedPool();
+    const uint32_t bandCount = std::min(destinationHeight / minimumBandRowCount, threadPool.getThreadCount() + 1);
+
+    if (bandCount <= 1) {
+        quartz::rendering::MipChain::downsampleRows(
+            p_sourcePixels,
+            sourceWidth,
+            sourceHeight,
+            sourceChannelCount,
+            p_destinationPixels,
+            destinationWidth,
+            destinationChannelCount,
+            0,
+            destinationHeight,
+            isSRGB
+        );
+        return;
+    }
+
+    const uint32_t bandRowCount = (destinationHeight + bandCount - 1) / bandCount;
+    std::vector<std::future<void>> bandFutures;
+    bandFutures.reserve(bandCount);
+
+    for (uint32_t firstRow = 0; firstRow < destinationHeight; firstRow += bandRowCount) {
+        const uint32_t rowCount = std::min(bandRowCount, destinationHeight - firstRow);
+        bandFutures.push_back(
+            threadPool.submit(
+                [=]() {
+                    quartz::rendering::MipChain::downsampleRows(
+                        p_sourcePixels,
+                        sourceWidth,
+                        sourceHeight,
+                        sourceChannelCount,
+                        p_destinationPixels,
+                        destinationWidth,
+                        destinationChannelCount,
+                        firstRow,
+                        rowCount,
+                        isSRGB
+                    );
+                }
+            )
+        );
+    }
+
+    // Every band has to finish before the next level can read this one
+    for (std::future<void>& bandFuture : bandFutures) {
+        bandFuture.get();
+    }
+}
+
+std::vector<uint8_t>
+quartz::rendering::MipChain::generateLevels(
+    const std::vector<const uint8_t*>& baseLayerPixels,
+    const uint32_t channelCount,
+    const uint32_t levelChannelCount,
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+    const bool isSRGB
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_MIPS, "{} levels with {} layers", levels.size(), baseLayerPixels.size());
+
+    if (levels.size() <= 1) {
+        LOG_TRACE(TEXTURE_MIPS, "Nothing to generate below the base level");
+        return {};
+    }
+
+    const uint32_t layerCount = baseLayerPixels.size();
+    const vk::DeviceSize generatedOffsetBytes = levels[1].offsetBytes;
+    const vk::DeviceSize generatedSizeBytes = levels.back().offsetBytes + static_cast<vk::DeviceSize>(levels.back().width) * levels.back().height * layerCount * levelChannelCount - generatedOffsetBytes;
+
+    std::vector<uint8_t> generatedPixels(generatedSizeBytes);
+
+    for (uint32_t i = 1; i < levels.size(); ++i) {
+        const quartz::rendering::UploadBatch::ImageLevel& sourceLevel = levels[i - 1];
+        const quartz::rendering::UploadBatch::ImageLevel& destinationLevel = levels[i];
+        LOG_TRACE(TEXTURE_MIPS, "Generating {}x{} level {} from {}x{}", destinationLevel.width, destinationLevel.height, i, sourceLevel.width, sourceLevel.height);
+
+        for (uint32_t layer = 0; layer < layerCount; ++layer) {
+            const uint8_t* p_sourcePixels =
+                i == 1 ?
+                    baseLayerPixels[layer] :
+                    generatedPixels.data() + (sourceLevel.offsetBytes - generatedOffsetBytes) + static_cast<size_t>(layer) * sourceLevel.width * sourceLevel.height * levelChannelCount;
+            uint8_t* p_destinationPixels = generatedPixels.data() + (destinationLevel.offsetBytes - generatedOffsetBytes) + static_cast<size_t>(layer) * destinationLevel.width * destinationLevel.height * levelChannelCount;
+
+            quartz::rendering::MipChain::downsample(
+                p_sourcePixels,
+                sourceLevel.width,
+                sourceLevel.height,
+                i == 1 ? channelCount : levelChannelCount,
+                p_destinationPixels,
+                destinationLevel.width,
+                destinationLevel.height,
+                levelChannelCount,
+                isSRGB
+            );
+        }
+    }
+
+    return generatedPixels;
+}
+
+quartz::rendering::MipChain::MipChain(
+    const std::vector<const uint8_t*>& baseLayerPixels,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const uint32_t levelChannelCount,
+    const bool isSRGB
+) :
+    m_baseLayerPixels(baseLayerPixels),
+    m_channelCount(channelCount),
+    m_levelChannelCount(levelChannelCount),
+    m_levels(
+        quartz::rendering::StagedImageBuffer::calculateMipLevels(
+            imageWidth,
+            imageHeight,
+            baseLayerPixels.size(),
+            quartz::rendering::StagedImageBuffer::calculateFullMipLevelCount(imageWidth, imageHeight),
+            levelChannelCount
+        )
+    ),
+    m_sizeBytes(
+        quartz::rendering::StagedImageBuffer::calculateMipChainSizeBytes(
+            imageWidth,
+            imageHeight,
+            baseLayerPixels.size(),
+            m_levels.size(),
+            levelChannelCount
+        )
+    ),
+    m_generatedPixels(
+        quartz::rendering::MipChain::generateLevels(
+            m_baseLayerPixels,
+            m_channelCount,
+            m_levelChannelCount,
+            m_levels,
+            isSRGB
+        )
+    )
+{
+    LOG_FUNCTION_CALL_TRACEthis("{}x{} with {} layers, {} levels with {} channels", imageWidth, imageHeight, baseLayerPixels.size(), m_levels.size(), m_levelChannelCount);
+}
+
+void
+quartz::rendering::MipChain::write(
+    uint8_t* p_destination
+) const {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} bytes", m_sizeBytes);
+
+    const uint32_t baseLayerPixelCount = m_levels[0].width * m_levels[0].height;
+    const size_t baseLayerSizeBytes = static_cast<size_t>(baseLayerPixelCount) * m_levelChannelCount;
+
+    for (uint32_t layer = 0; layer < m_baseLayerPixels.size(); ++layer) {
+        // Packed base levels already have the channels we are keeping, so there is nothing to expand
+        if (m_channelCount == m_levelChannelCount) {
+            memcpy(p_destination + layer * baseLayerSizeBytes, m_baseLayerPixels[layer], baseLayerSizeBytes);
+            continue;
+        }
+
+        quartz::rendering::Texture::expandToRGBA(
+            m_baseLayerPixels[layer],
+            baseLayerPixelCount,
+            m_channelCount,
+            p_destination + layer * baseLayerSizeBytes
+        );
+    }
+
+    if (!m_generatedPixels.empty()) {
+        memcpy(p_destination + m_levels[1].offsetBytes, m_generatedPixels.data(), m_generatedPixels.size());
+    }
+}
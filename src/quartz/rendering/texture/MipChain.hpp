@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+
+namespace quartz {
+namespace rendering {
+    class MipChain;
+}
+}
+
+/**
+ * @brief Generates every mip level below an image's base level on the cpu with a 2x2 box filter,
+ *   spreading the rows of each level across the shared thread pool. Srgb images are filtered in
+ *   linear space so they don't darken as they shrink.
+ *
+ * @brief We filter on the cpu instead of blitting on the gpu because uploads are recorded on the
+ *   dedicated transfer queue when there is one, and transfer queues can't blit. This also means we
+ *   don't depend on the format supporting linear blits.
+ *
+ * @brief The base level is left where it is and is only read, so rgb base levels can still be
+ *   expanded to rgba on their way into staging memory. Every level we generate has levelChannelCount
+ *   channels, which is either 4 for rgba or the base level's own channel count for textures that
+ *   only keep the channels they use (see Texture::getPackedChannels).
+ */
+class quartz::rendering::MipChain {
+public: // member functions
+    /**
+     * @brief The base layer pixels must stay alive until the chain is written
+     */
+    MipChain(
+        const std::vector<const uint8_t*>& baseLayerPixels,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const uint32_t levelChannelCount,
+        const bool isSRGB
+    );
+    MipChain(const MipChain& other) = delete;
+
+    MipChain& operator=(const MipChain& other) = delete;
+
+    USE_LOGGER(TEXTURE_MIPS);
+
+    uint32_t getLevelCount() const { return m_levels.size(); }
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& getLevels() const { return m_levels; }
+    uint32_t getLevelChannelCount() const { return m_levelChannelCount; }
+    uint32_t getSizeBytes() const { return m_sizeBytes; } // of every level with levelChannelCount channels
+
+    /**
+     * @brief Writes the whole chain with levelChannelCount channels, laid out the way
+     *   StagedImageBuffer::calculateMipLevels says
+     */
+    void write(uint8_t* p_destination) const;
+
+private: // static functions
+    static const std::array<float, 256>& getSRGBToLinearTable();
+    static const std::array<uint8_t, 4096>& getLinearToSRGBTable();
+
+    /**
+     * @brief Runs on a worker thread, so this must not log
+     */
+    static void downsampleRows(
+        const uint8_t* p_sourcePixels,
+        const uint32_t sourceWidth,
+        const uint32_t sourceHeight,
+        const uint32_t sourceChannelCount,
+        uint8_t* p_destinationPixels,
+        const uint32_t destinationWidth,
+        const uint32_t destinationChannelCount,
+        const uint32_t firstRow,
+        const uint32_t rowCount,
+        const bool isSRGB
+    );
+    static void downsample(
+        const uint8_t* p_sourcePixels,
+        const uint32_t sourceWidth,
+        const uint32_t sourceHeight,
+        const uint32_t sourceChannelCount,
+        uint8_t* p_destinationPixels,
+        const uint32_t destinationWidth,
+        const uint32_t destinationHeight,
+        const uint32_t destinationChannelCount,
+        const bool isSRGB
+    );
+    static std::vector<uint8_t> generateLevels(
+        const std::vector<const uint8_t*>& baseLayerPixels,
+        const uint32_t channelCount,
+        const uint32_t levelChannelCount,
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const bool isSRGB
+    );
+
+private: // member variables
+    std::vector<const uint8_t*> m_baseLayerPixels;
+    uint32_t m_channelCount; // of the base level
+    uint32_t m_levelChannelCount;
+    std::vector<quartz::rendering::UploadBatch::ImageLevel> m_levels;
+    uint32_t m_sizeBytes;
+
+    // Every level but the base, laid out the same way they are in m_levels
+    std::vector<uint8_t> m_generatedPixels;
+};
@@ -0,0 +1,94 @@
+#include <tuple>
+
+#include "util/errors/RichException.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/texture/SamplerCache.hpp"
+#include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
+
+std::map<quartz::rendering::SamplerCache::Key, std::shared_ptr<vk::UniqueSampler>> quartz::rendering::SamplerCache::samplers;
+
+bool
+quartz::rendering::SamplerCache::Key::operator<(
+    const quartz::rendering::SamplerCache::Key& other
+) const {
+    return
+        std::tie(magFilter, minFilter, mipmapMode, addressModeU, addressModeV, addressModeW, maxAnisotropy, minLod, maxLod) <
+        std::tie(other.magFilter, other.minFilter, other.mipmapMode, other.addressModeU, other.addressModeV, other.addressModeW, other.maxAnisotropy, other.minLod, other.maxLod);
+}
+
+bool
+quartz::rendering::SamplerCache::Key::operator==(
+    const quartz::rendering::SamplerCache::Key& other
+) const {
+    return
+        std::tie(magFilter, minFilter, mipmapMode, addressModeU, addressModeV, addressModeW, maxAnisotropy, minLod, maxLod) ==
+        std::tie(other.magFilter, other.minFilter, other.mipmapMode, other.addressModeU, other.addressModeV, other.addressModeW, other.maxAnisotropy, other.minLod, other.maxLod);
+}
+
+quartz::rendering::SamplerCache::Key
+quartz::rendering::SamplerCache::getDefaultKey(
+    const quartz::rendering::Device& renderingDevice
+) {
+    const float maxAnisotropy = renderingDevice.getVulkanPhysicalDevice().getProperties().limits.maxSamplerAnisotropy;
+
+    return {
+        vk::Filter::eLinear,
+        vk::Filter::eLinear,
+        vk::SamplerMipmapMode::eLinear,
+        vk::SamplerAddressMode::eRepeat,
+        vk::SamplerAddressMode::eRepeat,
+        vk::SamplerAddressMode::eRepeat,
+        maxAnisotropy,
+        0.0f,
+        VK_LOD_CLAMP_NONE
+    };
+}
+
+std::shared_ptr<vk::UniqueSampler>
+quartz::rendering::SamplerCache::getVulkanSamplerPtr(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::SamplerCache::Key& key
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_SAMPLER, "{} cached samplers", quartz::rendering::SamplerCache::samplers.size());
+
+    const std::map<quartz::rendering::SamplerCache::Key, std::shared_ptr<vk::UniqueSampler>>::const_iterator samplerIterator = quartz::rendering::SamplerCache::samplers.find(key);
+    if (samplerIterator != quartz::rendering::SamplerCache::samplers.end()) {
+        LOG_TRACE(TEXTURE_SAMPLER, "Reusing cached sampler");
+        return samplerIterator->second;
+    }
+
+    const uint32_t maxSamplerAllocationCount = renderingDevice.getVulkanPhysicalDevice().getProperties().limits.maxSamplerAllocationCount;
+    if (quartz::rendering::SamplerCache::samplers.size() >= maxSamplerAllocationCount) {
+        LOG_THROW(TEXTURE_SAMPLER, util::RichException<uint32_t>, maxSamplerAllocationCount, "Already have {} samplers, which is as many as the device allows", quartz::rendering::SamplerCache::samplers.size());
+    }
+
+    LOG_TRACE(TEXTURE_SAMPLER, "Creating sampler {} of at most {}", quartz::rendering::SamplerCache::samplers.size() + 1, maxSamplerAllocationCount);
+
+    std::shared_ptr<vk::UniqueSampler> p_sampler = std::make_shared<vk::UniqueSampler>(
+        quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
+            renderingDevice.getVulkanLogicalDevicePtr(),
+            key.magFilter,
+            key.minFilter,
+            key.mipmapMode,
+            key.addressModeU,
+            key.addressModeV,
+            key.addressModeW,
+            key.maxAnisotropy,
+            key.minLod,
+            key.maxLod
+        )
+    );
+
+    quartz::rendering::SamplerCache::samplers.emplace(key, p_sampler);
+
+    return p_sampler;
+}
+
+void
+quartz::rendering::SamplerCache::clear() {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_SAMPLER, "{} cached samplers", quartz::rendering::SamplerCache::samplers.size());
+
+    quartz::rendering::SamplerCache::samplers.clear();
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/device/Device.hpp"
+
+namespace quartz {
+namespace rendering {
+    class SamplerCache;
+}
+}
+
+/**
+ * @brief Hands out one sampler for every distinct set of sampler settings, instead of every texture
+ *   creating its own. Scenes usually only sample a handful of ways, so this keeps us far below the
+ *   device's maxSamplerAllocationCount no matter how many textures we load.
+ *
+ * @brief Samplers are shared, so textures hold onto them with shared pointers. Clearing the cache
+ *   only drops the cache's references, so anything still using a sampler keeps it alive until it is
+ *   destroyed itself.
+ */
+class quartz::rendering::SamplerCache {
+public: // classes
+    struct Key {
+    public: // member functions
+        bool operator<(const Key& other) const;
+        bool operator==(const Key& other) const;
+
+    public: // member variables
+        vk::Filter magFilter;
+        vk::Filter minFilter;
+        vk::SamplerMipmapMode mipmapMode;
+        vk::SamplerAddressMode addressModeU;
+        vk::SamplerAddressMode addressModeV;
+        vk::SamplerAddressMode addressModeW;
+        float maxAnisotropy; // 1 disables anisotropic filtering
+        float minLod;
+        float maxLod;
+    };
+
+public: // member functions
+    SamplerCache() = delete;
+
+public: // static functions
+    /**
+     * @brief Linear filtering that repeats in every direction, with as much anisotropy as the device
+     *   allows. The lod range isn't clamped so every texture can share it regardless of how many mip
+     *   levels it has, as the image view already limits which levels get sampled
+     */
+    static quartz::rendering::SamplerCache::Key getDefaultKey(const quartz::rendering::Device& renderingDevice);
+
+    static std::shared_ptr<vk::UniqueSampler> getVulkanSamplerPtr(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::SamplerCache::Key& key
+    );
+    static uint32_t getSamplerCount() { return quartz::rendering::SamplerCache::samplers.size(); }
+
+    /**
+     * @brief Must happen before the device is destroyed
+     */
+    static void clear();
+
+private: // static variables
+    static std::map<quartz::rendering::SamplerCache::Key, std::shared_ptr<vk::UniqueSampler>> samplers;
+};
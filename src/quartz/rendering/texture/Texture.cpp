@@ -6,13 +6,33 @@
 
 //#include <stb_image.h>
 
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <span>
+#include <utility>
+
+#if defined __SSSE3__
+#include <tmmintrin.h>
+#elif defined __ARM_NEON
+#include <arm_neon.h>
+#endif
+
 #include <vulkan/vulkan.hpp>
 
+#include "util/macros.hpp"
 #include "util/errors/RichException.hpp"
+#include "util/file_system/MappedFile.hpp"
+#include "util/hash/Hash.hpp"
 
 #include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
 #include "quartz/rendering/buffer/StagedImageBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/texture/BlockCompressor.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+#include "quartz/rendering/texture/SamplerCache.hpp"
+#include "quartz/rendering/texture/MipChain.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
 #include "quartz/rendering/vulkan_util/VulkanUtil.hpp"
 
@@ -22,29 +42,124 @@ uint32_t quartz::rendering::Texture::normalDefaultMasterIndex = 0;
 uint32_t quartz::rendering::Texture::emissionDefaultMasterIndex = 0;
 uint32_t quartz::rendering::Texture::occlusionDefaultMasterIndex = 0;
 std::vector<std::shared_ptr<quartz::rendering::Texture>> quartz::rendering::Texture::masterTextureList;
+std::multimap<uint64_t, uint32_t> quartz::rendering::Texture::contentHashMasterIndices;
+
+std::span<const uint8_t>
+quartz::rendering::Texture::LevelData::getLevelBytes(
+    const uint32_t level
+) const {
+    const vk::DeviceSize levelSizeBytes = (level + 1 < levels.size() ? levels[level + 1].offsetBytes : sizeBytes) - levels[level].offsetBytes;
+
+    if (p_mappedFile) {
+        return p_mappedFile->getBytes(mappedOffsets[level], levelSizeBytes);
+    }
+
+    return std::span<const uint8_t>(bytes).subspan(levels[level].offsetBytes, levelSizeBytes);
+}
 
 uint32_t
 quartz::rendering::Texture::createTexture(
     const quartz::rendering::Device& renderingDevice,
     const tinygltf::Image& gltfImage,
-    const tinygltf::Sampler& gltfSampler
+    const tinygltf::Sampler& gltfSampler,
+    const quartz::rendering::Texture::Type textureType
 ) {
-    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "");
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}", quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
 
     if (quartz::rendering::Texture::masterTextureList.empty()) {
         LOG_TRACE(TEXTURE, "Master texture list is empty, initializing");
         quartz::rendering::Texture::initializeMasterTextureList(renderingDevice);
     }
 
+    const uint64_t contentHash = quartz::rendering::Texture::calculateContentHash(
+        gltfImage.image,
+        gltfImage.width,
+        gltfImage.height,
+        gltfImage.component,
+        textureType,
+        gltfSampler
+    );
+    quartz::rendering::Texture::LevelData levelData = quartz::rendering::Texture::loadLevelDataFromGLTFImage(
+        gltfImage,
+        textureType
+    );
+    const quartz::rendering::SamplerCache::Key samplerKey = quartz::rendering::Texture::getSamplerCacheKey(renderingDevice, gltfSampler);
+
+    // Hashes can collide, so every texture with a matching hash is compared against ours
+    const std::pair<std::multimap<uint64_t, uint32_t>::const_iterator, std::multimap<uint64_t, uint32_t>::const_iterator> masterIndexRange = quartz::rendering::Texture::contentHashMasterIndices.equal_range(contentHash);
+    for (std::multimap<uint64_t, uint32_t>::const_iterator masterIndexIterator = masterIndexRange.first; masterIndexIterator != masterIndexRange.second; ++masterIndexIterator) {
+        if (quartz::rendering::Texture::masterTextureList[masterIndexIterator->second]->hasSameContent(levelData, samplerKey, textureType)) {
+            LOG_TRACE(TEXTURE, "Identical texture already exists at master index {}", masterIndexIterator->second);
+            return masterIndexIterator->second;
+        }
+    }
+
     std::shared_ptr<quartz::rendering::Texture> p_texture = std::make_shared<quartz::rendering::Texture>(
         renderingDevice,
-        gltfImage,
+        std::move(levelData),
+        samplerKey,
+        textureType
+    );
+
+    quartz::rendering::Texture::masterTextureList.push_back(p_texture);
+
+    uint32_t insertedIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
+    quartz::rendering::Texture::contentHashMasterIndices.emplace(contentHash, insertedIndex);
+    LOG_TRACE(TEXTURE, "Texture was inserted into master list at index {}", insertedIndex);
+
+    return insertedIndex;
+}
+
+uint32_t
+quartz::rendering::Texture::createTexture(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::KTX2Container& container,
+    const std::shared_ptr<const util::MappedFile>& p_mappedFile,
+    const tinygltf::Sampler& gltfSampler,
+    const quartz::rendering::Texture::Type textureType
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}x{} {} {}", container.getWidth(), container.getHeight(), vk::to_string(container.getVulkanFormat()), quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
+
+    if (quartz::rendering::Texture::masterTextureList.empty()) {
+        LOG_TRACE(TEXTURE, "Master texture list is empty, initializing");
+        quartz::rendering::Texture::initializeMasterTextureList(renderingDevice);
+    }
+
+    const uint64_t contentHash = quartz::rendering::Texture::calculateContentHash(
+        container.getBytes(),
+        container.getWidth(),
+        container.getHeight(),
+        0,
+        textureType,
         gltfSampler
     );
+    quartz::rendering::Texture::LevelData levelData = quartz::rendering::Texture::loadLevelDataFromKTX2(
+        renderingDevice,
+        container,
+        p_mappedFile
+    );
+    const quartz::rendering::SamplerCache::Key samplerKey = quartz::rendering::Texture::getSamplerCacheKey(renderingDevice, gltfSampler);
+
+    // Hashes can collide, so every texture with a matching hash is compared against ours
+    const std::pair<std::multimap<uint64_t, uint32_t>::const_iterator, std::multimap<uint64_t, uint32_t>::const_iterator> masterIndexRange = quartz::rendering::Texture::contentHashMasterIndices.equal_range(contentHash);
+    for (std::multimap<uint64_t, uint32_t>::const_iterator masterIndexIterator = masterIndexRange.first; masterIndexIterator != masterIndexRange.second; ++masterIndexIterator) {
+        if (quartz::rendering::Texture::masterTextureList[masterIndexIterator->second]->hasSameContent(levelData, samplerKey, textureType)) {
+            LOG_TRACE(TEXTURE, "Identical texture already exists at master index {}", masterIndexIterator->second);
+            return masterIndexIterator->second;
+        }
+    }
+
+    std::shared_ptr<quartz::rendering::Texture> p_texture = std::make_shared<quartz::rendering::Texture>(
+        renderingDevice,
+        std::move(levelData),
+        samplerKey,
+        textureType
+    );
 
     quartz::rendering::Texture::masterTextureList.push_back(p_texture);
 
     uint32_t insertedIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
+    quartz::rendering::Texture::contentHashMasterIndices.emplace(contentHash, insertedIndex);
     LOG_TRACE(TEXTURE, "Texture was inserted into master list at index {}", insertedIndex);
 
     return insertedIndex;
@@ -70,33 +185,36 @@ quartz::rendering::Texture::initializeMasterTextureList(
         1,
         1,
         4,
-        reinterpret_cast<const void*>(baseColorPixel.data())
+        reinterpret_cast<const void*>(baseColorPixel.data()),
+        quartz::rendering::Texture::Type::BaseColor
     );
     quartz::rendering::Texture::masterTextureList.push_back(p_baseColorDefault);
     quartz::rendering::Texture::baseColorDefaultMasterIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
     LOG_TRACE(TEXTURE, "Base color default texture master index: {}", quartz::rendering::Texture::baseColorDefaultMasterIndex);
 
     LOG_TRACE(TEXTURE, "Creating metallic roughness default texture");
-    const std::vector<uint8_t> metallicRoughnessPixel = { 0x00, 0xFF, 0xFF, 0xFF}; // Default to 1.0 metallic and 1.0 rough
+    const std::vector<uint8_t> metallicRoughnessPixel = { 0xFF, 0xFF }; // Default to 1.0 rough and 1.0 metallic, packed the way getPackedChannels says
     std::shared_ptr<quartz::rendering::Texture> p_metallicRoughnessDefault = std::make_shared<quartz::rendering::Texture>(
         renderingDevice,
         1,
         1,
-        4,
-        reinterpret_cast<const void*>(metallicRoughnessPixel.data())
+        2,
+        reinterpret_cast<const void*>(metallicRoughnessPixel.data()),
+        quartz::rendering::Texture::Type::MetallicRoughness
     );
     quartz::rendering::Texture::masterTextureList.push_back(p_metallicRoughnessDefault);
     quartz::rendering::Texture::metallicRoughnessDefaultMasterIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
     LOG_TRACE(TEXTURE, "Metallic roughness default texture master index: {}", quartz::rendering::Texture::metallicRoughnessDefaultMasterIndex);
 
     LOG_TRACE(TEXTURE, "Creating normal default texture");
-    const std::vector<uint8_t> normalPixel = { 0x7F, 0x7F, 0xFF, 0xFF}; // Default to no offset
+    const std::vector<uint8_t> normalPixel = { 0x7F, 0x7F }; // Default to no offset, z is rebuilt in the shader
     std::shared_ptr<quartz::rendering::Texture> p_normalDefault = std::make_shared<quartz::rendering::Texture>(
         renderingDevice,
         1,
         1,
-        4,
-        reinterpret_cast<const void*>(normalPixel.data())
+        2,
+        reinterpret_cast<const void*>(normalPixel.data()),
+        quartz::rendering::Texture::Type::Normal
     );
     quartz::rendering::Texture::masterTextureList.push_back(p_normalDefault);
     quartz::rendering::Texture::normalDefaultMasterIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
@@ -109,20 +227,22 @@ quartz::rendering::Texture::initializeMasterTextureList(
         1,
         1,
         4,
-        reinterpret_cast<const void*>(emissionPixel.data())
+        reinterpret_cast<const void*>(emissionPixel.data()),
+        quartz::rendering::Texture::Type::Emission
     );
     quartz::rendering::Texture::masterTextureList.push_back(p_emissionDefault);
     quartz::rendering::Texture::emissionDefaultMasterIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
     LOG_TRACE(TEXTURE, "Emission default texture master index: {}", quartz::rendering::Texture::emissionDefaultMasterIndex);
 
     LOG_TRACE(TEXTURE, "Creating occlusion default texture");
-    const std::vector<uint8_t> occlusionPixel = { 0xFF, 0x00, 0x00, 0x00}; // Default to no occlusion scale (don't bring down ambient light)
+    const std::vector<uint8_t> occlusionPixel = { 0xFF }; // Default to no occlusion scale (don't bring down ambient light)
     std::shared_ptr<quartz::rendering::Texture> p_occlusionDefault = std::make_shared<quartz::rendering::Texture>(
         renderingDevice,
         1,
         1,
-        4,
-        reinterpret_cast<const void*>(occlusionPixel.data())
+        1,
+        reinterpret_cast<const void*>(occlusionPixel.data()),
+        quartz::rendering::Texture::Type::Occlusion
     );
     quartz::rendering::Texture::masterTextureList.push_back(p_occlusionDefault);
     quartz::rendering::Texture::occlusionDefaultMasterIndex = quartz::rendering::Texture::masterTextureList.size() - 1;
@@ -134,6 +254,87 @@ quartz::rendering::Texture::cleanUpAllTextures() {
     LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "");
 
     quartz::rendering::Texture::masterTextureList.clear();
+    quartz::rendering::Texture::contentHashMasterIndices.clear();
+    quartz::rendering::SamplerCache::clear();
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+}
+
+uint64_t
+quartz::rendering::Texture::calculateContentHash(
+    const std::span<const uint8_t> bytes,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const quartz::rendering::Texture::Type textureType,
+    const tinygltf::Sampler& gltfSampler
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{} bytes", bytes.size());
+
+    const std::array<int32_t, 9> properties = {
+        static_cast<int32_t>(imageWidth),
+        static_cast<int32_t>(imageHeight),
+        static_cast<int32_t>(channelCount),
+        static_cast<int32_t>(textureType),
+        gltfSampler.minFilter,
+        gltfSampler.magFilter,
+        gltfSampler.wrapS,
+        gltfSampler.wrapT,
+        static_cast<int32_t>(bytes.size())
+    };
+
+    uint64_t hash = util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, properties.data(), sizeof(properties));
+    hash = util::Hash::fnv1a(hash, bytes.data(), bytes.size());
+
+    LOG_TRACE(TEXTURE, "Content hash is {:#018x}", hash);
+
+    return hash;
+}
+
+bool
+quartz::rendering::Texture::hasSameLevels(
+    const quartz::rendering::Texture::LevelData& levelDataA,
+    const quartz::rendering::Texture::LevelData& levelDataB
+) {
+    const bool hasSameLayout =
+        levelDataA.format == levelDataB.format &&
+        levelDataA.channelCount == levelDataB.channelCount &&
+        levelDataA.sizeBytes == levelDataB.sizeBytes &&
+        std::equal(
+            levelDataA.levels.begin(),
+            levelDataA.levels.end(),
+            levelDataB.levels.begin(),
+            levelDataB.levels.end(),
+            [](const quartz::rendering::UploadBatch::ImageLevel& levelA, const quartz::rendering::UploadBatch::ImageLevel& levelB) {
+                return levelA.width == levelB.width && levelA.height == levelB.height && levelA.offsetBytes == levelB.offsetBytes;
+            }
+        );
+    if (!hasSameLayout) {
+        return false;
+    }
+
+    // Either of them may be reading its levels out of a mapped file, so they are compared a level at a time
+    for (uint32_t i = 0; i < levelDataA.levels.size(); ++i) {
+        const std::span<const uint8_t> levelBytesA = levelDataA.getLevelBytes(i);
+        const std::span<const uint8_t> levelBytesB = levelDataB.getLevelBytes(i);
+        if (!std::equal(levelBytesA.begin(), levelBytesA.end(), levelBytesB.begin(), levelBytesB.end())) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+uint32_t
+quartz::rendering::Texture::getInitialResidentBaseLevel(
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels
+) {
+    for (uint32_t i = 0; i < levels.size(); ++i) {
+        if (std::max(levels[i].width, levels[i].height) <= quartz::rendering::Texture::initialResidentDimension) {
+            return i;
+        }
+    }
+
+    return levels.empty() ? 0 : levels.size() - 1;
 }
 
 std::string
@@ -154,6 +355,228 @@ quartz::rendering::Texture::getTextureTypeGLTFString(
     }
 }
 
+int32_t
+quartz::rendering::Texture::getGLTFImageIndex(
+    const tinygltf::Model& gltfModel,
+    const tinygltf::Texture& gltfTexture
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "texture \"{}\" with source {}", gltfTexture.name, gltfTexture.source);
+
+    const tinygltf::ExtensionMap::const_iterator basisuIterator = gltfTexture.extensions.find("KHR_texture_basisu");
+    if (basisuIterator != gltfTexture.extensions.end() && basisuIterator->second.Has("source")) {
+        const int32_t basisuImageIndex = basisuIterator->second.Get("source").GetNumberAsInt();
+        LOG_TRACE(TEXTURE, "Texture has a ktx2 image at index {}", basisuImageIndex);
+
+        const bool isUploadable =
+            basisuImageIndex >= 0 &&
+            static_cast<uint32_t>(basisuImageIndex) < gltfModel.images.size() &&
+            quartz::rendering::KTX2Container::isKTX2(gltfModel.images[basisuImageIndex].image) &&
+            !quartz::rendering::KTX2Container::requiresTranscoding(gltfModel.images[basisuImageIndex].image);
+        if (isUploadable) {
+            return basisuImageIndex;
+        }
+
+        LOG_WARNING(TEXTURE, "Ktx2 image {} of texture \"{}\" needs to be transcoded, which we can't do. Falling back to its source image", basisuImageIndex, gltfTexture.name);
+    }
+
+    if (gltfTexture.source < 0 || static_cast<uint32_t>(gltfTexture.source) >= gltfModel.images.size()) {
+        LOG_THROW(TEXTURE, util::RichException<tinygltf::Texture>, gltfTexture, "Texture \"{}\" has no image we can load", gltfTexture.name);
+    }
+
+    return gltfTexture.source;
+}
+
+std::vector<quartz::rendering::Texture::Type>
+quartz::rendering::Texture::getGLTFTextureTypes(
+    const tinygltf::Model& gltfModel
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{} textures", gltfModel.textures.size());
+
+    std::vector<quartz::rendering::Texture::Type> textureTypes(gltfModel.textures.size(), quartz::rendering::Texture::Type::BaseColor);
+    std::vector<bool> isTextureTyped(gltfModel.textures.size(), false);
+
+    for (const tinygltf::Material& gltfMaterial : gltfModel.materials) {
+        const std::array<std::pair<int32_t, quartz::rendering::Texture::Type>, 5> materialTextures = {{
+            {gltfMaterial.pbrMetallicRoughness.baseColorTexture.index, quartz::rendering::Texture::Type::BaseColor},
+            {gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index, quartz::rendering::Texture::Type::MetallicRoughness},
+            {gltfMaterial.normalTexture.index, quartz::rendering::Texture::Type::Normal},
+            {gltfMaterial.emissiveTexture.index, quartz::rendering::Texture::Type::Emission},
+            {gltfMaterial.occlusionTexture.index, quartz::rendering::Texture::Type::Occlusion}
+        }};
+
+        for (const std::pair<int32_t, quartz::rendering::Texture::Type>& materialTexture : materialTextures) {
+            const int32_t textureIndex = materialTexture.first;
+            const quartz::rendering::Texture::Type textureType = materialTexture.second;
+
+            if (textureIndex < 0 || static_cast<uint32_t>(textureIndex) >= textureTypes.size()) {
+                continue;
+            }
+
+            if (!isTextureTyped[textureIndex]) {
+                textureTypes[textureIndex] = textureType;
+                isTextureTyped[textureIndex] = true;
+                continue;
+            }
+
+            if (textureTypes[textureIndex] != textureType) {
+                LOG_TRACE(TEXTURE, "Texture {} is used as both a {} and a {}, keeping all of its channels", textureIndex, quartz::rendering::Texture::getTextureTypeGLTFString(textureTypes[textureIndex]), quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
+                textureTypes[textureIndex] = quartz::rendering::Texture::Type::BaseColor;
+            }
+        }
+    }
+
+    return textureTypes;
+}
+
+std::vector<uint32_t>
+quartz::rendering::Texture::getPackedChannels(
+    const quartz::rendering::Texture::Type textureType
+) {
+    switch (textureType) {
+        case quartz::rendering::Texture::Type::Occlusion:
+            return {0};
+        case quartz::rendering::Texture::Type::MetallicRoughness:
+            return {1, 2};
+        case quartz::rendering::Texture::Type::Normal:
+            return {0, 1};
+        case quartz::rendering::Texture::Type::BaseColor:
+        case quartz::rendering::Texture::Type::Emission:
+            return {0, 1, 2, 3};
+    }
+
+    return {0, 1, 2, 3};
+}
+
+std::vector<uint8_t>
+quartz::rendering::Texture::packChannels(
+    const uint8_t* p_pixels,
+    const uint32_t pixelCount,
+    const uint32_t channelCount,
+    const std::vector<uint32_t>& channels
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{} pixels from {} channels to {} channels", pixelCount, channelCount, channels.size());
+
+    std::vector<uint8_t> packedPixels(static_cast<size_t>(pixelCount) * channels.size());
+
+    for (uint32_t i = 0; i < pixelCount; ++i) {
+        const uint8_t* p_pixel = p_pixels + static_cast<size_t>(i) * channelCount;
+        uint8_t* p_packedPixel = packedPixels.data() + static_cast<size_t>(i) * channels.size();
+
+        for (uint32_t j = 0; j < channels.size(); ++j) {
+            const uint32_t channel = channels[j];
+            p_packedPixel[j] = channel < channelCount ? p_pixel[channel] : (channel == 3 ? 255 : 0);
+        }
+    }
+
+    return packedPixels;
+}
+
+uint32_t
+quartz::rendering::Texture::expandRGBToRGBAVectorized(
+    UNUSED const uint8_t* p_rgbPixels,
+    UNUSED const uint32_t pixelCount,
+    UNUSED uint8_t* p_rgbaPixels
+) {
+    uint32_t i = 0;
+
+#if defined __SSSE3__
+    // Spreads 4 rgb pixels (12 bytes) out into 4 rgba pixels, leaving the alpha bytes zeroed
+    const __m128i spreadMask = _mm_setr_epi8(0, 1, 2, -1, 3, 4, 5, -1, 6, 7, 8, -1, 9, 10, 11, -1);
+    const __m128i alphaMask = _mm_set1_epi32(static_cast<int32_t>(0xFF000000));
+
+    // 16 pixels at a time, which is 48 bytes in and 64 bytes out
+    for (; i + 16 <= pixelCount; i += 16) {
+        const uint8_t* p_source = p_rgbPixels + static_cast<size_t>(i) * 3;
+        uint8_t* p_destination = p_rgbaPixels + static_cast<size_t>(i) * 4;
+
+        const __m128i source0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source));
+        const __m128i source1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source + 16));
+        const __m128i source2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source + 32));
+
+        // Line up bytes 0, 12, 24, and 36 at the front of a register so each can be spread the same way
+        const __m128i pixels0 = source0;
+        const __m128i pixels1 = _mm_alignr_epi8(source1, source0, 12);
+        const __m128i pixels2 = _mm_alignr_epi8(source2, source1, 8);
+        const __m128i pixels3 = _mm_srli_si128(source2, 4);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination), _mm_or_si128(_mm_shuffle_epi8(pixels0, spreadMask), alphaMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination + 16), _mm_or_si128(_mm_shuffle_epi8(pixels1, spreadMask), alphaMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination + 32), _mm_or_si128(_mm_shuffle_epi8(pixels2, spreadMask), alphaMask));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination + 48), _mm_or_si128(_mm_shuffle_epi8(pixels3, spreadMask), alphaMask));
+    }
+#elif defined __ARM_NEON
+    // The structured loads and stores do the de and re-interleaving for us
+    const uint8x16_t alpha = vdupq_n_u8(255);
+
+    for (; i + 16 <= pixelCount; i += 16) {
+        const uint8x16x3_t rgb = vld3q_u8(p_rgbPixels + static_cast<size_t>(i) * 3);
+
+        uint8x16x4_t rgba;
+        rgba.val[0] = rgb.val[0];
+        rgba.val[1] = rgb.val[1];
+        rgba.val[2] = rgb.val[2];
+        rgba.val[3] = alpha;
+
+        vst4q_u8(p_rgbaPixels + static_cast<size_t>(i) * 4, rgba);
+    }
+#endif
+
+    return i;
+}
+
+void
+quartz::rendering::Texture::expandToRGBA(
+    const uint8_t* p_pixels,
+    const uint32_t pixelCount,
+    const uint32_t channelCount,
+    uint8_t* p_rgbaPixels
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{} pixels with {} channels", pixelCount, channelCount);
+
+    if (channelCount == 4) {
+        memcpy(p_rgbaPixels, p_pixels, static_cast<size_t>(pixelCount) * 4);
+        return;
+    }
+
+    // Rgb is the only layout common enough to be worth vectorizing
+    const uint32_t vectorizedPixelCount =
+        channelCount == 3 ?
+            quartz::rendering::Texture::expandRGBToRGBAVectorized(p_pixels, pixelCount, p_rgbaPixels) :
+            0;
+    LOG_TRACE(TEXTURE, "Expanded {} pixels with simd shuffles", vectorizedPixelCount);
+
+    for (uint32_t i = vectorizedPixelCount; i < pixelCount; ++i) {
+        const size_t baseDestinationIndex = static_cast<size_t>(i) * 4;
+        const size_t baseSourceIndex = static_cast<size_t>(i) * channelCount;
+
+        for (uint32_t j = 0; j < 4; ++j) {
+            p_rgbaPixels[baseDestinationIndex + j] = j < channelCount ? p_pixels[baseSourceIndex + j] : 0;
+        }
+
+        if (channelCount < 4) {
+            p_rgbaPixels[baseDestinationIndex + 3] = 255;
+        }
+    }
+}
+
+std::vector<uint8_t>
+quartz::rendering::Texture::expandToRGBA(
+    const uint8_t* p_pixels,
+    const uint32_t pixelCount,
+    const uint32_t channelCount
+) {
+    std::vector<uint8_t> rgbaPixels(static_cast<size_t>(pixelCount) * 4);
+
+    quartz::rendering::Texture::expandToRGBA(
+        p_pixels,
+        pixelCount,
+        channelCount,
+        rgbaPixels.data()
+    );
+
+    return rgbaPixels;
+}
+
 quartz::rendering::StagedImageBuffer
 quartz::rendering::Texture::createImageBufferFromFilepath(
     const quartz::rendering::Device& renderingDevice,
@@ -161,6 +584,18 @@ quartz::rendering::Texture::createImageBufferFromFilepath(
 ) {
     LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}", filepath);
 
+    if (quartz::rendering::KTX2Container::isKTX2Filepath(filepath)) {
+        LOG_TRACE(TEXTURE, "Mapping ktx2 container from {}", filepath);
+        const util::MappedFile mappedFile(filepath);
+        const quartz::rendering::KTX2Container container(mappedFile.getBytes(0, mappedFile.getSizeBytes()));
+
+        return quartz::rendering::Texture::createImageBufferFromLevelData(
+            renderingDevice,
+            quartz::rendering::Texture::loadLevelDataFromKTX2(renderingDevice, container),
+            0
+        );
+    }
+
     int32_t textureWidth;
     int32_t textureHeight;
     int32_t textureChannelCount;
@@ -188,6 +623,15 @@ quartz::rendering::Texture::createImageBufferFromFilepath(
     uint32_t textureSizeBytes = textureWidth * textureHeight * 4;
     LOG_TRACE(TEXTURE, "Successfully loaded {}x{} image with {} channels ( {} bytes ) from {}", textureWidth, textureHeight, textureChannelCount, textureSizeBytes, filepath);
 
+    const quartz::rendering::MipChain mipChain(
+        {p_texturePixels},
+        static_cast<uint32_t>(textureWidth),
+        static_cast<uint32_t>(textureHeight),
+        STBI_rgb_alpha,
+        4,
+        true
+    );
+
     quartz::rendering::StagedImageBuffer stagedImageBuffer(
         renderingDevice,
         static_cast<uint32_t>(textureWidth),
@@ -195,11 +639,12 @@ quartz::rendering::Texture::createImageBufferFromFilepath(
         static_cast<uint32_t>(textureChannelCount),
         textureSizeBytes,
         1,
+        mipChain.getLevelCount(),
         vk::ImageUsageFlagBits::eSampled,
         {},
         vk::Format::eR8G8B8A8Srgb,
         vk::ImageTiling::eOptimal,
-        p_texturePixels
+        [&mipChain](uint8_t* p_stagingData) { mipChain.write(p_stagingData); }
     );
 
     LOG_TRACE(TEXTURE, "Freeing stbi image");
@@ -208,86 +653,290 @@ quartz::rendering::Texture::createImageBufferFromFilepath(
     return stagedImageBuffer;
 }
 
-quartz::rendering::StagedImageBuffer
-quartz::rendering::Texture::createImageBufferFromGLTFImage(
-    const quartz::rendering::Device& renderingDevice,
-    const tinygltf::Image& gltfImage
+quartz::rendering::Texture::LevelData
+quartz::rendering::Texture::loadLevelDataFromGLTFImage(
+    const tinygltf::Image& gltfImage,
+    const quartz::rendering::Texture::Type textureType
 ) {
-    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "");
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}", quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
 
     int32_t textureWidth = gltfImage.width;
     int32_t textureHeight = gltfImage.height;
     int32_t textureChannelCount = gltfImage.component;
-    uint32_t textureSizeBytes;
-
-    uint8_t* p_intermediateRGBAPixels = nullptr;
-    const uint8_t* p_texturePixels;
 
     LOG_TRACE(TEXTURE, "gltf image is {}x{} with {} channels", textureWidth, textureHeight, textureChannelCount);
 
-    if (textureChannelCount == 3) {
-        /// @todo 2023/11/01 Check if we actually need to convert based on device support
-        LOG_DEBUG(TEXTURE, "Converting image data from 3 channels (RGB) to 4 channels (RGBA)");
-        LOG_DEBUG(TEXTURE, "  - We are assuming the current device doesn't support RGB only");
-
-        textureSizeBytes = textureWidth * textureHeight * 4; // rgba
-        p_intermediateRGBAPixels = new uint8_t[textureSizeBytes];
-        const uint8_t* p_sourceRGBPixels = &gltfImage.image[0];
-
-        // Copy every pixel from source rgb buffer to intermediate rgba buffer
-        for (uint32_t i = 0; i < static_cast<uint32_t>(gltfImage.height * gltfImage.width); ++i) {
-            const uint32_t baseIntermediateIndex = i * 4;
-            const uint32_t baseSourceIndex = i * textureChannelCount;
-
-            // Copy over the 3 bytes (one each for rgb) from source buffer
-            for (uint32_t j = 0; j < static_cast<uint32_t>(textureChannelCount); ++j) {
-                p_intermediateRGBAPixels[baseIntermediateIndex + j] = p_sourceRGBPixels[baseSourceIndex + j];
-            }
-        }
-
-        p_texturePixels = p_intermediateRGBAPixels;
-    } else {
-        LOG_DEBUG(TEXTURE, "Image data contains valid channel count of {}", textureChannelCount);
-        p_texturePixels = &gltfImage.image[0];
-        textureSizeBytes = gltfImage.image.size();
-    }
-    LOG_DEBUG(TEXTURE, "Got pixel data at {} with size of {} bytes", static_cast<const void*>(p_texturePixels), textureSizeBytes);
-
-    if (!p_texturePixels) {
+    if (gltfImage.image.empty()) {
         LOG_THROW(TEXTURE, util::RichException<tinygltf::Image>, gltfImage, "Failed to load texture from gltfImage with name \"{}\"", gltfImage.name);
     }
 
-    // x4 for rgba (32 bits = 4 bytes)
     LOG_TRACE(
         TEXTURE,
-        "Successfully loaded {}x{} texture with {} channels ( {} bytes ) from gltf image \"{}\"",
+        "Successfully loaded {}x{} texture with {} channels from gltf image \"{}\"",
         textureWidth,
         textureHeight,
         textureChannelCount,
-        textureSizeBytes,
         gltfImage.name
     );
 
-    quartz::rendering::StagedImageBuffer stagedImageBuffer(
-        renderingDevice,
+    const std::vector<uint32_t> packedChannels = quartz::rendering::Texture::getPackedChannels(textureType);
+    if (packedChannels.size() < 4) {
+        LOG_TRACE(TEXTURE, "Only keeping {} of the image's channels for a {}", packedChannels.size(), quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
+        const std::vector<uint8_t> packedPixels = quartz::rendering::Texture::packChannels(
+            gltfImage.image.data(),
+            static_cast<uint32_t>(textureWidth * textureHeight),
+            static_cast<uint32_t>(textureChannelCount),
+            packedChannels
+        );
+
+        return quartz::rendering::Texture::loadLevelDataFromPixels(
+            static_cast<uint32_t>(textureWidth),
+            static_cast<uint32_t>(textureHeight),
+            packedChannels.size(),
+            packedChannels.size(),
+            packedPixels.data()
+        );
+    }
+
+    if (textureChannelCount != 4) {
+        /// @todo 2023/11/01 Check if we actually need to convert based on device support
+        LOG_DEBUG(TEXTURE, "Converting image data from {} channels to 4 channels (RGBA) while generating its levels", textureChannelCount);
+        LOG_DEBUG(TEXTURE, "  - We are assuming the current device doesn't support RGB only");
+    }
+
+    return quartz::rendering::Texture::loadLevelDataFromPixels(
         static_cast<uint32_t>(textureWidth),
         static_cast<uint32_t>(textureHeight),
         static_cast<uint32_t>(textureChannelCount),
-        textureSizeBytes,
+        4,
+        gltfImage.image.data()
+    );
+}
+
+quartz::rendering::Texture::LevelData
+quartz::rendering::Texture::loadLevelDataFromKTX2(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::KTX2Container& container,
+    const std::shared_ptr<const util::MappedFile>& p_mappedFile
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}x{} {} with {} levels", container.getWidth(), container.getHeight(), vk::to_string(container.getVulkanFormat()), container.getLevelCount());
+
+    if (container.getLayerCount() > 1 || container.getFaceCount() != 1 || container.getDepth() > 1) {
+        LOG_THROW(TEXTURE, util::StringException, vk::to_string(container.getVulkanFormat()), "Only 2d ktx2 textures are supported, not {} layers with {} faces and a depth of {}", container.getLayerCount(), container.getFaceCount(), container.getDepth());
+    }
+
+    const vk::Format format = container.getVulkanFormat();
+    const vk::FormatProperties formatProperties = renderingDevice.getVulkanPhysicalDevice().getFormatProperties(format);
+
+    if (!(formatProperties.optimalTilingFeatures & vk::FormatFeatureFlagBits::eSampledImage)) {
+        if (quartz::rendering::BlockCompressor::getBlockSizeBytes(format) == 0) {
+            LOG_THROW(TEXTURE, util::StringException, vk::to_string(format), "Device can't sample {} and we can't decompress it", vk::to_string(format));
+        }
+
+        LOG_WARNING(TEXTURE, "Device can't sample {}, decompressing {}x{} texture on the cpu", vk::to_string(format), container.getWidth(), container.getHeight());
+        const std::vector<uint8_t> rgbaPixels = quartz::rendering::BlockCompressor::decompress(
+            format,
+            container.getLevel(0).data(),
+            container.getWidth(),
+            container.getHeight()
+        );
+
+        // Keep single and two channel formats that way so they are still swizzled like the original
+        const uint32_t decompressedChannelCount =
+            format == vk::Format::eBc4UnormBlock ? 1 :
+            format == vk::Format::eBc5UnormBlock ? 2 :
+            4;
+        const std::vector<uint32_t> decompressedChannels = {0, 1, 2, 3};
+        const std::vector<uint8_t> decompressedPixels = quartz::rendering::Texture::packChannels(
+            rgbaPixels.data(),
+            container.getWidth() * container.getHeight(),
+            4,
+            std::vector<uint32_t>(decompressedChannels.begin(), decompressedChannels.begin() + decompressedChannelCount)
+        );
+
+        return quartz::rendering::Texture::loadLevelDataFromPixels(
+            container.getWidth(),
+            container.getHeight(),
+            decompressedChannelCount,
+            decompressedChannelCount,
+            decompressedPixels.data()
+        );
+    }
+
+    quartz::rendering::Texture::LevelData levelData = {
+        format,
+        4,
+        container.getImageLevels(),
+        container.getLevelDataSizeBytes(),
+        {},
+        p_mappedFile,
+        {}
+    };
+
+    if (!p_mappedFile) {
+        LOG_TRACE(TEXTURE, "Container isn't mapped. Copying its {} bytes of levels", levelData.sizeBytes);
+        levelData.bytes.resize(levelData.sizeBytes);
+        container.writeLevels(levelData.bytes.data());
+
+        return levelData;
+    }
+
+    const std::span<const uint8_t> containerBytes = container.getBytes();
+    if (containerBytes.data() < p_mappedFile->getData() || containerBytes.data() + containerBytes.size() > p_mappedFile->getData() + p_mappedFile->getSizeBytes()) {
+        LOG_THROW(TEXTURE, util::StringException, p_mappedFile->getFilepath(), "Ktx2 container isn't within {}, so we can't read its levels back out of it", p_mappedFile->getFilepath());
+    }
+
+    LOG_TRACE(TEXTURE, "Reading {} bytes of levels out of {} whenever they are staged", levelData.sizeBytes, p_mappedFile->getFilepath());
+    levelData.mappedOffsets.reserve(container.getLevelCount());
+    for (uint32_t i = 0; i < container.getLevelCount(); ++i) {
+        levelData.mappedOffsets.push_back(container.getLevel(i).data() - p_mappedFile->getData());
+    }
+
+    return levelData;
+}
+
+quartz::rendering::Texture::LevelData
+quartz::rendering::Texture::loadLevelDataFromPixels(
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const uint32_t levelChannelCount,
+    const void* p_pixels
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}x{} with {} channels, storing {}", imageWidth, imageHeight, channelCount, levelChannelCount);
+
+    const quartz::rendering::MipChain mipChain(
+        {static_cast<const uint8_t*>(p_pixels)},
+        imageWidth,
+        imageHeight,
+        channelCount,
+        levelChannelCount,
+        false
+    );
+
+    quartz::rendering::Texture::LevelData levelData = {
+        quartz::rendering::Texture::getPackedVulkanFormat(levelChannelCount),
+        levelChannelCount,
+        mipChain.getLevels(),
+        mipChain.getSizeBytes(),
+        std::vector<uint8_t>(mipChain.getSizeBytes()),
+        nullptr,
+        {}
+    };
+    mipChain.write(levelData.bytes.data());
+
+    return levelData;
+}
+
+quartz::rendering::StagedImageBuffer
+quartz::rendering::Texture::createImageBufferFromLevelData(
+    const quartz::rendering::Device& renderingDevice,
+    const quartz::rendering::Texture::LevelData& levelData,
+    const uint32_t baseLevel
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "Levels {} through {}", baseLevel, levelData.levels.size() - 1);
+
+    // The levels we are keeping are staged back to back, the same as they are at the end of the level data
+    const vk::DeviceSize baseOffsetBytes = levelData.levels[baseLevel].offsetBytes;
+    std::vector<quartz::rendering::UploadBatch::ImageLevel> residentLevels(levelData.levels.begin() + baseLevel, levelData.levels.end());
+    for (quartz::rendering::UploadBatch::ImageLevel& residentLevel : residentLevels) {
+        residentLevel.offsetBytes -= baseOffsetBytes;
+    }
+
+    const uint32_t residentSizeBytes = levelData.sizeBytes - baseOffsetBytes;
+    LOG_TRACE(TEXTURE, "Staging {}x{} base level with {} bytes of levels", residentLevels[0].width, residentLevels[0].height, residentSizeBytes);
+
+    return {
+        renderingDevice,
+        residentLevels[0].width,
+        residentLevels[0].height,
+        levelData.channelCount,
         1,
+        residentLevels,
+        residentSizeBytes,
         vk::ImageUsageFlagBits::eSampled,
         {},
-        vk::Format::eR8G8B8A8Unorm,
+        levelData.format,
         vk::ImageTiling::eOptimal,
-        p_texturePixels
+        [&levelData, &residentLevels, baseLevel](uint8_t* p_stagingData) {
+            for (uint32_t i = 0; i < residentLevels.size(); ++i) {
+                const std::span<const uint8_t> levelBytes = levelData.getLevelBytes(baseLevel + i);
+                memcpy(p_stagingData + residentLevels[i].offsetBytes, levelBytes.data(), levelBytes.size());
+            }
+        }
+    };
+}
+
+quartz::rendering::StagedImageBuffer
+quartz::rendering::Texture::createImageBufferFromPixels(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const uint32_t levelChannelCount,
+    const void* p_pixels
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "{}x{} with {} channels, storing {}", imageWidth, imageHeight, channelCount, levelChannelCount);
+
+    const quartz::rendering::MipChain mipChain(
+        {static_cast<const uint8_t*>(p_pixels)},
+        imageWidth,
+        imageHeight,
+        channelCount,
+        levelChannelCount,
+        false
     );
 
-    if (p_intermediateRGBAPixels) {
-        LOG_TRACE(TEXTURE, "Used intermediate pixel buffer. Freeing it");
-        delete[] p_intermediateRGBAPixels;
+    return {
+        renderingDevice,
+        imageWidth,
+        imageHeight,
+        levelChannelCount,
+        imageWidth * imageHeight * levelChannelCount,
+        1,
+        mipChain.getLevelCount(),
+        vk::ImageUsageFlagBits::eSampled,
+        {},
+        quartz::rendering::Texture::getPackedVulkanFormat(levelChannelCount),
+        vk::ImageTiling::eOptimal,
+        [&mipChain](uint8_t* p_stagingData) { mipChain.write(p_stagingData); }
+    };
+}
+
+vk::Format
+quartz::rendering::Texture::getPackedVulkanFormat(
+    const uint32_t channelCount
+) {
+    switch (channelCount) {
+        case 1:
+            return vk::Format::eR8Unorm;
+        case 2:
+            return vk::Format::eR8G8Unorm;
     }
 
-    return stagedImageBuffer;
+    return vk::Format::eR8G8B8A8Unorm;
+}
+
+vk::ComponentMapping
+quartz::rendering::Texture::getVulkanComponentMapping(
+    const quartz::rendering::Texture::Type textureType,
+    const vk::Format format
+) {
+    const bool isTwoChannelFormat =
+        format == vk::Format::eR8G8Unorm ||
+        format == vk::Format::eBc5UnormBlock;
+
+    if (textureType == quartz::rendering::Texture::Type::MetallicRoughness && isTwoChannelFormat) {
+        LOG_TRACE(TEXTURE, "Swizzling packed metallic roughness back into green and blue");
+        return {
+            vk::ComponentSwizzle::eZero,
+            vk::ComponentSwizzle::eR,
+            vk::ComponentSwizzle::eG,
+            vk::ComponentSwizzle::eOne
+        };
+    }
+
+    return {};
 }
 
 vk::Filter
@@ -333,55 +982,74 @@ quartz::rendering::Texture::getVulkanSamplerAddressMode(const int32_t addressMod
     return vk::SamplerAddressMode::eRepeat;
 }
 
+quartz::rendering::SamplerCache::Key
+quartz::rendering::Texture::getSamplerCacheKey(
+    const quartz::rendering::Device& renderingDevice,
+    const tinygltf::Sampler& gltfSampler
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE, "");
+
+    quartz::rendering::SamplerCache::Key key = quartz::rendering::SamplerCache::getDefaultKey(renderingDevice);
+    key.magFilter = quartz::rendering::Texture::getVulkanFilterMode(gltfSampler.magFilter);
+    key.minFilter = quartz::rendering::Texture::getVulkanFilterMode(gltfSampler.minFilter);
+    key.addressModeU = quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapS);
+    key.addressModeV = quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapT);
+    key.addressModeW = quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapT);
+
+    return key;
+}
+
 quartz::rendering::Texture::Texture(
     const quartz::rendering::Device& renderingDevice,
     const uint32_t imageWidth,
     const uint32_t imageHeight,
     const uint32_t channelCount,
-    const void* p_pixels
+    const void* p_pixels,
+    const quartz::rendering::Texture::Type textureType
 ) :
+    m_type(textureType),
+    m_levelData(),
+    m_residentBaseLevel(0),
+    m_samplerKey(quartz::rendering::SamplerCache::getDefaultKey(renderingDevice)),
     m_stagedImageBuffer(
-        renderingDevice,
-        imageWidth,
-        imageHeight,
-        channelCount,
-        imageWidth * imageHeight * channelCount,
-        1,
-        vk::ImageUsageFlagBits::eSampled,
-        {},
-        vk::Format::eR8G8B8A8Unorm,
-        vk::ImageTiling::eOptimal,
-        p_pixels
+        quartz::rendering::Texture::createImageBufferFromPixels(
+            renderingDevice,
+            imageWidth,
+            imageHeight,
+            channelCount,
+            channelCount,
+            p_pixels
+        )
     ),
     mp_vulkanImageView(
         quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
             renderingDevice.getVulkanLogicalDevicePtr(),
             *(m_stagedImageBuffer.getVulkanImagePtr()),
             m_stagedImageBuffer.getVulkanFormat(),
-            {},
+            quartz::rendering::Texture::getVulkanComponentMapping(m_type, m_stagedImageBuffer.getVulkanFormat()),
             vk::ImageAspectFlagBits::eColor,
-            vk::ImageViewType::e2D
+            vk::ImageViewType::e2D,
+            m_stagedImageBuffer.getMipLevelCount()
         )
     ),
     mp_vulkanSampler(
-        quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            vk::Filter::eLinear,
-            vk::Filter::eLinear,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat
+        quartz::rendering::SamplerCache::getVulkanSamplerPtr(
+            renderingDevice,
+            m_samplerKey
         )
     )
 {
-    LOG_FUNCTION_CALL_TRACEthis("");
+    LOG_FUNCTION_CALL_TRACEthis("{}", quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
 }
 
 quartz::rendering::Texture::Texture(
     const quartz::rendering::Device& renderingDevice,
     const std::string& filepath
 ) :
+    m_type(quartz::rendering::Texture::Type::BaseColor),
+    m_levelData(),
+    m_residentBaseLevel(0),
+    m_samplerKey(quartz::rendering::SamplerCache::getDefaultKey(renderingDevice)),
     m_stagedImageBuffer(
         quartz::rendering::Texture::createImageBufferFromFilepath(
             renderingDevice,
@@ -395,18 +1063,14 @@ quartz::rendering::Texture::Texture(
             m_stagedImageBuffer.getVulkanFormat(),
             {},
             vk::ImageAspectFlagBits::eColor,
-            vk::ImageViewType::e2D
+            vk::ImageViewType::e2D,
+            m_stagedImageBuffer.getMipLevelCount()
         )
     ),
     mp_vulkanSampler(
-        quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            vk::Filter::eLinear,
-            vk::Filter::eLinear,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat,
-            vk::SamplerAddressMode::eRepeat
+        quartz::rendering::SamplerCache::getVulkanSamplerPtr(
+            renderingDevice,
+            m_samplerKey
         )
     )
 {
@@ -415,13 +1079,19 @@ quartz::rendering::Texture::Texture(
 
 quartz::rendering::Texture::Texture(
     const quartz::rendering::Device& renderingDevice,
-    const tinygltf::Image& gltfImage,
-    const tinygltf::Sampler& gltfSampler
+    quartz::rendering::Texture::LevelData&& levelData,
+    const quartz::rendering::SamplerCache::Key& samplerKey,
+    const quartz::rendering::Texture::Type textureType
 ) :
+    m_type(textureType),
+    m_levelData(std::move(levelData)),
+    m_residentBaseLevel(quartz::rendering::Texture::getInitialResidentBaseLevel(m_levelData.levels)),
+    m_samplerKey(samplerKey),
     m_stagedImageBuffer(
-        quartz::rendering::Texture::createImageBufferFromGLTFImage(
+        quartz::rendering::Texture::createImageBufferFromLevelData(
             renderingDevice,
-            gltfImage
+            m_levelData,
+            m_residentBaseLevel
         )
     ),
     mp_vulkanImageView(
@@ -429,27 +1099,27 @@ quartz::rendering::Texture::Texture(
             renderingDevice.getVulkanLogicalDevicePtr(),
             *(m_stagedImageBuffer.getVulkanImagePtr()),
             m_stagedImageBuffer.getVulkanFormat(),
-            {},
+            quartz::rendering::Texture::getVulkanComponentMapping(m_type, m_stagedImageBuffer.getVulkanFormat()),
             vk::ImageAspectFlagBits::eColor,
-            vk::ImageViewType::e2D
+            vk::ImageViewType::e2D,
+            m_stagedImageBuffer.getMipLevelCount()
         )
     ),
     mp_vulkanSampler(
-        quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
-            renderingDevice.getVulkanPhysicalDevice(),
-            renderingDevice.getVulkanLogicalDevicePtr(),
-            quartz::rendering::Texture::getVulkanFilterMode(gltfSampler.minFilter),
-            quartz::rendering::Texture::getVulkanFilterMode(gltfSampler.magFilter),
-            quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapS),
-            quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapT),
-            quartz::rendering::Texture::getVulkanSamplerAddressMode(gltfSampler.wrapT)
+        quartz::rendering::SamplerCache::getVulkanSamplerPtr(
+            renderingDevice,
+            m_samplerKey
         )
     )
 {
-    LOG_FUNCTION_CALL_TRACEthis("");
+    LOG_FUNCTION_CALL_TRACEthis("{}", quartz::rendering::Texture::getTextureTypeGLTFString(textureType));
 }
 
 quartz::rendering::Texture::Texture(quartz::rendering::Texture&& other) :
+    m_type(other.m_type),
+    m_levelData(std::move(other.m_levelData)),
+    m_residentBaseLevel(other.m_residentBaseLevel),
+    m_samplerKey(other.m_samplerKey),
     m_stagedImageBuffer(std::move(other.m_stagedImageBuffer)),
     mp_vulkanImageView(std::move(other.mp_vulkanImageView)),
     mp_vulkanSampler(std::move(other.mp_vulkanSampler))
@@ -460,3 +1130,78 @@ quartz::rendering::Texture::Texture(quartz::rendering::Texture&& other) :
 quartz::rendering::Texture::~Texture() {
     LOG_FUNCTION_CALL_TRACEthis("");
 }
+
+vk::DeviceSize
+quartz::rendering::Texture::getLevelDataSizeBytes(
+    const uint32_t baseLevel
+) const {
+    if (baseLevel >= m_levelData.levels.size()) {
+        return 0;
+    }
+
+    return m_levelData.sizeBytes - m_levelData.levels[baseLevel].offsetBytes;
+}
+
+bool
+quartz::rendering::Texture::hasSameContent(
+    const quartz::rendering::Texture::LevelData& levelData,
+    const quartz::rendering::SamplerCache::Key& samplerKey,
+    const quartz::rendering::Texture::Type textureType
+) const {
+    return
+        m_type == textureType &&
+        m_samplerKey == samplerKey &&
+        quartz::rendering::Texture::hasSameLevels(m_levelData, levelData);
+}
+
+quartz::rendering::Texture::ResidentImage
+quartz::rendering::Texture::createResidentImage(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t baseLevel
+) const {
+    LOG_FUNCTION_SCOPE_TRACEthis("level {} of {}", baseLevel, m_levelData.levels.size());
+
+    if (baseLevel >= m_levelData.levels.size()) {
+        LOG_THROW(TEXTURE, util::RichException<uint32_t>, baseLevel, "Can't make level {} resident in a texture with {} streamed levels", baseLevel, m_levelData.levels.size());
+    }
+
+    quartz::rendering::StagedImageBuffer stagedImageBuffer = quartz::rendering::Texture::createImageBufferFromLevelData(
+        renderingDevice,
+        m_levelData,
+        baseLevel
+    );
+    vk::UniqueImageView p_vulkanImageView = quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
+        renderingDevice.getVulkanLogicalDevicePtr(),
+        *(stagedImageBuffer.getVulkanImagePtr()),
+        stagedImageBuffer.getVulkanFormat(),
+        quartz::rendering::Texture::getVulkanComponentMapping(m_type, stagedImageBuffer.getVulkanFormat()),
+        vk::ImageAspectFlagBits::eColor,
+        vk::ImageViewType::e2D,
+        stagedImageBuffer.getMipLevelCount()
+    );
+
+    return {
+        std::move(stagedImageBuffer),
+        std::move(p_vulkanImageView),
+        baseLevel
+    };
+}
+
+quartz::rendering::Texture::ResidentImage
+quartz::rendering::Texture::swapResidentImage(
+    quartz::rendering::Texture::ResidentImage&& residentImage
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("level {} to level {} of {}", m_residentBaseLevel, residentImage.baseLevel, m_levelData.levels.size());
+
+    quartz::rendering::Texture::ResidentImage retiredImage = {
+        std::move(m_stagedImageBuffer),
+        std::move(mp_vulkanImageView),
+        m_residentBaseLevel
+    };
+
+    m_stagedImageBuffer = std::move(residentImage.stagedImageBuffer);
+    mp_vulkanImageView = std::move(residentImage.p_vulkanImageView);
+    m_residentBaseLevel = residentImage.baseLevel;
+
+    return retiredImage;
+}
@@ -1,13 +1,21 @@
 #pragma once
 
+#include <map>
+#include <memory>
+#include <span>
 #include <string>
+#include <vector>
 
 #define TINYGLTF_NO_STB_IMAGE_WRITE
 #include <tiny_gltf.h>
 
+#include "util/file_system/MappedFile.hpp"
+
 #include "quartz/rendering/Loggers.hpp"
 #include "quartz/rendering/buffer/StagedImageBuffer.hpp"
 #include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+#include "quartz/rendering/texture/SamplerCache.hpp"
 
 namespace quartz {
 namespace rendering {
@@ -15,7 +23,46 @@ namespace rendering {
 }
 }
 
+/**
+ * @brief Textures loaded from models are streamed. They start out with only their smallest levels on
+ *   the gpu, and the TextureStreamer swaps in images with more or fewer levels depending on how large
+ *   they are on screen and how much memory is left.
+ *
+ * @brief Textures out of a cooked model read their levels back out of the mapped file whenever they
+ *   need them, so none of their levels are held on the cpu. Anything else has no file to go back to,
+ *   so it keeps every level it generated.
+ */
 class quartz::rendering::Texture {
+public: // classes
+    /**
+     * @brief Every level of a streamed texture, either held in bytes laid out the way they are staged,
+     *   or left in a mapped file and read from there whenever they are staged
+     */
+    struct LevelData {
+    public: // member functions
+        std::span<const uint8_t> getLevelBytes(const uint32_t level) const;
+
+    public: // member variables
+        vk::Format format;
+        uint32_t channelCount;
+        std::vector<quartz::rendering::UploadBatch::ImageLevel> levels; // largest first, where each is staged
+        vk::DeviceSize sizeBytes; // of every level
+        std::vector<uint8_t> bytes; // empty when the levels are in p_mappedFile
+        std::shared_ptr<const util::MappedFile> p_mappedFile;
+        std::vector<uint64_t> mappedOffsets; // of each level within p_mappedFile
+    };
+
+    /**
+     * @brief An image and the view sampling it, which is what gets swapped out when a streamed
+     *   texture's resident levels change
+     */
+    struct ResidentImage {
+    public: // member variables
+        quartz::rendering::StagedImageBuffer stagedImageBuffer;
+        vk::UniqueImageView p_vulkanImageView;
+        uint32_t baseLevel;
+    };
+
 public: // enums
     enum class Type {
         BaseColor = 0,
@@ -31,15 +78,105 @@ public: // static functions
     static uint32_t createTexture(
         const quartz::rendering::Device& renderingDevice,
         const tinygltf::Image& gltfImage,
-        const tinygltf::Sampler& gltfSampler
+        const tinygltf::Sampler& gltfSampler,
+        const quartz::rendering::Texture::Type textureType
+    );
+    /**
+     * @brief If the container is in p_mappedFile its levels are read from there instead of being
+     *   copied, and the texture keeps the file mapped
+     */
+    static uint32_t createTexture(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::KTX2Container& container,
+        const std::shared_ptr<const util::MappedFile>& p_mappedFile,
+        const tinygltf::Sampler& gltfSampler,
+        const quartz::rendering::Texture::Type textureType
     );
     static void initializeMasterTextureList(
         const quartz::rendering::Device& renderingDevice
     );
     static void cleanUpAllTextures();
 
+    /**
+     * @brief Identifies a texture by the bytes it is loaded from along with everything else that
+     *   changes what ends up on the gpu, so the same image embedded in many models is only ever
+     *   uploaded once. The bytes are either an image's decoded pixels or a ktx2 container
+     */
+    static uint64_t calculateContentHash(
+        const std::span<const uint8_t> bytes,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const quartz::rendering::Texture::Type textureType,
+        const tinygltf::Sampler& gltfSampler
+    );
+    /**
+     * @brief Compares the levels byte for byte. The hashes are calculated from whatever the levels
+     *   were loaded out of, so two textures can only share levels once their hashes have matched
+     */
+    static bool hasSameLevels(
+        const quartz::rendering::Texture::LevelData& levelDataA,
+        const quartz::rendering::Texture::LevelData& levelDataB
+    );
+
     static std::string getTextureTypeGLTFString(const quartz::rendering::Texture::Type type);
 
+    /**
+     * @brief The image a gltf texture should be loaded from. Textures using KHR_texture_basisu point
+     *   at a ktx2 image, which we prefer when we can upload it as it is. Basis universal payloads
+     *   need transcoding, so for those we fall back to the texture's regular source image
+     */
+    static int32_t getGLTFImageIndex(
+        const tinygltf::Model& gltfModel,
+        const tinygltf::Texture& gltfTexture
+    );
+    /**
+     * @brief How the materials use each of the model's textures, so each can be stored with only the
+     *   channels it needs. Unused textures are treated as base color. Textures used in more than one
+     *   way are also treated as base color, which keeps every channel. That is what keeps occlusion,
+     *   roughness, and metallic packed into one orm texture when the gltf file shares them
+     */
+    static std::vector<quartz::rendering::Texture::Type> getGLTFTextureTypes(
+        const tinygltf::Model& gltfModel
+    );
+
+    /**
+     * @brief The channels of a gltf image that a texture of this type reads, in the order we store
+     *   them. Occlusion only reads red, metallic roughness only reads green and blue, and normals
+     *   only need red and green because the shader rebuilds z
+     */
+    static std::vector<uint32_t> getPackedChannels(const quartz::rendering::Texture::Type textureType);
+    /**
+     * @brief Keeps only the given channels of each pixel, tightly packed. Channels the pixels don't
+     *   have are filled the same way expandToRGBA fills them
+     */
+    static std::vector<uint8_t> packChannels(
+        const uint8_t* p_pixels,
+        const uint32_t pixelCount,
+        const uint32_t channelCount,
+        const std::vector<uint32_t>& channels
+    );
+
+    /**
+     * @brief We assume the device can't sample rgb only images, so everything is uploaded as rgba.
+     *   Missing color channels are zero and missing alpha is opaque
+     */
+    static std::vector<uint8_t> expandToRGBA(
+        const uint8_t* p_pixels,
+        const uint32_t pixelCount,
+        const uint32_t channelCount
+    );
+    /**
+     * @brief Expands into p_rgbaPixels, which must have room for pixelCount * 4 bytes. This lets the
+     *   expansion write straight into staging memory instead of into a buffer which then gets copied
+     */
+    static void expandToRGBA(
+        const uint8_t* p_pixels,
+        const uint32_t pixelCount,
+        const uint32_t channelCount,
+        uint8_t* p_rgbaPixels
+    );
+
     static const vk::UniqueSampler& getDefaultVulkanSamplerPtr() { return quartz::rendering::Texture::masterTextureList[quartz::rendering::Texture::baseColorDefaultMasterIndex]->getVulkanSamplerPtr(); }
 
     static uint32_t getBaseColorDefaultMasterIndex() { return quartz::rendering::Texture::baseColorDefaultMasterIndex; }
@@ -51,17 +188,88 @@ public: // static functions
     static std::weak_ptr<Texture> getTexturePtr(const uint32_t index) { return quartz::rendering::Texture::masterTextureList[index]; }
     static const std::vector<std::shared_ptr<quartz::rendering::Texture>>& getMasterTextureList() { return quartz::rendering::Texture::masterTextureList; }
 
+    /**
+     * @brief The largest level a streamed texture starts out with, which is the largest one no bigger
+     *   than initialResidentDimension, or the smallest level if every level is bigger
+     */
+    static uint32_t getInitialResidentBaseLevel(const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels);
+
+public: // static variables
+    static constexpr uint32_t initialResidentDimension = 64;
+
 private: // static functions
     static quartz::rendering::StagedImageBuffer createImageBufferFromFilepath(
         const quartz::rendering::Device& renderingDevice,
         const std::string& filepath
     );
-    static quartz::rendering::StagedImageBuffer createImageBufferFromGLTFImage(
+    static quartz::rendering::Texture::LevelData loadLevelDataFromGLTFImage(
+        const tinygltf::Image& gltfImage,
+        const quartz::rendering::Texture::Type textureType
+    );
+    /**
+     * @brief Uses the container's levels as they are, pointing at them in p_mappedFile when there is
+     *   one and copying them otherwise. If the device can't sample the container's format we
+     *   decompress the largest level and generate mips from it like any other pixels
+     */
+    static quartz::rendering::Texture::LevelData loadLevelDataFromKTX2(
         const quartz::rendering::Device& renderingDevice,
-        const tinygltf::Image& gltfImage
+        const quartz::rendering::KTX2Container& container,
+        const std::shared_ptr<const util::MappedFile>& p_mappedFile
+    );
+    /**
+     * @brief The texture has levelChannelCount channels, which must either be 4 or match the pixels
+     */
+    static quartz::rendering::Texture::LevelData loadLevelDataFromPixels(
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const uint32_t levelChannelCount,
+        const void* p_pixels
+    );
+    /**
+     * @brief An image holding baseLevel and every level smaller than it
+     */
+    static quartz::rendering::StagedImageBuffer createImageBufferFromLevelData(
+        const quartz::rendering::Device& renderingDevice,
+        const quartz::rendering::Texture::LevelData& levelData,
+        const uint32_t baseLevel
+    );
+    /**
+     * @brief The texture has levelChannelCount channels, which must either be 4 or match the pixels
+     */
+    static quartz::rendering::StagedImageBuffer createImageBufferFromPixels(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const uint32_t levelChannelCount,
+        const void* p_pixels
+    );
+    /**
+     * @brief Expands as many of the pixels as it can with simd shuffles, returning how many it
+     *   expanded so the caller can finish off the remainder
+     */
+    static uint32_t expandRGBToRGBAVectorized(
+        const uint8_t* p_rgbPixels,
+        const uint32_t pixelCount,
+        uint8_t* p_rgbaPixels
+    );
+    static vk::Format getPackedVulkanFormat(const uint32_t channelCount);
+    /**
+     * @brief Metallic roughness packed into two channels is stored as red and green, so the view
+     *   swizzles them back to the green and blue the shader reads. Everything else reads its
+     *   channels where they are stored
+     */
+    static vk::ComponentMapping getVulkanComponentMapping(
+        const quartz::rendering::Texture::Type textureType,
+        const vk::Format format
     );
     static vk::Filter getVulkanFilterMode(const int32_t filterMode);
     static vk::SamplerAddressMode getVulkanSamplerAddressMode(const int32_t addressMode);
+    static quartz::rendering::SamplerCache::Key getSamplerCacheKey(
+        const quartz::rendering::Device& renderingDevice,
+        const tinygltf::Sampler& gltfSampler
+    );
 
 private: // static variables
     static uint32_t baseColorDefaultMasterIndex;
@@ -70,25 +278,34 @@ private: // static variables
     static uint32_t emissionDefaultMasterIndex;
     static uint32_t occlusionDefaultMasterIndex;
     static std::vector<std::shared_ptr<Texture>> masterTextureList;
+    static std::multimap<uint64_t, uint32_t> contentHashMasterIndices;
 
 // -----+++++===== Instance Interface =====+++++----- //
 
 public: // member functions
+    /**
+     * @brief The pixels must already be packed the way getPackedChannels says for the type
+     */
     Texture(
         const quartz::rendering::Device& renderingDevice,
         const uint32_t imageWidth,
         const uint32_t imageHeight,
         const uint32_t channelCount,
-        const void* p_pixels
+        const void* p_pixels,
+        const quartz::rendering::Texture::Type textureType
     );
     Texture(
         const quartz::rendering::Device& renderingDevice,
         const std::string& filepath
     );
+    /**
+     * @brief A streamed texture, starting out with its initial resident levels on the gpu
+     */
     Texture(
         const quartz::rendering::Device& renderingDevice,
-        const tinygltf::Image& gltfImage,
-        const tinygltf::Sampler& gltfSampler
+        quartz::rendering::Texture::LevelData&& levelData,
+        const quartz::rendering::SamplerCache::Key& samplerKey,
+        const quartz::rendering::Texture::Type textureType
     );
     Texture(Texture&& other);
     ~Texture();
@@ -96,15 +313,50 @@ public: // member functions
     USE_LOGGER(TEXTURE);
 
     const vk::UniqueImageView& getVulkanImageViewPtr() const { return mp_vulkanImageView; }
-    const vk::UniqueSampler& getVulkanSamplerPtr() const { return mp_vulkanSampler; }
+    const vk::UniqueSampler& getVulkanSamplerPtr() const { return *mp_vulkanSampler; }
+
+    bool getIsStreamed() const { return !m_levelData.levels.empty(); }
+    const quartz::rendering::Texture::LevelData& getLevelData() const { return m_levelData; }
+    uint32_t getResidentBaseLevel() const { return m_residentBaseLevel; }
+    vk::DeviceSize getResidentSizeBytes() const { return getLevelDataSizeBytes(m_residentBaseLevel); }
+
+    /**
+     * @brief Of baseLevel and every level smaller than it. 0 for textures which aren't streamed
+     */
+    vk::DeviceSize getLevelDataSizeBytes(const uint32_t baseLevel) const;
+
+    /**
+     * @brief Whether a texture loaded from these levels would be identical to this one, which is
+     *   everything calculateContentHash covers
+     */
+    bool hasSameContent(
+        const quartz::rendering::Texture::LevelData& levelData,
+        const quartz::rendering::SamplerCache::Key& samplerKey,
+        const quartz::rendering::Texture::Type textureType
+    ) const;
 
-private: // member variables
     /**
-     * @todo 2023/11/10 We probably only want to have one sampler for each type of texture. It seems
-     *   to be the case that all base color textures will have the same type of sampler,
-     *   likewise with all normal textures, etc ...
+     * @brief An image holding baseLevel and every level smaller than it. Its upload joins whichever
+     *   upload batch is recording, so it must not be swapped in until that batch has completed
      */
+    quartz::rendering::Texture::ResidentImage createResidentImage(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t baseLevel
+    ) const;
+    /**
+     * @brief Starts sampling residentImage instead of the current image. The previous image is handed
+     *   back, and must be kept alive until the gpu has finished every frame which might be sampling it
+     */
+    quartz::rendering::Texture::ResidentImage swapResidentImage(
+        quartz::rendering::Texture::ResidentImage&& residentImage
+    );
+
+private: // member variables
+    quartz::rendering::Texture::Type m_type;
+    quartz::rendering::Texture::LevelData m_levelData; // empty for textures which aren't streamed
+    uint32_t m_residentBaseLevel;
+    quartz::rendering::SamplerCache::Key m_samplerKey;
     quartz::rendering::StagedImageBuffer m_stagedImageBuffer;
     vk::UniqueImageView mp_vulkanImageView;
-    vk::UniqueSampler mp_vulkanSampler;
+    std::shared_ptr<vk::UniqueSampler> mp_vulkanSampler; // shared with every texture sampled the same way
 };
\ No newline at end of file
@@ -0,0 +1,145 @@
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <stb_image.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/texture/BlockCompressor.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+#include "quartz/rendering/texture/MipChain.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureCooker.hpp"
+
+vk::Format
+quartz::rendering::TextureCooker::getCookedFormat(
+    const quartz::rendering::Texture::Type textureType,
+    const bool hasTranslucency
+) {
+    switch (textureType) {
+        case quartz::rendering::Texture::Type::BaseColor:
+            return hasTranslucency ? vk::Format::eBc3UnormBlock : vk::Format::eBc1RgbUnormBlock;
+        case quartz::rendering::Texture::Type::Normal:
+        case quartz::rendering::Texture::Type::MetallicRoughness:
+            return vk::Format::eBc5UnormBlock;
+        case quartz::rendering::Texture::Type::Occlusion:
+            return vk::Format::eBc4UnormBlock;
+        case quartz::rendering::Texture::Type::Emission:
+            return vk::Format::eBc1RgbUnormBlock;
+    }
+}
+
+std::vector<uint8_t>
+quartz::rendering::TextureCooker::cook(
+    const uint8_t* p_pixels,
+    const uint32_t imageWidth,
+    const uint32_t imageHeight,
+    const uint32_t channelCount,
+    const quartz::rendering::Texture::Type textureType
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_COOKED, "{}x{} {} with {} channels", imageWidth, imageHeight, quartz::rendering::Texture::getTextureTypeGLTFString(textureType), channelCount);
+
+    // The block compressor reads the channels it stores from the front of each rgba pixel, so the
+    // channels this type keeps are packed there first, the same way an uncooked texture packs them
+    const std::vector<uint32_t> packedChannels = quartz::rendering::Texture::getPackedChannels(textureType);
+    const std::vector<uint8_t> packedPixels = quartz::rendering::Texture::packChannels(
+        p_pixels,
+        imageWidth * imageHeight,
+        channelCount,
+        packedChannels
+    );
+
+    const quartz::rendering::MipChain mipChain(
+        {packedPixels.data()},
+        imageWidth,
+        imageHeight,
+        packedChannels.size(),
+        4,
+        false
+    );
+
+    std::vector<uint8_t> rgbaPixels(mipChain.getSizeBytes());
+    mipChain.write(rgbaPixels.data());
+
+    bool hasTranslucency = false;
+    for (uint32_t i = 0; i < imageWidth * imageHeight && !hasTranslucency; ++i) {
+        hasTranslucency = rgbaPixels[static_cast<size_t>(i) * 4 + 3] != 255;
+    }
+
+    const vk::Format format = quartz::rendering::TextureCooker::getCookedFormat(textureType, hasTranslucency);
+    LOG_TRACE(TEXTURE_COOKED, "Compressing {} levels to {}", mipChain.getLevelCount(), vk::to_string(format));
+
+    std::vector<std::vector<uint8_t>> levels;
+    levels.reserve(mipChain.getLevelCount());
+
+    for (const quartz::rendering::UploadBatch::ImageLevel& level : mipChain.getLevels()) {
+        levels.push_back(quartz::rendering::BlockCompressor::compress(
+            format,
+            rgbaPixels.data() + level.offsetBytes,
+            level.width,
+            level.height
+        ));
+    }
+
+    std::vector<uint8_t> bytes = quartz::rendering::KTX2Container::write(
+        format,
+        imageWidth,
+        imageHeight,
+        levels
+    );
+    LOG_TRACE(TEXTURE_COOKED, "Cooked {} bytes of rgba into a {} byte container", rgbaPixels.size(), bytes.size());
+
+    return bytes;
+}
+
+void
+quartz::rendering::TextureCooker::cookFile(
+    const std::string& imageFilepath,
+    const std::string& ktx2Filepath,
+    const quartz::rendering::Texture::Type textureType
+) {
+    LOG_FUNCTION_SCOPE_TRACE(TEXTURE_COOKED, "{} -> {}", imageFilepath, ktx2Filepath);
+
+    int32_t imageWidth;
+    int32_t imageHeight;
+    int32_t fileChannelCount;
+    const std::unique_ptr<uint8_t, void(*)(void*)> p_pixels(
+        stbi_load(
+            imageFilepath.c_str(),
+            &imageWidth,
+            &imageHeight,
+            &fileChannelCount,
+            STBI_rgb_alpha
+        ),
+        stbi_image_free
+    );
+    if (!p_pixels) {
+        LOG_THROW(TEXTURE_COOKED, util::StringException, imageFilepath, "Failed to load {} ({})", imageFilepath, stbi_failure_reason());
+    }
+
+    const std::vector<uint8_t> bytes = quartz::rendering::TextureCooker::cook(
+        p_pixels.get(),
+        imageWidth,
+        imageHeight,
+        STBI_rgb_alpha,
+        textureType
+    );
+
+    std::ofstream outfile(ktx2Filepath, std::ios::binary | std::ios::trunc);
+    if (!outfile.is_open()) {
+        LOG_THROW(TEXTURE_COOKED, util::StringException, ktx2Filepath, "Failed to open {} for binary writing", ktx2Filepath);
+    }
+
+    outfile.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    if (!outfile) {
+        LOG_THROW(TEXTURE_COOKED, util::StringException, ktx2Filepath, "Failed to write {} bytes to {}", bytes.size(), ktx2Filepath);
+    }
+
+    LOG_INFO(TEXTURE_COOKED, "Cooked {} into {} ({} bytes)", imageFilepath, ktx2Filepath, bytes.size());
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+
+namespace quartz {
+namespace rendering {
+    class TextureCooker;
+}
+}
+
+/**
+ * @brief Turns decoded pixels into a ktx2 container holding a full, block compressed mip chain,
+ *   which quartz::rendering::Texture uploads without decoding, expanding, or filtering anything.
+ *   Used by quartz::rendering::ModelCooker for the textures in a model, and by quartz_cook for
+ *   standalone images.
+ *
+ * @brief The mips are generated with the same quartz::rendering::MipChain an uncooked texture uses,
+ *   and the format is picked from the type of texture (see getCookedFormat).
+ */
+class quartz::rendering::TextureCooker {
+public: // member functions
+    TextureCooker() = delete;
+
+public: // static functions
+    /**
+     * @brief Each type gets the smallest format holding the channels Texture::getPackedChannels keeps
+     *   for it. Bc4 for occlusion, bc5 for normals and metallic roughness, and bc1 for emission. Base
+     *   color gets bc3 when it has any translucency and bc1 otherwise. These are the unorm formats
+     *   because that is how we sample uncooked gltf textures
+     */
+    static vk::Format getCookedFormat(
+        const quartz::rendering::Texture::Type textureType,
+        const bool hasTranslucency
+    );
+
+    static std::vector<uint8_t> cook(
+        const uint8_t* p_pixels,
+        const uint32_t imageWidth,
+        const uint32_t imageHeight,
+        const uint32_t channelCount,
+        const quartz::rendering::Texture::Type textureType
+    );
+    static void cookFile(
+        const std::string& imageFilepath,
+        const std::string& ktx2Filepath,
+        const quartz::rendering::Texture::Type textureType
+    );
+};
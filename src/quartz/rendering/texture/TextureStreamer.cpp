@@ -0,0 +1,299 @@
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureStreamer.hpp"
+
+uint32_t
+quartz::rendering::TextureStreamer::getDesiredBaseLevel(
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+    const uint32_t dimension
+) {
+    uint32_t desiredBaseLevel = 0;
+    for (uint32_t i = 0; i < levels.size(); ++i) {
+        if (std::max(levels[i].width, levels[i].height) < dimension) {
+            break;
+        }
+        desiredBaseLevel = i;
+    }
+
+    return std::min(desiredBaseLevel, quartz::rendering::Texture::getInitialResidentBaseLevel(levels));
+}
+
+quartz::rendering::TextureStreamer::TextureStreamer(
+    const vk::DeviceSize budgetBytes,
+    const vk::DeviceSize maxUploadBytesPerFrame,
+    const uint32_t retiredFrameCount
+) :
+    m_budgetBytes(budgetBytes),
+    m_maxUploadBytesPerFrame(maxUploadBytesPerFrame),
+    m_retiredFrameCount(retiredFrameCount),
+    m_frameNumber(0),
+    m_residentBytes(0),
+    m_uploadingBytes(0),
+    m_retiredBytes(0),
+    m_textureStates(),
+    m_retiredImages(),
+    m_uploadingImages(),
+    m_isUploading(),
+    mp_uploadBatch(),
+    m_upgradeMasterIndices(),
+    m_evictionMasterIndices()
+{
+    LOG_FUNCTION_CALL_TRACEthis("{} byte budget, uploading at most {} bytes per frame", m_budgetBytes, m_maxUploadBytesPerFrame);
+}
+
+quartz::rendering::TextureStreamer::~TextureStreamer() {
+    LOG_FUNCTION_CALL_TRACEthis("");
+}
+
+void
+quartz::rendering::TextureStreamer::request(
+    const uint32_t textureMasterIndex,
+    const uint32_t dimension
+) {
+    if (textureMasterIndex >= m_textureStates.size()) {
+        m_textureStates.resize(textureMasterIndex + 1, {0, 0});
+    }
+
+    quartz::rendering::TextureStreamer::TextureState& textureState = m_textureStates[textureMasterIndex];
+    textureState.requestedDimension = std::max(textureState.requestedDimension, dimension);
+}
+
+bool
+quartz::rendering::TextureStreamer::update(
+    const quartz::rendering::Device& renderingDevice
+) {
+    m_frameNumber++;
+
+    while (!m_retiredImages.empty() && m_frameNumber - m_retiredImages.front().retiredFrame > m_retiredFrameCount) {
+        m_retiredBytes -= m_retiredImages.front().sizeBytes;
+        m_retiredImages.pop_front();
+    }
+
+    const bool texturesChanged = this->swapUploadedImages();
+
+    const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs = quartz::rendering::Texture::getMasterTextureList();
+    m_textureStates.resize(texturePtrs.size(), {0, 0});
+    m_isUploading.resize(texturePtrs.size(), false);
+
+    m_residentBytes = 0;
+    m_upgradeMasterIndices.clear();
+    for (uint32_t i = 0; i < texturePtrs.size(); ++i) {
+        const quartz::rendering::Texture& texture = *(texturePtrs[i]);
+        if (!texture.getIsStreamed()) {
+            continue;
+        }
+
+        m_residentBytes += texture.getResidentSizeBytes();
+
+        quartz::rendering::TextureStreamer::TextureState& textureState = m_textureStates[i];
+        if (textureState.requestedDimension == 0) {
+            continue;
+        }
+
+        textureState.lastRequestedFrame = m_frameNumber;
+        if (quartz::rendering::TextureStreamer::getDesiredBaseLevel(texture.getLevelData().levels, textureState.requestedDimension) < texture.getResidentBaseLevel()) {
+            m_upgradeMasterIndices.push_back(i);
+        }
+    }
+
+    if (mp_uploadBatch) {
+        LOG_TRACEthis("Still uploading {} images. Not uploading anything else", m_uploadingImages.size());
+    } else {
+        this->upgrade(renderingDevice);
+    }
+
+    for (quartz::rendering::TextureStreamer::TextureState& textureState : m_textureStates) {
+        textureState.requestedDimension = 0;
+    }
+
+    return texturesChanged;
+}
+
+void
+quartz::rendering::TextureStreamer::reset() {
+    LOG_FUNCTION_SCOPE_TRACEthis("Destroying {} retired images and {} uploading images", m_retiredImages.size(), m_uploadingImages.size());
+
+    // The batch goes first so it is done with the images before they are destroyed
+    mp_uploadBatch.reset();
+    m_uploadingImages.clear();
+    m_isUploading.clear();
+
+    m_residentBytes = 0;
+    m_uploadingBytes = 0;
+    m_retiredBytes = 0;
+    m_textureStates.clear();
+    m_retiredImages.clear();
+}
+
+void
+quartz::rendering::TextureStreamer::upgrade(
+    const quartz::rendering::Device& renderingDevice
+) {
+    const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs = quartz::rendering::Texture::getMasterTextureList();
+
+    // Retired images are destroyed within a few updates, so we only evict for what they won't free
+    vk::DeviceSize freeingBytes = m_retiredBytes;
+
+    // The budget may have shrunk since the last update
+    if (this->getAllocatedBytes() > m_budgetBytes + freeingBytes) {
+        freeingBytes += this->evict(renderingDevice, this->getAllocatedBytes() - m_budgetBytes - freeingBytes);
+    }
+
+    // Textures which are the furthest below the size they were requested at go first
+    std::sort(
+        m_upgradeMasterIndices.begin(),
+        m_upgradeMasterIndices.end(),
+        [&](const uint32_t masterIndexA, const uint32_t masterIndexB) {
+            const quartz::rendering::UploadBatch::ImageLevel& residentLevelA = texturePtrs[masterIndexA]->getLevelData().levels[texturePtrs[masterIndexA]->getResidentBaseLevel()];
+            const quartz::rendering::UploadBatch::ImageLevel& residentLevelB = texturePtrs[masterIndexB]->getLevelData().levels[texturePtrs[masterIndexB]->getResidentBaseLevel()];
+            const float shortfallA = static_cast<float>(m_textureStates[masterIndexA].requestedDimension) / std::max(residentLevelA.width, residentLevelA.height);
+            const float shortfallB = static_cast<float>(m_textureStates[masterIndexB].requestedDimension) / std::max(residentLevelB.width, residentLevelB.height);
+            return shortfallA > shortfallB;
+        }
+    );
+
+    vk::DeviceSize uploadedBytes = 0;
+    for (const uint32_t masterIndex : m_upgradeMasterIndices) {
+        const quartz::rendering::Texture& texture = *(texturePtrs[masterIndex]);
+        const uint32_t desiredBaseLevel = quartz::rendering::TextureStreamer::getDesiredBaseLevel(texture.getLevelData().levels, m_textureStates[masterIndex].requestedDimension);
+        const vk::DeviceSize desiredSizeBytes = texture.getLevelDataSizeBytes(desiredBaseLevel);
+
+        // The first upgrade always goes through so textures larger than the cap still get loaded
+        if (uploadedBytes > 0 && uploadedBytes + desiredSizeBytes > m_maxUploadBytesPerFrame) {
+            LOG_TRACEthis("Reached {} of {} bytes of uploads this frame", uploadedBytes, m_maxUploadBytesPerFrame);
+            break;
+        }
+
+        // The new image sits alongside the current one until the current one is retired and destroyed
+        const vk::DeviceSize requiredBytes = this->getAllocatedBytes() + desiredSizeBytes;
+        if (requiredBytes > m_budgetBytes) {
+            if (requiredBytes > m_budgetBytes + freeingBytes) {
+                freeingBytes += this->evict(renderingDevice, requiredBytes - m_budgetBytes - freeingBytes);
+            }
+
+            LOG_TRACEthis("Texture {} needs {} more bytes freed before its {} byte image fits in the budget", masterIndex, requiredBytes - m_budgetBytes, desiredSizeBytes);
+            continue;
+        }
+
+        LOG_TRACEthis("Upgrading texture {} from level {} to level {}", masterIndex, texture.getResidentBaseLevel(), desiredBaseLevel);
+        this->upload(renderingDevice, masterIndex, desiredBaseLevel);
+        freeingBytes += texture.getResidentSizeBytes();
+        uploadedBytes += desiredSizeBytes;
+    }
+
+    if (mp_uploadBatch) {
+        LOG_TRACEthis("Submitting {} images with {} bytes of levels", m_uploadingImages.size(), m_uploadingBytes);
+        mp_uploadBatch->submitWithoutWaiting();
+    }
+}
+
+vk::DeviceSize
+quartz::rendering::TextureStreamer::evict(
+    const quartz::rendering::Device& renderingDevice,
+    const vk::DeviceSize bytesToFree
+) {
+    LOG_FUNCTION_SCOPE_TRACEthis("{} bytes", bytesToFree);
+
+    const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs = quartz::rendering::Texture::getMasterTextureList();
+
+    m_evictionMasterIndices.clear();
+    for (uint32_t i = 0; i < texturePtrs.size(); ++i) {
+        const quartz::rendering::Texture& texture = *(texturePtrs[i]);
+        if (
+            texture.getIsStreamed() &&
+            !m_isUploading[i] &&
+            m_textureStates[i].lastRequestedFrame < m_frameNumber &&
+            texture.getResidentBaseLevel() < quartz::rendering::Texture::getInitialResidentBaseLevel(texture.getLevelData().levels)
+        ) {
+            m_evictionMasterIndices.push_back(i);
+        }
+    }
+
+    std::sort(
+        m_evictionMasterIndices.begin(),
+        m_evictionMasterIndices.end(),
+        [&](const uint32_t masterIndexA, const uint32_t masterIndexB) {
+            return m_textureStates[masterIndexA].lastRequestedFrame < m_textureStates[masterIndexB].lastRequestedFrame;
+        }
+    );
+
+    vk::DeviceSize freedBytes = 0;
+    for (const uint32_t masterIndex : m_evictionMasterIndices) {
+        if (freedBytes >= bytesToFree) {
+            break;
+        }
+
+        const quartz::rendering::Texture& texture = *(texturePtrs[masterIndex]);
+        const uint32_t initialBaseLevel = quartz::rendering::Texture::getInitialResidentBaseLevel(texture.getLevelData().levels);
+
+        LOG_TRACEthis("Evicting texture {} last requested on frame {} from level {} to level {}", masterIndex, m_textureStates[masterIndex].lastRequestedFrame, texture.getResidentBaseLevel(), initialBaseLevel);
+        this->upload(renderingDevice, masterIndex, initialBaseLevel);
+        freedBytes += texture.getResidentSizeBytes();
+    }
+
+    LOG_TRACEthis("Freeing {} bytes once the evicted images are retired", freedBytes);
+
+    return freedBytes;
+}
+
+void
+quartz::rendering::TextureStreamer::upload(
+    const quartz::rendering::Device& renderingDevice,
+    const uint32_t textureMasterIndex,
+    const uint32_t baseLevel
+) {
+    if (!mp_uploadBatch) {
+        LOG_TRACEthis("Starting an upload batch");
+        mp_uploadBatch = std::make_unique<quartz::rendering::UploadBatch>(renderingDevice);
+    }
+
+    const quartz::rendering::Texture& texture = *(quartz::rendering::Texture::getMasterTextureList()[textureMasterIndex]);
+    const vk::DeviceSize sizeBytes = texture.getLevelDataSizeBytes(baseLevel);
+
+    m_uploadingImages.push_back({
+        textureMasterIndex,
+        texture.createResidentImage(renderingDevice, baseLevel),
+        sizeBytes
+    });
+    m_uploadingBytes += sizeBytes;
+    m_isUploading[textureMasterIndex] = true;
+}
+
+bool
+quartz::rendering::TextureStreamer::swapUploadedImages() {
+    if (!mp_uploadBatch || !mp_uploadBatch->getIsComplete()) {
+        return false;
+    }
+
+    LOG_FUNCTION_SCOPE_TRACEthis("{} images", m_uploadingImages.size());
+
+    const std::vector<std::shared_ptr<quartz::rendering::Texture>>& texturePtrs = quartz::rendering::Texture::getMasterTextureList();
+    for (quartz::rendering::TextureStreamer::UploadingImage& uploadingImage : m_uploadingImages) {
+        quartz::rendering::Texture& texture = *(texturePtrs[uploadingImage.textureMasterIndex]);
+        const vk::DeviceSize retiredSizeBytes = texture.getResidentSizeBytes();
+
+        this->retire(texture.swapResidentImage(std::move(uploadingImage.residentImage)), retiredSizeBytes);
+        m_isUploading[uploadingImage.textureMasterIndex] = false;
+    }
+
+    m_uploadingImages.clear();
+    m_uploadingBytes = 0;
+    mp_uploadBatch.reset();
+
+    return true;
+}
+
+void
+quartz::rendering::TextureStreamer::retire(
+    quartz::rendering::Texture::ResidentImage&& residentImage,
+    const vk::DeviceSize sizeBytes
+) {
+    m_retiredImages.push_back({std::move(residentImage), sizeBytes, m_frameNumber});
+    m_retiredBytes += sizeBytes;
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+
+namespace quartz {
+namespace rendering {
+    class TextureStreamer;
+}
+}
+
+/**
+ * @brief Decides how many levels of each streamed texture live on the gpu. Every frame the renderer
+ *   requests a size for the textures it is drawing, based on how large their doodads are on screen.
+ *   Each update upgrades the textures that are furthest below the size they were requested at, up to
+ *   a number of bytes per frame so loading a new area doesn't stall a single frame for too long.
+ *
+ * @brief When the streamed textures' images would go over the budget, the textures which were
+ *   requested least recently drop back to the levels they started out with. The budget covers every
+ *   image we are holding on to, which includes the ones still uploading and the retired ones.
+ *
+ * @brief The new images an update creates are uploaded in one batch which the update doesn't wait on.
+ *   A later update swaps them in once the batch has completed, so the textures keep sampling their
+ *   previous images until then. Nothing else is uploaded while a batch is in flight.
+ *
+ * @brief Swapping a texture's image leaves the previous image in use by frames which are still in
+ *   flight, so previous images are held on to for retiredFrameCount updates before being destroyed.
+ *   Descriptor sets referring to the textures must be rewritten once an update changes anything.
+ */
+class quartz::rendering::TextureStreamer {
+public: // member functions
+    TextureStreamer(
+        const vk::DeviceSize budgetBytes,
+        const vk::DeviceSize maxUploadBytesPerFrame,
+        const uint32_t retiredFrameCount
+    );
+    TextureStreamer(const TextureStreamer& other) = delete;
+    ~TextureStreamer();
+
+    TextureStreamer& operator=(const TextureStreamer& other) = delete;
+
+    USE_LOGGER(TEXTURE_STREAMING);
+
+    vk::DeviceSize getBudgetBytes() const { return m_budgetBytes; }
+    vk::DeviceSize getMaxUploadBytesPerFrame() const { return m_maxUploadBytesPerFrame; }
+    vk::DeviceSize getResidentBytes() const { return m_residentBytes; } // of the streamed textures, as of the last update
+    vk::DeviceSize getUploadingBytes() const { return m_uploadingBytes; }
+    vk::DeviceSize getRetiredBytes() const { return m_retiredBytes; }
+    bool getIsUploading() const { return mp_uploadBatch != nullptr; }
+
+    void setBudgetBytes(const vk::DeviceSize budgetBytes) { m_budgetBytes = budgetBytes; }
+    void setMaxUploadBytesPerFrame(const vk::DeviceSize maxUploadBytesPerFrame) { m_maxUploadBytesPerFrame = maxUploadBytesPerFrame; }
+
+    /**
+     * @brief Asks for the texture to have a level at least dimension texels across resident. The
+     *   largest request made for a texture since the last update is the one that counts
+     */
+    void request(
+        const uint32_t textureMasterIndex,
+        const uint32_t dimension
+    );
+
+    /**
+     * @brief Must only be called once the frame which submitted retiredFrameCount updates ago has
+     *   finished. Returns true if any texture's image changed, which only happens once the images an
+     *   earlier update started uploading are ready
+     */
+    bool update(const quartz::rendering::Device& renderingDevice);
+
+    /**
+     * @brief Forgets every texture and destroys every retired and uploading image, for when the master
+     *   texture list is cleared. The gpu must be idle
+     */
+    void reset();
+
+public: // static functions
+    /**
+     * @brief The smallest level which is at least dimension texels across, or the largest level if
+     *   none of them are. Never larger than the base level the texture started out with
+     */
+    static uint32_t getDesiredBaseLevel(
+        const std::vector<quartz::rendering::UploadBatch::ImageLevel>& levels,
+        const uint32_t dimension
+    );
+
+private: // classes
+    struct TextureState {
+    public: // member variables
+        uint32_t requestedDimension; // largest request since the last update, 0 if there were none
+        uint64_t lastRequestedFrame;
+    };
+
+    struct RetiredImage {
+    public: // member variables
+        quartz::rendering::Texture::ResidentImage residentImage;
+        vk::DeviceSize sizeBytes;
+        uint64_t retiredFrame;
+    };
+
+    struct UploadingImage {
+    public: // member variables
+        uint32_t textureMasterIndex;
+        quartz::rendering::Texture::ResidentImage residentImage;
+        vk::DeviceSize sizeBytes;
+    };
+
+private: // member functions
+    vk::DeviceSize getAllocatedBytes() const { return m_residentBytes + m_uploadingBytes + m_retiredBytes; }
+
+    /**
+     * @brief Starts uploading images for the requested textures which are furthest below the size
+     *   they were requested at, evicting other textures to make room, and submits them all in one batch
+     */
+    void upgrade(const quartz::rendering::Device& renderingDevice);
+
+    /**
+     * @brief Drops textures which weren't requested this frame back to their initial levels, least
+     *   recently requested first, until their images will have shrunk by at least bytesToFree bytes.
+     *   Returns how much they will shrink by once the new images are swapped in and the old ones are
+     *   destroyed
+     */
+    vk::DeviceSize evict(
+        const quartz::rendering::Device& renderingDevice,
+        const vk::DeviceSize bytesToFree
+    );
+    /**
+     * @brief Records the upload of the texture's new image into this update's upload batch, starting
+     *   the batch if this is the first
+     */
+    void upload(
+        const quartz::rendering::Device& renderingDevice,
+        const uint32_t textureMasterIndex,
+        const uint32_t baseLevel
+    );
+    /**
+     * @brief Swaps every uploaded image in once the upload batch has completed. Returns true if it had
+     */
+    bool swapUploadedImages();
+    void retire(
+        quartz::rendering::Texture::ResidentImage&& residentImage,
+        const vk::DeviceSize sizeBytes
+    );
+
+private: // member variables
+    vk::DeviceSize m_budgetBytes;
+    vk::DeviceSize m_maxUploadBytesPerFrame;
+    uint32_t m_retiredFrameCount;
+
+    uint64_t m_frameNumber;
+    vk::DeviceSize m_residentBytes;
+    vk::DeviceSize m_uploadingBytes;
+    vk::DeviceSize m_retiredBytes;
+    std::vector<quartz::rendering::TextureStreamer::TextureState> m_textureStates; // indexed by master index
+    std::deque<quartz::rendering::TextureStreamer::RetiredImage> m_retiredImages; // oldest first
+
+    std::vector<quartz::rendering::TextureStreamer::UploadingImage> m_uploadingImages;
+    std::vector<bool> m_isUploading; // indexed by master index
+
+    // After the images it uploads, so it is destroyed first and waits for the gpu to finish with them
+    std::unique_ptr<quartz::rendering::UploadBatch> mp_uploadBatch; // nullptr unless images are uploading
+
+    // Reused each update
+    std::vector<uint32_t> m_upgradeMasterIndices;
+    std::vector<uint32_t> m_evictionMasterIndices;
+};
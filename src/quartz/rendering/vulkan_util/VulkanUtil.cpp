@@ -115,7 +115,8 @@ quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
     const vk::Format format,
     const vk::ComponentMapping components,
     const vk::ImageAspectFlags imageAspectFlags,
-    const vk::ImageViewType imageViewType // vk::ImageViewType::eCube , vk::ImageViewType::e2D
+    const vk::ImageViewType imageViewType, // vk::ImageViewType::eCube , vk::ImageViewType::e2D
+    const uint32_t mipLevelCount
 ) {
     LOG_FUNCTION_SCOPE_TRACE(IMAGE, "");
 
@@ -123,6 +124,7 @@ quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
     const uint32_t layerCount = imageViewType == vk::ImageViewType::eCube ? 6 : 1;
     LOG_TRACE(IMAGE, "Using image view type: {}", quartz::rendering::VulkanUtil::toString(imageViewType));
     LOG_TRACE(IMAGE, "Using layer count: {}", layerCount);
+    LOG_TRACE(IMAGE, "Using mip level count: {}", mipLevelCount);
 
     vk::ImageViewCreateInfo imageViewCreateInfo(
         {},
@@ -133,7 +135,7 @@ quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
         {
             imageAspectFlags,
             0,
-            1,
+            mipLevelCount,
             0,
             layerCount
         }
@@ -152,33 +154,35 @@ quartz::rendering::VulkanUtil::createVulkanImageViewPtr(
 
 vk::UniqueSampler
 quartz::rendering::VulkanUtil::createVulkanSamplerPtr(
-    const vk::PhysicalDevice& vulkanPhysicalDevice,
     const vk::UniqueDevice& p_vulkanLogicalDevice,
     const vk::Filter magFilter,
     const vk::Filter minFilter,
+    const vk::SamplerMipmapMode mipmapMode,
     const vk::SamplerAddressMode addressModeU,
     const vk::SamplerAddressMode addressModeV,
-    const vk::SamplerAddressMode addressModeW
+    const vk::SamplerAddressMode addressModeW,
+    const float maxAnisotropy,
+    const float minLod,
+    const float maxLod
 ) {
     LOG_FUNCTION_CALL_TRACE(TEXTURE, "");
 
-    vk::PhysicalDeviceProperties physicalDeviceProperties = vulkanPhysicalDevice.getProperties();
-
+    // An anisotropy of 1 samples the same as having anisotropic filtering disabled
     vk::SamplerCreateInfo samplerCreateInfo(
         {},
         magFilter,
         minFilter,
-        vk::SamplerMipmapMode::eLinear,
+        mipmapMode,
         addressModeU,
         addressModeV,
         addressModeW,
         0.0f,
-        true,
-        physicalDeviceProperties.limits.maxSamplerAnisotropy,
+        maxAnisotropy > 1.0f,
+        maxAnisotropy,
         false,
         vk::CompareOp::eAlways,
-        0.0f,
-        0.0f,
+        minLod,
+        maxLod,
         vk::BorderColor::eIntOpaqueBlack,
         false
     );
@@ -31,17 +31,21 @@ public: // static functions
         const vk::Format format,
         const vk::ComponentMapping components,
         const vk::ImageAspectFlags imageAspectFlags,
-        const vk::ImageViewType imageViewType
+        const vk::ImageViewType imageViewType,
+        const uint32_t mipLevelCount
     );
 
     static vk::UniqueSampler createVulkanSamplerPtr(
-        const vk::PhysicalDevice& vulkanPhysicalDevice,
         const vk::UniqueDevice& p_vulkanLogicalDevice,
         const vk::Filter magFilter,
         const vk::Filter minFilter,
+        const vk::SamplerMipmapMode mipmapMode,
         const vk::SamplerAddressMode addressModeU,
         const vk::SamplerAddressMode addressModeV,
-        const vk::SamplerAddressMode addressModeW
+        const vk::SamplerAddressMode addressModeW,
+        const float maxAnisotropy,
+        const float minLod,
+        const float maxLod
     );
 
     // ----- command pool and command buffer things ----- //
@@ -1,3 +1,4 @@
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -84,11 +85,50 @@ quartz::scene::Doodad::Doodad(
     const quartz::scene::Doodad::FixedUpdateCallback& fixedUpdateCallback,
     const quartz::scene::Doodad::UpdateCallback& updateCallback
 ) :
-    mo_model(
+    Doodad(
+        physicsManager,
+        o_field,
         o_objectFilepath ?
-            std::optional<quartz::rendering::Model>(quartz::rendering::Model(renderingDevice, *o_objectFilepath)) :
-            std::nullopt
-    ),
+            std::make_shared<const quartz::rendering::Model>(renderingDevice, *o_objectFilepath) :
+            std::shared_ptr<const quartz::rendering::Model>(),
+        transform,
+        o_rigidBodyParameters,
+        awakenCallback,
+        fixedUpdateCallback,
+        updateCallback
+    )
+{}
+
+quartz::scene::Doodad::Doodad(
+    const quartz::rendering::Device& renderingDevice,
+    quartz::managers::PhysicsManager& physicsManager,
+    std::optional<quartz::physics::Field>& o_field,
+    const quartz::scene::Doodad::Parameters& doodadParameters
+) :
+    Doodad(
+        renderingDevice,
+        physicsManager,
+        o_field,
+        doodadParameters.o_objectFilepath,
+        doodadParameters.transform,
+        doodadParameters.o_rigidBodyParameters,
+        doodadParameters.awakenCallback,
+        doodadParameters.fixedUpdateCallback,
+        doodadParameters.updateCallback
+    )
+{}
+
+quartz::scene::Doodad::Doodad(
+    quartz::managers::PhysicsManager& physicsManager,
+    std::optional<quartz::physics::Field>& o_field,
+    const std::shared_ptr<const quartz::rendering::Model>& p_model,
+    const math::Transform& transform,
+    const std::optional<quartz::physics::RigidBody::Parameters>& o_rigidBodyParameters,
+    const quartz::scene::Doodad::AwakenCallback& awakenCallback,
+    const quartz::scene::Doodad::FixedUpdateCallback& fixedUpdateCallback,
+    const quartz::scene::Doodad::UpdateCallback& updateCallback
+) :
+    mp_model(p_model),
     m_transform(quartz::scene::Doodad::fixTransform(transform)),
     m_transformationMatrix(m_transform.calculateTransformationMatrix()),
     mo_rigidBody(
@@ -101,36 +141,30 @@ quartz::scene::Doodad::Doodad(
     m_updateCallback(updateCallback ? updateCallback : quartz::scene::Doodad::noopUpdateCallback)
 {
     LOG_FUNCTION_CALL_TRACEthis("");
-    LOG_TRACEthis("Constructing doodad with transform:");
+    LOG_TRACEthis("Constructing doodad with model {} and transform:", reinterpret_cast<const void*>(mp_model.get()));
     LOG_TRACE(DOODAD, "  position = {}", m_transform.position.toString());
     LOG_TRACE(DOODAD, "  rotation = {}", m_transform.rotation.toString());
     LOG_TRACE(DOODAD, "  scale    = {}", m_transform.scale.toString());
 }
 
 quartz::scene::Doodad::Doodad(
-    const quartz::rendering::Device& renderingDevice,
-    quartz::managers::PhysicsManager& physicsManager,
-    std::optional<quartz::physics::Field>& o_field,
-    const quartz::scene::Doodad::Parameters& doodadParameters
+    const std::shared_ptr<const quartz::rendering::Model>& p_model,
+    const math::Transform& transform,
+    std::optional<quartz::physics::RigidBody>&& o_rigidBody,
+    const quartz::scene::Doodad::AwakenCallback& awakenCallback,
+    const quartz::scene::Doodad::FixedUpdateCallback& fixedUpdateCallback,
+    const quartz::scene::Doodad::UpdateCallback& updateCallback
 ) :
-    mo_model(
-        doodadParameters.o_objectFilepath ?
-            std::optional<quartz::rendering::Model>(quartz::rendering::Model(renderingDevice, *doodadParameters.o_objectFilepath)) :
-            std::nullopt
-    ),
-    m_transform(quartz::scene::Doodad::fixTransform(doodadParameters.transform)),
+    mp_model(p_model),
+    m_transform(quartz::scene::Doodad::fixTransform(transform)),
     m_transformationMatrix(m_transform.calculateTransformationMatrix()),
-    mo_rigidBody(
-        (o_field && doodadParameters.o_rigidBodyParameters) ?
-            std::optional<quartz::physics::RigidBody>(physicsManager.createRigidBody(*o_field, m_transform, *doodadParameters.o_rigidBodyParameters)) :
-            std::nullopt
-    ),
-    m_awakenCallback(doodadParameters.awakenCallback ? doodadParameters.awakenCallback : quartz::scene::Doodad::noopAwakenCallback),
-    m_fixedUpdateCallback(doodadParameters.fixedUpdateCallback ? doodadParameters.fixedUpdateCallback : quartz::scene::Doodad::noopFixedUpdateCallback),
-    m_updateCallback(doodadParameters.updateCallback ? doodadParameters.updateCallback : quartz::scene::Doodad::noopUpdateCallback)
+    mo_rigidBody(std::move(o_rigidBody)),
+    m_awakenCallback(awakenCallback ? awakenCallback : quartz::scene::Doodad::noopAwakenCallback),
+    m_fixedUpdateCallback(fixedUpdateCallback ? fixedUpdateCallback : quartz::scene::Doodad::noopFixedUpdateCallback),
+    m_updateCallback(updateCallback ? updateCallback : quartz::scene::Doodad::noopUpdateCallback)
 {
     LOG_FUNCTION_CALL_TRACEthis("");
-    LOG_TRACEthis("Constructing doodad with transform:");
+    LOG_TRACEthis("Constructing doodad with model {}, an existing rigid body, and transform:", reinterpret_cast<const void*>(mp_model.get()));
     LOG_TRACE(DOODAD, "  position = {}", m_transform.position.toString());
     LOG_TRACE(DOODAD, "  rotation = {}", m_transform.rotation.toString());
     LOG_TRACE(DOODAD, "  scale    = {}", m_transform.scale.toString());
@@ -139,7 +173,7 @@ quartz::scene::Doodad::Doodad(
 quartz::scene::Doodad::Doodad(
     quartz::scene::Doodad&& other
 ) :
-    mo_model(std::move(other.mo_model)),
+    mp_model(std::move(other.mp_model)),
     m_transform(other.m_transform),
     m_transformationMatrix(other.m_transformationMatrix),
     mo_rigidBody(std::move(other.mo_rigidBody)),
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 
@@ -126,12 +127,34 @@ public: // member functions
         std::optional<quartz::physics::Field>& o_field,
         const quartz::scene::Doodad::Parameters& doodadParameters
     );
+    Doodad(
+        quartz::managers::PhysicsManager& physicsManager,
+        std::optional<quartz::physics::Field>& o_field,
+        const std::shared_ptr<const quartz::rendering::Model>& p_model,
+        const math::Transform& transform,
+        const std::optional<quartz::physics::RigidBody::Parameters>& o_rigidBodyParameters,
+        const quartz::scene::Doodad::AwakenCallback& awakenCallback,
+        const quartz::scene::Doodad::FixedUpdateCallback& fixedUpdateCallback,
+        const quartz::scene::Doodad::UpdateCallback& updateCallback
+    );
+    /**
+     * @brief For rigid bodies which were already created (in bulk, by the scene) with the fixed
+     *   version of the given transform
+     */
+    Doodad(
+        const std::shared_ptr<const quartz::rendering::Model>& p_model,
+        const math::Transform& transform,
+        std::optional<quartz::physics::RigidBody>&& o_rigidBody,
+        const quartz::scene::Doodad::AwakenCallback& awakenCallback,
+        const quartz::scene::Doodad::FixedUpdateCallback& fixedUpdateCallback,
+        const quartz::scene::Doodad::UpdateCallback& updateCallback
+    );
     Doodad(Doodad&& other);
     ~Doodad();
 
     USE_LOGGER(DOODAD);
 
-    const std::optional<quartz::rendering::Model>& getModelOptional() const { return mo_model; }
+    const std::shared_ptr<const quartz::rendering::Model>& getModelPtr() const { return mp_model; }
     const math::Transform& getTransform() const { return m_transform; }
     const math::Mat4& getTransformationMatrix() const { return m_transformationMatrix; }
     const std::optional<quartz::physics::RigidBody>& getRigidBodyOptional() const { return mo_rigidBody; }
@@ -177,7 +200,7 @@ private: // static functions
     static void noopUpdateCallback(UpdateCallbackParameters parameters);
 
 private: // member variables
-    std::optional<quartz::rendering::Model> mo_model;
+    std::shared_ptr<const quartz::rendering::Model> mp_model; // shared between all doodads using the same model file
 
     math::Transform m_transform;
     math::Mat4 m_transformationMatrix;
@@ -8,7 +8,9 @@
 #include "quartz/managers/input_manager/InputManager.hpp"
 #include "quartz/managers/physics_manager/PhysicsManager.hpp"
 #include "quartz/physics/field/Field.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
 #include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/model/ModelCache.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
 #include "quartz/rendering/window/Window.hpp"
 #include "quartz/scene/camera/Camera.hpp"
@@ -21,12 +23,35 @@ std::vector<quartz::scene::Doodad>
 quartz::scene::Scene::constructDoodads(
     const quartz::rendering::Device& renderingDevice,
     quartz::managers::PhysicsManager& physicsManager,
+    quartz::rendering::ModelCache& modelCache,
     std::optional<quartz::physics::Field>& o_field,
     const std::vector<quartz::scene::Doodad::Parameters>& doodadParameters
 ) {
     LOG_FUNCTION_SCOPE_TRACE(SCENE, "");
 
+    /**
+     * @brief Every rigid body is created up front in one call, so the physics manager can do each
+     *   step of the creation for all of them at once instead of interleaving it with model loading
+     */
+    std::vector<math::Transform> rigidBodyTransforms;
+    std::vector<quartz::physics::RigidBody::Parameters> rigidBodyParameters;
+    if (o_field) {
+        for (const quartz::scene::Doodad::Parameters& parameters : doodadParameters) {
+            if (parameters.o_rigidBodyParameters) {
+                rigidBodyTransforms.push_back(quartz::scene::Doodad::fixTransform(parameters.transform));
+                rigidBodyParameters.push_back(*parameters.o_rigidBodyParameters);
+            }
+        }
+    }
+    LOG_TRACE(SCENE, "Creating {} rigid bodies", rigidBodyParameters.size());
+    std::vector<quartz::physics::RigidBody> rigidBodies =
+        o_field ?
+            physicsManager.createRigidBodies(*o_field, rigidBodyTransforms, rigidBodyParameters) :
+            std::vector<quartz::physics::RigidBody>();
+    uint32_t rigidBodyIndex = 0;
+
     std::vector<quartz::scene::Doodad> doodads;
+    doodads.reserve(doodadParameters.size());
 
     for (const quartz::scene::Doodad::Parameters& parameters : doodadParameters) {
         const std::optional<std::string>& o_filepath = parameters.o_objectFilepath;
@@ -50,13 +75,23 @@ quartz::scene::Scene::constructDoodads(
             LOG_TRACE(SCENE, "    no rigid body");
         }
 
+        // Doodads only draw their models, their colliders come from their rigid body parameters
+        const bool retainGeometry = false;
+        const std::shared_ptr<const quartz::rendering::Model> p_model =
+            o_filepath ?
+                modelCache.getModelPtr(renderingDevice, *o_filepath, retainGeometry) :
+                std::shared_ptr<const quartz::rendering::Model>();
+
+        std::optional<quartz::physics::RigidBody> o_rigidBody;
+        if (o_field && o_rigidBodyInformation) {
+            o_rigidBody.emplace(std::move(rigidBodies[rigidBodyIndex]));
+            rigidBodyIndex++;
+        }
+
         doodads.emplace_back(
-            renderingDevice,
-            physicsManager,
-            o_field,
-            o_filepath,
+            p_model,
             transform,
-            o_rigidBodyInformation,
+            std::move(o_rigidBody),
             awakenCallback,
             fixedUpdateCallback,
             updateCallback
@@ -64,6 +99,7 @@ quartz::scene::Scene::constructDoodads(
     }
 
     LOG_TRACE(SCENE, "Loaded {} doodads", doodads.size());
+    LOG_TRACE(SCENE, "Model cache has {} live models ({} hits, {} misses)", modelCache.getLiveModelCount(), modelCache.getCacheHitCount(), modelCache.getCacheMissCount());
 
     return doodads;
 }
@@ -71,6 +107,7 @@ quartz::scene::Scene::constructDoodads(
 quartz::scene::Scene::Scene() :
     mo_field(),
     mr_camera(quartz::scene::Scene::defaultCamera),
+    m_modelCache(),
     m_doodads(),
     m_skyBox(),
     m_ambientLight(),
@@ -85,6 +122,7 @@ quartz::scene::Scene::Scene(
 ) :
     mo_field(std::move(other.mo_field)),
     mr_camera(other.mr_camera), // don't need to move a reference
+    m_modelCache(std::move(other.m_modelCache)),
     m_doodads(std::move(other.m_doodads)),
     m_skyBox(std::move(other.m_skyBox)),
     m_ambientLight(std::move(other.m_ambientLight)),
@@ -138,6 +176,12 @@ quartz::scene::Scene::load(
         mo_field.emplace(physicsManager.createField(*o_fieldParameters));
     }
 
+    /**
+     * @brief Everything uploaded while loading the scene (textures, the skybox, every model) goes into
+     *   one batch, so the whole scene costs a single submission
+     */
+    quartz::rendering::UploadBatch uploadBatch(renderingDevice);
+
     LOG_TRACEthis("Initializing master texture list");
     quartz::rendering::Texture::initializeMasterTextureList(renderingDevice);
 
@@ -158,11 +202,15 @@ quartz::scene::Scene::load(
     m_doodads = quartz::scene::Scene::constructDoodads(
         renderingDevice,
         physicsManager,
+        m_modelCache,
         mo_field,
         doodadParameters
     );
     LOG_TRACEthis("Loaded {} doodads", m_doodads.size());
 
+    uploadBatch.submit();
+    LOG_TRACEthis("Uploaded scene resources");
+
     m_ambientLight = ambientLight;
     LOG_TRACEthis("Loaded ambient light with color {}", m_ambientLight.color.toString());
 
@@ -219,9 +267,9 @@ quartz::scene::Scene::unload(
     LOG_TRACEthis("Unloading physics items");
 
     LOG_TRACEthis("Unloading {} doodads", m_doodads.size());
+    std::vector<quartz::physics::RigidBody*> rigidBodyPtrs;
+    rigidBodyPtrs.reserve(m_doodads.size());
     for (uint32_t i = 0; i < m_doodads.size(); i++) {
-        LOG_TRACEthis("Unloading doodad {}", i);
-
         quartz::scene::Doodad& doodad = m_doodads[i];
 
         if (!doodad.getRigidBodyOptionalReference()) {
@@ -229,10 +277,12 @@ quartz::scene::Scene::unload(
             continue;
         }
 
-        LOG_TRACEthis("  destroying rigidbody");
-        physicsManager.destroyRigidBody(*mo_field, *doodad.getRigidBodyOptionalReference());
+        rigidBodyPtrs.push_back(&*doodad.getRigidBodyOptionalReference());
     }
 
+    LOG_TRACEthis("Destroying {} rigidbodies", rigidBodyPtrs.size());
+    physicsManager.destroyRigidBodies(*mo_field, rigidBodyPtrs);
+
     physicsManager.destroyField(*mo_field);
 }
 
@@ -12,6 +12,7 @@
 #include "quartz/managers/physics_manager/PhysicsManager.hpp"
 #include "quartz/physics/field/Field.hpp"
 #include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/model/ModelCache.hpp"
 #include "quartz/rendering/window/Window.hpp"
 #include "quartz/scene/Loggers.hpp"
 #include "quartz/scene/camera/Camera.hpp"
@@ -73,6 +74,7 @@ public: // member functions
 
     const quartz::scene::Camera& getCamera() const { return mr_camera; }
     const std::vector<quartz::scene::Doodad>& getDoodads() const { return m_doodads; }
+    const quartz::rendering::ModelCache& getModelCache() const { return m_modelCache; }
     const quartz::scene::SkyBox& getSkyBox() const { return m_skyBox; }
     const quartz::scene::AmbientLight& getAmbientLight() const { return m_ambientLight; }
     const quartz::scene::DirectionalLight& getDirectionalLight() const { return m_directionalLight; }
@@ -126,6 +128,7 @@ private: // static functions
     static std::vector<quartz::scene::Doodad> constructDoodads(
         const quartz::rendering::Device& renderingDevice,
         quartz::managers::PhysicsManager& physicsManager,
+        quartz::rendering::ModelCache& modelCache,
         std::optional<quartz::physics::Field>& o_field,
         const std::vector<quartz::scene::Doodad::Parameters>& doodadParameters
     );
@@ -143,6 +146,7 @@ private: // member variables
 
     std::reference_wrapper<quartz::scene::Camera> mr_camera;
 
+    quartz::rendering::ModelCache m_modelCache;
     std::vector<quartz::scene::Doodad> m_doodads;
 
     quartz::scene::SkyBox m_skyBox;
@@ -0,0 +1,105 @@
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include <tiny_gltf.h>
+
+#include "math/Loggers.hpp"
+
+#include "util/Loggers.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "quartz/rendering/Loggers.hpp"
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/ModelCooker.hpp"
+#include "quartz/rendering/texture/KTX2Container.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureCooker.hpp"
+
+/**
+ * @brief Cooks a gltf file into a model which quartz::rendering::Model can load without parsing,
+ *   decoding, or optimizing anything. Or cooks a single image into a block compressed .ktx2 file,
+ *   compressed for the given gltf texture type (baseColorTexture, normalTexture, ...).
+ *
+ *   quartz_cook <input .gltf or .glb> <output .qzmodel>
+ *   quartz_cook <input image> <output .ktx2> <texture type>
+ */
+int main(int argc, char* argv[]) {
+    util::Logger::setShouldLogPreamble(false);
+
+    REGISTER_LOGGER_GROUP_WITH_LEVEL(MATH, warning);
+    REGISTER_LOGGER_GROUP_WITH_LEVEL(UTIL, warning);
+    REGISTER_LOGGER_GROUP_WITH_LEVEL(QUARTZ_RENDERING, warning);
+    util::Logger::setLevel(quartz::loggers::MODEL_COOKED.loggerName, util::Logger::Level::info);
+    util::Logger::setLevel(quartz::loggers::TEXTURE_COOKED.loggerName, util::Logger::Level::info);
+
+    if (argc != 3 && argc != 4) {
+        std::cerr << "Usage: " << argv[0] << " <input .gltf or .glb> <output ." << quartz::rendering::CookedModel::fileExtension << ">" << std::endl;
+        std::cerr << "       " << argv[0] << " <input image> <output ." << quartz::rendering::KTX2Container::fileExtension << "> <gltf texture type, such as normalTexture>" << std::endl;
+        return 1;
+    }
+
+    if (argc == 4) {
+        const std::string imageFilepath = argv[1];
+        const std::string ktx2Filepath = argv[2];
+        const std::string textureTypeString = argv[3];
+
+        std::optional<quartz::rendering::Texture::Type> o_textureType;
+        for (uint32_t i = 0; i <= static_cast<uint32_t>(quartz::rendering::Texture::Type::Occlusion); ++i) {
+            const quartz::rendering::Texture::Type textureType = static_cast<quartz::rendering::Texture::Type>(i);
+            if (quartz::rendering::Texture::getTextureTypeGLTFString(textureType) == textureTypeString) {
+                o_textureType = textureType;
+            }
+        }
+
+        if (!o_textureType) {
+            std::cerr << "Unknown texture type " << textureTypeString << ". Use the gltf name, such as baseColorTexture or normalTexture" << std::endl;
+            return 1;
+        }
+
+        if (!quartz::rendering::KTX2Container::isKTX2Filepath(ktx2Filepath)) {
+            std::cerr << "Output file " << ktx2Filepath << " must end in ." << quartz::rendering::KTX2Container::fileExtension << " for quartz to load it as a ktx2 texture" << std::endl;
+            return 1;
+        }
+
+        try {
+            quartz::rendering::TextureCooker::cookFile(imageFilepath, ktx2Filepath, *o_textureType);
+        } catch (const util::StringException& e) {
+            std::cerr << e << std::endl;
+            return 1;
+        } catch (const util::RichException<uint64_t>& e) {
+            std::cerr << e << std::endl;
+            return 1;
+        }
+
+        return 0;
+    }
+
+    const std::string gltfFilepath = argv[1];
+    const std::string cookedFilepath = argv[2];
+
+    if (!quartz::rendering::CookedModel::isCookedFilepath(cookedFilepath)) {
+        std::cerr << "Output file " << cookedFilepath << " must end in ." << quartz::rendering::CookedModel::fileExtension << " for quartz to load it as a cooked model" << std::endl;
+        return 1;
+    }
+
+    try {
+        quartz::rendering::ModelCooker::cookFile(gltfFilepath, cookedFilepath);
+    } catch (const util::StringException& e) {
+        std::cerr << e << std::endl;
+        return 1;
+    } catch (const util::RichException<tinygltf::Image>& e) {
+        std::cerr << e << std::endl;
+        return 1;
+    } catch (const util::RichException<tinygltf::Texture>& e) {
+        std::cerr << e << std::endl;
+        return 1;
+    } catch (const util::RichException<uint64_t>& e) {
+        std::cerr << e << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,128 @@
+#include <string>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "util/Loggers.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/logger/Logger.hpp"
+
+#include "util/file_system/MappedFile.hpp"
+
+const uint8_t*
+util::MappedFile::mapFile(
+    const std::string& filepath,
+    uint64_t& sizeBytes
+) {
+    LOG_FUNCTION_SCOPE_TRACE(FILESYSTEM, "{}", filepath);
+
+    const int32_t fileDescriptor = open(filepath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        LOG_THROW(FILESYSTEM, util::StringException, filepath, "Failed to open {} for mapping", filepath);
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0) {
+        close(fileDescriptor);
+        LOG_THROW(FILESYSTEM, util::StringException, filepath, "Failed to get the size of {}", filepath);
+    }
+
+    sizeBytes = static_cast<uint64_t>(fileStatus.st_size);
+    if (sizeBytes == 0) {
+        LOG_TRACE(FILESYSTEM, "File {} is empty, not mapping anything", filepath);
+        close(fileDescriptor);
+        return nullptr;
+    }
+
+    void* p_mapping = mmap(nullptr, sizeBytes, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping keeps its own reference to the file, so we don't need the descriptor anymore
+    close(fileDescriptor);
+
+    if (p_mapping == MAP_FAILED) {
+        LOG_THROW(FILESYSTEM, util::StringException, filepath, "Failed to map {} bytes of {}", sizeBytes, filepath);
+    }
+
+    // We almost always read these files front to back, so let the kernel read ahead of us
+    madvise(p_mapping, sizeBytes, MADV_SEQUENTIAL);
+
+    LOG_TRACE(FILESYSTEM, "Mapped {} bytes of {}", sizeBytes, filepath);
+
+    return static_cast<const uint8_t*>(p_mapping);
+}
+
+util::MappedFile::MappedFile() :
+    m_filepath(),
+    m_sizeBytes(0),
+    mp_data(nullptr)
+{}
+
+util::MappedFile::MappedFile(
+    const std::string& filepath
+) :
+    m_filepath(filepath),
+    m_sizeBytes(0),
+    mp_data(
+        util::MappedFile::mapFile(
+            m_filepath,
+            m_sizeBytes
+        )
+    )
+{}
+
+util::MappedFile::MappedFile(
+    util::MappedFile&& other
+) :
+    m_filepath(std::move(other.m_filepath)),
+    m_sizeBytes(std::exchange(other.m_sizeBytes, 0)),
+    mp_data(std::exchange(other.mp_data, nullptr))
+{}
+
+util::MappedFile::~MappedFile() {
+    this->unmap();
+}
+
+util::MappedFile&
+util::MappedFile::operator=(
+    util::MappedFile&& other
+) {
+    if (this == &other) {
+        return *this;
+    }
+
+    this->unmap();
+
+    m_filepath = std::move(other.m_filepath);
+    m_sizeBytes = std::exchange(other.m_sizeBytes, 0);
+    mp_data = std::exchange(other.mp_data, nullptr);
+
+    return *this;
+}
+
+std::span<const uint8_t>
+util::MappedFile::getBytes(
+    const uint64_t offset,
+    const uint64_t sizeBytes
+) const {
+    if (offset > m_sizeBytes || sizeBytes > m_sizeBytes - offset) {
+        LOG_THROW(FILESYSTEM, util::StringException, m_filepath, "Requested {} bytes at offset {} from {}, which is only {} bytes", sizeBytes, offset, m_filepath, m_sizeBytes);
+    }
+
+    return std::span<const uint8_t>(mp_data + offset, sizeBytes);
+}
+
+void
+util::MappedFile::unmap() {
+    if (!mp_data) {
+        return;
+    }
+
+    LOG_TRACE(FILESYSTEM, "Unmapping {} bytes of {}", m_sizeBytes, m_filepath);
+    munmap(const_cast<uint8_t*>(mp_data), m_sizeBytes);
+
+    mp_data = nullptr;
+    m_sizeBytes = 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+namespace util {
+    class MappedFile;
+}
+
+/**
+ * @brief A read only view of a file's bytes, mapped into our address space instead of read into a
+ *   buffer. Pages are only faulted in when they are touched, so reading a section of a large file
+ *   doesn't cost us the whole file.
+ */
+class util::MappedFile {
+public: // member functions
+    MappedFile();
+    MappedFile(const std::string& filepath);
+    MappedFile(const MappedFile& other) = delete;
+    MappedFile(MappedFile&& other);
+    ~MappedFile();
+
+    MappedFile& operator=(const MappedFile& other) = delete;
+    MappedFile& operator=(MappedFile&& other);
+
+    const std::string& getFilepath() const { return m_filepath; }
+    const uint8_t* getData() const { return mp_data; }
+    uint64_t getSizeBytes() const { return m_sizeBytes; }
+
+    /**
+     * @brief Throws if the requested bytes are not entirely within the file, so callers can trust
+     *   offsets read out of the file itself
+     */
+    std::span<const uint8_t> getBytes(
+        const uint64_t offset,
+        const uint64_t sizeBytes
+    ) const;
+
+private: // static functions
+    static const uint8_t* mapFile(
+        const std::string& filepath,
+        uint64_t& sizeBytes
+    );
+
+private: // member functions
+    void unmap();
+
+private: // member variables
+    std::string m_filepath;
+    uint64_t m_sizeBytes;
+    const uint8_t* mp_data;
+};
@@ -0,0 +1,18 @@
+#include "util/hash/Hash.hpp"
+
+uint64_t
+util::Hash::fnv1a(
+    const uint64_t hash,
+    const void* p_bytes,
+    const size_t sizeBytes
+) {
+    const uint8_t* p_byteValues = static_cast<const uint8_t*>(p_bytes);
+
+    uint64_t result = hash;
+    for (size_t i = 0; i < sizeBytes; ++i) {
+        result ^= p_byteValues[i];
+        result *= util::Hash::fnv1aPrime;
+    }
+
+    return result;
+}
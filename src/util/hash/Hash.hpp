@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace util {
+    class Hash;
+}
+
+class util::Hash {
+public:
+    /**
+     * @brief 64 bit FNV-1a. Start from fnv1aOffsetBasis and feed the previous result back in to hash
+     *   several pieces of memory as if they were one
+     */
+    static uint64_t fnv1a(
+        const uint64_t hash,
+        const void* p_bytes,
+        const size_t sizeBytes
+    );
+
+public:
+    static constexpr uint64_t fnv1aOffsetBasis = 0xcbf29ce484222325ull;
+    static constexpr uint64_t fnv1aPrime = 0x100000001b3ull;
+
+public:
+    Hash() = delete;
+};
@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "util/thread_pool/ThreadPool.hpp"
+
+util::ThreadPool&
+util::ThreadPool::getSharedPool() {
+    // hardware_concurrency is allowed to report 0 when it can't tell
+    static util::ThreadPool sharedPool(std::max<uint32_t>(std::thread::hardware_concurrency(), 2) - 1);
+
+    return sharedPool;
+}
+
+util::ThreadPool::ThreadPool(
+    const uint32_t threadCount
+) :
+    m_queueMutex(),
+    m_queueCondition(),
+    m_tasks(),
+    m_isStopping(false),
+    m_workerThreads()
+{
+    m_workerThreads.reserve(std::max<uint32_t>(threadCount, 1));
+    for (uint32_t i = 0; i < std::max<uint32_t>(threadCount, 1); ++i) {
+        m_workerThreads.emplace_back(&util::ThreadPool::runWorker, this);
+    }
+}
+
+util::ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_isStopping = true;
+    }
+    m_queueCondition.notify_all();
+
+    for (std::thread& workerThread : m_workerThreads) {
+        workerThread.join();
+    }
+}
+
+void
+util::ThreadPool::enqueue(
+    std::function<void()>&& task
+) {
+    {
+        std::lock_guard<std::mutex> lock(m_queueMutex);
+        m_tasks.push(std::move(task));
+    }
+    m_queueCondition.notify_one();
+}
+
+void
+util::ThreadPool::runWorker() {
+    while (true) {
+        std::function<void()> task;
+
+        {
+            std::unique_lock<std::mutex> lock(m_queueMutex);
+            m_queueCondition.wait(lock, [this]() { return m_isStopping || !m_tasks.empty(); });
+
+            // Only stop once everything that was submitted has run
+            if (m_tasks.empty()) {
+                return;
+            }
+
+            task = std::move(m_tasks.front());
+            m_tasks.pop();
+        }
+
+        task();
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace util {
+    class ThreadPool;
+}
+
+/**
+ * @brief A fixed set of worker threads pulling tasks off of a shared queue. Submitting a task gives
+ *   back a future for its result, and any exception the task throws is rethrown from that future.
+ *
+ * @brief Tasks should not log. The logger's scope indentation is shared by every thread, so tasks
+ *   hand their results back to the submitting thread and let it do the logging.
+ *
+ * @brief Destroying the pool finishes every task which was already submitted before joining the
+ *   workers.
+ */
+class util::ThreadPool {
+public: // member functions
+    ThreadPool(const uint32_t threadCount);
+    ThreadPool(const ThreadPool& other) = delete;
+    ~ThreadPool();
+
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+
+    uint32_t getThreadCount() const { return m_workerThreads.size(); }
+
+    template <typename Task_t>
+    std::future<std::invoke_result_t<std::decay_t<Task_t>>> submit(Task_t&& task) {
+        using Result_t = std::invoke_result_t<std::decay_t<Task_t>>;
+
+        // std::function needs something copyable, which a packaged task is not
+        std::shared_ptr<std::packaged_task<Result_t()>> p_packagedTask = std::make_shared<std::packaged_task<Result_t()>>(std::forward<Task_t>(task));
+        std::future<Result_t> future = p_packagedTask->get_future();
+
+        this->enqueue([p_packagedTask]() { (*p_packagedTask)(); });
+
+        return future;
+    }
+
+public: // static functions
+    /**
+     * @brief The pool shared by everything which wants to spread loading work across the machine.
+     *   Created the first time it is asked for, with a worker for every hardware thread but the one
+     *   asking
+     */
+    static util::ThreadPool& getSharedPool();
+
+private: // member functions
+    void enqueue(std::function<void()>&& task);
+    void runWorker();
+
+private: // member variables
+    std::mutex m_queueMutex;
+    std::condition_variable m_queueCondition;
+    std::queue<std::function<void()>> m_tasks;
+    bool m_isStopping;
+
+    std::vector<std::thread> m_workerThreads;
+};
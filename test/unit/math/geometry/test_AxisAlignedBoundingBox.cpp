@@ -0,0 +1,122 @@
+#include <cmath>
+
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec3.hpp"
+
+UT_FUNCTION(test_construction) {
+    // Default construction is empty
+    {
+        const math::AxisAlignedBoundingBox box;
+
+        UT_CHECK_TRUE(box.isEmpty());
+    }
+
+    // Construction from corners
+    {
+        const math::AxisAlignedBoundingBox box({-1, -2, -3}, {1, 4, 9});
+
+        UT_CHECK_FALSE(box.isEmpty());
+        UT_CHECK_EQUAL(box.getMinimum(), math::Vec3(-1, -2, -3));
+        UT_CHECK_EQUAL(box.getMaximum(), math::Vec3(1, 4, 9));
+        UT_CHECK_EQUAL(box.getCenter(), math::Vec3(0, 1, 3));
+        UT_CHECK_EQUAL(box.getHalfExtents(), math::Vec3(1, 3, 6));
+    }
+
+    // A single point is not empty
+    {
+        const math::AxisAlignedBoundingBox box({5, 5, 5}, {5, 5, 5});
+
+        UT_CHECK_FALSE(box.isEmpty());
+        UT_CHECK_EQUAL(box.getHalfExtents(), math::Vec3(0, 0, 0));
+    }
+}
+
+UT_FUNCTION(test_expand) {
+    // Expanding an empty box by points
+    {
+        math::AxisAlignedBoundingBox box;
+        box.expand(math::Vec3(1, -1, 0));
+        box.expand(math::Vec3(-2, 3, 0.5));
+
+        UT_CHECK_FALSE(box.isEmpty());
+        UT_CHECK_EQUAL(box.getMinimum(), math::Vec3(-2, -1, 0));
+        UT_CHECK_EQUAL(box.getMaximum(), math::Vec3(1, 3, 0.5));
+    }
+
+    // Expanding by another box
+    {
+        math::AxisAlignedBoundingBox box({0, 0, 0}, {1, 1, 1});
+        box.expand(math::AxisAlignedBoundingBox({-1, 0.5, 0.5}, {0.5, 2, 0.75}));
+
+        UT_CHECK_EQUAL(box.getMinimum(), math::Vec3(-1, 0, 0));
+        UT_CHECK_EQUAL(box.getMaximum(), math::Vec3(1, 2, 1));
+    }
+
+    // Expanding by an empty box does nothing
+    {
+        math::AxisAlignedBoundingBox box({0, 0, 0}, {1, 1, 1});
+        box.expand(math::AxisAlignedBoundingBox());
+
+        UT_CHECK_EQUAL(box.getMinimum(), math::Vec3(0, 0, 0));
+        UT_CHECK_EQUAL(box.getMaximum(), math::Vec3(1, 1, 1));
+    }
+}
+
+UT_FUNCTION(test_getTransformed) {
+    const math::AxisAlignedBoundingBox box({-1, -1, -1}, {1, 1, 1});
+
+    // Identity
+    {
+        const math::AxisAlignedBoundingBox transformed = box.getTransformed(math::Mat4(1.0f));
+
+        UT_CHECK_EQUAL(transformed.getMinimum(), math::Vec3(-1, -1, -1));
+        UT_CHECK_EQUAL(transformed.getMaximum(), math::Vec3(1, 1, 1));
+    }
+
+    // Translation and scale
+    {
+        math::Mat4 transformationMatrix(1.0f);
+        transformationMatrix.translate({10, 0, -5});
+        transformationMatrix.scale({2, 3, 4});
+
+        const math::AxisAlignedBoundingBox transformed = box.getTransformed(transformationMatrix);
+
+        UT_CHECK_EQUAL(transformed.getMinimum(), math::Vec3(8, -3, -9));
+        UT_CHECK_EQUAL(transformed.getMaximum(), math::Vec3(12, 3, -1));
+    }
+
+    // Rotating 45 degrees about y grows the box to contain the rotated corners
+    {
+        const math::Mat4 transformationMatrix = glm::rotate(glm::mat4(1.0f), glm::radians(45.0f), glm::vec3(0, 1, 0));
+
+        const math::AxisAlignedBoundingBox transformed = box.getTransformed(transformationMatrix);
+
+        const float expected = std::sqrt(2.0f);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMinimum().x, -expected);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMinimum().y, -1);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMinimum().z, -expected);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMaximum().x, expected);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMaximum().y, 1);
+        UT_CHECK_EQUAL_FLOATS(transformed.getMaximum().z, expected);
+    }
+
+    // Empty boxes stay empty
+    {
+        math::Mat4 transformationMatrix(1.0f);
+        transformationMatrix.translate({10, 0, -5});
+
+        UT_CHECK_TRUE(math::AxisAlignedBoundingBox().getTransformed(transformationMatrix).isEmpty());
+    }
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_construction);
+    REGISTER_UT_FUNCTION(test_expand);
+    REGISTER_UT_FUNCTION(test_getTransformed);
+    UT_RUN_TESTS();
+}
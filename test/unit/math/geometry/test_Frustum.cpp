@@ -0,0 +1,62 @@
+#include <glm/gtc/matrix_transform.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "math/geometry/AxisAlignedBoundingBox.hpp"
+#include "math/geometry/Frustum.hpp"
+#include "math/transform/Mat4.hpp"
+#include "math/transform/Vec3.hpp"
+
+/**
+ * @brief A camera at the origin looking down -z with a 90 degree field of view and a far plane at 100
+ */
+math::Frustum
+createFrustum() {
+    const glm::mat4 viewMatrix = glm::lookAt(glm::vec3(0, 0, 0), glm::vec3(0, 0, -1), glm::vec3(0, 1, 0));
+    const glm::mat4 projectionMatrix = glm::perspective(glm::radians(90.0f), 1.0f, 0.1f, 100.0f);
+
+    return math::Frustum(math::Mat4(projectionMatrix * viewMatrix));
+}
+
+UT_FUNCTION(test_planes) {
+    const math::Frustum frustum = createFrustum();
+
+    // All planes should be normalized
+    for (const math::Vec4& plane : frustum.getPlanes()) {
+        UT_CHECK_EQUAL_FLOATS(glm::length(glm::vec3(plane.glmVec)), 1.0f);
+    }
+}
+
+UT_FUNCTION(test_intersects) {
+    const math::Frustum frustum = createFrustum();
+
+    // In front of the camera
+    UT_CHECK_TRUE(frustum.intersects(math::AxisAlignedBoundingBox({-1, -1, -11}, {1, 1, -9})));
+
+    // Behind the camera
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({-1, -1, 9}, {1, 1, 11})));
+
+    // Beyond the far plane
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({-1, -1, -201}, {1, 1, -199})));
+
+    // Off to the sides
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({49, -1, -11}, {51, 1, -9})));
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({-51, -1, -11}, {-49, 1, -9})));
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({-1, 49, -11}, {1, 51, -9})));
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox({-1, -51, -11}, {1, -49, -9})));
+
+    // Straddling the left plane (x = z at this field of view)
+    UT_CHECK_TRUE(frustum.intersects(math::AxisAlignedBoundingBox({-12, -1, -11}, {-8, 1, -9})));
+
+    // Containing the whole frustum
+    UT_CHECK_TRUE(frustum.intersects(math::AxisAlignedBoundingBox({-1000, -1000, -1000}, {1000, 1000, 1000})));
+
+    // Empty boxes are never visible
+    UT_CHECK_FALSE(frustum.intersects(math::AxisAlignedBoundingBox()));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_planes);
+    REGISTER_UT_FUNCTION(test_intersects);
+    UT_RUN_TESTS();
+}
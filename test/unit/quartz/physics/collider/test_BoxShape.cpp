@@ -5,15 +5,25 @@
 #include "quartz/managers/physics_manager/PhysicsManager.hpp"
 
 #include "quartz/physics/collider/BoxShape.hpp"
+#include "quartz/physics/field/Field.hpp"
 
 namespace quartz {
 namespace unit_test {
 class PhysicsManagerUnitTestClient {
 public:
+    static quartz::physics::Field createField() {
+        return quartz::managers::PhysicsManager::Client::getInstance().createField({math::Vec3(0, -9.81, 0)});
+    }
+
+    static void destroyField(quartz::physics::Field& field) {
+        quartz::managers::PhysicsManager::Client::getInstance().destroyField(field);
+    }
+
     static quartz::physics::BoxShape createBoxShape(
+        quartz::physics::Field& field,
         const quartz::physics::BoxShape::Parameters& boxShapeParameters
     ) {
-        return quartz::managers::PhysicsManager::Client::getInstance().createBoxShape(boxShapeParameters);
+        return quartz::managers::PhysicsManager::Client::getInstance().createBoxShape(field, boxShapeParameters);
     }
 private:
     PhysicsManagerUnitTestClient() = delete;
@@ -23,12 +33,15 @@ private:
 } // namespace quartz
 
 UT_FUNCTION(test_construction_movement) {
+    // shapes come from the field's shape cache
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
     // regular construction
     {
         const math::Vec3 halfExtents_m(4, 7, 3);        
         quartz::physics::BoxShape::Parameters params(halfExtents_m);
 
-        const quartz::physics::BoxShape boxShape = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(params);
+        const quartz::physics::BoxShape boxShape = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(field, params);
         
         UT_CHECK_EQUAL(boxShape.getHalfExtents_m(), halfExtents_m);
 
@@ -48,7 +61,7 @@ UT_FUNCTION(test_construction_movement) {
         const math::Vec3 halfExtents_m(5, 8, 3);        
         quartz::physics::BoxShape::Parameters params(halfExtents_m);
 
-        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(params);
+        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(field, params);
         const quartz::physics::BoxShape boxShapeB(std::move(boxShapeA));
         
         UT_CHECK_EQUAL(boxShapeB.getHalfExtents_m(), halfExtents_m);
@@ -69,7 +82,7 @@ UT_FUNCTION(test_construction_movement) {
         const math::Vec3 halfExtents_m(1, 2, 3);        
         quartz::physics::BoxShape::Parameters params(halfExtents_m);
 
-        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(params);
+        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(field, params);
         const quartz::physics::BoxShape boxShapeB = std::move(boxShapeA);
         
         UT_CHECK_EQUAL(boxShapeB.getHalfExtents_m(), halfExtents_m);
@@ -90,9 +103,9 @@ UT_FUNCTION(test_construction_movement) {
         const math::Vec3 halfExtents_m(3, 4, 5);        
         quartz::physics::BoxShape::Parameters params(halfExtents_m);
 
-        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(params);
+        quartz::physics::BoxShape boxShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(field, params);
 
-        quartz::physics::BoxShape boxShapeB = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape({math::Vec3(9,9,9)});
+        quartz::physics::BoxShape boxShapeB = quartz::unit_test::PhysicsManagerUnitTestClient::createBoxShape(field, {math::Vec3(9,9,9)});
         boxShapeB = std::move(boxShapeA);
         
         UT_CHECK_EQUAL(boxShapeB.getHalfExtents_m(), halfExtents_m);
@@ -107,6 +120,8 @@ UT_FUNCTION(test_construction_movement) {
         UT_CHECK_EQUAL(localVertexPositions[6], math::Vec3( 3,  4, -5));
         UT_CHECK_EQUAL(localVertexPositions[7], math::Vec3(-3,  4, -5));
     }
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
 }
 
 UT_MAIN() {
@@ -0,0 +1,100 @@
+#include <reactphysics3d/engine/PhysicsCommon.h>
+
+#include "math/transform/Vec3.hpp"
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/physics/collider/ShapeCache.hpp"
+
+UT_FUNCTION(test_getKey) {
+    // Signs don't matter, just like they don't for the shapes themselves
+    UT_CHECK_TRUE(quartz::physics::ShapeCache::getBoxShapeKey({1, 2, 3}) == quartz::physics::ShapeCache::getBoxShapeKey({-1, 2, -3}));
+    UT_CHECK_EQUAL(quartz::physics::ShapeCache::getSphereShapeKey(4), quartz::physics::ShapeCache::getSphereShapeKey(-4));
+
+    // Floating point noise is quantized away
+    UT_CHECK_TRUE(quartz::physics::ShapeCache::getBoxShapeKey({1, 2, 3}) == quartz::physics::ShapeCache::getBoxShapeKey({1.000001, 2, 3}));
+    UT_CHECK_EQUAL(quartz::physics::ShapeCache::getSphereShapeKey(4), quartz::physics::ShapeCache::getSphereShapeKey(4.000001));
+
+    UT_CHECK_FALSE(quartz::physics::ShapeCache::getBoxShapeKey({1, 2, 3}) == quartz::physics::ShapeCache::getBoxShapeKey({1, 2, 3.001}));
+    UT_CHECK_FALSE(quartz::physics::ShapeCache::getSphereShapeKey(4) == quartz::physics::ShapeCache::getSphereShapeKey(4.001));
+}
+
+UT_FUNCTION(test_boxShapes) {
+    reactphysics3d::PhysicsCommon physicsCommon;
+    quartz::physics::ShapeCache shapeCache(physicsCommon);
+
+    reactphysics3d::BoxShape* p_boxShape1 = shapeCache.acquireBoxShape({1, 2, 3});
+    reactphysics3d::BoxShape* p_boxShape2 = shapeCache.acquireBoxShape({-1, 2, 3});
+    reactphysics3d::BoxShape* p_boxShape3 = shapeCache.acquireBoxShape({4, 5, 6});
+    UT_CHECK_TRUE(p_boxShape1 == p_boxShape2);
+    UT_CHECK_TRUE(p_boxShape1 != p_boxShape3);
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 2);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_boxShape1), 2);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_boxShape3), 1);
+    UT_CHECK_EQUAL(math::Vec3(p_boxShape1->getHalfExtents()), math::Vec3(1, 2, 3));
+
+    // A shared shape can't be resized, so we get a different one
+    reactphysics3d::BoxShape* p_resizedBoxShape = shapeCache.resizeBoxShape(p_boxShape2, {7, 8, 9});
+    UT_CHECK_TRUE(p_resizedBoxShape != p_boxShape2);
+    UT_CHECK_EQUAL(math::Vec3(p_boxShape1->getHalfExtents()), math::Vec3(1, 2, 3));
+    UT_CHECK_EQUAL(math::Vec3(p_resizedBoxShape->getHalfExtents()), math::Vec3(7, 8, 9));
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 3);
+    shapeCache.releaseBoxShape(p_boxShape2);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_boxShape1), 1);
+
+    // A shape with a single reference is resized in place
+    reactphysics3d::BoxShape* p_resizedInPlaceBoxShape = shapeCache.resizeBoxShape(p_resizedBoxShape, {10, 11, 12});
+    UT_CHECK_TRUE(p_resizedInPlaceBoxShape == p_resizedBoxShape);
+    UT_CHECK_EQUAL(math::Vec3(p_resizedInPlaceBoxShape->getHalfExtents()), math::Vec3(10, 11, 12));
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_resizedInPlaceBoxShape), 1);
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 3);
+
+    // Unless there is already a shape with those half extents
+    reactphysics3d::BoxShape* p_existingBoxShape = shapeCache.resizeBoxShape(p_resizedInPlaceBoxShape, {4, 5, 6});
+    UT_CHECK_TRUE(p_existingBoxShape == p_boxShape3);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_boxShape3), 2);
+    shapeCache.releaseBoxShape(p_resizedInPlaceBoxShape);
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 2);
+
+    // Shapes are destroyed with their last reference
+    shapeCache.releaseBoxShape(p_boxShape1);
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 1);
+    shapeCache.releaseBoxShape(p_boxShape3);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_boxShape3), 1);
+    shapeCache.releaseBoxShape(p_boxShape3);
+    UT_CHECK_EQUAL(shapeCache.getBoxShapeCount(), 0);
+}
+
+UT_FUNCTION(test_sphereShapes) {
+    reactphysics3d::PhysicsCommon physicsCommon;
+    quartz::physics::ShapeCache shapeCache(physicsCommon);
+
+    reactphysics3d::SphereShape* p_sphereShape1 = shapeCache.acquireSphereShape(2);
+    reactphysics3d::SphereShape* p_sphereShape2 = shapeCache.acquireSphereShape(2);
+    reactphysics3d::SphereShape* p_sphereShape3 = shapeCache.acquireSphereShape(3);
+    UT_CHECK_TRUE(p_sphereShape1 == p_sphereShape2);
+    UT_CHECK_TRUE(p_sphereShape1 != p_sphereShape3);
+    UT_CHECK_EQUAL(shapeCache.getSphereShapeCount(), 2);
+    UT_CHECK_EQUAL(shapeCache.getReferenceCount(p_sphereShape1), 2);
+
+    reactphysics3d::SphereShape* p_resizedSphereShape = shapeCache.resizeSphereShape(p_sphereShape2, -5);
+    UT_CHECK_TRUE(p_resizedSphereShape != p_sphereShape2);
+    UT_CHECK_EQUAL_FLOATS(p_resizedSphereShape->getRadius(), 5);
+    UT_CHECK_EQUAL_FLOATS(p_sphereShape1->getRadius(), 2);
+    shapeCache.releaseSphereShape(p_sphereShape2);
+
+    UT_CHECK_TRUE(shapeCache.resizeSphereShape(p_resizedSphereShape, 6) == p_resizedSphereShape);
+    UT_CHECK_EQUAL_FLOATS(p_resizedSphereShape->getRadius(), 6);
+
+    shapeCache.releaseSphereShape(p_sphereShape1);
+    shapeCache.releaseSphereShape(p_sphereShape3);
+    shapeCache.releaseSphereShape(p_resizedSphereShape);
+    UT_CHECK_EQUAL(shapeCache.getSphereShapeCount(), 0);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_getKey);
+    REGISTER_UT_FUNCTION(test_boxShapes);
+    REGISTER_UT_FUNCTION(test_sphereShapes);
+    UT_RUN_TESTS();
+}
@@ -1,17 +1,29 @@
 #include "util/unit_test/UnitTest.hpp"
 
+#include "math/transform/Vec3.hpp"
+
 #include "quartz/managers/physics_manager/PhysicsManager.hpp"
 
 #include "quartz/physics/collider/SphereShape.hpp"
+#include "quartz/physics/field/Field.hpp"
 
 namespace quartz {
 namespace unit_test {
 class PhysicsManagerUnitTestClient {
 public:
+    static quartz::physics::Field createField() {
+        return quartz::managers::PhysicsManager::Client::getInstance().createField({math::Vec3(0, -9.81, 0)});
+    }
+
+    static void destroyField(quartz::physics::Field& field) {
+        quartz::managers::PhysicsManager::Client::getInstance().destroyField(field);
+    }
+
     static quartz::physics::SphereShape createSphereShape(
+        quartz::physics::Field& field,
         const quartz::physics::SphereShape::Parameters& sphereShapeParameters
     ) {
-        return quartz::managers::PhysicsManager::Client::getInstance().createSphereShape(sphereShapeParameters);
+        return quartz::managers::PhysicsManager::Client::getInstance().createSphereShape(field, sphereShapeParameters);
     }
 private:
     PhysicsManagerUnitTestClient() = delete;
@@ -21,12 +33,15 @@ private:
 } // namespace quartz
 
 UT_FUNCTION(test_construction_movement) {
+    // shapes come from the field's shape cache
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
     // construction
     {
         const double radius_m = 4.0;        
         quartz::physics::SphereShape::Parameters params(radius_m);
 
-        const quartz::physics::SphereShape sphereShape = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(params);
+        const quartz::physics::SphereShape sphereShape = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(field, params);
         
         UT_CHECK_EQUAL(sphereShape.getRadius_m(), radius_m);
     }
@@ -36,7 +51,7 @@ UT_FUNCTION(test_construction_movement) {
         const double radius_m = 5.0;        
         quartz::physics::SphereShape::Parameters params(radius_m);
 
-        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(params);
+        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(field, params);
         quartz::physics::SphereShape sphereShapeB(std::move(sphereShapeA));
         
         UT_CHECK_EQUAL(sphereShapeB.getRadius_m(), radius_m);
@@ -47,7 +62,7 @@ UT_FUNCTION(test_construction_movement) {
         const double radius_m = 6.0;        
         quartz::physics::SphereShape::Parameters params(radius_m);
 
-        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(params);
+        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(field, params);
         quartz::physics::SphereShape sphereShapeB = std::move(sphereShapeA);
         
         UT_CHECK_EQUAL(sphereShapeB.getRadius_m(), radius_m);
@@ -58,13 +73,15 @@ UT_FUNCTION(test_construction_movement) {
         const double radius_m = 7.0;        
         quartz::physics::SphereShape::Parameters params(radius_m);
 
-        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(params);
+        quartz::physics::SphereShape sphereShapeA = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(field, params);
 
-        quartz::physics::SphereShape sphereShapeB = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape({1.0});
+        quartz::physics::SphereShape sphereShapeB = quartz::unit_test::PhysicsManagerUnitTestClient::createSphereShape(field, {1.0});
         sphereShapeB = std::move(sphereShapeA);
         
         UT_CHECK_EQUAL(sphereShapeB.getRadius_m(), radius_m);
     }
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
 }
 
 UT_MAIN() {
@@ -1,13 +1,20 @@
+#include <cmath>
+#include <optional>
+#include <span>
+
 #include "math/transform/Transform.hpp"
 #include "math/transform/Vec3.hpp"
 
+#include "util/macros.hpp"
 #include "util/logger/Logger.hpp"
 #include "util/unit_test/UnitTest.hpp"
 
 #include "quartz/managers/physics_manager/PhysicsManager.hpp"
 
+#include "quartz/physics/field/CollisionEventStream.hpp"
 #include "quartz/physics/field/Field.hpp"
 #include "quartz/physics/rigid_body/RigidBody.hpp"
+#include "quartz/physics/collider/BoxShape.hpp"
 #include "quartz/physics/collider/Collider.hpp"
 #include "quartz/physics/collider/SphereShape.hpp"
 
@@ -133,8 +140,253 @@ UT_FUNCTION(test_fixedUpdate_2) {
     quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
 }
 
+UT_FUNCTION(test_collisionEventStream) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField({0, 0, 0});
+
+    // Neither of these have callbacks, so the events are recorded but nobody is subscribed to them
+
+    quartz::physics::RigidBody sphereRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {
+            {0, 0.99, 0},
+            0,
+            {0, 1, 0},
+            {1, 1, 1}
+        },
+        quartz::physics::RigidBody::Parameters {
+            quartz::physics::RigidBody::BodyType::Dynamic,
+            false,
+            {0, 0, 0},
+            quartz::physics::Collider::Parameters {
+                false,
+                quartz::physics::Collider::CategoryProperties(0b01, 0b11),
+                quartz::physics::SphereShape::Parameters(1),
+                {},
+                {},
+                {}
+            }
+        }
+    );
+
+    quartz::physics::RigidBody groundRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {
+            {0, -1, 0},
+            0,
+            {0, 1, 0},
+            {1, 1, 1}
+        },
+        quartz::physics::RigidBody::Parameters {
+            quartz::physics::RigidBody::BodyType::Static,
+            false,
+            {0, 1, 0},
+            quartz::physics::Collider::Parameters {
+                false,
+                quartz::physics::Collider::CategoryProperties(0b10, 0b11),
+                quartz::physics::BoxShape::Parameters({10, 1, 10}),
+                {},
+                {},
+                {}
+            }
+        }
+    );
+
+    const quartz::physics::CollisionEventStream& collisionEventStream = field.getCollisionEventStream();
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionCount(), 0);
+    UT_CHECK_EQUAL(collisionEventStream.getEvents().size(), 0);
+
+    // The sphere starts out overlapping the ground
+    field.fixedUpdate(0.05);
+    UT_REQUIRE(collisionEventStream.getEvents().size() == 1);
+    {
+        const quartz::physics::CollisionEventStream::Event& event = collisionEventStream.getEvents()[0];
+        UT_CHECK_TRUE(event.collisionType == quartz::physics::Collider::CollisionType::ContactStart);
+        UT_CHECK_FALSE(event.isTrigger);
+        const quartz::physics::Collider* p_collider1 = collisionEventStream.getCollider(event.p_rp3dCollider1);
+        const quartz::physics::Collider* p_collider2 = collisionEventStream.getCollider(event.p_rp3dCollider2);
+        UT_CHECK_TRUE(p_collider1 == &(*sphereRb.getColliderOptional()) || p_collider1 == &(*groundRb.getColliderOptional()));
+        UT_CHECK_TRUE(p_collider2 == &(*sphereRb.getColliderOptional()) || p_collider2 == &(*groundRb.getColliderOptional()));
+        UT_CHECK_TRUE(p_collider1 != p_collider2);
+
+        const std::span<const quartz::physics::Collider::ContactPoint> contactPoints = collisionEventStream.getContactPoints(event);
+        UT_REQUIRE(!contactPoints.empty());
+        for (const quartz::physics::Collider::ContactPoint& contactPoint : contactPoints) {
+            UT_CHECK_TRUE(contactPoint.penetrationDepth_m > 0);
+            UT_CHECK_TRUE(std::abs(contactPoint.worldNormal.y) > 0.99);
+        }
+    }
+
+    // The previous tick's events are replaced, not appended to
+    field.fixedUpdate(0.05);
+    UT_REQUIRE(collisionEventStream.getEvents().size() == 1);
+    UT_CHECK_TRUE(collisionEventStream.getEvents()[0].collisionType == quartz::physics::Collider::CollisionType::ContactStay);
+
+    // Contacts that are ending don't have any contact points
+    sphereRb.setPosition({1000, 1000, 1000});
+    field.fixedUpdate(0.05);
+    UT_REQUIRE(collisionEventStream.getEvents().size() == 1);
+    UT_CHECK_TRUE(collisionEventStream.getEvents()[0].collisionType == quartz::physics::Collider::CollisionType::ContactEnd);
+    UT_CHECK_EQUAL(collisionEventStream.getContactPoints(collisionEventStream.getEvents()[0]).size(), 0);
+
+    // Nothing is touching anymore
+    field.fixedUpdate(0.05);
+    UT_CHECK_EQUAL(collisionEventStream.getEvents().size(), 0);
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, groundRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, sphereRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
+UT_FUNCTION(test_collisionEventStream_dispatch) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField({0, 0, 0});
+    const quartz::physics::CollisionEventStream& collisionEventStream = field.getCollisionEventStream();
+
+    uint32_t sphereStartValue = 0;
+    const quartz::physics::Collider* p_sphereOtherCollider = nullptr;
+    const quartz::physics::RigidBody::Parameters sphereRbParameters(
+        quartz::physics::RigidBody::BodyType::Dynamic,
+        false,
+        {0, 0, 0},
+        quartz::physics::Collider::Parameters(
+            false,
+            quartz::physics::Collider::CategoryProperties(0b01, 0b11),
+            quartz::physics::SphereShape::Parameters(1),
+            [&sphereStartValue, &p_sphereOtherCollider] (quartz::physics::Collider::CollisionCallbackParameters parameters) {
+                sphereStartValue++;
+                p_sphereOtherCollider = parameters.p_otherCollider;
+            },
+            {},
+            {}
+        )
+    );
+
+    quartz::physics::RigidBody sphereRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {{0, 0.99, 0}, 0, {0, 1, 0}, {1, 1, 1}},
+        sphereRbParameters
+    );
+
+    // The ground has no callbacks, so it is never subscribed and nothing is dispatched to it
+    quartz::physics::RigidBody groundRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {{0, -1, 0}, 0, {0, 1, 0}, {1, 1, 1}},
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Static,
+            false,
+            {0, 1, 0},
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b10, 0b11),
+                quartz::physics::BoxShape::Parameters({10, 1, 10}),
+                {},
+                {},
+                {}
+            )
+        )
+    );
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionCount(), 1);
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionSlotCount(), 1);
+
+    field.fixedUpdate(0.05);
+    UT_CHECK_EQUAL(sphereStartValue, 1);
+    UT_CHECK_TRUE(p_sphereOtherCollider == &(*groundRb.getColliderOptional()));
+
+    // Destroying the sphere frees its subscription, and the next sphere reuses it
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, sphereRb);
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionCount(), 0);
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionSlotCount(), 1);
+
+    quartz::physics::RigidBody nextSphereRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {{0, 0.99, 0}, 0, {0, 1, 0}, {1, 1, 1}},
+        sphereRbParameters
+    );
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionCount(), 1);
+    UT_CHECK_EQUAL(collisionEventStream.getSubscriptionSlotCount(), 1);
+
+    field.fixedUpdate(0.05);
+    UT_CHECK_EQUAL(sphereStartValue, 2);
+    UT_CHECK_TRUE(p_sphereOtherCollider == &(*groundRb.getColliderOptional()));
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, nextSphereRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, groundRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
+UT_FUNCTION(test_collisionEventStream_destroyDuringDispatch) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField({0, 0, 0});
+
+    // Whichever of these is dispatched to first destroys the other, so the other is never dispatched to
+    uint32_t callbackCount = 0;
+    std::optional<quartz::physics::RigidBody> o_sphereRb;
+    std::optional<quartz::physics::RigidBody> o_groundRb;
+
+    o_sphereRb.emplace(quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {{0, 0.99, 0}, 0, {0, 1, 0}, {1, 1, 1}},
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Dynamic,
+            false,
+            {0, 0, 0},
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b01, 0b11),
+                quartz::physics::SphereShape::Parameters(1),
+                [&field, &callbackCount, &o_groundRb] (UNUSED quartz::physics::Collider::CollisionCallbackParameters parameters) {
+                    callbackCount++;
+                    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, *o_groundRb);
+                    o_groundRb.reset();
+                },
+                {},
+                {}
+            )
+        )
+    ));
+
+    o_groundRb.emplace(quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform {{0, -1, 0}, 0, {0, 1, 0}, {1, 1, 1}},
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Static,
+            false,
+            {0, 1, 0},
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b10, 0b11),
+                quartz::physics::BoxShape::Parameters({10, 1, 10}),
+                [&field, &callbackCount, &o_sphereRb] (UNUSED quartz::physics::Collider::CollisionCallbackParameters parameters) {
+                    callbackCount++;
+                    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, *o_sphereRb);
+                    o_sphereRb.reset();
+                },
+                {},
+                {}
+            )
+        )
+    ));
+
+    field.fixedUpdate(0.05);
+    UT_CHECK_EQUAL(callbackCount, 1);
+    UT_CHECK_TRUE(o_sphereRb.has_value() != o_groundRb.has_value());
+
+    // The destroyed one's subscription was freed after the dispatch, leaving its slot for reuse
+    UT_CHECK_EQUAL(field.getCollisionEventStream().getSubscriptionCount(), 1);
+    UT_CHECK_EQUAL(field.getCollisionEventStream().getSubscriptionSlotCount(), 2);
+
+    if (o_sphereRb) {
+        quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, *o_sphereRb);
+    }
+    if (o_groundRb) {
+        quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, *o_groundRb);
+    }
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
 UT_MAIN() {
     REGISTER_UT_FUNCTION(test_fixedUpdate_1);
     REGISTER_UT_FUNCTION(test_fixedUpdate_2);
+    REGISTER_UT_FUNCTION(test_collisionEventStream);
+    REGISTER_UT_FUNCTION(test_collisionEventStream_dispatch);
+    REGISTER_UT_FUNCTION(test_collisionEventStream_destroyDuringDispatch);
     UT_RUN_TESTS();
 }
@@ -0,0 +1,179 @@
+#include <thread>
+#include <vector>
+
+#include "math/transform/Transform.hpp"
+#include "math/transform/Vec3.hpp"
+
+#include "util/macros.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/managers/physics_manager/PhysicsManager.hpp"
+
+#include "quartz/physics/collider/BoxShape.hpp"
+#include "quartz/physics/collider/Collider.hpp"
+#include "quartz/physics/collider/SphereShape.hpp"
+#include "quartz/physics/field/Field.hpp"
+#include "quartz/physics/field/FieldScheduler.hpp"
+#include "quartz/physics/rigid_body/RigidBody.hpp"
+
+namespace quartz {
+namespace unit_test {
+class PhysicsManagerUnitTestClient {
+public:
+    static quartz::physics::Field createField(const math::Vec3& gravity) {
+        return quartz::managers::PhysicsManager::Client::getInstance().createField(gravity);
+    }
+
+    static void destroyField(quartz::physics::Field& field) {
+        quartz::managers::PhysicsManager::Client::getInstance().destroyField(field);
+    }
+
+    static quartz::physics::RigidBody createRigidBody(
+        quartz::physics::Field& field,
+        const math::Transform& transform,
+        const quartz::physics::RigidBody::Parameters& rigidBodyParameters
+    ) {
+        return quartz::managers::PhysicsManager::Client::getInstance().createRigidBody(field, transform, rigidBodyParameters);
+    }
+
+    static void destroyRigidBody(
+        quartz::physics::Field& field,
+        quartz::physics::RigidBody& rigidBody
+    ) {
+        quartz::managers::PhysicsManager::Client::getInstance().destroyRigidBody(field, rigidBody);
+    }
+
+private:
+    PhysicsManagerUnitTestClient() = delete;
+};
+} // namespace unit_test
+} // namespace quartz
+
+UT_FUNCTION(test_getGroupCount) {
+    util::ThreadPool threadPool(3);
+    const quartz::physics::FieldScheduler fieldScheduler(threadPool);
+
+    UT_CHECK_EQUAL(fieldScheduler.getGroupCount(0), 0);
+    UT_CHECK_EQUAL(fieldScheduler.getGroupCount(1), 1);
+    UT_CHECK_EQUAL(fieldScheduler.getGroupCount(2), 2);
+    UT_CHECK_EQUAL(fieldScheduler.getGroupCount(3), 3);
+    UT_CHECK_EQUAL(fieldScheduler.getGroupCount(100), 3);
+}
+
+UT_FUNCTION(test_fixedUpdate) {
+    util::ThreadPool threadPool(3);
+    quartz::physics::FieldScheduler fieldScheduler(threadPool);
+
+    const std::thread::id testThreadId = std::this_thread::get_id();
+
+    // Every field gets a falling sphere, and every other field also gets a ground for it to land on
+
+    const uint32_t fieldCount = 8;
+    std::vector<quartz::physics::Field> fields;
+    std::vector<quartz::physics::RigidBody> sphereRbs;
+    std::vector<quartz::physics::RigidBody> groundRbs;
+    std::vector<uint32_t> startValues(fieldCount, 0);
+    std::vector<bool> callbacksOnTestThread(fieldCount, true);
+    fields.reserve(fieldCount);
+    sphereRbs.reserve(fieldCount);
+    groundRbs.reserve(fieldCount);
+
+    for (uint32_t i = 0; i < fieldCount; ++i) {
+        fields.push_back(quartz::unit_test::PhysicsManagerUnitTestClient::createField({0, -4, 0}));
+
+        sphereRbs.push_back(quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+            fields[i],
+            math::Transform {
+                {0, 10, 0},
+                0,
+                {0, 1, 0},
+                {1, 1, 1}
+            },
+            quartz::physics::RigidBody::Parameters {
+                quartz::physics::RigidBody::BodyType::Dynamic,
+                true,
+                {0, 0, 0},
+                quartz::physics::Collider::Parameters {
+                    false,
+                    quartz::physics::Collider::CategoryProperties(0b01, 0b11),
+                    quartz::physics::SphereShape::Parameters(1),
+                    [&startValues, &callbacksOnTestThread, testThreadId, i] (UNUSED quartz::physics::Collider::CollisionCallbackParameters parameters) {
+                        startValues[i]++;
+                        callbacksOnTestThread[i] = callbacksOnTestThread[i] && std::this_thread::get_id() == testThreadId;
+                    },
+                    {},
+                    {}
+                }
+            }
+        ));
+
+        if (i % 2 == 0) {
+            continue;
+        }
+
+        groundRbs.push_back(quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+            fields[i],
+            math::Transform {
+                {0, 5, 0},
+                0,
+                {0, 1, 0},
+                {1, 1, 1}
+            },
+            quartz::physics::RigidBody::Parameters {
+                quartz::physics::RigidBody::BodyType::Static,
+                false,
+                {0, 0, 0},
+                quartz::physics::Collider::Parameters {
+                    false,
+                    quartz::physics::Collider::CategoryProperties(0b10, 0b11),
+                    quartz::physics::BoxShape::Parameters({10, 1, 10}),
+                    {},
+                    {},
+                    {}
+                }
+            }
+        ));
+    }
+
+    std::vector<quartz::physics::Field*> fieldPtrs;
+    for (quartz::physics::Field& field : fields) {
+        fieldPtrs.push_back(&field);
+    }
+
+    // Will accelerate by -4 m/s/s, so every sphere goes from 10 m to 6 m, which sinks it into the
+    // ground in the fields that have one. That contact is found at the start of the next step
+    fieldScheduler.fixedUpdate(fieldPtrs, 1.0);
+    for (uint32_t i = 0; i < fieldCount; i += 2) {
+        UT_CHECK_EQUAL(sphereRbs[i].getPosition(), math::Vec3(0, 6, 0));
+    }
+
+    // Every sphere without a ground keeps falling the same as it would in a field updated on its own
+    fieldScheduler.fixedUpdate(fieldPtrs, 1.0);
+    for (uint32_t i = 0; i < fieldCount; i += 2) {
+        UT_CHECK_EQUAL(sphereRbs[i].getPosition(), math::Vec3(0, -2, 0));
+        UT_CHECK_EQUAL(startValues[i], 0);
+    }
+
+    // Every sphere with a ground hit it, and was told about it on this thread
+    for (uint32_t i = 0; i < fieldCount; ++i) {
+        UT_CHECK_TRUE(callbacksOnTestThread[i]);
+    }
+    for (uint32_t i = 1; i < fieldCount; i += 2) {
+        UT_CHECK_EQUAL(startValues[i], 1);
+    }
+
+    for (uint32_t i = 0; i < fieldCount; ++i) {
+        if (i % 2 == 1) {
+            quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(fields[i], groundRbs[i / 2]);
+        }
+        quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(fields[i], sphereRbs[i]);
+        quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(fields[i]);
+    }
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_getGroupCount);
+    REGISTER_UT_FUNCTION(test_fixedUpdate);
+    UT_RUN_TESTS();
+}
@@ -1,3 +1,5 @@
+#include <vector>
+
 #include "math/transform/Transform.hpp"
 #include "math/transform/Vec3.hpp"
 
@@ -8,6 +10,7 @@
 
 #include "quartz/physics/field/Field.hpp"
 #include "quartz/physics/rigid_body/RigidBody.hpp"
+#include "quartz/physics/collider/BoxShape.hpp"
 #include "quartz/physics/collider/Collider.hpp"
 #include "quartz/physics/collider/SphereShape.hpp"
 
@@ -38,6 +41,21 @@ public:
         quartz::managers::PhysicsManager::Client::getInstance().destroyRigidBody(field, rigidBody);
     }
 
+    static std::vector<quartz::physics::RigidBody> createRigidBodies(
+        quartz::physics::Field& field,
+        const std::vector<math::Transform>& transforms,
+        const std::vector<quartz::physics::RigidBody::Parameters>& rigidBodyParameters
+    ) {
+        return quartz::managers::PhysicsManager::Client::getInstance().createRigidBodies(field, transforms, rigidBodyParameters);
+    }
+
+    static void destroyRigidBodies(
+        quartz::physics::Field& field,
+        const std::vector<quartz::physics::RigidBody*>& rigidBodyPtrs
+    ) {
+        quartz::managers::PhysicsManager::Client::getInstance().destroyRigidBodies(field, rigidBodyPtrs);
+    }
+
 private:
     PhysicsManagerUnitTestClient() = delete;
 };
@@ -432,10 +450,260 @@ UT_FUNCTION(test_trigger_callback) {
     quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
 }
 
+UT_FUNCTION(test_bulk_construction) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
+    const quartz::physics::Collider::Parameters sphereColliderParameters(
+        false,
+        quartz::physics::Collider::CategoryProperties(0b01, 0b11),
+        quartz::physics::SphereShape::Parameters(2),
+        {},
+        {},
+        {}
+    );
+    const quartz::physics::Collider::Parameters boxColliderParameters(
+        true,
+        quartz::physics::Collider::CategoryProperties(0b10, 0b01),
+        quartz::physics::BoxShape::Parameters(math::Vec3(1, 2, 3)),
+        {},
+        {},
+        {}
+    );
+
+    const std::vector<math::Transform> transforms = {
+        math::Transform(math::Vec3(0, 1, 2), math::Quaternion(), math::Vec3(1, 3, 1)),
+        math::Transform(math::Vec3(3, 4, 5), math::Quaternion::fromAxisAngleRotation(math::Vec3(0, 1, 0), 30), math::Vec3(2, -2, 2)),
+        math::Transform(math::Vec3(6, 7, 8), math::Quaternion(), math::Vec3(1, 1, 1))
+    };
+    const std::vector<quartz::physics::RigidBody::Parameters> rbParameters = {
+        quartz::physics::RigidBody::Parameters(quartz::physics::RigidBody::BodyType::Dynamic, true, math::Vec3(1, 1, 1), sphereColliderParameters),
+        quartz::physics::RigidBody::Parameters(quartz::physics::RigidBody::BodyType::Static, false, math::Vec3(0, 0, 0), boxColliderParameters),
+        quartz::physics::RigidBody::Parameters(quartz::physics::RigidBody::BodyType::Kinematic, false, math::Vec3(0, 1, 0), sphereColliderParameters)
+    };
+
+    // Each body should match what creating it on its own would have given us
+    std::vector<quartz::physics::RigidBody> rbs = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBodies(field, transforms, rbParameters);
+    UT_REQUIRE(rbs.size() == transforms.size());
+
+    for (uint32_t i = 0; i < rbs.size(); ++i) {
+        UT_CHECK_EQUAL(rbs[i].getPosition(), transforms[i].position);
+        UT_CHECK_EQUAL(rbs[i].getRotation(), transforms[i].rotation);
+
+        const std::optional<quartz::physics::Collider>& o_collider = rbs[i].getColliderOptional();
+        UT_REQUIRE(o_collider);
+        UT_CHECK_EQUAL(o_collider->getCategoryProperties(), rbParameters[i].colliderParameters.categoryProperties);
+        UT_CHECK_EQUAL(o_collider->getIsTrigger(), rbParameters[i].colliderParameters.isTrigger);
+    }
+
+    UT_REQUIRE(rbs[0].getColliderOptional()->getSphereShapeOptional());
+    UT_CHECK_EQUAL_FLOATS(rbs[0].getColliderOptional()->getSphereShapeOptional()->getRadius_m(), 6);
+    UT_REQUIRE(rbs[1].getColliderOptional()->getBoxShapeOptional());
+    UT_CHECK_EQUAL(rbs[1].getColliderOptional()->getBoxShapeOptional()->getHalfExtents_m(), math::Vec3(2, 4, 6));
+    UT_REQUIRE(rbs[2].getColliderOptional()->getSphereShapeOptional());
+    UT_CHECK_EQUAL_FLOATS(rbs[2].getColliderOptional()->getSphereShapeOptional()->getRadius_m(), 2);
+
+    // Destroying them in bulk should be fine after they have been moved out of the returned vector
+    std::vector<quartz::physics::RigidBody> movedRbs;
+    for (quartz::physics::RigidBody& rb : rbs) {
+        movedRbs.push_back(std::move(rb));
+    }
+
+    std::vector<quartz::physics::RigidBody*> rbPtrs;
+    for (uint32_t i = 0; i < movedRbs.size(); ++i) {
+        UT_CHECK_EQUAL(movedRbs[i].getPosition(), transforms[i].position);
+        rbPtrs.push_back(&movedRbs[i]);
+    }
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBodies(field, rbPtrs);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
+UT_FUNCTION(test_shared_shape_setScale) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
+    const math::Vec3 boxHalfExtents_m(1, 1, 1);
+    quartz::physics::Collider* p_startCollider = nullptr;
+    quartz::physics::Collider* p_startOtherCollider = nullptr;
+    const quartz::physics::Collider::Parameters triggerColliderParameters(
+        true,
+        quartz::physics::Collider::CategoryProperties(0b0101, 0b0011),
+        quartz::physics::BoxShape::Parameters(boxHalfExtents_m),
+        [&p_startCollider, &p_startOtherCollider] (quartz::physics::Collider::CollisionCallbackParameters parameters) {
+            p_startCollider = parameters.p_collider;
+            p_startOtherCollider = parameters.p_otherCollider;
+        },
+        {},
+        {}
+    );
+    const quartz::physics::RigidBody::Parameters triggerRbParameters(quartz::physics::RigidBody::BodyType::Static, false, math::Vec3(0, 0, 0), triggerColliderParameters);
+
+    // Both triggers have the same extents, so they share a shape
+    quartz::physics::RigidBody triggerRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(0, 0, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        triggerRbParameters
+    );
+    quartz::physics::RigidBody otherTriggerRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(100, 0, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        triggerRbParameters
+    );
+
+    // Sits just above the first trigger until that trigger grows
+    quartz::physics::RigidBody sphereRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(0, 3, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Dynamic,
+            false,
+            math::Vec3(0, 0, 0),
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b0010, 0b0001),
+                quartz::physics::SphereShape::Parameters(1),
+                {},
+                {},
+                {}
+            )
+        )
+    );
+
+    field.fixedUpdate(0.05);
+    UT_CHECK_TRUE(p_startCollider == nullptr);
+
+    // The shape is shared, so this has to give the trigger a new rp3d collider with a new shape
+    triggerRb.setScale({3, 3, 3});
+
+    const std::optional<quartz::physics::Collider>& o_triggerCollider = triggerRb.getColliderOptional();
+    UT_REQUIRE(o_triggerCollider);
+    UT_CHECK_EQUAL(o_triggerCollider->getCategoryProperties(), triggerColliderParameters.categoryProperties);
+    UT_CHECK_TRUE(o_triggerCollider->getIsTrigger());
+    UT_CHECK_EQUAL(o_triggerCollider->getBoxShapeOptional()->getHalfExtents_m(), math::Vec3(3, 3, 3));
+    UT_CHECK_EQUAL(otherTriggerRb.getColliderOptional()->getBoxShapeOptional()->getHalfExtents_m(), boxHalfExtents_m);
+
+    // The new rp3d collider has to resolve back to the same quartz collider for its events to reach it
+    field.fixedUpdate(0.05);
+    UT_CHECK_TRUE(p_startCollider == &(*o_triggerCollider));
+    UT_CHECK_TRUE(p_startOtherCollider == &(*sphereRb.getColliderOptional()));
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, sphereRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, otherTriggerRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, triggerRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
+UT_FUNCTION(test_shared_shape_setScale_duringDispatch) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
+    // Whichever sphere is dispatched to first rescales the other, whose event for this tick still references
+    // the rp3d collider the rescale destroys, so that event must be skipped rather than read
+    uint32_t callbackCount = 0;
+    quartz::physics::RigidBody* p_sphereRbA = nullptr;
+    quartz::physics::RigidBody* p_sphereRbB = nullptr;
+
+    const auto createSphereParameters = [&callbackCount] (quartz::physics::RigidBody*& p_otherRb) {
+        return quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Dynamic,
+            false,
+            math::Vec3(0, 0, 0),
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b01, 0b10),
+                quartz::physics::SphereShape::Parameters(1),
+                [&callbackCount, &p_otherRb] (UNUSED quartz::physics::Collider::CollisionCallbackParameters parameters) {
+                    callbackCount++;
+                    p_otherRb->setScale({2, 2, 2});
+                },
+                {},
+                {}
+            )
+        );
+    };
+
+    // Both spheres have the same radius, so they share a shape and rescaling one gives it a new rp3d collider
+    quartz::physics::RigidBody sphereRbA = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(-3, 0.99, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        createSphereParameters(p_sphereRbB)
+    );
+    quartz::physics::RigidBody sphereRbB = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(3, 0.99, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        createSphereParameters(p_sphereRbA)
+    );
+    p_sphereRbA = &sphereRbA;
+    p_sphereRbB = &sphereRbB;
+
+    quartz::physics::RigidBody groundRb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(0, -1, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Static,
+            false,
+            math::Vec3(0, 0, 0),
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b10, 0b01),
+                quartz::physics::BoxShape::Parameters({10, 1, 10}),
+                {},
+                {},
+                {}
+            )
+        )
+    );
+
+    field.fixedUpdate(0.05);
+    UT_CHECK_EQUAL(callbackCount, 1);
+
+    // Only the sphere which wasn't dispatched to was rescaled, and the other kept the shared shape
+    const double radiusA_m = sphereRbA.getColliderOptional()->getSphereShapeOptional()->getRadius_m();
+    const double radiusB_m = sphereRbB.getColliderOptional()->getSphereShapeOptional()->getRadius_m();
+    UT_CHECK_TRUE((radiusA_m > 1.5) != (radiusB_m > 1.5));
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, groundRb);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, sphereRbB);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, sphereRbA);
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
+UT_FUNCTION(test_move_after_destroy) {
+    quartz::physics::Field field = quartz::unit_test::PhysicsManagerUnitTestClient::createField();
+
+    quartz::physics::RigidBody rb = quartz::unit_test::PhysicsManagerUnitTestClient::createRigidBody(
+        field,
+        math::Transform(math::Vec3(0, 0, 0), math::Quaternion(), math::Vec3(1, 1, 1)),
+        quartz::physics::RigidBody::Parameters(
+            quartz::physics::RigidBody::BodyType::Dynamic,
+            false,
+            math::Vec3(0, 0, 0),
+            quartz::physics::Collider::Parameters(
+                false,
+                quartz::physics::Collider::CategoryProperties(0b01, 0b01),
+                quartz::physics::SphereShape::Parameters(1),
+                {},
+                {},
+                {}
+            )
+        )
+    );
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyRigidBody(field, rb);
+
+    // Owners of destroyed bodies (such as doodads) may still be moved around afterwards
+    quartz::physics::RigidBody movedRb(std::move(rb));
+    rb = std::move(movedRb);
+    UT_CHECK_TRUE(rb.getColliderOptional().has_value());
+
+    quartz::unit_test::PhysicsManagerUnitTestClient::destroyField(field);
+}
+
 UT_MAIN() {
     REGISTER_UT_FUNCTION(test_construction);
+    REGISTER_UT_FUNCTION(test_bulk_construction);
     REGISTER_UT_FUNCTION(test_collider_callback);
     REGISTER_UT_FUNCTION(test_trigger_callback);
+    REGISTER_UT_FUNCTION(test_shared_shape_setScale);
+    REGISTER_UT_FUNCTION(test_shared_shape_setScale_duringDispatch);
+    REGISTER_UT_FUNCTION(test_move_after_destroy);
     UT_RUN_TESTS();
 }
 
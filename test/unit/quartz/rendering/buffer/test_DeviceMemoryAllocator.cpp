@@ -0,0 +1,170 @@
+#include <cstdint>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/instance/Instance.hpp"
+
+uint32_t
+getHostVisibleMemoryTypeIndex(
+    const quartz::rendering::Device& renderingDevice
+) {
+    const vk::PhysicalDeviceMemoryProperties memoryProperties = renderingDevice.getVulkanPhysicalDevice().getMemoryProperties();
+
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
+        if (memoryProperties.memoryTypes[i].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible) {
+            return i;
+        }
+    }
+
+    return 0;
+}
+
+quartz::rendering::DeviceMemoryAllocation
+allocateTransientBuffer(
+    const quartz::rendering::Device& renderingDevice,
+    const vk::DeviceSize sizeBytes
+) {
+    return quartz::rendering::DeviceMemoryAllocator::allocate(
+        renderingDevice.getVulkanPhysicalDevice(),
+        renderingDevice.getVulkanLogicalDevicePtr(),
+        vk::MemoryRequirements(sizeBytes, 256, ~0u),
+        getHostVisibleMemoryTypeIndex(renderingDevice),
+        quartz::rendering::DeviceMemoryAllocator::ResourceType::Buffer,
+        quartz::rendering::DeviceMemoryAllocator::Lifetime::Transient
+    );
+}
+
+UT_FUNCTION(test_alignUp) {
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(0, 256), 0);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(1, 256), 256);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(256, 256), 256);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(257, 256), 512);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(13, 4), 16);
+
+    // No alignment requirement leaves the value untouched
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(13, 0), 13);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::alignUp(13, 1), 13);
+}
+
+UT_FUNCTION(test_getSizeClassIndex) {
+    // Everything up to the minimum class size lands in the first class
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(1, 1), 0);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(256, 16), 0);
+
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(257, 16), 1);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(512, 16), 1);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(1000, 16), 2);
+
+    // Large alignments bump us into a class big enough to keep every slot aligned
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(100, 4096), 4);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(5000, 65536), 8);
+
+    // The largest class is 4 MiB and anything bigger gets a dedicated block
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(4 * 1024 * 1024, 256), 14);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(4 * 1024 * 1024 + 1, 256), quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(512 * 1024 * 1024, 256), quartz::rendering::DeviceMemoryAllocator::dedicatedSizeClassIndex);
+}
+
+UT_FUNCTION(test_getSizeClassBytes) {
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(0), 256);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(1), 512);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(14), 4 * 1024 * 1024);
+
+    for (uint32_t i = 0; i < quartz::rendering::DeviceMemoryAllocator::sizeClassCount; ++i) {
+        const vk::DeviceSize classBytes = quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(i);
+        UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassIndex(classBytes, 1), i);
+    }
+}
+
+UT_FUNCTION(test_getSizeClassBlockBytes) {
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassBlockBytes(0), 1 * 1024 * 1024);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getSizeClassBlockBytes(14), 64 * 1024 * 1024);
+
+    // Every block must be split into a whole number of slots
+    for (uint32_t i = 0; i < quartz::rendering::DeviceMemoryAllocator::sizeClassCount; ++i) {
+        const vk::DeviceSize classBytes = quartz::rendering::DeviceMemoryAllocator::getSizeClassBytes(i);
+        const vk::DeviceSize blockBytes = quartz::rendering::DeviceMemoryAllocator::getSizeClassBlockBytes(i);
+
+        UT_CHECK_EQUAL(blockBytes % classBytes, 0);
+        UT_CHECK_TRUE(blockBytes / classBytes >= 16);
+    }
+}
+
+UT_FUNCTION(test_retainEmptyTransientBlock) {
+    quartz::rendering::Instance renderingInstance("DEVICE_MEMORY_ALLOCATOR_UT", 9, 9, 9, true);
+    quartz::rendering::Device renderingDevice(renderingInstance);
+
+    const quartz::rendering::DeviceMemoryAllocator::Statistics initialStatistics = quartz::rendering::DeviceMemoryAllocator::getStatistics();
+
+    {
+        quartz::rendering::DeviceMemoryAllocation firstAllocation = allocateTransientBuffer(renderingDevice, 1024);
+        UT_REQUIRE(firstAllocation);
+        UT_CHECK_EQUAL(firstAllocation.getOffset(), 0);
+    }
+
+    // The emptied block sticks around and starts over from the front for the next upload
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount + 1);
+
+    {
+        quartz::rendering::DeviceMemoryAllocation secondAllocation = allocateTransientBuffer(renderingDevice, 1024);
+        UT_REQUIRE(secondAllocation);
+        UT_CHECK_EQUAL(secondAllocation.getOffset(), 0);
+        UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().vulkanAllocationCallCount, initialStatistics.vulkanAllocationCallCount + 1);
+    }
+
+    // Filling the first block forces a second one, but only one of them is kept once both are empty
+    {
+        quartz::rendering::DeviceMemoryAllocation fullAllocation = allocateTransientBuffer(renderingDevice, quartz::rendering::DeviceMemoryAllocator::linearBlockBytes);
+        quartz::rendering::DeviceMemoryAllocation overflowAllocation = allocateTransientBuffer(renderingDevice, 1024);
+        UT_REQUIRE(fullAllocation);
+        UT_REQUIRE(overflowAllocation);
+        UT_CHECK_TRUE(fullAllocation.getVulkanDeviceMemory() != overflowAllocation.getVulkanDeviceMemory());
+        UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount + 2);
+    }
+
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount + 1);
+
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount);
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockBytes, initialStatistics.blockBytes);
+}
+
+UT_FUNCTION(test_blocksAreNotSharedBetweenDevices) {
+    quartz::rendering::Instance renderingInstance("DEVICE_MEMORY_ALLOCATOR_UT", 9, 9, 9, true);
+    quartz::rendering::Device firstRenderingDevice(renderingInstance);
+    quartz::rendering::Device secondRenderingDevice(renderingInstance);
+
+    const quartz::rendering::DeviceMemoryAllocator::Statistics initialStatistics = quartz::rendering::DeviceMemoryAllocator::getStatistics();
+
+    {
+        quartz::rendering::DeviceMemoryAllocation firstAllocation = allocateTransientBuffer(firstRenderingDevice, 1024);
+        UT_REQUIRE(firstAllocation);
+    }
+
+    // The first device's empty block has plenty of room, but it is the wrong device's memory
+    {
+        quartz::rendering::DeviceMemoryAllocation secondAllocation = allocateTransientBuffer(secondRenderingDevice, 1024);
+        UT_REQUIRE(secondAllocation);
+        UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().vulkanAllocationCallCount, initialStatistics.vulkanAllocationCallCount + 2);
+    }
+
+    // Each device keeps an empty block of its own
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount + 2);
+
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+    UT_CHECK_EQUAL(quartz::rendering::DeviceMemoryAllocator::getStatistics().blockCount, initialStatistics.blockCount);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_alignUp);
+    REGISTER_UT_FUNCTION(test_getSizeClassIndex);
+    REGISTER_UT_FUNCTION(test_getSizeClassBytes);
+    REGISTER_UT_FUNCTION(test_getSizeClassBlockBytes);
+    REGISTER_UT_FUNCTION(test_retainEmptyTransientBlock);
+    REGISTER_UT_FUNCTION(test_blocksAreNotSharedBetweenDevices);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,89 @@
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/buffer/DeviceMemoryAllocator.hpp"
+#include "quartz/rendering/buffer/StagedBuffer.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/device/Device.hpp"
+#include "quartz/rendering/instance/Instance.hpp"
+
+UT_FUNCTION(test_joining) {
+    quartz::rendering::Instance renderingInstance("UPLOAD_BATCH_UT", 9, 9, 9, true);
+    quartz::rendering::Device renderingDevice(renderingInstance);
+
+    {
+        quartz::rendering::UploadBatch outerBatch(renderingDevice);
+        UT_CHECK_TRUE(outerBatch.getIsRecording());
+
+        {
+            quartz::rendering::UploadBatch innerBatch(renderingDevice);
+            UT_CHECK_FALSE(innerBatch.getIsRecording());
+        }
+
+        // The inner batch going away doesn't stop the outer one from being joined
+        quartz::rendering::UploadBatch laterBatch(renderingDevice);
+        UT_CHECK_FALSE(laterBatch.getIsRecording());
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+}
+
+UT_FUNCTION(test_batchAfterSubmit) {
+    quartz::rendering::Instance renderingInstance("UPLOAD_BATCH_UT", 9, 9, 9, true);
+    quartz::rendering::Device renderingDevice(renderingInstance);
+
+    {
+        const std::vector<uint32_t> data = {0, 1, 2, 3, 4, 5, 6, 7};
+
+        quartz::rendering::UploadBatch submittedBatch(renderingDevice);
+        UT_CHECK_TRUE(submittedBatch.getIsRecording());
+        quartz::rendering::StagedBuffer firstBuffer(renderingDevice, data.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eVertexBuffer, data.data());
+        submittedBatch.submit();
+
+        // The submitted batch is still in scope, but a new batch must record on its own rather than join it
+        {
+            quartz::rendering::UploadBatch laterBatch(renderingDevice);
+            UT_CHECK_TRUE(laterBatch.getIsRecording());
+
+            quartz::rendering::StagedBuffer secondBuffer(renderingDevice, data.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eVertexBuffer, data.data());
+            laterBatch.submit();
+        }
+
+        // With both batches submitted, a staged buffer records in a batch of its own as well
+        quartz::rendering::StagedBuffer thirdBuffer(renderingDevice, data.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eIndexBuffer, data.data());
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+}
+
+UT_FUNCTION(test_batchAfterSubmitWithoutWaiting) {
+    quartz::rendering::Instance renderingInstance("UPLOAD_BATCH_UT", 9, 9, 9, true);
+    quartz::rendering::Device renderingDevice(renderingInstance);
+
+    {
+        const std::vector<uint32_t> data = {0, 1, 2, 3, 4, 5, 6, 7};
+
+        quartz::rendering::UploadBatch submittedBatch(renderingDevice);
+        quartz::rendering::StagedBuffer firstBuffer(renderingDevice, data.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eVertexBuffer, data.data());
+        submittedBatch.submitWithoutWaiting();
+
+        quartz::rendering::UploadBatch laterBatch(renderingDevice);
+        UT_CHECK_TRUE(laterBatch.getIsRecording());
+
+        quartz::rendering::StagedBuffer secondBuffer(renderingDevice, data.size() * sizeof(uint32_t), vk::BufferUsageFlagBits::eVertexBuffer, data.data());
+        laterBatch.submit();
+    }
+
+    quartz::rendering::DeviceMemoryAllocator::releaseEmptyBlocks();
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_joining);
+    REGISTER_UT_FUNCTION(test_batchAfterSubmit);
+    REGISTER_UT_FUNCTION(test_batchAfterSubmitWithoutWaiting);
+    UT_RUN_TESTS();
+}
@@ -1,5 +1,33 @@
 #include "util/unit_test/UnitTest.hpp"
 
+#include "math/transform/Vec3.hpp"
+#include "math/transform/Vec4.hpp"
+
+#include "quartz/rendering/material/Material.hpp"
+
+quartz::rendering::Material
+createMaterial(
+    const std::string& name,
+    const uint32_t normalTextureMasterIndex,
+    const float metallicFactor
+) {
+    return quartz::rendering::Material(
+        name,
+        1,
+        2,
+        normalTextureMasterIndex,
+        4,
+        5,
+        math::Vec4(0.5f, 0.25f, 0.0f, 1.0f),
+        math::Vec3(0.0f, 0.0f, 0.0f),
+        metallicFactor,
+        0.75f,
+        quartz::rendering::Material::AlphaMode::Mask,
+        0.5f,
+        true
+    );
+}
+
 /**
  * @todo Ensure that the default material is the first thing in the list and that we can load it
  */
@@ -8,7 +36,30 @@ UT_FUNCTION(test_something) {
 
 }
 
+UT_FUNCTION(test_calculateParameterHash) {
+    const quartz::rendering::Material material = createMaterial("brick", 3, 0.0f);
+
+    // Names aren't parameters, so they don't stop materials from being shared
+    const quartz::rendering::Material renamedMaterial = createMaterial("brick_from_another_model", 3, 0.0f);
+    UT_CHECK_EQUAL(quartz::rendering::Material::calculateParameterHash(material), quartz::rendering::Material::calculateParameterHash(renamedMaterial));
+    UT_CHECK_TRUE(material.hasSameParameters(renamedMaterial));
+
+    // Negative zero compares equal to zero, so it has to hash the same too
+    const quartz::rendering::Material negativeZeroMaterial = createMaterial("brick", 3, -0.0f);
+    UT_CHECK_EQUAL(quartz::rendering::Material::calculateParameterHash(material), quartz::rendering::Material::calculateParameterHash(negativeZeroMaterial));
+    UT_CHECK_TRUE(material.hasSameParameters(negativeZeroMaterial));
+
+    const quartz::rendering::Material differentTextureMaterial = createMaterial("brick", 6, 0.0f);
+    UT_CHECK_FALSE(quartz::rendering::Material::calculateParameterHash(material) == quartz::rendering::Material::calculateParameterHash(differentTextureMaterial));
+    UT_CHECK_FALSE(material.hasSameParameters(differentTextureMaterial));
+
+    const quartz::rendering::Material differentFactorMaterial = createMaterial("brick", 3, 1.0f);
+    UT_CHECK_FALSE(quartz::rendering::Material::calculateParameterHash(material) == quartz::rendering::Material::calculateParameterHash(differentFactorMaterial));
+    UT_CHECK_FALSE(material.hasSameParameters(differentFactorMaterial));
+}
+
 UT_MAIN() {
     REGISTER_UT_FUNCTION(test_something);
+    REGISTER_UT_FUNCTION(test_calculateParameterHash);
     UT_RUN_TESTS();
 }
@@ -0,0 +1,339 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <tiny_gltf.h>
+
+#include "math/transform/Vec3.hpp"
+
+#include "util/platform.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/CookedModel.hpp"
+#include "quartz/rendering/model/ModelCooker.hpp"
+#include "quartz/rendering/model/Primitive.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
+
+std::string
+getTempFilepath(
+    const std::string& filename
+) {
+#ifdef ON_LINUX
+    return std::filesystem::temp_directory_path().string() + "/" + filename;
+#else
+    return std::filesystem::temp_directory_path().string() + filename;
+#endif
+}
+
+const std::vector<math::Vec3> quadPositions = {
+    math::Vec3(0.0f, 0.0f, 0.0f),
+    math::Vec3(1.0f, 0.0f, 0.0f),
+    math::Vec3(0.0f, 1.0f, 0.0f),
+    math::Vec3(1.0f, 1.0f, 0.0f)
+};
+const std::vector<uint16_t> quadIndices = {0, 1, 2, 2, 1, 3};
+
+/**
+ * @brief A gltf model with a single quad, stored the way a gltf file would store it: positions
+ *   and then indices in one buffer
+ */
+tinygltf::Model
+createQuadModel(
+    std::vector<uint8_t>& buffer
+) {
+    const uint32_t positionsSizeBytes = quadPositions.size() * sizeof(math::Vec3);
+    const uint32_t indicesSizeBytes = quadIndices.size() * sizeof(uint16_t);
+
+    buffer.resize(positionsSizeBytes + indicesSizeBytes);
+    std::memcpy(buffer.data(), quadPositions.data(), positionsSizeBytes);
+    std::memcpy(buffer.data() + positionsSizeBytes, quadIndices.data(), indicesSizeBytes);
+
+    tinygltf::Model gltfModel;
+
+    tinygltf::BufferView positionBufferView;
+    positionBufferView.buffer = 0;
+    positionBufferView.byteOffset = 0;
+    positionBufferView.byteLength = positionsSizeBytes;
+    gltfModel.bufferViews.push_back(positionBufferView);
+
+    tinygltf::BufferView indexBufferView;
+    indexBufferView.buffer = 0;
+    indexBufferView.byteOffset = positionsSizeBytes;
+    indexBufferView.byteLength = indicesSizeBytes;
+    gltfModel.bufferViews.push_back(indexBufferView);
+
+    tinygltf::Accessor positionAccessor;
+    positionAccessor.bufferView = 0;
+    positionAccessor.componentType = TINYGLTF_COMPONENT_TYPE_FLOAT;
+    positionAccessor.type = TINYGLTF_TYPE_VEC3;
+    positionAccessor.count = quadPositions.size();
+    positionAccessor.minValues = {0.0, 0.0, 0.0};
+    positionAccessor.maxValues = {1.0, 1.0, 0.0};
+    gltfModel.accessors.push_back(positionAccessor);
+
+    tinygltf::Accessor indexAccessor;
+    indexAccessor.bufferView = 1;
+    indexAccessor.componentType = TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT;
+    indexAccessor.type = TINYGLTF_TYPE_SCALAR;
+    indexAccessor.count = quadIndices.size();
+    gltfModel.accessors.push_back(indexAccessor);
+
+    tinygltf::Primitive gltfPrimitive;
+    gltfPrimitive.attributes["POSITION"] = 0;
+    gltfPrimitive.indices = 1;
+    gltfPrimitive.material = -1;
+
+    tinygltf::Mesh gltfMesh;
+    gltfMesh.primitives.push_back(gltfPrimitive);
+    gltfModel.meshes.push_back(gltfMesh);
+
+    return gltfModel;
+}
+
+/**
+ * @brief Cooks the quad and writes it to a temporary file so we can load it back the same way
+ *   the engine does
+ */
+std::string
+cookQuadModel(
+    const std::string& filename
+) {
+    std::vector<uint8_t> buffer;
+    const tinygltf::Model gltfModel = createQuadModel(buffer);
+    const std::vector<uint8_t> bytes = quartz::rendering::ModelCooker::cook(gltfModel, {std::span<const uint8_t>(buffer)});
+
+    const std::string filepath = getTempFilepath(filename);
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    file.close();
+
+    return filepath;
+}
+
+/**
+ * @brief Cooks the quad under a scene with a parent and child node, lets the caller corrupt the
+ *   cooked bytes, and reports whether loading the result throws. The node index table holds node
+ *   0's only child (node 1) and then the scene's only root (node 0)
+ */
+bool
+cookedModelThrowsRichException(
+    const std::string& filename,
+    const std::function<void(quartz::rendering::CookedModel::Header&, std::vector<uint8_t>&)>& corrupt
+) {
+    std::vector<uint8_t> buffer;
+    tinygltf::Model gltfModel = createQuadModel(buffer);
+
+    tinygltf::Node parentNode;
+    parentNode.mesh = 0;
+    parentNode.children = {1};
+    gltfModel.nodes.push_back(parentNode);
+    gltfModel.nodes.push_back(tinygltf::Node());
+
+    tinygltf::Scene gltfScene;
+    gltfScene.nodes = {0};
+    gltfModel.scenes.push_back(gltfScene);
+    gltfModel.defaultScene = 0;
+
+    std::vector<uint8_t> bytes = quartz::rendering::ModelCooker::cook(gltfModel, {std::span<const uint8_t>(buffer)});
+
+    quartz::rendering::CookedModel::Header header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    corrupt(header, bytes);
+    std::memcpy(bytes.data(), &header, sizeof(header));
+
+    const std::string filepath = getTempFilepath(filename);
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    file.close();
+
+    bool threw = false;
+    try {
+        const quartz::rendering::CookedModel cookedModel(filepath);
+    } catch (const util::RichException<uint32_t>&) {
+        threw = true;
+    }
+
+    std::filesystem::remove(filepath);
+
+    return threw;
+}
+
+template <typename Record_t>
+Record_t&
+getCookedRecord(
+    std::vector<uint8_t>& bytes,
+    const quartz::rendering::CookedModel::TableLocation& location,
+    const uint32_t index
+) {
+    return reinterpret_cast<Record_t*>(bytes.data() + location.offset)[index];
+}
+
+bool
+throwsRichException(
+    const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord
+) {
+    try {
+        quartz::rendering::Primitive::validateCookedPrimitiveRecord(primitiveRecord);
+    } catch (const util::RichException<uint32_t>&) {
+        return true;
+    }
+
+    return false;
+}
+
+UT_FUNCTION(test_roundTrip) {
+    const std::string filepath = cookQuadModel("test_CookedPrimitive_roundTrip.qzmodel");
+
+    {
+        const quartz::rendering::CookedModel cookedModel(filepath);
+
+        UT_REQUIRE(cookedModel.getMeshRecords().size() == 1);
+        const std::span<const quartz::rendering::CookedModel::PrimitiveRecord> primitiveRecords = cookedModel.getPrimitiveRecords(cookedModel.getMeshRecords()[0]);
+        UT_REQUIRE(primitiveRecords.size() == 1);
+        const quartz::rendering::CookedModel::PrimitiveRecord& primitiveRecord = primitiveRecords[0];
+
+        UT_CHECK_EQUAL(primitiveRecord.vertexCount, quadPositions.size());
+        UT_CHECK_EQUAL(primitiveRecord.indexCount, quadIndices.size());
+        UT_CHECK_EQUAL(primitiveRecord.indexType, static_cast<uint32_t>(vk::IndexType::eUint16));
+        UT_CHECK_FALSE(throwsRichException(primitiveRecord));
+
+        const std::span<const uint8_t> positionData = cookedModel.getData(primitiveRecord.positions);
+        std::vector<math::Vec3> positions(primitiveRecord.vertexCount);
+        std::memcpy(positions.data(), positionData.data(), positionData.size());
+
+        const std::span<const uint8_t> indexData = cookedModel.getData(primitiveRecord.indices);
+        std::vector<uint16_t> indices(primitiveRecord.indexCount);
+        std::memcpy(indices.data(), indexData.data(), indexData.size());
+
+        // The optimizer is free to reorder vertices, but every index must still land on the same position
+        for (uint32_t i = 0; i < indices.size(); ++i) {
+            UT_REQUIRE(indices[i] < positions.size());
+            UT_CHECK_TRUE(positions[indices[i]] == quadPositions[quadIndices[i]]);
+        }
+    }
+
+    std::filesystem::remove(filepath);
+}
+
+UT_FUNCTION(test_validateCookedPrimitiveRecord) {
+    const std::string filepath = cookQuadModel("test_CookedPrimitive_validate.qzmodel");
+
+    {
+        const quartz::rendering::CookedModel cookedModel(filepath);
+
+        UT_REQUIRE(cookedModel.getPrimitiveRecords().size() == 1);
+        const quartz::rendering::CookedModel::PrimitiveRecord primitiveRecord = cookedModel.getPrimitiveRecords()[0];
+        UT_CHECK_FALSE(throwsRichException(primitiveRecord));
+
+        {
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.indexType = 1000; // not an index type at all
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+
+        {
+            // Claiming uint32 indices means the index data is now half the size it should be
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.indexType = static_cast<uint32_t>(vk::IndexType::eUint32);
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+
+        {
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.indexCount += 1;
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+
+        {
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.vertexCount += 1;
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+
+        {
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.positions.sizeBytes -= sizeof(math::Vec3);
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+
+        {
+            quartz::rendering::CookedModel::PrimitiveRecord corruptedRecord = primitiveRecord;
+            corruptedRecord.attributes.sizeBytes -= sizeof(quartz::rendering::Vertex::PackedAttributes);
+            UT_CHECK_TRUE(throwsRichException(corruptedRecord));
+        }
+    }
+
+    std::filesystem::remove(filepath);
+}
+
+UT_FUNCTION(test_validateCookedRecords) {
+    const std::string filename = "test_CookedPrimitive_validateRecords.qzmodel";
+
+    UT_CHECK_FALSE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header&, std::vector<uint8_t>&) {}));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>&) {
+        header.defaultSceneIndex = 1;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<quartz::rendering::CookedModel::NodeRecord>(bytes, header.nodeTable, 0).meshIndex = 1;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<quartz::rendering::CookedModel::NodeRecord>(bytes, header.nodeTable, 0).childCount = 3;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<uint32_t>(bytes, header.nodeIndexTable, 0) = 2;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<quartz::rendering::CookedModel::SceneRecord>(bytes, header.sceneTable, 0).firstRootNodeIndex = 2;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<quartz::rendering::CookedModel::MeshRecord>(bytes, header.meshTable, 0).primitiveCount = 2;
+    }));
+
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        // There are no materials at all
+        getCookedRecord<quartz::rendering::CookedModel::PrimitiveRecord>(bytes, header.primitiveTable, 0).materialIndex = 0;
+    }));
+}
+
+UT_FUNCTION(test_validateNodeHierarchy) {
+    const std::string filename = "test_CookedPrimitive_validateNodeHierarchy.qzmodel";
+
+    // Node 0 is its own child
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        getCookedRecord<uint32_t>(bytes, header.nodeIndexTable, 0) = 0;
+    }));
+
+    // Node 1 takes the scene's root range as its children, making node 0 its child as well as its parent
+    UT_CHECK_TRUE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        quartz::rendering::CookedModel::NodeRecord& childRecord = getCookedRecord<quartz::rendering::CookedModel::NodeRecord>(bytes, header.nodeTable, 1);
+        childRecord.firstChildIndex = 1;
+        childRecord.childCount = 1;
+    }));
+
+    // Node 1 being both a root and node 0's child is reaching it twice, which is not a cycle
+    UT_CHECK_FALSE(cookedModelThrowsRichException(filename, [](quartz::rendering::CookedModel::Header& header, std::vector<uint8_t>& bytes) {
+        quartz::rendering::CookedModel::SceneRecord& sceneRecord = getCookedRecord<quartz::rendering::CookedModel::SceneRecord>(bytes, header.sceneTable, 0);
+        sceneRecord.firstRootNodeIndex = 0;
+        sceneRecord.rootNodeCount = 2;
+    }));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_roundTrip);
+    REGISTER_UT_FUNCTION(test_validateCookedPrimitiveRecord);
+    REGISTER_UT_FUNCTION(test_validateCookedRecords);
+    REGISTER_UT_FUNCTION(test_validateNodeHierarchy);
+    UT_RUN_TESTS();
+}
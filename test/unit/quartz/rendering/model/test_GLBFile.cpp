@@ -0,0 +1,162 @@
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "util/platform.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/GLBFile.hpp"
+
+std::string
+getTempFilepath(
+    const std::string& filename
+) {
+#ifdef ON_LINUX
+    return std::filesystem::temp_directory_path().string() + "/" + filename;
+#else
+    return std::filesystem::temp_directory_path().string() + filename;
+#endif
+}
+
+void
+appendBytes(
+    std::vector<uint8_t>& bytes,
+    const void* p_data,
+    const uint32_t sizeBytes
+) {
+    const uint8_t* p_bytes = static_cast<const uint8_t*>(p_data);
+    bytes.insert(bytes.end(), p_bytes, p_bytes + sizeBytes);
+}
+
+void
+appendChunk(
+    std::vector<uint8_t>& bytes,
+    const uint32_t type,
+    const std::string& contents
+) {
+    const quartz::rendering::GLBFile::ChunkHeader chunkHeader = {static_cast<uint32_t>(contents.size()), type};
+    appendBytes(bytes, &chunkHeader, sizeof(chunkHeader));
+    appendBytes(bytes, contents.data(), contents.size());
+}
+
+/**
+ * @brief Writes a glb file whose header claims the file is headerLength bytes. A headerLength of 0
+ *   means use the actual length
+ */
+std::string
+writeGLBFile(
+    const std::string& filename,
+    const uint32_t magic,
+    const std::vector<uint8_t>& chunks,
+    const uint32_t headerLength = 0
+) {
+    const quartz::rendering::GLBFile::Header header = {
+        magic,
+        quartz::rendering::GLBFile::version,
+        headerLength ? headerLength : static_cast<uint32_t>(sizeof(quartz::rendering::GLBFile::Header) + chunks.size())
+    };
+
+    std::vector<uint8_t> bytes;
+    appendBytes(bytes, &header, sizeof(header));
+    appendBytes(bytes, chunks.data(), chunks.size());
+
+    const std::string filepath = getTempFilepath(filename);
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    file.close();
+
+    return filepath;
+}
+
+UT_FUNCTION(test_construction) {
+    const std::string json = "{\"asset\":{\"version\":\"2.0\"}}   ";
+    const std::string binary = "0123456789abcdef";
+
+    {
+        std::vector<uint8_t> chunks;
+        appendChunk(chunks, quartz::rendering::GLBFile::jsonChunkType, json);
+        appendChunk(chunks, quartz::rendering::GLBFile::binaryChunkType, binary);
+
+        const std::string filepath = writeGLBFile("glbfile_both_chunks.glb", quartz::rendering::GLBFile::magic, chunks);
+        const quartz::rendering::GLBFile glbFile(filepath);
+
+        UT_CHECK_EQUAL(glbFile.getFilepath(), filepath);
+        UT_CHECK_EQUAL(glbFile.getBytes().size(), sizeof(quartz::rendering::GLBFile::Header) + chunks.size());
+        UT_CHECK_EQUAL(std::string(glbFile.getJsonChunk().begin(), glbFile.getJsonChunk().end()), json);
+        UT_CHECK_EQUAL(std::string(glbFile.getBinaryChunk().begin(), glbFile.getBinaryChunk().end()), binary);
+
+        // The chunks should be in the mapping, not copies of it
+        UT_CHECK_TRUE(glbFile.getJsonChunk().data() == glbFile.getBytes().data() + sizeof(quartz::rendering::GLBFile::Header) + sizeof(quartz::rendering::GLBFile::ChunkHeader));
+    }
+
+    {
+        std::vector<uint8_t> chunks;
+        appendChunk(chunks, quartz::rendering::GLBFile::jsonChunkType, json);
+
+        const quartz::rendering::GLBFile glbFile(writeGLBFile("glbfile_json_chunk.glb", quartz::rendering::GLBFile::magic, chunks));
+
+        UT_CHECK_EQUAL(std::string(glbFile.getJsonChunk().begin(), glbFile.getJsonChunk().end()), json);
+        UT_CHECK_EQUAL(glbFile.getBinaryChunk().size(), 0);
+    }
+}
+
+UT_FUNCTION(test_move) {
+    std::vector<uint8_t> chunks;
+    appendChunk(chunks, quartz::rendering::GLBFile::jsonChunkType, "{}  ");
+    appendChunk(chunks, quartz::rendering::GLBFile::binaryChunkType, "abcd");
+
+    quartz::rendering::GLBFile glbFile(writeGLBFile("glbfile_move.glb", quartz::rendering::GLBFile::magic, chunks));
+    const uint8_t* p_binaryChunk = glbFile.getBinaryChunk().data();
+
+    quartz::rendering::GLBFile movedFile(std::move(glbFile));
+    UT_CHECK_TRUE(movedFile.getBinaryChunk().data() == p_binaryChunk);
+    UT_CHECK_EQUAL(movedFile.getBinaryChunk().size(), 4);
+    UT_CHECK_EQUAL(glbFile.getJsonChunk().size(), 0);
+    UT_CHECK_EQUAL(glbFile.getBinaryChunk().size(), 0);
+}
+
+UT_FUNCTION(test_invalidFiles) {
+    std::vector<uint8_t> chunks;
+    appendChunk(chunks, quartz::rendering::GLBFile::jsonChunkType, "{}  ");
+    appendChunk(chunks, quartz::rendering::GLBFile::binaryChunkType, "abcd");
+
+    std::vector<uint8_t> truncatedChunks(chunks.begin(), chunks.end() - 2);
+
+    std::vector<uint8_t> missingJsonChunks;
+    appendChunk(missingJsonChunks, quartz::rendering::GLBFile::binaryChunkType, "abcd");
+
+    const std::vector<std::string> invalidFilepaths = {
+        writeGLBFile("glbfile_bad_magic.glb", 0x12345678, chunks),
+        writeGLBFile("glbfile_too_long.glb", quartz::rendering::GLBFile::magic, chunks, 1024),
+        writeGLBFile("glbfile_truncated.glb", quartz::rendering::GLBFile::magic, truncatedChunks),
+        writeGLBFile("glbfile_missing_json.glb", quartz::rendering::GLBFile::magic, missingJsonChunks),
+    };
+
+    for (const std::string& filepath : invalidFilepaths) {
+        bool threw = false;
+        try {
+            const quartz::rendering::GLBFile glbFile(filepath);
+        } catch (const util::StringException&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+}
+
+UT_FUNCTION(test_isGLBFilepath) {
+    UT_CHECK_TRUE(quartz::rendering::GLBFile::isGLBFilepath("models/box.glb"));
+    UT_CHECK_FALSE(quartz::rendering::GLBFile::isGLBFilepath("models/box.gltf"));
+    UT_CHECK_FALSE(quartz::rendering::GLBFile::isGLBFilepath("models/box.qzmodel"));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_construction);
+    REGISTER_UT_FUNCTION(test_move);
+    REGISTER_UT_FUNCTION(test_invalidFiles);
+    REGISTER_UT_FUNCTION(test_isGLBFilepath);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,188 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "math/transform/Vec3.hpp"
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/MeshOptimizer.hpp"
+#include "quartz/rendering/model/Vertex.hpp"
+
+quartz::rendering::Vertex
+createVertex(
+    const float x,
+    const float y
+) {
+    quartz::rendering::Vertex vertex;
+    vertex.position = math::Vec3(x, y, 0.0f);
+    vertex.normal = math::Vec3(0.0f, 0.0f, 1.0f);
+    return vertex;
+}
+
+/**
+ * @brief A size x size grid of quads, with the triangles listed in a scattered order so there is
+ *   something for the cache optimization to improve on
+ */
+void
+createScatteredGrid(
+    const uint32_t size,
+    std::vector<quartz::rendering::Vertex>& vertices,
+    std::vector<uint32_t>& indices
+) {
+    for (uint32_t y = 0; y <= size; ++y) {
+        for (uint32_t x = 0; x <= size; ++x) {
+            vertices.push_back(createVertex(x, y));
+        }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < size; ++y) {
+        for (uint32_t x = 0; x < size; ++x) {
+            const uint32_t bottomLeft = y * (size + 1) + x;
+            const uint32_t topLeft = bottomLeft + size + 1;
+            triangles.push_back({bottomLeft, bottomLeft + 1, topLeft});
+            triangles.push_back({bottomLeft + 1, topLeft + 1, topLeft});
+        }
+    }
+
+    // Walk the triangles with a stride coprime to their count so neighbors end up far apart
+    const uint32_t stride = 97;
+    for (uint32_t i = 0; i < triangles.size(); ++i) {
+        const std::array<uint32_t, 3>& triangle = triangles[(i * stride) % triangles.size()];
+        indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+}
+
+std::vector<std::array<uint32_t, 3>>
+getSortedTriangles(
+    const std::vector<quartz::rendering::Vertex>& vertices,
+    const std::vector<uint32_t>& indices
+) {
+    // Compare by position so the result doesn't depend on how vertices were renumbered
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t i = 0; i < indices.size(); i += 3) {
+        std::array<uint32_t, 3> triangle;
+        for (uint32_t j = 0; j < 3; ++j) {
+            const quartz::rendering::Vertex& vertex = vertices[indices[i + j]];
+            triangle[j] = static_cast<uint32_t>(vertex.position.y) * 1000 + static_cast<uint32_t>(vertex.position.x);
+        }
+        std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()), triangle.end());
+        triangles.push_back(triangle);
+    }
+    std::sort(triangles.begin(), triangles.end());
+
+    return triangles;
+}
+
+UT_FUNCTION(test_weldVertices) {
+    // A quad where each triangle has its own copy of the shared edge
+    std::vector<quartz::rendering::Vertex> vertices = {
+        createVertex(0.0f, 0.0f),
+        createVertex(1.0f, 0.0f),
+        createVertex(0.0f, 1.0f),
+        createVertex(1.0f, 0.0f),
+        createVertex(1.0f, 1.0f),
+        createVertex(0.0f, 1.0f)
+    };
+    std::vector<uint32_t> indices = {0, 1, 2, 3, 4, 5};
+
+    quartz::rendering::MeshOptimizer::weldVertices(vertices, indices);
+
+    UT_CHECK_EQUAL(vertices.size(), 4);
+    UT_CHECK_EQUAL(indices.size(), 6);
+    UT_CHECK_EQUAL(indices[1], indices[3]);
+    UT_CHECK_EQUAL(indices[2], indices[5]);
+
+    // Vertices differing in anything other than position are kept apart
+    std::vector<quartz::rendering::Vertex> differentVertices = {createVertex(0.0f, 0.0f), createVertex(0.0f, 0.0f)};
+    differentVertices[1].textureCoordinate = math::Vec2(0.5f, 0.5f);
+    std::vector<uint32_t> differentIndices = {0, 1, 0};
+
+    quartz::rendering::MeshOptimizer::weldVertices(differentVertices, differentIndices);
+
+    UT_CHECK_EQUAL(differentVertices.size(), 2);
+}
+
+UT_FUNCTION(test_optimizeVertexCache) {
+    std::vector<quartz::rendering::Vertex> vertices;
+    std::vector<uint32_t> indices;
+    createScatteredGrid(32, vertices, indices);
+
+    const std::vector<std::array<uint32_t, 3>> trianglesBefore = getSortedTriangles(vertices, indices);
+    const float acmrBefore = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), indices);
+
+    quartz::rendering::MeshOptimizer::optimizeVertexCache(vertices.size(), indices);
+
+    const float acmrAfter = quartz::rendering::MeshOptimizer::calculateACMR(vertices.size(), indices);
+
+    UT_CHECK_TRUE(getSortedTriangles(vertices, indices) == trianglesBefore);
+    UT_CHECK_TRUE(acmrAfter < acmrBefore);
+    UT_CHECK_TRUE(acmrAfter < 1.0f);
+}
+
+UT_FUNCTION(test_optimizeVertexFetch) {
+    std::vector<quartz::rendering::Vertex> vertices = {
+        createVertex(0.0f, 0.0f),
+        createVertex(1.0f, 0.0f),
+        createVertex(0.0f, 1.0f),
+        createVertex(1.0f, 1.0f),
+        createVertex(5.0f, 5.0f) // not used by any triangle
+    };
+    std::vector<uint32_t> indices = {3, 2, 1, 1, 2, 0};
+
+    quartz::rendering::MeshOptimizer::optimizeVertexFetch(vertices, indices);
+
+    UT_CHECK_EQUAL(vertices.size(), 4);
+    UT_CHECK_TRUE(indices == std::vector<uint32_t>({0, 1, 2, 2, 1, 3}));
+    UT_CHECK_EQUAL(vertices[0].position.x, 1.0f);
+    UT_CHECK_EQUAL(vertices[0].position.y, 1.0f);
+    UT_CHECK_EQUAL(vertices[3].position.x, 0.0f);
+    UT_CHECK_EQUAL(vertices[3].position.y, 0.0f);
+}
+
+UT_FUNCTION(test_optimize) {
+    std::vector<quartz::rendering::Vertex> vertices;
+    std::vector<uint32_t> indices;
+    createScatteredGrid(16, vertices, indices);
+
+    // Duplicate every vertex so welding has something to do
+    const uint32_t originalVertexCount = vertices.size();
+    vertices.insert(vertices.end(), vertices.begin(), vertices.end());
+    for (uint32_t i = 0; i < indices.size(); i += 2) {
+        indices[i] += originalVertexCount;
+    }
+
+    const std::vector<std::array<uint32_t, 3>> trianglesBefore = getSortedTriangles(vertices, indices);
+
+    const quartz::rendering::MeshOptimizer::Statistics statistics = quartz::rendering::MeshOptimizer::optimize(vertices, indices);
+
+    UT_CHECK_TRUE(getSortedTriangles(vertices, indices) == trianglesBefore);
+    UT_CHECK_EQUAL(statistics.vertexCountBefore, originalVertexCount * 2);
+    UT_CHECK_EQUAL(statistics.vertexCountAfter, originalVertexCount);
+    UT_CHECK_EQUAL(vertices.size(), originalVertexCount);
+    UT_CHECK_TRUE(statistics.acmrAfter < statistics.acmrBefore);
+    UT_CHECK_TRUE(statistics.bytesAfter < statistics.bytesBefore);
+    UT_CHECK_TRUE(statistics.indexType == vk::IndexType::eUint16);
+}
+
+UT_FUNCTION(test_getIndexType) {
+    UT_CHECK_TRUE(quartz::rendering::MeshOptimizer::getIndexType(3) == vk::IndexType::eUint16);
+    UT_CHECK_TRUE(quartz::rendering::MeshOptimizer::getIndexType(65536) == vk::IndexType::eUint16);
+    UT_CHECK_TRUE(quartz::rendering::MeshOptimizer::getIndexType(65537) == vk::IndexType::eUint32);
+
+    UT_CHECK_EQUAL(quartz::rendering::MeshOptimizer::getIndexSizeBytes(vk::IndexType::eUint16), 2);
+    UT_CHECK_EQUAL(quartz::rendering::MeshOptimizer::getIndexSizeBytes(vk::IndexType::eUint32), 4);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_weldVertices);
+    REGISTER_UT_FUNCTION(test_optimizeVertexCache);
+    REGISTER_UT_FUNCTION(test_optimizeVertexFetch);
+    REGISTER_UT_FUNCTION(test_optimize);
+    REGISTER_UT_FUNCTION(test_getIndexType);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,68 @@
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "util/platform.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/ModelCache.hpp"
+
+std::string
+writeTempFile(
+    const std::string& filename,
+    const std::vector<char>& bytes
+) {
+#ifdef ON_LINUX
+    const std::string filepath = std::filesystem::temp_directory_path().string() + "/" + filename;
+#else
+    const std::string filepath = std::filesystem::temp_directory_path().string() + filename;
+#endif
+
+    std::ofstream file(filepath, std::ios::binary | std::ios::trunc);
+    file.write(bytes.data(), bytes.size());
+    file.close();
+
+    return filepath;
+}
+
+UT_FUNCTION(test_calculateContentHash) {
+    const std::vector<char> bytes = {'g', 'l', 'T', 'F', 2, 0, 0, 0};
+    std::vector<char> otherBytes = bytes;
+    otherBytes[4] = 1;
+
+    UT_CHECK_EQUAL(quartz::rendering::ModelCache::calculateContentHash(bytes), quartz::rendering::ModelCache::calculateContentHash(bytes));
+    UT_CHECK_NOT_EQUAL(quartz::rendering::ModelCache::calculateContentHash(bytes), quartz::rendering::ModelCache::calculateContentHash(otherBytes));
+
+    // The size is part of the hash, so a file doesn't hash the same as its prefix
+    const std::vector<char> prefixBytes(bytes.begin(), bytes.begin() + 4);
+    UT_CHECK_NOT_EQUAL(quartz::rendering::ModelCache::calculateContentHash(bytes), quartz::rendering::ModelCache::calculateContentHash(prefixBytes));
+}
+
+UT_FUNCTION(test_hasSameContent) {
+    const std::vector<char> bytes = {'g', 'l', 'T', 'F', 2, 0, 0, 0};
+    const std::string filepath = writeTempFile("test_ModelCache_hasSameContent.glb", bytes);
+
+    UT_CHECK_TRUE(quartz::rendering::ModelCache::hasSameContent(filepath, bytes));
+
+    // Same size, different bytes, which is what a hash collision between two glb files looks like
+    std::vector<char> otherBytes = bytes;
+    otherBytes[7] = 1;
+    UT_CHECK_FALSE(quartz::rendering::ModelCache::hasSameContent(filepath, otherBytes));
+
+    std::vector<char> longerBytes = bytes;
+    longerBytes.push_back(0);
+    UT_CHECK_FALSE(quartz::rendering::ModelCache::hasSameContent(filepath, longerBytes));
+
+    std::filesystem::remove(filepath);
+
+    // A file which has since gone away can't be the same as anything
+    UT_CHECK_FALSE(quartz::rendering::ModelCache::hasSameContent(filepath, bytes));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_calculateContentHash);
+    REGISTER_UT_FUNCTION(test_hasSameContent);
+    UT_RUN_TESTS();
+}
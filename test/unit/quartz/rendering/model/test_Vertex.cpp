@@ -0,0 +1,91 @@
+#include <cmath>
+#include <vector>
+
+#include <glm/geometric.hpp>
+#include <glm/packing.hpp>
+
+#include "math/transform/Vec2.hpp"
+#include "math/transform/Vec3.hpp"
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/Vertex.hpp"
+
+bool
+isWithinTolerance(
+    const math::Vec3& a,
+    const math::Vec3& b,
+    const float tolerance
+) {
+    return (
+        std::abs(a.x - b.x) <= tolerance &&
+        std::abs(a.y - b.y) <= tolerance &&
+        std::abs(a.z - b.z) <= tolerance
+    );
+}
+
+UT_FUNCTION(test_octahedralRoundTrip) {
+    const std::vector<math::Vec3> unitVectors = {
+        { 1.0f,  0.0f,  0.0f},
+        {-1.0f,  0.0f,  0.0f},
+        { 0.0f,  1.0f,  0.0f},
+        { 0.0f, -1.0f,  0.0f},
+        { 0.0f,  0.0f,  1.0f},
+        { 0.0f,  0.0f, -1.0f},
+        glm::normalize(glm::vec3( 1.0f,  1.0f,  1.0f)),
+        glm::normalize(glm::vec3(-1.0f,  2.0f, -3.0f)),
+        glm::normalize(glm::vec3( 0.3f, -0.7f, -0.1f))
+    };
+
+    for (const math::Vec3& unitVector : unitVectors) {
+        const math::Vec2 encodedVector = quartz::rendering::Vertex::encodeOctahedral(unitVector);
+
+        // Everything lands on the [-1, 1] square, so it fits in snorm components
+        UT_CHECK_TRUE(std::abs(encodedVector.x) <= 1.0f);
+        UT_CHECK_TRUE(std::abs(encodedVector.y) <= 1.0f);
+
+        UT_CHECK_TRUE(isWithinTolerance(quartz::rendering::Vertex::decodeOctahedral(encodedVector), unitVector, 1e-5f));
+
+        // Quantizing to snorm16 loses very little
+        const math::Vec2 quantizedVector = glm::unpackSnorm2x16(glm::packSnorm2x16(encodedVector));
+        UT_CHECK_TRUE(isWithinTolerance(quartz::rendering::Vertex::decodeOctahedral(quantizedVector), unitVector, 1e-3f));
+    }
+}
+
+UT_FUNCTION(test_pack) {
+    const quartz::rendering::Vertex vertex(
+        {1.0f, 2.0f, 3.0f},
+        {0.0f, 0.0f, -1.0f},
+        {1.0f, 0.0f, 0.0f},
+        {1.0f, 0.5f, 0.0f},
+        {2.5f, -0.25f}
+    );
+
+    const quartz::rendering::Vertex::PackedAttributes packedAttributes = vertex.pack();
+
+    UT_CHECK_EQUAL(sizeof(quartz::rendering::Vertex::PackedAttributes), 16);
+
+    UT_CHECK_TRUE(isWithinTolerance(
+        quartz::rendering::Vertex::decodeOctahedral(glm::unpackSnorm2x16(packedAttributes.normal)),
+        vertex.normal,
+        1e-3f
+    ));
+    UT_CHECK_TRUE(isWithinTolerance(
+        quartz::rendering::Vertex::decodeOctahedral(glm::unpackSnorm2x16(packedAttributes.tangent)),
+        vertex.tangent,
+        1e-3f
+    ));
+
+    // Texture coordinates outside of [0, 1] survive because they are half floats
+    const math::Vec2 textureCoordinate = glm::unpackHalf2x16(packedAttributes.textureCoordinate);
+    UT_CHECK_EQUAL(textureCoordinate.x, 2.5f);
+    UT_CHECK_EQUAL(textureCoordinate.y, -0.25f);
+
+    UT_CHECK_EQUAL(packedAttributes.color, glm::packUnorm4x8(glm::vec4(1.0f, 0.5f, 0.0f, 1.0f)));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_octahedralRoundTrip);
+    REGISTER_UT_FUNCTION(test_pack);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/model/DrawPacket.hpp"
+#include "quartz/rendering/render_queue/RenderQueue.hpp"
+
+/**
+ * @brief The queue never dereferences the buffer handles, so we can use made up ones
+ */
+vk::Buffer
+createFakeBuffer(
+    const uint64_t handle
+) {
+    return vk::Buffer(reinterpret_cast<VkBuffer>(handle));
+}
+
+quartz::rendering::DrawPacket
+createDrawPacket(
+    const uint32_t materialMasterIndex,
+    const uint64_t vertexBufferHandle
+) {
+    return {
+        math::Mat4(1.0f),
+        createFakeBuffer(vertexBufferHandle),
+        createFakeBuffer(vertexBufferHandle + 1),
+        createFakeBuffer(vertexBufferHandle + 2),
+        3,
+        vk::IndexType::eUint32,
+        materialMasterIndex,
+        materialMasterIndex * 256
+    };
+}
+
+UT_FUNCTION(test_createSortKey) {
+    const quartz::rendering::DrawPacket drawPacket = createDrawPacket(5, 0x10);
+
+    // Pipeline is more significant than material
+    UT_CHECK_TRUE(
+        quartz::rendering::RenderQueue::createSortKey(0, createDrawPacket(1000, 0x10)) <
+        quartz::rendering::RenderQueue::createSortKey(1, createDrawPacket(0, 0x10))
+    );
+
+    // Material is more significant than vertex buffer
+    UT_CHECK_TRUE(
+        quartz::rendering::RenderQueue::createSortKey(0, createDrawPacket(4, 0xFFFF)) <
+        quartz::rendering::RenderQueue::createSortKey(0, createDrawPacket(5, 0x10))
+    );
+
+    // The same state gives the same key
+    UT_CHECK_EQUAL(
+        quartz::rendering::RenderQueue::createSortKey(3, drawPacket),
+        quartz::rendering::RenderQueue::createSortKey(3, createDrawPacket(5, 0x10))
+    );
+}
+
+UT_FUNCTION(test_sort) {
+    const std::vector<quartz::rendering::DrawPacket> drawPackets = {
+        createDrawPacket(3, 0x30),
+        createDrawPacket(1, 0x20),
+        createDrawPacket(3, 0x10),
+        createDrawPacket(1, 0x20),
+        createDrawPacket(2, 0x40),
+        createDrawPacket(1, 0x10),
+        createDrawPacket(300, 0x10),
+    };
+
+    quartz::rendering::RenderQueue renderQueue;
+
+    for (uint32_t i = 0; i < drawPackets.size(); ++i) {
+        renderQueue.push(0, drawPackets[i], i, 1);
+    }
+    renderQueue.sort();
+
+    const std::vector<quartz::rendering::RenderQueue::Item>& items = renderQueue.getItems();
+    UT_REQUIRE(items.size() == drawPackets.size());
+
+    // Keys are non decreasing
+    for (uint32_t i = 1; i < items.size(); ++i) {
+        UT_CHECK_TRUE(items[i - 1].sortKey <= items[i].sortKey);
+    }
+
+    // Grouped by material, then vertex buffer, with equal keys keeping their order
+    UT_CHECK_EQUAL(items[0].p_drawPacket, &drawPackets[5]);
+    UT_CHECK_EQUAL(items[1].p_drawPacket, &drawPackets[1]);
+    UT_CHECK_EQUAL(items[2].p_drawPacket, &drawPackets[3]);
+    UT_CHECK_EQUAL(items[3].p_drawPacket, &drawPackets[4]);
+    UT_CHECK_EQUAL(items[4].p_drawPacket, &drawPackets[2]);
+    UT_CHECK_EQUAL(items[5].p_drawPacket, &drawPackets[0]);
+    UT_CHECK_EQUAL(items[6].p_drawPacket, &drawPackets[6]);
+
+    // The instance ranges travel with their packets
+    UT_CHECK_EQUAL(items[0].firstInstance, 5);
+    UT_CHECK_EQUAL(items[6].firstInstance, 6);
+
+    // Clearing empties the queue so it can be reused next frame
+    renderQueue.clear();
+    UT_CHECK_TRUE(renderQueue.getItems().empty());
+}
+
+UT_FUNCTION(test_statistics) {
+    quartz::rendering::RenderQueue::Statistics statistics;
+    statistics.descriptorSetBindCount = 1;
+    statistics.vertexBufferBindCount = 2;
+    statistics.indexBufferBindCount = 3;
+    statistics.pushConstantCount = 4;
+    statistics.descriptorSetBindsAvoided = 5;
+    statistics.vertexBufferBindsAvoided = 6;
+    statistics.indexBufferBindsAvoided = 7;
+    statistics.pushConstantsAvoided = 8;
+
+    UT_CHECK_EQUAL(statistics.getBindCount(), 10);
+    UT_CHECK_EQUAL(statistics.getBindsAvoidedCount(), 26);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_createSortKey);
+    REGISTER_UT_FUNCTION(test_sort);
+    REGISTER_UT_FUNCTION(test_statistics);
+    UT_RUN_TESTS();
+}
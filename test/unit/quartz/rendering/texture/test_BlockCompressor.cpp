@@ -0,0 +1,124 @@
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/texture/BlockCompressor.hpp"
+
+UT_FUNCTION(test_sizes) {
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eBc1RgbUnormBlock), 8);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eBc4UnormBlock), 8);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eBc3UnormBlock), 16);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eBc5UnormBlock), 16);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eBc7UnormBlock), 0);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getBlockSizeBytes(vk::Format::eR8G8B8A8Unorm), 0);
+
+    // Partial blocks still take up a whole block
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getCompressedSizeBytes(vk::Format::eBc1RgbUnormBlock, 4, 4), 8);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getCompressedSizeBytes(vk::Format::eBc1RgbUnormBlock, 1, 1), 8);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getCompressedSizeBytes(vk::Format::eBc3UnormBlock, 5, 9), 2 * 3 * 16);
+    UT_CHECK_EQUAL(quartz::rendering::BlockCompressor::getCompressedSizeBytes(vk::Format::eBc5UnormBlock, 64, 32), 16 * 8 * 16);
+}
+
+UT_FUNCTION(test_solidColor) {
+    const uint32_t width = 8;
+    const uint32_t height = 8;
+
+    std::vector<uint8_t> pixels(width * height * 4);
+    for (uint32_t i = 0; i < width * height; ++i) {
+        pixels[i * 4 + 0] = 255;
+        pixels[i * 4 + 1] = 0;
+        pixels[i * 4 + 2] = 255;
+        pixels[i * 4 + 3] = 255;
+    }
+
+    const std::vector<uint8_t> blocks = quartz::rendering::BlockCompressor::compress(vk::Format::eBc1RgbUnormBlock, pixels.data(), width, height);
+    UT_REQUIRE(blocks.size() == quartz::rendering::BlockCompressor::getCompressedSizeBytes(vk::Format::eBc1RgbUnormBlock, width, height));
+
+    // Magenta is exactly representable in 565, so it should survive untouched
+    const std::vector<uint8_t> decompressed = quartz::rendering::BlockCompressor::decompress(vk::Format::eBc1RgbUnormBlock, blocks.data(), width, height);
+    UT_CHECK_EQUAL_CONTAINERS(decompressed, pixels);
+}
+
+UT_FUNCTION(test_gradient) {
+    const uint32_t width = 16;
+    const uint32_t height = 16;
+
+    // A normal map's x and y as two independent gradients
+    std::vector<uint8_t> pixels(width * height * 4);
+    for (uint32_t y = 0; y < height; ++y) {
+        for (uint32_t x = 0; x < width; ++x) {
+            uint8_t* p_pixel = pixels.data() + (y * width + x) * 4;
+            p_pixel[0] = x * 16;
+            p_pixel[1] = y * 16;
+            p_pixel[2] = 255;
+            p_pixel[3] = 255;
+        }
+    }
+
+    const std::vector<uint8_t> blocks = quartz::rendering::BlockCompressor::compress(vk::Format::eBc5UnormBlock, pixels.data(), width, height);
+    const std::vector<uint8_t> decompressed = quartz::rendering::BlockCompressor::decompress(vk::Format::eBc5UnormBlock, blocks.data(), width, height);
+    UT_REQUIRE(decompressed.size() == pixels.size());
+
+    // Each 4x4 block only spans 48 values per channel, so 8 interpolated values keep it within a few
+    for (uint32_t i = 0; i < width * height; ++i) {
+        UT_CHECK_LESS_THAN_EQUAL(std::abs(decompressed[i * 4 + 0] - pixels[i * 4 + 0]), 4);
+        UT_CHECK_LESS_THAN_EQUAL(std::abs(decompressed[i * 4 + 1] - pixels[i * 4 + 1]), 4);
+    }
+
+    // Bc5 doesn't store blue or alpha
+    UT_CHECK_EQUAL(decompressed[2], 0);
+    UT_CHECK_EQUAL(decompressed[3], 255);
+}
+
+UT_FUNCTION(test_alpha) {
+    const uint32_t width = 4;
+    const uint32_t height = 4;
+
+    std::vector<uint8_t> pixels(width * height * 4);
+    for (uint32_t i = 0; i < width * height; ++i) {
+        pixels[i * 4 + 0] = 0;
+        pixels[i * 4 + 1] = 255;
+        pixels[i * 4 + 2] = 0;
+        pixels[i * 4 + 3] = i < 8 ? 0 : 255;
+    }
+
+    const std::vector<uint8_t> blocks = quartz::rendering::BlockCompressor::compress(vk::Format::eBc3UnormBlock, pixels.data(), width, height);
+    UT_REQUIRE(blocks.size() == 16);
+
+    // The alpha endpoints are the extremes themselves, so both come back exactly
+    const std::vector<uint8_t> decompressed = quartz::rendering::BlockCompressor::decompress(vk::Format::eBc3UnormBlock, blocks.data(), width, height);
+    UT_CHECK_EQUAL_CONTAINERS(decompressed, pixels);
+}
+
+UT_FUNCTION(test_partialBlocks) {
+    const uint32_t width = 5;
+    const uint32_t height = 3;
+
+    std::vector<uint8_t> pixels(width * height * 4);
+    for (uint32_t i = 0; i < width * height; ++i) {
+        pixels[i * 4 + 0] = 0;
+        pixels[i * 4 + 1] = 0;
+        pixels[i * 4 + 2] = 255;
+        pixels[i * 4 + 3] = 255;
+    }
+
+    const std::vector<uint8_t> blocks = quartz::rendering::BlockCompressor::compress(vk::Format::eBc1RgbUnormBlock, pixels.data(), width, height);
+    UT_REQUIRE(blocks.size() == 2 * 8);
+
+    // Only the pixels inside the image are written back
+    const std::vector<uint8_t> decompressed = quartz::rendering::BlockCompressor::decompress(vk::Format::eBc1RgbUnormBlock, blocks.data(), width, height);
+    UT_CHECK_EQUAL_CONTAINERS(decompressed, pixels);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_sizes);
+    REGISTER_UT_FUNCTION(test_solidColor);
+    REGISTER_UT_FUNCTION(test_gradient);
+    REGISTER_UT_FUNCTION(test_alpha);
+    REGISTER_UT_FUNCTION(test_partialBlocks);
+    UT_RUN_TESTS();
+}
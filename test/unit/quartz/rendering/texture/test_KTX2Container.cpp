@@ -0,0 +1,179 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <vulkan/vulkan.hpp>
+
+#include "util/errors/RichException.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/texture/KTX2Container.hpp"
+
+std::vector<uint8_t>
+writeTestContainer() {
+    // 8x8 bc1 is 4 blocks, 4x4 is 1, 2x2 is 1, and 1x1 is 1
+    const std::vector<std::vector<uint8_t>> levels = {
+        std::vector<uint8_t>(32, 1),
+        std::vector<uint8_t>(8, 2),
+        std::vector<uint8_t>(8, 3),
+        std::vector<uint8_t>(8, 4),
+    };
+
+    return quartz::rendering::KTX2Container::write(vk::Format::eBc1RgbUnormBlock, 8, 8, levels);
+}
+
+UT_FUNCTION(test_roundTrip) {
+    const std::vector<uint8_t> bytes = writeTestContainer();
+    UT_REQUIRE(quartz::rendering::KTX2Container::isKTX2(bytes));
+    UT_CHECK_FALSE(quartz::rendering::KTX2Container::requiresTranscoding(bytes));
+
+    const quartz::rendering::KTX2Container container(bytes);
+
+    UT_CHECK_EQUAL(container.getVulkanFormat(), vk::Format::eBc1RgbUnormBlock);
+    UT_CHECK_EQUAL(container.getWidth(), 8);
+    UT_CHECK_EQUAL(container.getHeight(), 8);
+    UT_CHECK_EQUAL(container.getFaceCount(), 1);
+    UT_REQUIRE(container.getLevelCount() == 4);
+
+    for (uint32_t i = 0; i < container.getLevelCount(); ++i) {
+        const std::span<const uint8_t> level = container.getLevel(i);
+        UT_CHECK_EQUAL(level.size(), i == 0 ? 32 : 8);
+        UT_CHECK_EQUAL(level[0], i + 1);
+
+        // Levels are block aligned within the container
+        UT_CHECK_EQUAL((level.data() - bytes.data()) % 16, 0);
+    }
+
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel> imageLevels = container.getImageLevels();
+    UT_REQUIRE(imageLevels.size() == 4);
+    UT_CHECK_EQUAL(imageLevels[0].width, 8);
+    UT_CHECK_EQUAL(imageLevels[0].offsetBytes, 0);
+    UT_CHECK_EQUAL(imageLevels[1].width, 4);
+    UT_CHECK_EQUAL(imageLevels[1].offsetBytes, 32);
+    UT_CHECK_EQUAL(imageLevels[3].width, 1);
+    UT_CHECK_EQUAL(imageLevels[3].height, 1);
+    UT_CHECK_EQUAL(imageLevels[3].offsetBytes, 48);
+    UT_CHECK_EQUAL(container.getLevelDataSizeBytes(), 56);
+
+    std::vector<uint8_t> stagedLevels(container.getLevelDataSizeBytes(), 0);
+    container.writeLevels(stagedLevels.data());
+    UT_CHECK_EQUAL(stagedLevels[0], 1);
+    UT_CHECK_EQUAL(stagedLevels[31], 1);
+    UT_CHECK_EQUAL(stagedLevels[32], 2);
+    UT_CHECK_EQUAL(stagedLevels[55], 4);
+}
+
+UT_FUNCTION(test_invalidContainers) {
+    {
+        std::vector<uint8_t> bytes = writeTestContainer();
+        bytes[0] = 0;
+        UT_CHECK_FALSE(quartz::rendering::KTX2Container::isKTX2(bytes));
+
+        bool threw = false;
+        try {
+            const quartz::rendering::KTX2Container container(bytes);
+        } catch (const util::RichException<uint64_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+
+    {
+        // Basis universal supercompression lives at offset 44 of the header
+        std::vector<uint8_t> bytes = writeTestContainer();
+        const uint32_t basisLZ = 1;
+        std::memcpy(bytes.data() + 44, &basisLZ, sizeof(basisLZ));
+        UT_CHECK_TRUE(quartz::rendering::KTX2Container::requiresTranscoding(bytes));
+
+        bool threw = false;
+        try {
+            const quartz::rendering::KTX2Container container(bytes);
+        } catch (const util::RichException<uint64_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+
+    {
+        // The largest level is written last, so chopping it off leaves its index entry pointing past the end
+        std::vector<uint8_t> bytes = writeTestContainer();
+        bytes.resize(bytes.size() - 40);
+
+        bool threw = false;
+        try {
+            const quartz::rendering::KTX2Container container(bytes);
+        } catch (const util::RichException<uint64_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+
+    {
+        // Level 1's index entry is at 80 + 24 and its size is 8 bytes into the entry. Shrinking it keeps
+        // the level inside the container, but leaves it too small for a 4x4 level
+        std::vector<uint8_t> bytes = writeTestContainer();
+        const uint64_t truncatedSizeBytes = 4;
+        std::memcpy(bytes.data() + 80 + 24 + 8, &truncatedSizeBytes, sizeof(truncatedSizeBytes));
+
+        bool threw = false;
+        try {
+            const quartz::rendering::KTX2Container container(bytes);
+        } catch (const util::RichException<uint64_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+
+    {
+        // The pixel height lives at offset 24 of the header
+        std::vector<uint8_t> bytes = writeTestContainer();
+        const uint32_t pixelHeight = 0;
+        std::memcpy(bytes.data() + 24, &pixelHeight, sizeof(pixelHeight));
+
+        bool threw = false;
+        try {
+            const quartz::rendering::KTX2Container container(bytes);
+        } catch (const util::RichException<uint64_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+
+    {
+        const std::vector<uint8_t> bytes = writeTestContainer();
+        const quartz::rendering::KTX2Container container(bytes);
+
+        bool threw = false;
+        try {
+            container.getLevel(4);
+        } catch (const util::RichException<uint32_t>&) {
+            threw = true;
+        }
+        UT_CHECK_TRUE(threw);
+    }
+}
+
+UT_FUNCTION(test_calculateImageSizeBytes) {
+    // Block compressed formats round up to whole 4x4 blocks
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eBc1RgbUnormBlock, 8, 8), 32);
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eBc1RgbUnormBlock, 1, 1), 8);
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eBc7SrgbBlock, 5, 3), 32);
+
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eR8Unorm, 3, 3), 9);
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eR8G8B8A8Srgb, 4, 2), 32);
+
+    UT_CHECK_EQUAL(quartz::rendering::KTX2Container::calculateImageSizeBytes(vk::Format::eUndefined, 4, 4), 0);
+}
+
+UT_FUNCTION(test_isKTX2Filepath) {
+    UT_CHECK_TRUE(quartz::rendering::KTX2Container::isKTX2Filepath("textures/brick_normal.ktx2"));
+    UT_CHECK_FALSE(quartz::rendering::KTX2Container::isKTX2Filepath("textures/brick_normal.png"));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_roundTrip);
+    REGISTER_UT_FUNCTION(test_invalidContainers);
+    REGISTER_UT_FUNCTION(test_calculateImageSizeBytes);
+    REGISTER_UT_FUNCTION(test_isKTX2Filepath);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,156 @@
+#include <cstdint>
+#include <vector>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/texture/MipChain.hpp"
+
+UT_FUNCTION(test_levels) {
+    {
+        const std::vector<uint8_t> pixels(16 * 4 * 4, 0);
+        const quartz::rendering::MipChain mipChain({pixels.data()}, 16, 4, 4, 4, false);
+
+        // 16x4 , 8x2 , 4x1 , 2x1 , 1x1
+        UT_CHECK_EQUAL(mipChain.getLevelCount(), 5);
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), (64 + 16 + 4 + 2 + 1) * 4);
+    }
+
+    {
+        const std::vector<uint8_t> pixels(3, 0);
+        const quartz::rendering::MipChain mipChain({pixels.data()}, 1, 1, 3, 4, false);
+
+        UT_CHECK_EQUAL(mipChain.getLevelCount(), 1);
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), 4);
+    }
+
+    {
+        // Every layer gets its own copy of every level
+        const std::vector<uint8_t> pixels(4 * 4 * 4, 0);
+        const quartz::rendering::MipChain mipChain(std::vector<const uint8_t*>(6, pixels.data()), 4, 4, 4, 4, true);
+
+        UT_CHECK_EQUAL(mipChain.getLevelCount(), 3);
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), (16 + 4 + 1) * 4 * 6);
+    }
+}
+
+UT_FUNCTION(test_write) {
+    const std::vector<uint8_t> pixels = {
+        10, 20, 30,    100, 120, 130,
+        50, 60, 70,    200, 220, 230,
+    };
+    const quartz::rendering::MipChain mipChain({pixels.data()}, 2, 2, 3, 4, false);
+    UT_REQUIRE(mipChain.getLevelCount() == 2);
+
+    std::vector<uint8_t> destination(mipChain.getSizeBytes(), 0);
+    mipChain.write(destination.data());
+
+    const std::vector<uint8_t> expected = {
+        10, 20, 30, 255,    100, 120, 130, 255,
+        50, 60, 70, 255,    200, 220, 230, 255,
+        90, 105, 115, 255,
+    };
+    UT_CHECK_EQUAL_CONTAINERS(destination, expected);
+}
+
+UT_FUNCTION(test_writeSRGB) {
+    // Black and white average to a much brighter grey than 128 once we average them in linear space
+    const std::vector<uint8_t> pixels = {
+        0, 0, 0, 0,    255, 255, 255, 255,
+        0, 0, 0, 0,    255, 255, 255, 255,
+    };
+    const quartz::rendering::MipChain mipChain({pixels.data()}, 2, 2, 4, 4, true);
+    UT_REQUIRE(mipChain.getLevelCount() == 2);
+
+    std::vector<uint8_t> destination(mipChain.getSizeBytes(), 0);
+    mipChain.write(destination.data());
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        UT_CHECK_GREATER_THAN_EQUAL(destination[16 + i], 186);
+        UT_CHECK_LESS_THAN_EQUAL(destination[16 + i], 188);
+    }
+
+    // Alpha is never linearized
+    UT_CHECK_EQUAL(destination[19], 128);
+}
+
+UT_FUNCTION(test_writePacked) {
+    // Packed levels keep the base level's channel count instead of growing to rgba
+    const std::vector<uint8_t> pixels = {
+        10, 20,    100, 120,
+        50, 60,    200, 220,
+    };
+    const quartz::rendering::MipChain mipChain({pixels.data()}, 2, 2, 2, 2, false);
+    UT_REQUIRE(mipChain.getLevelCount() == 2);
+    UT_CHECK_EQUAL(mipChain.getLevelChannelCount(), 2);
+    UT_CHECK_EQUAL(mipChain.getSizeBytes(), (4 + 1) * 2);
+
+    std::vector<uint8_t> destination(mipChain.getSizeBytes(), 0);
+    mipChain.write(destination.data());
+
+    const std::vector<uint8_t> expected = {
+        10, 20,    100, 120,
+        50, 60,    200, 220,
+        90, 105,
+    };
+    UT_CHECK_EQUAL_CONTAINERS(destination, expected);
+}
+
+UT_FUNCTION(test_paddedLevels) {
+    {
+        // 3x3 , 1x1 with one byte texels, so the second level starts at 12 rather than 9
+        const std::vector<uint8_t> pixels(3 * 3, 0);
+        const quartz::rendering::MipChain mipChain({pixels.data()}, 3, 3, 1, 1, false);
+        UT_REQUIRE(mipChain.getLevelCount() == 2);
+
+        UT_CHECK_EQUAL(mipChain.getLevels()[1].offsetBytes, 12);
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), 12 + 1);
+    }
+
+    {
+        // 5x5 , 2x2 , 1x1 with two byte texels, so the second level starts at 52 rather than 50
+        const std::vector<uint8_t> pixels(5 * 5 * 2, 0);
+        const quartz::rendering::MipChain mipChain({pixels.data()}, 5, 5, 2, 2, false);
+        UT_REQUIRE(mipChain.getLevelCount() == 3);
+
+        UT_CHECK_EQUAL(mipChain.getLevels()[1].offsetBytes, 52);
+        UT_CHECK_EQUAL(mipChain.getLevels()[2].offsetBytes, 60);
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), 60 + 2);
+    }
+
+    {
+        // Levels which already end on a multiple of 4 get no padding
+        const std::vector<uint8_t> pixels(8 * 8 * 4, 0);
+        const quartz::rendering::MipChain mipChain({pixels.data()}, 8, 8, 4, 4, false);
+
+        UT_CHECK_EQUAL(mipChain.getSizeBytes(), (64 + 16 + 4 + 1) * 4);
+    }
+}
+
+UT_FUNCTION(test_writePadded) {
+    const std::vector<uint8_t> pixels = {
+        10, 20, 30,
+        40, 50, 60,
+        70, 80, 90,
+    };
+    const quartz::rendering::MipChain mipChain({pixels.data()}, 3, 3, 1, 1, false);
+    UT_REQUIRE(mipChain.getLevelCount() == 2);
+
+    std::vector<uint8_t> destination(mipChain.getSizeBytes(), 0);
+    mipChain.write(destination.data());
+
+    // The base level is untouched and the generated level lands after the padding, not right after the base level
+    for (uint32_t i = 0; i < pixels.size(); ++i) {
+        UT_CHECK_EQUAL(destination[i], pixels[i]);
+    }
+    UT_CHECK_NOT_EQUAL(destination[12], 0);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_levels);
+    REGISTER_UT_FUNCTION(test_write);
+    REGISTER_UT_FUNCTION(test_writeSRGB);
+    REGISTER_UT_FUNCTION(test_writePacked);
+    REGISTER_UT_FUNCTION(test_paddedLevels);
+    REGISTER_UT_FUNCTION(test_writePadded);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "util/platform.hpp"
+#include "util/file_system/MappedFile.hpp"
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/texture/Texture.hpp"
+
+std::vector<uint8_t>
+createPixels(
+    const uint32_t pixelCount,
+    const uint32_t channelCount
+) {
+    std::vector<uint8_t> pixels(static_cast<size_t>(pixelCount) * channelCount);
+    for (uint32_t i = 0; i < pixels.size(); ++i) {
+        pixels[i] = static_cast<uint8_t>(i * 7 + 3);
+    }
+
+    return pixels;
+}
+
+UT_FUNCTION(test_expandToRGBA) {
+    // Counts on both sides of the 16 pixels the simd path works on at a time, so we cover the remainder too
+    for (const uint32_t pixelCount : {0u, 1u, 15u, 16u, 17u, 47u, 64u, 1001u}) {
+        for (const uint32_t channelCount : {1u, 2u, 3u, 4u}) {
+            const std::vector<uint8_t> pixels = createPixels(pixelCount, channelCount);
+
+            const std::vector<uint8_t> rgbaPixels = quartz::rendering::Texture::expandToRGBA(
+                pixels.data(),
+                pixelCount,
+                channelCount
+            );
+            UT_REQUIRE(rgbaPixels.size() == static_cast<size_t>(pixelCount) * 4);
+
+            for (uint32_t i = 0; i < pixelCount; ++i) {
+                for (uint32_t j = 0; j < 3; ++j) {
+                    UT_CHECK_EQUAL(rgbaPixels[i * 4 + j], j < channelCount ? pixels[i * channelCount + j] : 0);
+                }
+                UT_CHECK_EQUAL(rgbaPixels[i * 4 + 3], channelCount == 4 ? pixels[i * 4 + 3] : 255);
+            }
+        }
+    }
+}
+
+UT_FUNCTION(test_expandToRGBAInPlace) {
+    const uint32_t pixelCount = 37;
+    const std::vector<uint8_t> pixels = createPixels(pixelCount, 3);
+
+    // Only the bytes for the requested pixels should be written
+    std::vector<uint8_t> destination(pixelCount * 4 + 4, 0xAB);
+    quartz::rendering::Texture::expandToRGBA(
+        pixels.data(),
+        pixelCount,
+        3,
+        destination.data()
+    );
+
+    const std::vector<uint8_t> expected = quartz::rendering::Texture::expandToRGBA(
+        pixels.data(),
+        pixelCount,
+        3
+    );
+    UT_CHECK_EQUAL_CONTAINERS(std::vector<uint8_t>(destination.begin(), destination.begin() + pixelCount * 4), expected);
+    for (uint32_t i = pixelCount * 4; i < destination.size(); ++i) {
+        UT_CHECK_EQUAL(destination[i], 0xAB);
+    }
+}
+
+UT_FUNCTION(test_packChannels) {
+    const std::vector<uint8_t> pixels = {
+        1, 2, 3,
+        4, 5, 6,
+    };
+
+    // Metallic roughness keeps green and blue
+    const std::vector<uint8_t> metallicRoughnessPixels = quartz::rendering::Texture::packChannels(
+        pixels.data(),
+        2,
+        3,
+        quartz::rendering::Texture::getPackedChannels(quartz::rendering::Texture::Type::MetallicRoughness)
+    );
+    UT_CHECK_EQUAL_CONTAINERS(metallicRoughnessPixels, std::vector<uint8_t>({2, 3, 5, 6}));
+
+    const std::vector<uint8_t> occlusionPixels = quartz::rendering::Texture::packChannels(
+        pixels.data(),
+        2,
+        3,
+        quartz::rendering::Texture::getPackedChannels(quartz::rendering::Texture::Type::Occlusion)
+    );
+    UT_CHECK_EQUAL_CONTAINERS(occlusionPixels, std::vector<uint8_t>({1, 4}));
+
+    const std::vector<uint8_t> normalPixels = quartz::rendering::Texture::packChannels(
+        pixels.data(),
+        2,
+        3,
+        quartz::rendering::Texture::getPackedChannels(quartz::rendering::Texture::Type::Normal)
+    );
+    UT_CHECK_EQUAL_CONTAINERS(normalPixels, std::vector<uint8_t>({1, 2, 4, 5}));
+
+    // Missing alpha is opaque, just like when expanding
+    const std::vector<uint8_t> baseColorPixels = quartz::rendering::Texture::packChannels(
+        pixels.data(),
+        2,
+        3,
+        quartz::rendering::Texture::getPackedChannels(quartz::rendering::Texture::Type::BaseColor)
+    );
+    UT_CHECK_EQUAL_CONTAINERS(baseColorPixels, std::vector<uint8_t>({1, 2, 3, 255, 4, 5, 6, 255}));
+}
+
+UT_FUNCTION(test_getGLTFTextureTypes) {
+    tinygltf::Model gltfModel;
+    gltfModel.textures.resize(4);
+
+    // An orm texture shared between occlusion and metallic roughness keeps all of its channels
+    tinygltf::Material gltfMaterial;
+    gltfMaterial.pbrMetallicRoughness.metallicRoughnessTexture.index = 0;
+    gltfMaterial.occlusionTexture.index = 0;
+    gltfMaterial.normalTexture.index = 1;
+    gltfMaterial.emissiveTexture.index = 2;
+    gltfModel.materials.push_back(gltfMaterial);
+
+    const std::vector<quartz::rendering::Texture::Type> textureTypes = quartz::rendering::Texture::getGLTFTextureTypes(gltfModel);
+    UT_REQUIRE(textureTypes.size() == 4);
+    UT_CHECK_TRUE(textureTypes[0] == quartz::rendering::Texture::Type::BaseColor);
+    UT_CHECK_TRUE(textureTypes[1] == quartz::rendering::Texture::Type::Normal);
+    UT_CHECK_TRUE(textureTypes[2] == quartz::rendering::Texture::Type::Emission);
+    UT_CHECK_TRUE(textureTypes[3] == quartz::rendering::Texture::Type::BaseColor);
+}
+
+UT_FUNCTION(test_calculateContentHash) {
+    const std::vector<uint8_t> pixels = createPixels(64, 4);
+    tinygltf::Sampler gltfSampler;
+    gltfSampler.minFilter = 9729;
+    gltfSampler.magFilter = 9729;
+    gltfSampler.wrapS = 10497;
+    gltfSampler.wrapT = 10497;
+
+    const uint64_t hash = quartz::rendering::Texture::calculateContentHash(pixels, 8, 8, 4, quartz::rendering::Texture::Type::BaseColor, gltfSampler);
+
+    // The same image from another model is the same texture
+    const std::vector<uint8_t> copiedPixels = pixels;
+    UT_CHECK_EQUAL(quartz::rendering::Texture::calculateContentHash(copiedPixels, 8, 8, 4, quartz::rendering::Texture::Type::BaseColor, gltfSampler), hash);
+
+    std::vector<uint8_t> changedPixels = pixels;
+    changedPixels[100] ^= 1;
+    UT_CHECK_FALSE(quartz::rendering::Texture::calculateContentHash(changedPixels, 8, 8, 4, quartz::rendering::Texture::Type::BaseColor, gltfSampler) == hash);
+
+    // Same bytes in a different shape
+    UT_CHECK_FALSE(quartz::rendering::Texture::calculateContentHash(pixels, 16, 4, 4, quartz::rendering::Texture::Type::BaseColor, gltfSampler) == hash);
+
+    // Packed differently on the gpu
+    UT_CHECK_FALSE(quartz::rendering::Texture::calculateContentHash(pixels, 8, 8, 4, quartz::rendering::Texture::Type::Normal, gltfSampler) == hash);
+
+    tinygltf::Sampler clampedGLTFSampler = gltfSampler;
+    clampedGLTFSampler.wrapS = 33071;
+    UT_CHECK_FALSE(quartz::rendering::Texture::calculateContentHash(pixels, 8, 8, 4, quartz::rendering::Texture::Type::BaseColor, clampedGLTFSampler) == hash);
+}
+
+UT_FUNCTION(test_hasSameLevels) {
+    const quartz::rendering::Texture::LevelData levelData = {
+        vk::Format::eR8G8B8A8Unorm,
+        4,
+        {{2, 2, 0}, {1, 1, 16}},
+        20,
+        createPixels(5, 4),
+        nullptr,
+        {}
+    };
+
+    const quartz::rendering::Texture::LevelData copiedLevelData = levelData;
+    UT_CHECK_TRUE(quartz::rendering::Texture::hasSameLevels(levelData, copiedLevelData));
+
+    // A hash collision has to be caught by the bytes themselves
+    quartz::rendering::Texture::LevelData changedLevelData = levelData;
+    changedLevelData.bytes[18] ^= 1;
+    UT_CHECK_FALSE(quartz::rendering::Texture::hasSameLevels(levelData, changedLevelData));
+
+    // Same bytes in a different shape
+    quartz::rendering::Texture::LevelData reshapedLevelData = levelData;
+    reshapedLevelData.levels = {{4, 1, 0}, {2, 1, 16}};
+    UT_CHECK_FALSE(quartz::rendering::Texture::hasSameLevels(levelData, reshapedLevelData));
+
+    quartz::rendering::Texture::LevelData truncatedLevelData = levelData;
+    truncatedLevelData.levels.pop_back();
+    UT_CHECK_FALSE(quartz::rendering::Texture::hasSameLevels(levelData, truncatedLevelData));
+
+    quartz::rendering::Texture::LevelData reformattedLevelData = levelData;
+    reformattedLevelData.format = vk::Format::eR8G8B8A8Srgb;
+    UT_CHECK_FALSE(quartz::rendering::Texture::hasSameLevels(levelData, reformattedLevelData));
+}
+
+UT_FUNCTION(test_getLevelBytesFromMappedFile) {
+#ifdef ON_LINUX
+    const std::string tempFilepath = std::filesystem::temp_directory_path().string() + "/" + std::string("mappedlevels.ktx2");
+#else
+    const std::string tempFilepath = std::filesystem::temp_directory_path().string() + std::string("mappedlevels.ktx2");
+#endif
+
+    const std::vector<uint8_t> bytes = createPixels(5, 4);
+
+    // Smallest level first with some padding in front, the way levels are laid out in a ktx2 container
+    std::ofstream tempFile(tempFilepath, std::ios::binary);
+    tempFile.write("padding!", 8);
+    tempFile.write(reinterpret_cast<const char*>(bytes.data()) + 16, 4);
+    tempFile.write(reinterpret_cast<const char*>(bytes.data()), 16);
+    tempFile.close();
+
+    const quartz::rendering::Texture::LevelData levelData = {
+        vk::Format::eR8G8B8A8Unorm,
+        4,
+        {{2, 2, 0}, {1, 1, 16}},
+        20,
+        bytes,
+        nullptr,
+        {}
+    };
+    const quartz::rendering::Texture::LevelData mappedLevelData = {
+        vk::Format::eR8G8B8A8Unorm,
+        4,
+        {{2, 2, 0}, {1, 1, 16}},
+        20,
+        {},
+        std::make_shared<const util::MappedFile>(tempFilepath),
+        {12, 8}
+    };
+
+    for (uint32_t i = 0; i < levelData.levels.size(); ++i) {
+        const std::span<const uint8_t> levelBytes = levelData.getLevelBytes(i);
+        const std::span<const uint8_t> mappedLevelBytes = mappedLevelData.getLevelBytes(i);
+        UT_REQUIRE(levelBytes.size() == mappedLevelBytes.size());
+        UT_CHECK_TRUE(std::equal(levelBytes.begin(), levelBytes.end(), mappedLevelBytes.begin()));
+    }
+
+    // A texture out of a cooked model is the same as one holding its levels
+    UT_CHECK_TRUE(quartz::rendering::Texture::hasSameLevels(levelData, mappedLevelData));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_expandToRGBA);
+    REGISTER_UT_FUNCTION(test_expandToRGBAInPlace);
+    REGISTER_UT_FUNCTION(test_packChannels);
+    REGISTER_UT_FUNCTION(test_getGLTFTextureTypes);
+    REGISTER_UT_FUNCTION(test_calculateContentHash);
+    REGISTER_UT_FUNCTION(test_hasSameLevels);
+    REGISTER_UT_FUNCTION(test_getLevelBytesFromMappedFile);
+    UT_RUN_TESTS();
+}
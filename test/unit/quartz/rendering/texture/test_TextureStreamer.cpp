@@ -0,0 +1,64 @@
+#include <cstdint>
+#include <vector>
+
+#include "util/unit_test/UnitTest.hpp"
+
+#include "quartz/rendering/buffer/StagedImageBuffer.hpp"
+#include "quartz/rendering/buffer/UploadBatch.hpp"
+#include "quartz/rendering/texture/Texture.hpp"
+#include "quartz/rendering/texture/TextureStreamer.hpp"
+
+std::vector<quartz::rendering::UploadBatch::ImageLevel>
+createLevels(
+    const uint32_t imageWidth,
+    const uint32_t imageHeight
+) {
+    return quartz::rendering::StagedImageBuffer::calculateMipLevels(
+        imageWidth,
+        imageHeight,
+        1,
+        quartz::rendering::StagedImageBuffer::calculateFullMipLevelCount(imageWidth, imageHeight),
+        4
+    );
+}
+
+UT_FUNCTION(test_getInitialResidentBaseLevel) {
+    // 256 , 128 , 64
+    UT_CHECK_EQUAL(quartz::rendering::Texture::getInitialResidentBaseLevel(createLevels(256, 256)), 2);
+
+    // 512x64 , 256x32 , 128x16 , 64x8
+    UT_CHECK_EQUAL(quartz::rendering::Texture::getInitialResidentBaseLevel(createLevels(512, 64)), 3);
+
+    // Small textures are entirely resident from the start
+    UT_CHECK_EQUAL(quartz::rendering::Texture::getInitialResidentBaseLevel(createLevels(32, 32)), 0);
+    UT_CHECK_EQUAL(quartz::rendering::Texture::getInitialResidentBaseLevel(createLevels(64, 64)), 0);
+
+    // Textures with only a large level can't start out any smaller
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel> levels = createLevels(256, 256);
+    UT_CHECK_EQUAL(quartz::rendering::Texture::getInitialResidentBaseLevel({levels[0]}), 0);
+}
+
+UT_FUNCTION(test_getDesiredBaseLevel) {
+    const std::vector<quartz::rendering::UploadBatch::ImageLevel> levels = createLevels(256, 256);
+
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 256), 0);
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 128), 1);
+
+    // Rounds up to the next level so the texture is never blurrier than what was asked for
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 100), 1);
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 129), 0);
+
+    // Can't go larger than the largest level
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 4096), 0);
+
+    // Never smaller than the levels the texture started out with
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 16), 2);
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 1), 2);
+    UT_CHECK_EQUAL(quartz::rendering::TextureStreamer::getDesiredBaseLevel(levels, 0), 2);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_getInitialResidentBaseLevel);
+    REGISTER_UT_FUNCTION(test_getDesiredBaseLevel);
+    UT_RUN_TESTS();
+}
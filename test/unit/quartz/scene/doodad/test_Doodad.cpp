@@ -90,7 +90,7 @@ UT_FUNCTION(test_construction) {
         UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
         UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
         UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-        UT_REQUIRE_NOT(doodad.getModelOptional());
+        UT_REQUIRE_NOT(doodad.getModelPtr());
         UT_REQUIRE_NOT(doodad.getRigidBodyOptional());
     }
 
@@ -134,9 +134,9 @@ UT_FUNCTION(test_construction) {
         UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
         UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-        const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-        UT_REQUIRE(o_model);
-        const quartz::rendering::Model& model = *o_model;
+        const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+        UT_REQUIRE(p_model);
+        const quartz::rendering::Model& model = *p_model;
         UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 0);
         const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
         UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 1);
@@ -201,9 +201,9 @@ UT_FUNCTION(test_construction) {
         UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
         UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-        const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-        UT_REQUIRE(o_model);
-        const quartz::rendering::Model& model = *o_model;
+        const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+        UT_REQUIRE(p_model);
+        const quartz::rendering::Model& model = *p_model;
         UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 2);
         const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
         UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 2);
@@ -275,7 +275,7 @@ UT_FUNCTION(test_awaken) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     UT_REQUIRE_NOT(doodad.getRigidBodyOptional());
 
     doodad.awaken(&scene);
@@ -351,7 +351,7 @@ UT_FUNCTION(test_updateCallback_rb) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     const std::optional<quartz::physics::RigidBody>& o_rigidBody = doodad.getRigidBodyOptional();
     UT_REQUIRE(o_rigidBody);
     const quartz::physics::RigidBody& rigidBody = *o_rigidBody;
@@ -383,7 +383,7 @@ UT_FUNCTION(test_updateCallback_rb) {
     UT_CHECK_EQUAL(doodad.getTransform().position, newPosition);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, newRotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     UT_REQUIRE(o_rigidBody);
     UT_CHECK_EQUAL(rigidBody.getPosition(), newPosition);
     UT_CHECK_EQUAL(rigidBody.getRotation(), newRotation);
@@ -460,7 +460,7 @@ UT_FUNCTION(test_updateCallback_doodad) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     const std::optional<quartz::physics::RigidBody>& o_rigidBody = doodad.getRigidBodyOptional();
     UT_REQUIRE(o_rigidBody);
     const quartz::physics::RigidBody& rigidBody = *o_rigidBody;
@@ -491,7 +491,7 @@ UT_FUNCTION(test_updateCallback_doodad) {
     UT_CHECK_EQUAL(doodad.getTransform().position, newPosition);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, newRotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, newScale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     UT_REQUIRE(o_rigidBody);
     UT_CHECK_EQUAL(rigidBody.getPosition(), newPosition);
     UT_CHECK_EQUAL(rigidBody.getRotation(), newRotation);
@@ -572,7 +572,7 @@ UT_FUNCTION(test_fixedUpdateCallback_rb) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     const std::optional<quartz::physics::RigidBody>& o_rigidBody = doodad.getRigidBodyOptional();
     UT_REQUIRE(o_rigidBody);
     const quartz::physics::RigidBody& rigidBody = *o_rigidBody;
@@ -605,7 +605,7 @@ UT_FUNCTION(test_fixedUpdateCallback_rb) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     UT_REQUIRE(o_rigidBody);
     UT_CHECK_EQUAL(rigidBody.getPosition(), newPosition);
     UT_CHECK_EQUAL(rigidBody.getRotation(), newRotation);
@@ -682,7 +682,7 @@ UT_FUNCTION(test_fixedUpdateCallback_doodad) {
     UT_CHECK_EQUAL(doodad.getTransform().position, transform.position);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     const std::optional<quartz::physics::RigidBody>& o_rigidBody = doodad.getRigidBodyOptional();
     UT_REQUIRE(o_rigidBody);
     const quartz::physics::RigidBody& rigidBody = *o_rigidBody;
@@ -714,7 +714,7 @@ UT_FUNCTION(test_fixedUpdateCallback_doodad) {
     UT_CHECK_EQUAL(doodad.getTransform().position, newPosition);
     UT_CHECK_EQUAL(doodad.getTransform().rotation, newRotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, newScale);
-    UT_REQUIRE_NOT(doodad.getModelOptional());
+    UT_REQUIRE_NOT(doodad.getModelPtr());
     UT_REQUIRE(o_rigidBody);
     UT_CHECK_EQUAL(rigidBody.getPosition(), newPosition);
     UT_CHECK_EQUAL(rigidBody.getRotation(), newRotation);
@@ -777,9 +777,9 @@ UT_FUNCTION(test_setPosition) {
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-    const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-    UT_REQUIRE(o_model);
-    const quartz::rendering::Model& model = *o_model;
+    const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+    UT_REQUIRE(p_model);
+    const quartz::rendering::Model& model = *p_model;
     UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 0);
     const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
     UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 1);
@@ -861,9 +861,9 @@ UT_FUNCTION(test_setRotation) {
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-    const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-    UT_REQUIRE(o_model);
-    const quartz::rendering::Model& model = *o_model;
+    const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+    UT_REQUIRE(p_model);
+    const quartz::rendering::Model& model = *p_model;
     UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 0);
     const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
     UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 1);
@@ -946,9 +946,9 @@ UT_FUNCTION(test_setScale_sphere) {
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-    const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-    UT_REQUIRE(o_model);
-    const quartz::rendering::Model& model = *o_model;
+    const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+    UT_REQUIRE(p_model);
+    const quartz::rendering::Model& model = *p_model;
     UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 0);
     const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
     UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 1);
@@ -1032,9 +1032,9 @@ UT_FUNCTION(test_setScale_box) {
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-    const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-    UT_REQUIRE(o_model);
-    const quartz::rendering::Model& model = *o_model;
+    const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+    UT_REQUIRE(p_model);
+    const quartz::rendering::Model& model = *p_model;
     UT_CHECK_EQUAL(model.getMaterialMasterIndices().size(), 0);
     const quartz::rendering::Scene& defaultScene = model.getDefaultScene();
     UT_CHECK_EQUAL(defaultScene.getRootNodePtrs().size(), 1);
@@ -1126,8 +1126,8 @@ UT_FUNCTION(test_snapToRigidBody) {
     UT_CHECK_EQUAL(doodad.getTransform().rotation, transform.rotation);
     UT_CHECK_EQUAL(doodad.getTransform().scale, transform.scale);
 
-    const std::optional<quartz::rendering::Model>& o_model = doodad.getModelOptional();
-    UT_REQUIRE_NOT(o_model);
+    const std::shared_ptr<const quartz::rendering::Model>& p_model = doodad.getModelPtr();
+    UT_REQUIRE_NOT(p_model);
 
     std::optional<quartz::physics::RigidBody>& o_rigidBody = doodad.getRigidBodyOptionalReference();
     UT_REQUIRE(o_rigidBody);
@@ -7,6 +7,7 @@
 
 #include "quartz/rendering/device/Device.hpp"
 #include "quartz/rendering/instance/Instance.hpp"
+#include "quartz/rendering/model/ModelCache.hpp"
 #include "quartz/rendering/texture/Texture.hpp"
 #include "quartz/scene/scene/Scene.hpp"
 #include "quartz/scene/doodad/Doodad.hpp"
@@ -126,8 +127,66 @@ UT_FUNCTION(test_high_level) {
     quartz::rendering::Texture::cleanUpAllTextures();
 }
 
+UT_FUNCTION(test_shared_models) {
+    quartz::rendering::Instance renderingInstance("DOODAD_UT", 9, 9, 9, true);
+    quartz::rendering::Device renderingDevice(renderingInstance);
+
+    quartz::managers::PhysicsManager& physicsManager = quartz::unit_test::PhysicsManagerUnitTestClient::getInstance();
+
+    const std::array<std::string, 6> skyBoxInformation {
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/posx-00FFFF-2x2.jpg"),
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/negx-FF0000-2x2.jpg"),
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/posy-FF00FF-2x2.jpg"),
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/negy-00FF00-2x2.jpg"),
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/posz-FFFF00-2x2.jpg"),
+        util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/sky_boxes/test/negz-0000FF-2x2.jpg")
+    };
+
+    const std::string cubeFilepath = util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/models/unit_models/unit_cube/glb/unit_cube.glb");
+    const std::string cubeFilepathAlias = util::FileSystem::getAbsoluteFilepathInQuartzDirectory("assets/models/unit_models/unit_cube/glb/../glb/unit_cube.glb");
+    const std::vector<quartz::scene::Doodad::Parameters> doodadParameters = {
+        quartz::scene::Doodad::Parameters{cubeFilepath, math::Transform{}, std::nullopt, {}, {}, {}},
+        quartz::scene::Doodad::Parameters{cubeFilepath, math::Transform{}, std::nullopt, {}, {}, {}},
+        quartz::scene::Doodad::Parameters{cubeFilepathAlias, math::Transform{}, std::nullopt, {}, {}, {}},
+        quartz::scene::Doodad::Parameters{std::nullopt, math::Transform{}, std::nullopt, {}, {}, {}}
+    };
+
+    quartz::scene::Scene scene;
+
+    scene.load(
+        renderingDevice,
+        physicsManager,
+        quartz::scene::AmbientLight(),
+        quartz::scene::DirectionalLight(),
+        {},
+        {},
+        math::Vec3(0),
+        skyBoxInformation,
+        doodadParameters,
+        std::nullopt
+    );
+
+    const std::vector<quartz::scene::Doodad>& doodads = scene.getDoodads();
+    UT_REQUIRE(doodads.size() == doodadParameters.size());
+    UT_REQUIRE(doodads[0].getModelPtr());
+    UT_CHECK_EQUAL(doodads[0].getModelPtr().get(), doodads[1].getModelPtr().get());
+    UT_CHECK_EQUAL(doodads[0].getModelPtr().get(), doodads[2].getModelPtr().get());
+    UT_CHECK_EQUAL(doodads[0].getModelPtr().use_count(), 3);
+    UT_REQUIRE_NOT(doodads[3].getModelPtr());
+
+    const quartz::rendering::ModelCache& modelCache = scene.getModelCache();
+    UT_CHECK_EQUAL(modelCache.getLiveModelCount(), 1);
+    UT_CHECK_EQUAL(modelCache.getCacheMissCount(), 1);
+    UT_CHECK_EQUAL(modelCache.getCacheHitCount(), 2);
+
+    scene.unload(physicsManager);
+
+    quartz::rendering::Texture::cleanUpAllTextures();
+}
+
 UT_MAIN() {
     REGISTER_UT_FUNCTION(test_construction);
     REGISTER_UT_FUNCTION(test_high_level);
+    REGISTER_UT_FUNCTION(test_shared_models);
     UT_RUN_TESTS();
 }
@@ -0,0 +1,105 @@
+#include <filesystem>
+#include <fstream>
+#include <limits>
+
+#include "util/platform.hpp"
+#include "util/errors/RichException.hpp"
+#include "util/unit_test/UnitTest.hpp"
+#include "util/file_system/FileSystem.hpp"
+#include "util/file_system/MappedFile.hpp"
+
+UT_FUNCTION(test_construction) {
+    {
+        // Here we are using CMakeCache.txt because we know it will have to exist if Quartz is compiled
+        const std::string filepath = util::FileSystem::getAbsoluteFilepathInBinaryDirectory("CMakeCache.txt");
+
+        const std::vector<char> readBytes = util::FileSystem::readBytesFromFile(filepath);
+        const util::MappedFile mappedFile(filepath);
+
+        UT_CHECK_EQUAL(mappedFile.getFilepath(), filepath);
+        UT_REQUIRE(mappedFile.getSizeBytes() == readBytes.size());
+
+        const std::vector<char> mappedBytes(mappedFile.getData(), mappedFile.getData() + mappedFile.getSizeBytes());
+        UT_CHECK_EQUAL_CONTAINERS(mappedBytes, readBytes);
+    }
+
+    {
+        const util::MappedFile mappedFile;
+
+        UT_CHECK_EQUAL(mappedFile.getSizeBytes(), 0);
+        UT_CHECK_TRUE(mappedFile.getData() == nullptr);
+    }
+}
+
+UT_FUNCTION(test_move) {
+    {
+        const std::string filepath = util::FileSystem::getAbsoluteFilepathInBinaryDirectory("CMakeCache.txt");
+
+        util::MappedFile mappedFile(filepath);
+        const uint8_t* p_data = mappedFile.getData();
+        const uint64_t sizeBytes = mappedFile.getSizeBytes();
+
+        util::MappedFile movedFile(std::move(mappedFile));
+        UT_CHECK_TRUE(movedFile.getData() == p_data);
+        UT_CHECK_EQUAL(movedFile.getSizeBytes(), sizeBytes);
+        UT_CHECK_TRUE(mappedFile.getData() == nullptr);
+        UT_CHECK_EQUAL(mappedFile.getSizeBytes(), 0);
+
+        util::MappedFile assignedFile;
+        assignedFile = std::move(movedFile);
+        UT_CHECK_TRUE(assignedFile.getData() == p_data);
+        UT_CHECK_EQUAL(assignedFile.getSizeBytes(), sizeBytes);
+        UT_CHECK_TRUE(movedFile.getData() == nullptr);
+    }
+}
+
+UT_FUNCTION(test_getBytes) {
+    {
+#ifdef ON_LINUX
+        const std::string tempFilepath = std::filesystem::temp_directory_path().string() + "/" + std::string("mappedfile.txt");
+#else
+        const std::string tempFilepath = std::filesystem::temp_directory_path().string() + std::string("mappedfile.txt");
+#endif
+
+        const std::string inputString = "0123456789abcdef";
+
+        std::ofstream tempFile(tempFilepath);
+        tempFile << inputString;
+        tempFile.close();
+
+        const util::MappedFile mappedFile(tempFilepath);
+        UT_REQUIRE(mappedFile.getSizeBytes() == inputString.size());
+
+        const std::span<const uint8_t> middleBytes = mappedFile.getBytes(4, 6);
+        UT_CHECK_EQUAL(std::string(middleBytes.begin(), middleBytes.end()), "456789");
+
+        const std::span<const uint8_t> lastBytes = mappedFile.getBytes(10, 6);
+        UT_CHECK_EQUAL(std::string(lastBytes.begin(), lastBytes.end()), "abcdef");
+
+        const std::span<const uint8_t> noBytes = mappedFile.getBytes(16, 0);
+        UT_CHECK_EQUAL(noBytes.size(), 0);
+
+        bool threwPastEnd = false;
+        try {
+            mappedFile.getBytes(10, 7);
+        } catch (const util::StringException&) {
+            threwPastEnd = true;
+        }
+        UT_CHECK_TRUE(threwPastEnd);
+
+        bool threwOnOverflow = false;
+        try {
+            mappedFile.getBytes(8, std::numeric_limits<uint64_t>::max());
+        } catch (const util::StringException&) {
+            threwOnOverflow = true;
+        }
+        UT_CHECK_TRUE(threwOnOverflow);
+    }
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_construction);
+    REGISTER_UT_FUNCTION(test_move);
+    REGISTER_UT_FUNCTION(test_getBytes);
+    UT_RUN_TESTS();
+}
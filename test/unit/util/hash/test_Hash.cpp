@@ -0,0 +1,40 @@
+#include <string>
+
+#include "util/unit_test/UnitTest.hpp"
+#include "util/hash/Hash.hpp"
+
+UT_FUNCTION(test_fnv1a) {
+    // Reference values for 64 bit FNV-1a
+    {
+        const std::string bytes = "";
+        UT_CHECK_EQUAL(util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, bytes.data(), bytes.size()), 0xcbf29ce484222325ull);
+    }
+
+    {
+        const std::string bytes = "a";
+        UT_CHECK_EQUAL(util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, bytes.data(), bytes.size()), 0xaf63dc4c8601ec8cull);
+    }
+
+    {
+        const std::string bytes = "foobar";
+        UT_CHECK_EQUAL(util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, bytes.data(), bytes.size()), 0x85944171f73967e8ull);
+    }
+}
+
+UT_FUNCTION(test_fnv1a_chaining) {
+    const std::string foo = "foo";
+    const std::string bar = "bar";
+    const std::string foobar = "foobar";
+
+    const uint64_t chainedHash = util::Hash::fnv1a(util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, foo.data(), foo.size()), bar.data(), bar.size());
+    UT_CHECK_EQUAL(chainedHash, util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, foobar.data(), foobar.size()));
+
+    // Different seeds give different hashes for the same bytes
+    UT_CHECK_NOT_EQUAL(util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis, foo.data(), foo.size()), util::Hash::fnv1a(util::Hash::fnv1aOffsetBasis ^ 3, foo.data(), foo.size()));
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_fnv1a);
+    REGISTER_UT_FUNCTION(test_fnv1a_chaining);
+    UT_RUN_TESTS();
+}
@@ -0,0 +1,77 @@
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include "util/unit_test/UnitTest.hpp"
+#include "util/thread_pool/ThreadPool.hpp"
+
+UT_FUNCTION(test_construction) {
+    {
+        util::ThreadPool threadPool(3);
+        UT_CHECK_EQUAL(threadPool.getThreadCount(), 3);
+    }
+
+    {
+        // We always want at least one worker, otherwise nothing would ever run
+        util::ThreadPool threadPool(0);
+        UT_CHECK_EQUAL(threadPool.getThreadCount(), 1);
+    }
+
+    UT_CHECK_GREATER_THAN_EQUAL(util::ThreadPool::getSharedPool().getThreadCount(), 1);
+    UT_CHECK_TRUE(&util::ThreadPool::getSharedPool() == &util::ThreadPool::getSharedPool());
+}
+
+UT_FUNCTION(test_submit) {
+    util::ThreadPool threadPool(4);
+
+    std::vector<std::future<uint32_t>> futures;
+    for (uint32_t i = 0; i < 100; ++i) {
+        futures.push_back(threadPool.submit([i]() { return i * i; }));
+    }
+
+    for (uint32_t i = 0; i < futures.size(); ++i) {
+        UT_CHECK_EQUAL(futures[i].get(), i * i);
+    }
+
+    std::future<void> voidFuture = threadPool.submit([]() {});
+    voidFuture.get();
+}
+
+UT_FUNCTION(test_exceptions) {
+    util::ThreadPool threadPool(2);
+
+    std::future<uint32_t> future = threadPool.submit([]() -> uint32_t { throw std::runtime_error("task failed"); });
+
+    bool threw = false;
+    try {
+        future.get();
+    } catch (const std::runtime_error&) {
+        threw = true;
+    }
+    UT_CHECK_TRUE(threw);
+
+    // The worker which ran the failing task should still be around for the next one
+    UT_CHECK_EQUAL(threadPool.submit([]() { return 7; }).get(), 7);
+}
+
+UT_FUNCTION(test_destructionFinishesTasks) {
+    std::atomic<uint32_t> completedCount = 0;
+
+    {
+        util::ThreadPool threadPool(2);
+        for (uint32_t i = 0; i < 50; ++i) {
+            threadPool.submit([&completedCount]() { ++completedCount; });
+        }
+    }
+
+    UT_CHECK_EQUAL(completedCount.load(), 50);
+}
+
+UT_MAIN() {
+    REGISTER_UT_FUNCTION(test_construction);
+    REGISTER_UT_FUNCTION(test_submit);
+    REGISTER_UT_FUNCTION(test_exceptions);
+    REGISTER_UT_FUNCTION(test_destructionFinishesTasks);
+    UT_RUN_TESTS();
+}